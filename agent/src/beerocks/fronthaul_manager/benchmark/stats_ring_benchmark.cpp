@@ -0,0 +1,268 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/*
+ * Synthetic benchmark of the monitor to slave statistics channel.
+ *
+ * Sends statistics measurement reports of a radio with the given number of associated stations
+ * from a "monitor" to a "slave" end, both in this process, and prints the CPU time per report:
+ * - over a unix domain socket, as a cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE CMDU
+ *   which is built, finalized (byte swapped), written, read and parsed,
+ * - over the shared memory statistics ring, as native byte order records.
+ *
+ * Building the CMDU the slave forwards to the controller is common to both and not measured.
+ *
+ * Usage: stats_ring_benchmark [stations] [iterations]
+ */
+
+#include <bcl/beerocks_shm_ring.h>
+#include <bcl/network/socket.h>
+#include <beerocks/tlvf/beerocks_message.h>
+#include <beerocks/tlvf/beerocks_message_monitor.h>
+#include <beerocks/tlvf/beerocks_stats_record.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <sys/socket.h>
+#include <vector>
+
+INITIALIZE_EASYLOGGINGPP
+
+using namespace beerocks;
+
+static const int DEFAULT_STATIONS   = 32;
+static const int DEFAULT_ITERATIONS = 10000;
+
+static uint8_t tx_buffer[message::MESSAGE_BUFFER_LENGTH];
+static uint8_t rx_buffer[message::MESSAGE_BUFFER_LENGTH];
+
+// Prevents the compiler from optimizing the consumers away
+static volatile uint32_t s_checksum;
+
+static void make_stats(int stations, beerocks_message::sApStatsParams &ap_stats,
+                       std::vector<beerocks_message::sStaStatsParams> &sta_stats)
+{
+    ap_stats                      = {};
+    ap_stats.rx_packets           = 1000;
+    ap_stats.tx_packets           = 2000;
+    ap_stats.channel_load_percent = 40;
+    ap_stats.client_count         = stations;
+
+    sta_stats.resize(stations);
+    for (int i = 0; i < stations; i++) {
+        auto &sta             = sta_stats[i];
+        sta                   = {};
+        sta.mac               = {{0x02, 0x00, 0x00, 0x00, uint8_t(i >> 8), uint8_t(i)}};
+        sta.rx_packets        = 100 + i;
+        sta.tx_packets        = 200 + i;
+        sta.tx_phy_rate_100kb = 8660;
+        sta.rx_phy_rate_100kb = 8660;
+        sta.rx_rssi           = -50;
+    }
+}
+
+static bool receive_cmdu_report(Socket &sd, ieee1905_1::CmduMessageRx &cmdu_rx)
+{
+    // Same reads as socket_thread::handle_cmdu_message_uds()
+    if (sd.readBytes(rx_buffer, sizeof(rx_buffer), true, sizeof(message::sUdsHeader), true) !=
+        sizeof(message::sUdsHeader)) {
+        return false;
+    }
+
+    auto uds_header     = reinterpret_cast<message::sUdsHeader *>(rx_buffer);
+    size_t message_size = uds_header->length + sizeof(message::sUdsHeader);
+    if (sd.readBytes(rx_buffer, sizeof(rx_buffer), true, message_size) != ssize_t(message_size)) {
+        return false;
+    }
+
+    if (!cmdu_rx.parse()) {
+        return false;
+    }
+
+    auto beerocks_header = message_com::parse_intel_vs_message(cmdu_rx);
+    if (!beerocks_header) {
+        return false;
+    }
+
+    auto response =
+        beerocks_header
+            ->addClass<beerocks_message::cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE>();
+    if (!response) {
+        return false;
+    }
+
+    uint32_t checksum = 0;
+    if (response->ap_stats_size() > 0) {
+        checksum += std::get<1>(response->ap_stats(0)).rx_packets;
+    }
+    for (size_t i = 0; i < response->sta_stats_size(); i++) {
+        checksum += std::get<1>(response->sta_stats(i)).rx_packets;
+    }
+    s_checksum = checksum;
+
+    return true;
+}
+
+static bool transfer_cmdu_report(Socket &monitor_socket, Socket &slave_socket,
+                                 ieee1905_1::CmduMessageTx &cmdu_tx,
+                                 ieee1905_1::CmduMessageRx &cmdu_rx, uint16_t id,
+                                 const beerocks_message::sApStatsParams &ap_stats,
+                                 const std::vector<beerocks_message::sStaStatsParams> &sta_stats)
+{
+    // Split over several CMDUs when the stations do not fit in one, like the monitor does
+    size_t offset = 0;
+    do {
+        auto response = message_com::create_vs_message<
+            beerocks_message::cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE>(cmdu_tx, id);
+        if (!response) {
+            return false;
+        }
+
+        if (offset == 0) {
+            if (!response->alloc_ap_stats()) {
+                return false;
+            }
+            std::get<1>(response->ap_stats(0)) = ap_stats;
+        }
+
+        size_t count = std::min(sta_stats.size() - offset,
+                                cmdu_tx.elements_in_message(sizeof(sta_stats[0])));
+        if (count > 0 && !response->alloc_sta_stats(count)) {
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            std::get<1>(response->sta_stats(i)) = sta_stats[offset + i];
+        }
+        offset += count;
+
+        if (!message_com::send_cmdu(&monitor_socket, cmdu_tx) ||
+            !receive_cmdu_report(slave_socket, cmdu_rx)) {
+            return false;
+        }
+    } while (offset < sta_stats.size());
+
+    return true;
+}
+
+static bool push_ring_report(shm_ring &ring, uint16_t id,
+                             const beerocks_message::sApStatsParams &ap_stats,
+                             const std::vector<beerocks_message::sStaStatsParams> &sta_stats)
+{
+    sStatsRecord record = {};
+    record.type         = sStatsRecord::STATS_RECORD_AP;
+    record.message_id   = id;
+    record.ap_stats     = ap_stats;
+    record.last         = sta_stats.empty();
+    if (!ring.push(&record, sizeof(record))) {
+        return false;
+    }
+
+    record.type = sStatsRecord::STATS_RECORD_STA;
+    for (size_t i = 0; i < sta_stats.size(); i++) {
+        record.sta_stats = sta_stats[i];
+        record.last      = (i == sta_stats.size() - 1);
+        if (!ring.push(&record, sizeof(record))) {
+            return false;
+        }
+    }
+
+    return ring.commit();
+}
+
+static bool pop_ring_report(shm_ring &ring)
+{
+    ring.clear_notification();
+
+    sStatsRecord record;
+    uint32_t checksum = 0;
+    while (ring.pop(&record)) {
+        checksum += record.type == sStatsRecord::STATS_RECORD_AP ? record.ap_stats.rx_packets
+                                                                  : record.sta_stats.rx_packets;
+        if (record.last) {
+            s_checksum = checksum;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static double cpu_time_us(std::clock_t start, int iterations)
+{
+    return 1e6 * double(std::clock() - start) / CLOCKS_PER_SEC / iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    int stations   = argc > 1 ? std::atoi(argv[1]) : DEFAULT_STATIONS;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : DEFAULT_ITERATIONS;
+    if (stations < 0 || size_t(stations) >= STATS_RING_CAPACITY || iterations <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [stations] [iterations]" << std::endl;
+        return 1;
+    }
+
+    el::Loggers::setLoggingLevel(el::Level::Error);
+
+    beerocks_message::sApStatsParams ap_stats;
+    std::vector<beerocks_message::sStaStatsParams> sta_stats;
+    make_stats(stations, ap_stats, sta_stats);
+
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+        std::cerr << "socketpair() failed" << std::endl;
+        return 1;
+    }
+    Socket monitor_socket(sv[0], 0);
+    Socket slave_socket(sv[1], 0);
+
+    ieee1905_1::CmduMessageTx cmdu_tx(tx_buffer + sizeof(message::sUdsHeader),
+                                      sizeof(tx_buffer) - sizeof(message::sUdsHeader));
+    ieee1905_1::CmduMessageRx cmdu_rx(rx_buffer + sizeof(message::sUdsHeader),
+                                      sizeof(rx_buffer) - sizeof(message::sUdsHeader));
+
+    auto start = std::clock();
+    for (int i = 0; i < iterations; i++) {
+        if (!transfer_cmdu_report(monitor_socket, slave_socket, cmdu_tx, cmdu_rx, i, ap_stats,
+                                  sta_stats)) {
+            std::cerr << "UDS report " << i << " failed" << std::endl;
+            return 1;
+        }
+    }
+    double uds_us = cpu_time_us(start, iterations);
+
+    auto ring = shm_ring::create("stats_benchmark", sizeof(sStatsRecord), STATS_RING_CAPACITY);
+    if (!ring) {
+        std::cerr << "Failed creating the statistics ring" << std::endl;
+        return 1;
+    }
+
+    start = std::clock();
+    for (int i = 0; i < iterations; i++) {
+        if (!push_ring_report(*ring, i, ap_stats, sta_stats) || !pop_ring_report(*ring)) {
+            std::cerr << "Ring report " << i << " failed" << std::endl;
+            return 1;
+        }
+    }
+    double ring_us = cpu_time_us(start, iterations);
+
+    close(sv[0]);
+    close(sv[1]);
+
+    std::cout << "stations: " << stations << ", iterations: " << iterations << std::endl;
+    std::cout << "uds cmdu: " << uds_us << " us/report" << std::endl;
+    std::cout << "shm ring: " << ring_us << " us/report" << std::endl;
+    if (ring_us > 0) {
+        std::cout << "speedup:  " << uds_us / ring_us << "x" << std::endl;
+    }
+
+    return 0;
+}
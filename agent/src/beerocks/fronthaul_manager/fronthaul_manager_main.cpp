@@ -10,6 +10,7 @@
 #include "monitor/monitor_thread.h"
 
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_metrics.h>
 #include <bcl/beerocks_os_utils.h>
 #include <bcl/beerocks_version.h>
 #include <easylogging++.h>
@@ -211,6 +212,10 @@ int main(int argc, char *argv[])
     std::string pid_file_path =
         beerocks_slave_conf.temp_path + "pid/" + base_fronthaul_name; // For file touching
 
+    // Failing to export the metrics is not fatal
+    beerocks::metrics::start_export(beerocks_slave_conf.temp_path + BEEROCKS_METRICS_UDS +
+                                    base_fronthaul_name);
+
     // Get Agent UDS file
     std::string agent_uds =
         beerocks_slave_conf.temp_path + std::string(BEEROCKS_SLAVE_UDS) + "_" + fronthaul_iface;
@@ -259,6 +264,7 @@ int main(int argc, char *argv[])
     }
 
     monitor.stop();
+    beerocks::metrics::stop_export();
 
     return 0;
 }
@@ -8,8 +8,8 @@
 
 #include "monitor_rssi.h"
 
+#include <bcl/beerocks_logging.h>
 #include <bcl/network/network_utils.h>
-#include <easylogging++.h>
 
 #include <beerocks/tlvf/beerocks_message.h>
 #include <beerocks/tlvf/beerocks_message_monitor.h>
@@ -150,8 +150,8 @@ void monitor_rssi::arp_recv()
 
         int arp_burst_delay   = mon_db->get_arp_burst_delay();
         int arp_burst_pkt_num = mon_db->get_arp_burst_pkt_num();
-        LOG(DEBUG) << "mon_db->arp_burst_delay = " << arp_burst_delay;
-        LOG(DEBUG) << "arp_burst_pkt_num = " << arp_burst_pkt_num;
+        LAZY_LOG(DEBUG) << "mon_db->arp_burst_delay = " << arp_burst_delay;
+        LAZY_LOG(DEBUG) << "arp_burst_pkt_num = " << arp_burst_pkt_num;
         if (arp_burst_delay < 10) {
             UTILS_SLEEP_MSEC(arp_burst_delay);
         } else {
@@ -230,9 +230,9 @@ void monitor_rssi::process()
                     notification->params().tx_phy_rate_100kb = sta_stats.tx_phy_rate_100kb_min;
                     notification->params().vap_id            = sta_vap_id;
                     message_com::send_cmdu(slave_socket, cmdu_tx);
-                    LOG(DEBUG) << "state IDLE, DELTA notification MAC: " << sta_mac
-                               << " RX RSSI: " << int(sta_stats.rx_rssi_curr)
-                               << " delta_val=" << int(delta_val);
+                    LAZY_LOG(DEBUG) << "state IDLE, DELTA notification MAC: " << sta_mac
+                                    << " RX RSSI: " << int(sta_stats.rx_rssi_curr)
+                                    << " delta_val=" << int(delta_val);
                 }
             }
             if (!conf_disable_initiative_arp) {
@@ -317,26 +317,27 @@ void monitor_rssi::process()
 
             auto sta_ipv4 = sta_node->get_ipv4();
             if (sta_ipv4.empty() || sta_ipv4 == network_utils::ZERO_IP_STRING) {
-                LOG(DEBUG) << "Sta " << sta_mac << " IP is missing, looking at the ARP Table";
+                LAZY_LOG(DEBUG) << "Sta " << sta_mac << " IP is missing, looking at the ARP Table";
                 auto arp_table = network_utils::get_arp_table();
                 if (arp_table) {
                     auto arp_entry_it = arp_table->find(sta_mac);
                     if (arp_entry_it != arp_table->end()) {
                         sta_ipv4 = arp_entry_it->second;
-                        LOG(DEBUG) << "Found IP on ARP Table, setting Sta " << sta_mac << " IP to "
-                                   << sta_ipv4;
+                        LAZY_LOG(DEBUG) << "Found IP on ARP Table, setting Sta " << sta_mac
+                                        << " IP to " << sta_ipv4;
                         sta_node->set_ipv4(arp_entry_it->second);
                     }
                 }
             }
 
-            LOG(DEBUG) << "state: SEND_ARP -> "
-                       << (sta_node->get_arp_burst() ? "WAIT_FIRST_REPLY" : "WAIT_REPLY")
-                       << ", arp_iface = " << arp_iface << ", arp_iface_ipv4 = " << arp_iface_ipv4
-                       << ", arp_iface_mac = " << arp_iface_mac
-                       << ", is_4addr_client = " << int(is_4addr_client)
-                       << ", sta_mac = " << sta_mac << ", dest_ip = " << sta_node->get_ipv4()
-                       << ", dst_mac = " << arp_dst_mac;
+            LAZY_LOG(DEBUG) << "state: SEND_ARP -> "
+                            << (sta_node->get_arp_burst() ? "WAIT_FIRST_REPLY" : "WAIT_REPLY")
+                            << ", arp_iface = " << arp_iface
+                            << ", arp_iface_ipv4 = " << arp_iface_ipv4
+                            << ", arp_iface_mac = " << arp_iface_mac
+                            << ", is_4addr_client = " << int(is_4addr_client)
+                            << ", sta_mac = " << sta_mac << ", dest_ip = " << sta_node->get_ipv4()
+                            << ", dst_mac = " << arp_dst_mac;
 
             network_utils::arp_send(arp_iface, sta_node->get_ipv4(), arp_iface_ipv4,
                                     tlvf::mac_from_string(arp_dst_mac),
@@ -376,8 +377,8 @@ void monitor_rssi::send_rssi_measurement_response(std::string &sta_mac, monitor_
         response->params().vap_id            = sta_node->get_vap_id();
 
         message_com::send_cmdu(slave_socket, cmdu_tx);
-        LOG(DEBUG) << "RSSI_MEASUREMENT_RESPONSE sta_mac=" << sta_mac
-                   << " rx_rssi: " << int(response->params().rx_rssi) << " id=" << request_id;
+        LAZY_LOG(DEBUG) << "RSSI_MEASUREMENT_RESPONSE sta_mac=" << sta_mac
+                        << " rx_rssi: " << int(response->params().rx_rssi) << " id=" << request_id;
     }
     sta_node->clear_rx_rssi_request_id_list();
 }
@@ -391,7 +392,7 @@ void monitor_rssi::monitor_idle_station(std::string &sta_mac, monitor_sta_node *
         if (!sta_node->idle_detected) {
             sta_node->idle_detected_start_time = current_time;
             sta_node->idle_detected            = true;
-            LOG(DEBUG) << "IDLE detected MAC: " << sta_mac;
+            LAZY_LOG(DEBUG) << "IDLE detected MAC: " << sta_mac;
         }
     } else {
         sta_node->idle_detected = false;
@@ -402,7 +403,7 @@ void monitor_rssi::monitor_idle_station(std::string &sta_mac, monitor_sta_node *
                            current_time - sta_node->idle_detected_start_time)
                            .count();
         if (idle_ms > m_idle_unit_time_ms) {
-            LOG(DEBUG) << "IDLE notification MAC: " << sta_mac;
+            LAZY_LOG(DEBUG) << "IDLE notification MAC: " << sta_mac;
             auto notification = message_com::create_vs_message<
                 beerocks_message::cACTION_MONITOR_CLIENT_NO_ACTIVITY_NOTIFICATION>(cmdu_tx);
             if (notification == nullptr) {
@@ -8,17 +8,21 @@
 
 #include "monitor_stats.h"
 
+#include <bcl/beerocks_logging.h>
 #include <bcl/network/network_utils.h>
-#include <easylogging++.h>
 
 #include <bcl/network/socket.h>
 
 #include <beerocks/tlvf/beerocks_message.h>
 #include <beerocks/tlvf/beerocks_message_monitor.h>
+#include <beerocks/tlvf/beerocks_stats_record.h>
 #include <tlvf/wfa_map/tlvApMetrics.h>
 #include <tlvf/wfa_map/tlvAssociatedStaLinkMetrics.h>
 #include <tlvf/wfa_map/tlvAssociatedStaTrafficStats.h>
 
+#include <cerrno>
+#include <cstring>
+
 using namespace beerocks;
 using namespace net;
 using namespace son;
@@ -33,9 +37,11 @@ void monitor_stats::stop()
 {
     mon_db       = nullptr;
     slave_socket = nullptr;
+    m_stats_ring = nullptr;
 }
 
-bool monitor_stats::start(monitor_db *mon_db_, Socket *slave_socket_)
+bool monitor_stats::start(monitor_db *mon_db_, Socket *slave_socket_,
+                          beerocks::shm_ring *stats_ring)
 {
     if (!mon_db_ || !slave_socket_) {
         LOG(ERROR) << "invalid input == NULL";
@@ -43,6 +49,7 @@ bool monitor_stats::start(monitor_db *mon_db_, Socket *slave_socket_)
     }
     mon_db       = mon_db_;
     slave_socket = slave_socket_;
+    m_stats_ring = stats_ring;
     return true;
 }
 
@@ -58,9 +65,89 @@ void monitor_stats::add_request(uint16_t id, uint8_t sync, const sMacAddr &sta_m
     requests_list.push_back(sMeasurementsRequest(id, sta_mac));
 }
 
+static void fill_ap_stats(beerocks_message::sApStatsParams &ap_stats_msg,
+                          const monitor_radio_node::SRadioStats &radio_stats)
+{
+    ap_stats_msg.stats_delta_ms         = radio_stats.delta_ms;
+    ap_stats_msg.rx_packets             = radio_stats.hal_stats.rx_packets;
+    ap_stats_msg.tx_packets             = radio_stats.hal_stats.tx_packets;
+    ap_stats_msg.rx_bytes               = radio_stats.hal_stats.rx_bytes;
+    ap_stats_msg.tx_bytes               = radio_stats.hal_stats.tx_bytes;
+    ap_stats_msg.errors_sent            = radio_stats.hal_stats.errors_sent;
+    ap_stats_msg.errors_received        = radio_stats.hal_stats.errors_received;
+    ap_stats_msg.retrans_count          = radio_stats.total_retrans_count;
+    ap_stats_msg.noise                  = radio_stats.hal_stats.noise;
+    ap_stats_msg.channel_load_percent   = radio_stats.channel_load_tot_curr;
+    ap_stats_msg.client_count           = radio_stats.sta_count;
+    ap_stats_msg.active_client_count    = radio_stats.active_client_count_curr;
+    ap_stats_msg.client_tx_load_percent = radio_stats.client_tx_load_tot_curr;
+    ap_stats_msg.client_rx_load_percent = radio_stats.client_rx_load_tot_curr;
+}
+
+static void fill_sta_stats(beerocks_message::sStaStatsParams &sta_stats_msg,
+                           const std::string &sta_mac, const monitor_sta_node::SStaStats &sta_stats)
+{
+    sta_stats_msg.mac               = tlvf::mac_from_string(sta_mac);
+    sta_stats_msg.rx_packets        = sta_stats.hal_stats.rx_packets;
+    sta_stats_msg.tx_packets        = sta_stats.hal_stats.tx_packets;
+    sta_stats_msg.tx_bytes          = sta_stats.hal_stats.tx_bytes;
+    sta_stats_msg.rx_bytes          = sta_stats.hal_stats.rx_bytes;
+    sta_stats_msg.retrans_count     = sta_stats.hal_stats.retrans_count;
+    sta_stats_msg.tx_phy_rate_100kb = sta_stats.tx_phy_rate_100kb_avg;
+    sta_stats_msg.rx_phy_rate_100kb = sta_stats.rx_phy_rate_100kb_avg;
+    sta_stats_msg.tx_load_percent   = sta_stats.tx_load_percent_curr;
+    sta_stats_msg.rx_load_percent   = sta_stats.rx_load_percent_curr;
+    sta_stats_msg.stats_delta_ms    = sta_stats.delta_ms;
+    sta_stats_msg.rx_rssi           = sta_stats.rx_rssi_curr;
+}
+
+bool monitor_stats::push_hostap_measurements(const sMeasurementsRequest &request,
+                                             const monitor_radio_node::SRadioStats &radio_stats)
+{
+    if (!m_stats_ring) {
+        return false;
+    }
+
+    if (m_stats_ring->get_free_count() < mon_db->get_sta_count() + 1) {
+        LAZY_LOG(DEBUG) << "Statistics ring is full, sending the response over the slave socket";
+        return false;
+    }
+
+    // Each record is pushed once the next one is known, so that the last one can be flagged
+    sStatsRecord record = {};
+    record.type         = sStatsRecord::STATS_RECORD_AP;
+    record.message_id   = request.message_id;
+    fill_ap_stats(record.ap_stats, radio_stats);
+
+    for (auto it = mon_db->sta_begin(); it != mon_db->sta_end(); ++it) {
+        auto sta_node = it->second;
+        if (sta_node == nullptr) {
+            continue;
+        }
+
+        m_stats_ring->push(&record, sizeof(record));
+
+        record.type = sStatsRecord::STATS_RECORD_STA;
+        fill_sta_stats(record.sta_stats, it->first, sta_node->get_stats());
+    }
+
+    record.last = 1;
+    m_stats_ring->push(&record, sizeof(record));
+    if (!m_stats_ring->commit()) {
+        // The report is published, the slave reads it on its next wake-up
+        LOG(ERROR) << "Failed waking up the slave: " << strerror(errno);
+    }
+
+    return true;
+}
+
 void monitor_stats::send_hostap_measurements(const sMeasurementsRequest &request,
                                              const monitor_radio_node::SRadioStats &radio_stats)
 {
+    if (push_hostap_measurements(request, radio_stats)) {
+        return;
+    }
+
     auto response = message_com::create_vs_message<
         beerocks_message::cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE>(cmdu_tx);
     if (!response) {
@@ -85,20 +172,7 @@ void monitor_stats::send_hostap_measurements(const sMeasurementsRequest &request
     }
     auto &ap_stats_msg = std::get<1>(ap_stats_tuple);
 
-    ap_stats_msg.stats_delta_ms         = radio_stats.delta_ms;
-    ap_stats_msg.rx_packets             = radio_stats.hal_stats.rx_packets;
-    ap_stats_msg.tx_packets             = radio_stats.hal_stats.tx_packets;
-    ap_stats_msg.rx_bytes               = radio_stats.hal_stats.rx_bytes;
-    ap_stats_msg.tx_bytes               = radio_stats.hal_stats.tx_bytes;
-    ap_stats_msg.errors_sent            = radio_stats.hal_stats.errors_sent;
-    ap_stats_msg.errors_received        = radio_stats.hal_stats.errors_received;
-    ap_stats_msg.retrans_count          = radio_stats.total_retrans_count;
-    ap_stats_msg.noise                  = radio_stats.hal_stats.noise;
-    ap_stats_msg.channel_load_percent   = radio_stats.channel_load_tot_curr;
-    ap_stats_msg.client_count           = radio_stats.sta_count;
-    ap_stats_msg.active_client_count    = radio_stats.active_client_count_curr;
-    ap_stats_msg.client_tx_load_percent = radio_stats.client_tx_load_tot_curr;
-    ap_stats_msg.client_rx_load_percent = radio_stats.client_rx_load_tot_curr;
+    fill_ap_stats(ap_stats_msg, radio_stats);
 
     auto total_sta_count = mon_db->get_sta_count();
     size_t elements_to_allocate;
@@ -144,19 +218,7 @@ void monitor_stats::send_hostap_measurements(const sMeasurementsRequest &request
         }
 
         auto &sta_stats_msg = std::get<1>(response->sta_stats(sta_count));
-
-        sta_stats_msg.mac               = tlvf::mac_from_string(sta_mac);
-        sta_stats_msg.rx_packets        = sta_stats.hal_stats.rx_packets;
-        sta_stats_msg.tx_packets        = sta_stats.hal_stats.tx_packets;
-        sta_stats_msg.tx_bytes          = sta_stats.hal_stats.tx_bytes;
-        sta_stats_msg.rx_bytes          = sta_stats.hal_stats.rx_bytes;
-        sta_stats_msg.retrans_count     = sta_stats.hal_stats.retrans_count;
-        sta_stats_msg.tx_phy_rate_100kb = sta_stats.tx_phy_rate_100kb_avg;
-        sta_stats_msg.rx_phy_rate_100kb = sta_stats.rx_phy_rate_100kb_avg;
-        sta_stats_msg.tx_load_percent   = sta_stats.tx_load_percent_curr;
-        sta_stats_msg.rx_load_percent   = sta_stats.rx_load_percent_curr;
-        sta_stats_msg.stats_delta_ms    = sta_stats.delta_ms;
-        sta_stats_msg.rx_rssi           = sta_stats.rx_rssi_curr;
+        fill_sta_stats(sta_stats_msg, sta_mac, sta_stats);
 
         sta_count++;
     }
@@ -209,8 +271,9 @@ void monitor_stats::send_associated_sta_link_metrics(const sMeasurementsRequest
     bss_info.uplink_estimated_mac_data_rate_mbps   = sta_stats.tx_phy_rate_100kb_avg / 10;
     bss_info.sta_measured_uplink_rssi_dbm_enc      = sta_stats.rx_rssi_curr;
 
-    LOG(DEBUG) << "Send ACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE "
-               << "for mac " << sta_metrics->sta_mac() << ", message_id = " << request.message_id;
+    LAZY_LOG(DEBUG) << "Send ACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE "
+                    << "for mac " << sta_metrics->sta_mac()
+                    << ", message_id = " << request.message_id;
     message_com::send_cmdu(slave_socket, cmdu_tx);
 }
 
@@ -261,8 +324,8 @@ void monitor_stats::process()
                2 * (conf_ap_active_threshold_B /*AP_ACTIVE_BYTES_THRESHOLD*/)) { // IDLE
         eApActiveMode                   = beerocks::eApActiveMode::AP_ACTIVE_MODE;
         send_activity_mode_notification = true;
-        LOG(DEBUG) << "->AP_ACTIVE_MODE - send notification to slave , idle_timer"
-                   << int(idle_timer);
+        LAZY_LOG(DEBUG) << "->AP_ACTIVE_MODE - send notification to slave , idle_timer"
+                        << int(idle_timer);
         idle_timer = 0;
     }
 
@@ -355,22 +418,23 @@ void monitor_stats::process()
         (!radio_stats.channel_load_tot_is_above_hi_th)) {
         radio_stats.channel_load_tot_is_above_hi_th = true;
         send_notification                           = true;
-        LOG(DEBUG) << "LOAD_NOTIFICATION, Th up, channel_load="
-                   << int(radio_stats.channel_load_tot_curr);
+        LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, Th up, channel_load="
+                        << int(radio_stats.channel_load_tot_curr);
     } else if ((radio_stats.channel_load_tot_curr <
                 conf_total_ch_load_notification_lo_th_percent) &&
                (radio_stats.channel_load_tot_is_above_hi_th)) {
         radio_stats.channel_load_tot_is_above_hi_th = false;
         send_notification                           = true;
-        LOG(DEBUG) << "LOAD_NOTIFICATION, Th down, channel_load="
-                   << int(radio_stats.channel_load_tot_curr);
+        LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, Th down, channel_load="
+                        << int(radio_stats.channel_load_tot_curr);
     }
     //check if current channel load delta passed monitor_channel_load_notification_delta_th_percent
     if (radio_stats.channel_load_tot_is_above_hi_th) {
         delta_val = abs(radio_stats.channel_load_tot_prev - radio_stats.channel_load_tot_curr);
         if (delta_val >= conf_total_ch_load_notification_delta_th_percent) {
             send_notification = true;
-            LOG(DEBUG) << "LOAD_NOTIFICATION, Th delta, channel_load delta_val=" << int(delta_val);
+            LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, Th delta, channel_load delta_val="
+                            << int(delta_val);
         }
     }
 
@@ -382,14 +446,14 @@ void monitor_stats::process()
         (radio_stats.active_client_count_is_above_th)) {
         radio_stats.active_client_count_is_above_th = false;
         send_notification                           = true;
-        LOG(DEBUG) << "LOAD_NOTIFICATION, Th down, vap active_sta_count="
-                   << int(radio_stats.active_client_count_curr);
+        LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, Th down, vap active_sta_count="
+                        << int(radio_stats.active_client_count_curr);
     } else if ((radio_stats.active_client_count_curr >= conf_min_active_client_count) &&
                (!radio_stats.active_client_count_is_above_th)) {
         radio_stats.active_client_count_is_above_th = true;
         send_notification                           = true;
-        LOG(DEBUG) << "LOAD_NOTIFICATION, Th up, vap  active_sta_count="
-                   << int(radio_stats.active_client_count_curr);
+        LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, Th up, vap  active_sta_count="
+                        << int(radio_stats.active_client_count_curr);
     } else if ((radio_stats.active_client_count_curr < conf_min_active_client_count) &&
                (!radio_stats.active_client_count_is_above_th)) {
         send_notification = false;
@@ -399,8 +463,8 @@ void monitor_stats::process()
         delta_val = radio_stats.active_client_count_curr - radio_stats.active_client_count_prev;
         if (delta_val > 0) {
             send_notification = true;
-            LOG(DEBUG) << "LOAD_NOTIFICATION, change, vap  active_sta_count="
-                       << int(radio_stats.active_client_count_curr);
+            LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, change, vap  active_sta_count="
+                            << int(radio_stats.active_client_count_curr);
         }
     }
 
@@ -414,8 +478,8 @@ void monitor_stats::process()
                 (radio_stats.client_tx_load_tot_curr + radio_stats.client_rx_load_tot_curr));
         if (delta_val >= conf_client_load_notification_delta_th_percent) {
             send_notification = true;
-            LOG(DEBUG) << "LOAD_NOTIFICATION, change, vap  sta load delta Th, delta_val="
-                       << int(delta_val);
+            LAZY_LOG(DEBUG) << "LOAD_NOTIFICATION, change, vap  sta load delta Th, delta_val="
+                            << int(delta_val);
         }
     }
 
@@ -12,6 +12,7 @@
 #include "monitor_db.h"
 
 #include <bcl/beerocks_message_structs.h>
+#include <bcl/beerocks_shm_ring.h>
 #include <bcl/network/network_utils.h>
 #include <bcl/network/socket.h>
 
@@ -23,7 +24,14 @@ class monitor_stats {
 public:
     explicit monitor_stats(ieee1905_1::CmduMessageTx &cmdu_tx_);
     ~monitor_stats() {}
-    bool start(monitor_db *mon_db_, Socket *slave_socket_);
+    /**
+     * @brief Starts the statistics monitoring.
+     *
+     * @param stats_ring Optional ring shared with the slave, the statistics measurement
+     * responses are pushed to it instead of being sent over the slave socket.
+     */
+    bool start(monitor_db *mon_db_, Socket *slave_socket_,
+               beerocks::shm_ring *stats_ring = nullptr);
     void stop();
 
     void add_request(uint16_t id, uint8_t sync,
@@ -62,8 +70,9 @@ private:
                                int active_sta_th);
 
     std::string parent_thread_name;
-    monitor_db *mon_db   = nullptr;
-    Socket *slave_socket = nullptr;
+    monitor_db *mon_db               = nullptr;
+    Socket *slave_socket             = nullptr;
+    beerocks::shm_ring *m_stats_ring = nullptr;
     uint32_t next_poll_id;
 
     struct sMeasurementsRequest {
@@ -74,6 +83,15 @@ private:
     std::list<sMeasurementsRequest> requests_list;
     void send_hostap_measurements(const sMeasurementsRequest &request,
                                   const monitor_radio_node::SRadioStats &radio_stats);
+
+    /**
+     * @brief Pushes the statistics measurement response to the statistics ring.
+     *
+     * @return True on success and false if there is no ring or not enough room in it for the
+     * whole response, in which case it has to be sent over the slave socket.
+     */
+    bool push_hostap_measurements(const sMeasurementsRequest &request,
+                                  const monitor_radio_node::SRadioStats &radio_stats);
     void send_associated_sta_link_metrics(const sMeasurementsRequest &request);
 
     ieee1905_1::CmduMessageTx &cmdu_tx;
@@ -16,6 +16,7 @@
 #include <bpl/bpl_cfg.h>
 
 #include <beerocks/tlvf/beerocks_message.h>
+#include <beerocks/tlvf/beerocks_stats_record.h>
 
 #include <tlvf/wfa_map/tlvApMetricQuery.h>
 
@@ -40,7 +41,9 @@ static constexpr uint8_t ap_metrics_channel_utilization_measurement_period_s = 1
 monitor_thread::monitor_thread(const std::string &slave_uds_, const std::string &monitor_iface_,
                                beerocks::config_file::sConfigSlave &beerocks_slave_conf_,
                                beerocks::logging &logger_)
-    : socket_thread(), monitor_iface(monitor_iface_), beerocks_slave_conf(beerocks_slave_conf_),
+    // AP Metrics Responses grow with the number of associated stations
+    : socket_thread(std::string(), message::MESSAGE_BUFFER_LENGTH_MAX),
+      monitor_iface(monitor_iface_), beerocks_slave_conf(beerocks_slave_conf_),
       bridge_iface(beerocks_slave_conf.bridge_iface), slave_uds(slave_uds_), logger(logger_),
       mon_rssi(cmdu_tx),
 #ifdef BEEROCKS_RDKB
@@ -148,6 +151,8 @@ void monitor_thread::stop_monitor_thread()
             delete slave_socket;
             slave_socket = nullptr;
         }
+
+        m_stats_ring.reset();
     }
 
     should_stop = true;
@@ -328,14 +333,28 @@ void monitor_thread::after_select(bool timeout)
                 LOG(ERROR) << "Failed building message!";
                 return;
             }
-            message_com::send_cmdu(slave_socket, cmdu_tx);
+
+            // The statistics ring is handed over to the slave along with the notification
+            if (beerocks_slave_conf.enable_stats_ring == "1") {
+                m_stats_ring = beerocks::shm_ring::create(
+                    "stats_" + monitor_iface, sizeof(sStatsRecord), STATS_RING_CAPACITY);
+            }
+            if (m_stats_ring) {
+                LOG(DEBUG) << "sharing the statistics ring, capacity="
+                           << m_stats_ring->get_capacity();
+                message_com::send_cmdu_with_fds(
+                    slave_socket, cmdu_tx,
+                    {m_stats_ring->get_memfd(), m_stats_ring->get_eventfd()});
+            } else {
+                message_com::send_cmdu(slave_socket, cmdu_tx);
+            }
 
             // Generate pre-existing client STA_Connected
             mon_wlan_hal->generate_connected_clients_events();
 
             // start local monitors //
             LOG(TRACE) << "mon_stats.start()";
-            if (!mon_stats.start(&mon_db, slave_socket)) {
+            if (!mon_stats.start(&mon_db, slave_socket, m_stats_ring.get())) {
                 LOG(ERROR) << "mon_stats.start() failed";
                 thread_last_error_code = MONITOR_THREAD_ERROR_ATTACH_FAIL;
                 stop_monitor_thread();
@@ -577,11 +596,12 @@ void monitor_thread::on_channel_utilization_measurement_period_elapsed()
         threshold_crossed = true;
     }
 
-    LOG(DEBUG) << "Channel utilization: previous_value="
-               << std::to_string(info.ap_metrics_channel_utilization_reporting_value)
-               << ", current_value=" << std::to_string(channel_utilization) << ", threshold_value="
-               << std::to_string(info.ap_channel_utilization_reporting_threshold)
-               << ", threshold_crossed=" << std::to_string(threshold_crossed);
+    LAZY_LOG(DEBUG) << "Channel utilization: previous_value="
+                    << std::to_string(info.ap_metrics_channel_utilization_reporting_value)
+                    << ", current_value=" << std::to_string(channel_utilization)
+                    << ", threshold_value="
+                    << std::to_string(info.ap_channel_utilization_reporting_threshold)
+                    << ", threshold_crossed=" << std::to_string(threshold_crossed);
 
     info.ap_metrics_channel_utilization_reporting_value = channel_utilization;
 
@@ -1091,7 +1111,7 @@ bool monitor_thread::handle_cmdu_vs_message(Socket &sd, ieee1905_1::CmduMessageR
                     beerocks_message::ACTION_MONITOR_STEERING_CLIENT_SET_RESPONSE, OPERATION_FAIL);
                 return false;
             }
-            LOG(DEBUG) << "client: " << sta_mac << " configuration was removed";
+            LAZY_LOG(DEBUG) << "client: " << sta_mac << " configuration was removed";
             send_steering_return_status(
                 beerocks_message::ACTION_MONITOR_STEERING_CLIENT_SET_RESPONSE, OPERATION_SUCCESS);
             break;
@@ -1100,10 +1120,10 @@ bool monitor_thread::handle_cmdu_vs_message(Socket &sd, ieee1905_1::CmduMessageR
         const auto bssid = tlvf::mac_to_string(request->params().bssid);
         int vap_id       = mon_db.get_vap_id(bssid);
 
-        LOG(DEBUG) << "snrInactXing " << request->params().config.snrInactXing << std::endl
-                   << "snrHighXing " << request->params().config.snrHighXing << std::endl
-                   << "snrLowXing " << request->params().config.snrLowXing << std::endl
-                   << "vapId " << vap_id;
+        LAZY_LOG(DEBUG) << "snrInactXing " << request->params().config.snrInactXing << std::endl
+                        << "snrHighXing " << request->params().config.snrHighXing << std::endl
+                        << "snrLowXing " << request->params().config.snrLowXing << std::endl
+                        << "vapId " << vap_id;
 
         if (vap_id == IFACE_ID_INVALID) {
             LOG(ERROR) << "wrong vap_id:" << int(vap_id);
@@ -1166,8 +1186,9 @@ bool monitor_thread::handle_cmdu_vs_message(Socket &sd, ieee1905_1::CmduMessageR
             }
             response->mac() = tlvf::mac_from_string(sta_mac);
             message_com::send_cmdu(slave_socket, cmdu_tx);
-            LOG(DEBUG) << "send ACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_CMD_RESPONSE, sta_mac = "
-                       << sta_mac << " id=" << beerocks_header->id();
+            LAZY_LOG(DEBUG)
+                << "send ACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_CMD_RESPONSE, sta_mac = "
+                << sta_mac << " id=" << beerocks_header->id();
             sta_node->set_arp_state(monitor_sta_node::SEND_ARP);
             LOG(INFO) << "RX_RSSI_MEASUREMENT REQUEST cross, resetting state to SEND_ARP,"
                       << " sta_mac=" << sta_mac << " id=" << beerocks_header->id();
@@ -1236,8 +1257,8 @@ bool monitor_thread::handle_cmdu_vs_message(Socket &sd, ieee1905_1::CmduMessageR
                                std::chrono::steady_clock::now(), beerocks_header->id()};
 
         // USED IN TESTS
-        LOG(DEBUG) << "inserting " << +request->params().expected_reports_count
-                   << " RRM_EVENT_BEACON_REP_RXED event(s) to the pending list";
+        LAZY_LOG(DEBUG) << "inserting " << +request->params().expected_reports_count
+                        << " RRM_EVENT_BEACON_REP_RXED event(s) to the pending list";
         for (int i = 0; i < request->params().expected_reports_count; i++) {
             pending_11k_events.insert(std::make_pair("RRM_EVENT_BEACON_REP_RXED", event_11k));
         }
@@ -1304,12 +1325,12 @@ bool monitor_thread::handle_cmdu_vs_message(Socket &sd, ieee1905_1::CmduMessageR
         }
 
         //debug print incoming information:
-        LOG(DEBUG) << std::endl
-                   << "scan_params:" << std::endl
-                   << "radio_mac=" << radio_mac << std::endl
-                   << "dwell_time_ms=" << dwell_time_ms << std::endl
-                   << "channel_pool_size=" << int(channel_pool_size) << std::endl
-                   << "channel_pool=" << channels;
+        LAZY_LOG(DEBUG) << std::endl
+                        << "scan_params:" << std::endl
+                        << "radio_mac=" << radio_mac << std::endl
+                        << "dwell_time_ms=" << dwell_time_ms << std::endl
+                        << "channel_pool_size=" << int(channel_pool_size) << std::endl
+                        << "channel_pool=" << channels;
 
         auto response_out = message_com::create_vs_message<
             beerocks_message::cACTION_MONITOR_CHANNEL_SCAN_TRIGGER_SCAN_RESPONSE>(
@@ -1397,7 +1418,8 @@ bool monitor_thread::handle_multi_ap_policy_config_request(Socket &sd,
      * back again to the monitor thread, where it is finally processed.
      */
     auto mid = cmdu_rx.getMessageId();
-    LOG(DEBUG) << "Received MULTI_AP_POLICY_CONFIG_REQUEST_MESSAGE, mid=" << std::hex << int(mid);
+    LAZY_LOG(DEBUG) << "Received MULTI_AP_POLICY_CONFIG_REQUEST_MESSAGE, mid=" << std::hex
+                    << int(mid);
 
     auto metric_reporting_policy_tlv = cmdu_rx.getClass<wfa_map::tlvMetricReportingPolicy>();
     if (metric_reporting_policy_tlv) {
@@ -1464,8 +1486,8 @@ bool monitor_thread::handle_ap_metrics_query(Socket &sd, ieee1905_1::CmduMessage
             return false;
         }
         const auto &bssid = std::get<1>(bssid_tuple);
-        LOG(DEBUG) << "Received AP_METRICS_QUERY_MESSAGE, mid=" << std::hex << int(mid)
-                   << "  bssid " << bssid;
+        LAZY_LOG(DEBUG) << "Received AP_METRICS_QUERY_MESSAGE, mid=" << std::hex << int(mid)
+                        << "  bssid " << bssid;
 
         bssid_list.emplace_back(bssid);
     }
@@ -1475,8 +1497,8 @@ bool monitor_thread::handle_ap_metrics_query(Socket &sd, ieee1905_1::CmduMessage
         return false;
     }
 
-    LOG(DEBUG) << "Sending AP_METRICS_RESPONSE_MESSAGE to slave_socket, mid=" << std::hex
-               << int(mid);
+    LAZY_LOG(DEBUG) << "Sending AP_METRICS_RESPONSE_MESSAGE to slave_socket, mid=" << std::hex
+                    << int(mid);
     return message_com::send_cmdu(slave_socket, cmdu_tx);
 }
 
@@ -17,6 +17,7 @@
 #include "monitor_stats.h"
 
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_shm_ring.h>
 #include <bcl/beerocks_socket_thread.h>
 
 #include <beerocks/tlvf/beerocks_message_monitor.h>
@@ -112,6 +113,13 @@ private:
     Socket *mon_hal_ext_events = nullptr;
     Socket *mon_hal_int_events = nullptr;
     Socket *mon_hal_nl_events  = nullptr;
+
+    /**
+     * Optional ring shared with the slave for the statistics measurement responses, enabled
+     * with enable_stats_ring in the agent configuration.
+     */
+    std::unique_ptr<beerocks::shm_ring> m_stats_ring;
+
     beerocks::logging &logger;
     bool m_logger_configured = false;
 
@@ -12,6 +12,140 @@
 
 namespace beerocks {
 
+template <typename Mutex> void AgentDB::lock(Mutex &mutex, sLockContention &contention)
+{
+    if (!mutex.try_lock()) {
+        auto start = std::chrono::steady_clock::now();
+        // Counted before blocking, so the contention can be observed while it lasts
+        contention.contentions++;
+        mutex.lock();
+        auto wait_time = std::chrono::steady_clock::now() - start;
+
+        contention.wait_time_us +=
+            std::chrono::duration_cast<std::chrono::microseconds>(wait_time).count();
+    }
+    contention.acquisitions++;
+}
+
+template void AgentDB::lock(std::mutex &mutex, sLockContention &contention);
+template void AgentDB::lock(std::recursive_mutex &mutex, sLockContention &contention);
+
+void AgentDB::db_lock()
+{
+    lock(m_db_mutex, m_db_contention);
+    m_db_lock_depth++;
+}
+
+void AgentDB::db_unlock()
+{
+    if (--m_db_lock_depth == 0) {
+        publish_config_snapshot();
+    }
+    m_db_mutex.unlock();
+}
+
+static bool operator==(const AgentDB::sRadio::sFront::sBssid &lhs,
+                       const AgentDB::sRadio::sFront::sBssid &rhs)
+{
+    return lhs.mac == rhs.mac && lhs.ssid == rhs.ssid && lhs.type == rhs.type;
+}
+
+static bool is_equal(const AgentDB::sRadio &lhs, const AgentDB::sRadio &rhs)
+{
+    return lhs.front.iface_name == rhs.front.iface_name &&
+           lhs.front.iface_mac == rhs.front.iface_mac &&
+           lhs.front.max_supported_bw == rhs.front.max_supported_bw &&
+           lhs.front.freq_type == rhs.front.freq_type && lhs.front.bssids == rhs.front.bssids &&
+           lhs.back.iface_name == rhs.back.iface_name && lhs.back.iface_mac == rhs.back.iface_mac;
+}
+
+void AgentDB::publish_config_snapshot()
+{
+    auto published = std::atomic_load(&m_config_snapshot);
+
+    // Most of the locks do not change the configuration, so compare before copying it
+    bool changed = published->device_conf.local_gw != device_conf.local_gw ||
+                   published->device_conf.local_controller != device_conf.local_controller ||
+                   published->bridge.mac != bridge.mac ||
+                   published->bridge.iface_name != bridge.iface_name ||
+                   published->ethernet.mac != ethernet.mac ||
+                   published->ethernet.iface_name != ethernet.iface_name ||
+                   published->radios.size() != m_radios.size();
+    if (!changed) {
+        auto published_it = published->radios.begin();
+        for (const auto &radio_entry : m_radios) {
+            if (!is_equal(*published_it++, radio_entry)) {
+                changed = true;
+                break;
+            }
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    auto snapshot         = std::make_shared<sConfigSnapshot>();
+    snapshot->device_conf = device_conf;
+    snapshot->bridge      = bridge;
+    snapshot->ethernet    = ethernet;
+    snapshot->radios.assign(m_radios.begin(), m_radios.end());
+
+    std::atomic_store(&m_config_snapshot, std::shared_ptr<const sConfigSnapshot>(snapshot));
+    m_config_snapshot_publications++;
+}
+
+std::shared_ptr<const AgentDB::sConfigSnapshot> AgentDB::get_config_snapshot()
+{
+    auto &db = instance();
+    db.m_config_snapshot_reads++;
+    return std::atomic_load(&db.m_config_snapshot);
+}
+
+static AgentDB::sLockCounters get_lock_counters(const std::atomic<uint64_t> &acquisitions,
+                                                const std::atomic<uint64_t> &contentions,
+                                                const std::atomic<uint64_t> &wait_time_us)
+{
+    AgentDB::sLockCounters counters;
+    counters.acquisitions = acquisitions;
+    counters.contentions  = contentions;
+    counters.wait_time_us = wait_time_us;
+    return counters;
+}
+
+AgentDB::sLockStats AgentDB::get_lock_stats()
+{
+    auto &db = instance();
+
+    sLockStats stats;
+    stats.db = get_lock_counters(db.m_db_contention.acquisitions, db.m_db_contention.contentions,
+                                 db.m_db_contention.wait_time_us);
+    stats.associated_clients = get_lock_counters(db.m_clients_contention.acquisitions,
+                                                 db.m_clients_contention.contentions,
+                                                 db.m_clients_contention.wait_time_us);
+    stats.neighbor_devices = get_lock_counters(db.m_neighbors_contention.acquisitions,
+                                               db.m_neighbors_contention.contentions,
+                                               db.m_neighbors_contention.wait_time_us);
+    stats.config_snapshot_reads        = db.m_config_snapshot_reads;
+    stats.config_snapshot_publications = db.m_config_snapshot_publications;
+    return stats;
+}
+
+void AgentDB::reset()
+{
+    {
+        auto db         = get();
+        db->device_conf = sDeviceConf();
+        db->bridge      = sBridge();
+        db->backhaul    = sBackhaul();
+        db->ethernet    = sEthernet();
+        db->m_radios_list.clear();
+        db->m_radios.clear();
+    }
+    get_associated_clients()->clear();
+    get_neighbor_devices()->clear();
+    increment_topology_generation();
+}
+
 AgentDB::sRadio *AgentDB::radio(const std::string &iface_name)
 {
     if (iface_name.empty()) {
@@ -47,6 +181,7 @@ bool AgentDB::add_radio(const std::string &front_iface_name, const std::string &
 
     m_radios.emplace_back(front_iface_name, back_iface_name);
     m_radios_list.push_back(&m_radios.back());
+    increment_topology_generation();
 
     return true;
 }
@@ -54,6 +189,17 @@ bool AgentDB::add_radio(const std::string &front_iface_name, const std::string &
 AgentDB::sRadio *AgentDB::get_radio_by_mac(const sMacAddr &mac, eMacType mac_type_hint)
 {
     bool all_mac_types = mac_type_hint == eMacType::ALL;
+
+    // A client is found through the bssid it is associated to
+    sMacAddr client_bssid = net::network_utils::ZERO_MAC;
+    if (all_mac_types || mac_type_hint == eMacType::CLIENT) {
+        auto clients   = get_associated_clients();
+        auto client_it = clients->find(mac);
+        if (client_it != clients->end()) {
+            client_bssid = client_it->second.bssid;
+        }
+    }
+
     auto radio_it = std::find_if(m_radios.begin(), m_radios.end(), [&](const sRadio &radio_entry) {
         if (all_mac_types || mac_type_hint == eMacType::RADIO) {
             if (radio_entry.front.iface_mac == mac || radio_entry.back.iface_mac == mac) {
@@ -69,9 +215,12 @@ AgentDB::sRadio *AgentDB::get_radio_by_mac(const sMacAddr &mac, eMacType mac_typ
                 return true;
             }
         }
-        if (all_mac_types || mac_type_hint == eMacType::CLIENT) {
-            auto client_it = radio_entry.associated_clients.find(mac);
-            return client_it != radio_entry.associated_clients.end();
+        if (client_bssid != net::network_utils::ZERO_MAC) {
+            auto &bssid_list = radio_entry.front.bssids;
+            return std::find_if(bssid_list.begin(), bssid_list.end(),
+                                [&](const sRadio::sFront::sBssid &bssid) {
+                                    return bssid.mac == client_bssid;
+                                }) != bssid_list.end();
         }
         // MAC is not one of the front\back radio MACs nor bssid MAC.
         return false;
@@ -82,18 +231,18 @@ AgentDB::sRadio *AgentDB::get_radio_by_mac(const sMacAddr &mac, eMacType mac_typ
 
 void AgentDB::erase_client(const sMacAddr &client_mac, sMacAddr bssid)
 {
-    if (bssid != net::network_utils::ZERO_MAC) {
-        auto radio = get_radio_by_mac(bssid, eMacType::BSSID);
-        if (!radio) {
-            return;
-        }
-        radio->associated_clients.erase(client_mac);
+    auto clients   = get_associated_clients();
+    auto client_it = clients->find(client_mac);
+    if (client_it == clients->end()) {
         return;
     }
 
-    for (auto &radio : m_radios) {
-        radio.associated_clients.erase(client_mac);
+    if (bssid != net::network_utils::ZERO_MAC && client_it->second.bssid != bssid) {
+        return;
     }
+
+    clients->erase(client_it);
+    increment_topology_generation();
 }
 
 bool AgentDB::get_mac_by_ssid(const sMacAddr &ruid, const std::string &ssid, sMacAddr &value)
@@ -9,9 +9,12 @@
 #include <bcl/network/network_utils.h>
 #include <bwl/sta_wlan_hal.h>
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 namespace beerocks {
 
@@ -46,8 +49,38 @@ namespace beerocks {
  *     return db->foo;                  // be unlocked when the function ends, and the caller will
  * }                                    // hold a refernce to it.
  * @endcode
+ *
+ * Threads which only need to read the mostly static sections of the database (device
+ * configuration, bridge, ethernet and radios configuration) shall not lock it, but read the last
+ * published snapshot of these sections instead:
+ * @code
+ * auto config = AgentDB::get_config_snapshot(); // No lock taken. The snapshot is immutable and
+ * auto &mac   = config->bridge.mac;            // remains valid as long as 'config' is held.
+ * @endcode
+ * A new snapshot is published when the database is unlocked, if any of these sections changed.
+ *
+ * The mutable sections which change at runtime (associated clients and 1905.1 neighbor devices)
+ * have locks of their own, and are accessed without locking the database:
+ * @code
+ * auto clients = AgentDB::get_associated_clients(); // Lock only the associated clients.
+ * clients->erase(client_mac);
+ * @endcode
+ * These locks are not recursive, and the database must not be locked while holding one of them
+ * (the database may be locked first, and then one of them).
  */
 class AgentDB {
+private:
+    /**
+     * @brief Lock contention counters of a lock.
+     */
+    struct sLockContention {
+        std::atomic<uint64_t> acquisitions{0};
+        std::atomic<uint64_t> contentions{0};
+        std::atomic<uint64_t> wait_time_us{0};
+    };
+
+    template <typename Mutex> static void lock(Mutex &mutex, sLockContention &contention);
+
 public:
     class SafeDB {
     public:
@@ -58,22 +91,45 @@ public:
     private:
         AgentDB &m_db;
     };
-    static SafeDB get()
-    {
-        // Guaranteed to be destroyed.
-        // Instantiated on first use.
-        static AgentDB instance;
-        return SafeDB(instance);
-    }
+    static SafeDB get() { return SafeDB(instance()); }
+
+    /**
+     * @brief Section of the database with a lock of its own, locked while the SafeSection exists.
+     */
+    template <typename T> class SafeSection {
+    public:
+        SafeSection(T &data, std::mutex &mutex, sLockContention &contention)
+            : m_data(data), m_mutex(mutex)
+        {
+            lock(m_mutex, contention);
+        }
+        ~SafeSection() { m_mutex.unlock(); }
+        T *operator->() { return &m_data; }
+        T &operator*() { return m_data; }
+
+    private:
+        T &m_data;
+        std::mutex &m_mutex;
+    };
+
     AgentDB(const AgentDB &) = delete;
     void operator=(const AgentDB &) = delete;
 
 private:
     // Private constructor so that no objects can be created.
     AgentDB() = default;
+    static AgentDB &instance()
+    {
+        // Guaranteed to be destroyed.
+        // Instantiated on first use.
+        static AgentDB instance;
+        return instance;
+    }
     std::recursive_mutex m_db_mutex;
-    void db_lock() { m_db_mutex.lock(); }
-    void db_unlock() { m_db_mutex.unlock(); }
+    // Recursion depth of m_db_mutex, the snapshot is published when the outermost lock is released
+    int m_db_lock_depth = 0;
+    void db_lock();
+    void db_unlock();
 
     /* Put down from here database members and functions used by the Agent modules */
 
@@ -88,15 +144,15 @@ public:
 
         } back_radio;
 
-        bool local_gw;
-        bool local_controller;
+        bool local_gw         = false;
+        bool local_controller = false;
     } device_conf;
 
     /** 
      * Agent Sub Entities Data
      */
     struct sBridge {
-        sMacAddr mac;
+        sMacAddr mac = net::network_utils::ZERO_MAC;
         std::string iface_name;
     } bridge;
 
@@ -106,7 +162,7 @@ public:
     } backhaul;
 
     struct sEthernet {
-        sMacAddr mac;
+        sMacAddr mac = net::network_utils::ZERO_MAC;
         std::string iface_name;
     } ethernet;
 
@@ -129,9 +185,9 @@ public:
             eFreqType freq_type;
 
             struct sBssid {
-                sMacAddr mac;
+                sMacAddr mac = net::network_utils::ZERO_MAC;
                 std::string ssid;
-                enum class eType { fAP, bAP } type;
+                enum class eType { fAP, bAP } type = eType::fAP;
             };
             std::array<sBssid, eBeeRocksIfaceIds::IFACE_TOTAL_VAPS> bssids;
         } front;
@@ -144,24 +200,41 @@ public:
             std::string iface_name;
             sMacAddr iface_mac;
         } back;
+    };
 
-        struct sClient {
-            sClient(sMacAddr bssid_, size_t association_frame_length_, uint8_t *association_frame_)
-                : bssid(bssid_), association_time(std::chrono::steady_clock::now()),
-                  association_frame_length(association_frame_length_)
-            {
-                std::copy_n(association_frame_, association_frame_length_,
-                            association_frame.begin());
-            }
-            sMacAddr bssid;
-            std::chrono::steady_clock::time_point association_time;
-            size_t association_frame_length;
-            std::array<uint8_t, ASSOCIATION_FRAME_SIZE> association_frame;
-        };
-        // Associated clients grouped by Client MAC.
-        std::unordered_map<sMacAddr, sClient> associated_clients;
+    /**
+     * @brief Client associated to one of the BSSs of the radios.
+     */
+    struct sClient {
+        sClient(sMacAddr bssid_, size_t association_frame_length_, uint8_t *association_frame_)
+            : bssid(bssid_), association_time(std::chrono::steady_clock::now()),
+              association_frame_length(association_frame_length_)
+        {
+            std::copy_n(association_frame_, association_frame_length_, association_frame.begin());
+        }
+        sMacAddr bssid;
+        std::chrono::steady_clock::time_point association_time;
+        size_t association_frame_length;
+        std::array<uint8_t, ASSOCIATION_FRAME_SIZE> association_frame;
     };
 
+    /**
+     * Associated clients of all the radios, by client MAC.
+     */
+    typedef std::unordered_map<sMacAddr, sClient> AssociatedClients;
+
+    /**
+     * @brief Lock and get the associated clients, without locking the database.
+     *
+     * Changes of the associated clients must call increment_topology_generation().
+     */
+    static SafeSection<AssociatedClients> get_associated_clients()
+    {
+        auto &db = instance();
+        return SafeSection<AssociatedClients>(db.m_associated_clients, db.m_clients_mutex,
+                                              db.m_clients_contention);
+    }
+
     /**
      * @brief Get pointer to the radio data struct of a specific interface. The function can
      * accepts either front or back interface name.
@@ -196,8 +269,11 @@ public:
 
     /**
      * @brief Get a pointer to the parent radio struct of given MAC address. 
+     *
+     * Looking up a client MAC locks the associated clients, so it must not be done while holding
+     * them.
      * 
-     * @param mac MAC address of radio interface or bssid.
+     * @param mac MAC address of radio interface, bssid or associated client.
      * @param mac_type_hint Hint for the MAC type, for faster lookup.
      * @return sRadio* A pointer to the radio struct containing the given MAC address.
      */
@@ -205,13 +281,14 @@ public:
 
     /**
      * @brief Erase client from associated_clients list.
-     * If @a bssid is given, then remove client only from its radio, otherwise remove from all
-     * radios.
+     * If @a bssid is given, then remove client only if associated to that bssid, otherwise remove
+     * it whatever its bssid.
      * 
      * @param client_mac The client MAC address.
-     * @param bssid The bssid that the client will be removed from its radio.
+     * @param bssid The bssid that the client will be removed from.
      */
-    void erase_client(const sMacAddr &client_mac, sMacAddr bssid = net::network_utils::ZERO_MAC);
+    static void erase_client(const sMacAddr &client_mac,
+                             sMacAddr bssid = net::network_utils::ZERO_MAC);
 
     /**
      * @brief Get the MAC address (or bssid) of an AP based on the ruid and ssid.
@@ -247,11 +324,119 @@ public:
      * an unknown 1905.1 device. Every 1905.1 device shall send this message every 60 seconds, and
      * we update the time stamp in which the message is received.
      */
-    std::unordered_map<sMacAddr, std::unordered_map<sMacAddr, sNeighborDevice>> neighbor_devices;
+    typedef std::unordered_map<sMacAddr, std::unordered_map<sMacAddr, sNeighborDevice>>
+        NeighborDevices;
+
+    /**
+     * @brief Lock and get the 1905.1 neighbor devices, without locking the database.
+     *
+     * Changes of the neighbor devices must call increment_topology_generation().
+     */
+    static SafeSection<NeighborDevices> get_neighbor_devices()
+    {
+        auto &db = instance();
+        return SafeSection<NeighborDevices>(db.m_neighbor_devices, db.m_neighbors_mutex,
+                                            db.m_neighbors_contention);
+    }
+
+    /**
+     * @brief Get the generation of the data reported in the 1905.1 Topology Response message,
+     * without locking the database.
+     *
+     * The TopologyTask keeps a pre-built Topology Response message and rebuilds it only when the
+     * generation has changed.
+     */
+    static uint32_t get_topology_generation() { return instance().m_topology_generation; }
+
+    /**
+     * @brief Increment the topology generation, without locking the database.
+     *
+     * Must be called on every change of the radios interfaces, their BSSs, their associated
+     * clients or of the 1905.1 neighbor devices.
+     */
+    static void increment_topology_generation() { instance().m_topology_generation++; }
+
+    /**
+     * @brief Snapshot of the mostly static sections of the database.
+     */
+    struct sConfigSnapshot {
+        sDeviceConf device_conf;
+        sBridge bridge;
+        sEthernet ethernet;
+        std::vector<sRadio> radios;
+    };
+
+    /**
+     * @brief Get the last published snapshot of the mostly static sections, without locking the
+     * database.
+     *
+     * The snapshot is published when the database is unlocked, so a thread holding the database
+     * lock shall read the database itself to see its own changes.
+     *
+     * @return The snapshot, never nullptr.
+     */
+    static std::shared_ptr<const sConfigSnapshot> get_config_snapshot();
+
+    /**
+     * @brief Lock counters of a lock of the database.
+     */
+    struct sLockCounters {
+        uint64_t acquisitions = 0; /**< Number of times the lock was taken. */
+        uint64_t contentions  = 0; /**< Number of times the lock was held by another thread. */
+        uint64_t wait_time_us = 0; /**< Total time spent waiting for the lock. */
+    };
+
+    /**
+     * @brief Lock contention statistics of the database.
+     */
+    struct sLockStats {
+        sLockCounters db;
+        sLockCounters associated_clients;
+        sLockCounters neighbor_devices;
+        uint64_t config_snapshot_reads        = 0;
+        uint64_t config_snapshot_publications = 0;
+    };
+
+    /**
+     * @brief Get the lock contention statistics since the start of the process.
+     */
+    static sLockStats get_lock_stats();
+
+    /**
+     * @brief Remove all the data of the database, as if the process had just started.
+     *
+     * The lock statistics are kept. Used by the unit tests, which share the database instance.
+     */
+    static void reset();
 
 private:
+    /**
+     * @brief Publish a new snapshot of the mostly static sections if they changed since the last
+     * one. Called with the database locked.
+     */
+    void publish_config_snapshot();
+
     std::list<sRadio> m_radios;
     std::vector<sRadio *> m_radios_list;
+
+    AssociatedClients m_associated_clients;
+    std::mutex m_clients_mutex;
+
+    NeighborDevices m_neighbor_devices;
+    std::mutex m_neighbors_mutex;
+
+    // Atomic, since the associated clients and neighbor devices change without the database lock
+    std::atomic<uint32_t> m_topology_generation{0};
+
+    // Accessed with std::atomic_load() and std::atomic_store() only
+    std::shared_ptr<const sConfigSnapshot> m_config_snapshot =
+        std::make_shared<const sConfigSnapshot>();
+
+    sLockContention m_db_contention;
+    sLockContention m_clients_contention;
+    sLockContention m_neighbors_contention;
+    std::atomic<uint64_t> m_config_snapshot_reads{0};
+    std::atomic<uint64_t> m_config_snapshot_publications{0};
 };
 
 } // namespace beerocks
@@ -0,0 +1,246 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "backhaul_candidates.h"
+
+#include <bcl/son/son_wireless_utils.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace beerocks {
+
+constexpr int backhaul_candidates::RSSI_THRESHOLD_5GHZ;
+constexpr int backhaul_candidates::RSSI_BAND_DELTA_THRESHOLD;
+constexpr int backhaul_candidates::SUBBAND_MISMATCH_PENALTY;
+constexpr int backhaul_candidates::BLACKLIST_TIMEOUT_SECONDS;
+constexpr int backhaul_candidates::BLACKLIST_FAILED_ATTEMPTS_THRESHOLD;
+constexpr uint32_t backhaul_candidates::MAX_MISSED_SCAN_ROUNDS;
+constexpr float backhaul_candidates::DEFAULT_RSSI_EWMA_WEIGHT;
+
+/**
+ * Score added to the 5GHz candidates with an RSSI above RSSI_THRESHOLD_5GHZ, high enough to win
+ * over any 2.4GHz candidate.
+ */
+static constexpr int PREFERRED_BAND_SCORE = 1000;
+
+float backhaul_candidates::sCandidate::get_average_rssi(float weight) const
+{
+    if (history_count == 0) {
+        return rssi;
+    }
+
+    return history_rssi + weight * (rssi - history_rssi);
+}
+
+backhaul_candidates::backhaul_candidates(float rssi_ewma_weight)
+    : m_rssi_ewma_weight(rssi_ewma_weight)
+{
+}
+
+void backhaul_candidates::start_scan_round()
+{
+    for (auto it = m_candidates.begin(); it != m_candidates.end();) {
+        auto &candidate = it->second;
+
+        if (!candidate.observations.empty()) {
+            candidate.history_rssi = candidate.get_average_rssi(m_rssi_ewma_weight);
+            candidate.history_count++;
+            candidate.observations.clear();
+        }
+
+        if (m_scan_round - candidate.scan_round >= MAX_MISSED_SCAN_ROUNDS) {
+            it = m_candidates.erase(it);
+        } else {
+            it++;
+        }
+    }
+
+    m_scan_round++;
+}
+
+void backhaul_candidates::add_scan_results(const std::string &sta_iface, bool sta_iface_filter_low,
+                                           const std::vector<bwl::SScanResult> &scan_results)
+{
+    for (const auto &scan_result : scan_results) {
+        auto &candidate = m_candidates[scan_result.bssid];
+
+        if (candidate.observations.empty()) {
+            candidate.bssid      = scan_result.bssid;
+            candidate.rssi       = scan_result.rssi;
+            candidate.scan_round = m_scan_round;
+        }
+        candidate.channel = scan_result.channel;
+
+        // The same BSSID may be reported twice by the same interface, keep the strongest
+        auto observation_it = std::find_if(
+            candidate.observations.begin(), candidate.observations.end(),
+            [&sta_iface](const sObservation &observation) {
+                return observation.sta_iface == sta_iface;
+            });
+        if (observation_it == candidate.observations.end()) {
+            sObservation observation;
+            observation.sta_iface            = sta_iface;
+            observation.sta_iface_filter_low = sta_iface_filter_low;
+            observation.rssi                 = scan_result.rssi;
+            candidate.observations.push_back(observation);
+        } else {
+            observation_it->rssi = std::max(observation_it->rssi, int(scan_result.rssi));
+        }
+
+        candidate.rssi = std::max(candidate.rssi, int(scan_result.rssi));
+    }
+}
+
+int backhaul_candidates::get_score(const sCandidate &candidate,
+                                   const sObservation &observation) const
+{
+    auto rssi = candidate.get_average_rssi(m_rssi_ewma_weight);
+    int score = std::lround(rssi);
+
+    if (son::wireless_utils::which_freq(candidate.channel) == eFreqType::FREQ_5G) {
+        score += RSSI_BAND_DELTA_THRESHOLD;
+
+        if (rssi > RSSI_THRESHOLD_5GHZ) {
+            score += PREFERRED_BAND_SCORE;
+        }
+
+        if (observation.sta_iface_filter_low &&
+            son::wireless_utils::which_subband(candidate.channel) != beerocks::LOW_SUBBAND) {
+            score -= SUBBAND_MISMATCH_PENALTY;
+        }
+    }
+
+    return score;
+}
+
+const backhaul_candidates::sObservation *
+backhaul_candidates::get_best_observation(const sCandidate &candidate) const
+{
+    const sObservation *best = nullptr;
+    int best_score           = 0;
+
+    for (const auto &observation : candidate.observations) {
+        int score = get_score(candidate, observation);
+        if (best) {
+            if (score < best_score) {
+                continue;
+            }
+            if (score == best_score) {
+                if (observation.rssi < best->rssi) {
+                    continue;
+                }
+                if (observation.rssi == best->rssi && observation.sta_iface > best->sta_iface) {
+                    continue;
+                }
+            }
+        }
+
+        best       = &observation;
+        best_score = score;
+    }
+
+    return best;
+}
+
+bool backhaul_candidates::get_candidate(const sMacAddr &bssid, sSelection &selection)
+{
+    auto it = m_candidates.find(bssid);
+    if (it == m_candidates.end() || is_blacklisted(bssid)) {
+        return false;
+    }
+
+    auto observation = get_best_observation(it->second);
+    if (!observation) {
+        return false;
+    }
+
+    selection.bssid     = it->second.bssid;
+    selection.channel   = it->second.channel;
+    selection.sta_iface = observation->sta_iface;
+    selection.rssi      = observation->rssi;
+    selection.score     = get_score(it->second, *observation);
+
+    return true;
+}
+
+bool backhaul_candidates::select(sSelection &selection)
+{
+    bool found = false;
+
+    for (const auto &entry : m_candidates) {
+        const auto &candidate = entry.second;
+
+        sSelection current;
+        if (!get_candidate(candidate.bssid, current)) {
+            continue;
+        }
+
+        LOG(DEBUG) << "candidate bssid = " << candidate.bssid
+                   << ", channel = " << int(candidate.channel) << ", iface = " << current.sta_iface
+                   << ", rssi = " << current.rssi << ", score = " << current.score;
+
+        if (found) {
+            if (current.score < selection.score) {
+                continue;
+            }
+            if (current.score == selection.score) {
+                if (current.rssi < selection.rssi) {
+                    continue;
+                }
+                if (current.rssi == selection.rssi &&
+                    std::memcmp(current.bssid.oct, selection.bssid.oct, sizeof(sMacAddr)) > 0) {
+                    continue;
+                }
+            }
+        }
+
+        selection = current;
+        found     = true;
+    }
+
+    return found;
+}
+
+int backhaul_candidates::add_failed_attempt(const sMacAddr &bssid)
+{
+    auto &entry     = m_blacklist[bssid];
+    entry.timestamp = std::chrono::steady_clock::now();
+    entry.attempts++;
+
+    return entry.attempts;
+}
+
+void backhaul_candidates::blacklist(const sMacAddr &bssid)
+{
+    auto &entry     = m_blacklist[bssid];
+    entry.timestamp = std::chrono::steady_clock::now();
+    entry.attempts  = BLACKLIST_FAILED_ATTEMPTS_THRESHOLD;
+}
+
+bool backhaul_candidates::is_blacklisted(const sMacAddr &bssid)
+{
+    auto it = m_blacklist.find(bssid);
+    if (it == m_blacklist.end()) {
+        return false;
+    }
+
+    if (std::chrono::steady_clock::now() >
+        it->second.timestamp + std::chrono::seconds(BLACKLIST_TIMEOUT_SECONDS)) {
+        LOG(DEBUG) << "bssid = " << bssid << " aged and removed from backhaul blacklist";
+        m_blacklist.erase(it);
+        return false;
+    }
+
+    return it->second.attempts >= BLACKLIST_FAILED_ATTEMPTS_THRESHOLD;
+}
+
+} // namespace beerocks
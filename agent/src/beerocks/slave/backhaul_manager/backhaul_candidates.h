@@ -0,0 +1,236 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BACKHAUL_CANDIDATES_H_
+#define _BACKHAUL_CANDIDATES_H_
+
+#include <bcl/beerocks_defines.h>
+#include <bwl/sta_wlan_hal_types.h>
+#include <tlvf/tlvftypes.h>
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace beerocks {
+
+/**
+ * @brief Table of the candidate BSSIDs for the wireless backhaul connection.
+ *
+ * The table merges the scan results of all the backhaul STA interfaces into one entry per BSSID,
+ * keyed by MAC address. Each entry keeps the interfaces through which the BSSID was seen in the
+ * last scan round, together with a moving average of its RSSI over the previous scan rounds, so
+ * a BSSID which is briefly shadowed does not lose its rank and reselection after a roaming event
+ * does not depend on a single scan.
+ *
+ * The table also holds the blacklist of BSSIDs which failed to connect, and selects the best
+ * candidate through a single scoring function which applies the band and subband preferences.
+ *
+ * Using the table is a sequence of scan rounds:
+ * - start_scan_round() when new scan results are available,
+ * - add_scan_results() for each STA interface,
+ * - get_candidate() / select() to choose the BSSID to connect to.
+ */
+class backhaul_candidates {
+public:
+    /**
+     * A 5GHz candidate with an RSSI above this threshold is preferred over any 2.4GHz candidate.
+     */
+    static constexpr int RSSI_THRESHOLD_5GHZ = -80;
+
+    /**
+     * Below RSSI_THRESHOLD_5GHZ, a 5GHz candidate is preferred over a 2.4GHz candidate unless the
+     * RSSI of the latter is at least this much higher.
+     */
+    static constexpr int RSSI_BAND_DELTA_THRESHOLD = 5;
+
+    /**
+     * Penalty applied when the subband of a 5GHz candidate does not match the filter of the STA
+     * interface it was seen through.
+     */
+    static constexpr int SUBBAND_MISMATCH_PENALTY = 5;
+
+    static constexpr int BLACKLIST_TIMEOUT_SECONDS           = 120;
+    static constexpr int BLACKLIST_FAILED_ATTEMPTS_THRESHOLD = 2;
+
+    /**
+     * Number of scan rounds a BSSID is kept in the table after it was last seen.
+     */
+    static constexpr uint32_t MAX_MISSED_SCAN_ROUNDS = 5;
+
+    static constexpr float DEFAULT_RSSI_EWMA_WEIGHT = 0.5;
+
+    /**
+     * @brief Observation of a BSSID through a backhaul STA interface in the last scan round.
+     */
+    struct sObservation {
+        std::string sta_iface;
+        bool sta_iface_filter_low = false;
+        int rssi                  = beerocks::RSSI_INVALID;
+    };
+
+    /**
+     * @brief Candidate BSSID.
+     */
+    struct sCandidate {
+        sMacAddr bssid  = {};
+        uint8_t channel = 0;
+
+        /**
+         * Interfaces through which the BSSID was seen in the last scan round, empty if it was
+         * not seen in the last scan round.
+         */
+        std::vector<sObservation> observations;
+
+        /**
+         * Best RSSI in the last scan round.
+         */
+        int rssi = beerocks::RSSI_INVALID;
+
+        /**
+         * Moving average of the best RSSI of the previous scan rounds, valid if history_count
+         * is not 0.
+         */
+        float history_rssi     = 0;
+        uint32_t history_count = 0;
+
+        /**
+         * Last scan round in which the BSSID was seen.
+         */
+        uint32_t scan_round = 0;
+
+        /**
+         * @brief Gets the RSSI of the candidate, smoothed with its history.
+         */
+        float get_average_rssi(float weight) const;
+    };
+
+    /**
+     * @brief Candidate selected to connect to.
+     */
+    struct sSelection {
+        sMacAddr bssid  = {};
+        uint8_t channel = 0;
+        std::string sta_iface;
+        int rssi  = beerocks::RSSI_INVALID;
+        int score = 0;
+    };
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param rssi_ewma_weight Weight of the last scan round in the RSSI moving average.
+     */
+    explicit backhaul_candidates(float rssi_ewma_weight = DEFAULT_RSSI_EWMA_WEIGHT);
+
+    /**
+     * @brief Starts a new scan round.
+     *
+     * The RSSI of the previous round is added to the history of each candidate, and candidates
+     * not seen for MAX_MISSED_SCAN_ROUNDS rounds are removed.
+     */
+    void start_scan_round();
+
+    /**
+     * @brief Merges the scan results of a backhaul STA interface into the table.
+     *
+     * @param sta_iface Name of the STA interface.
+     * @param sta_iface_filter_low True if the STA interface filters the 5GHz low subband.
+     * @param scan_results Scan results read from the STA interface.
+     */
+    void add_scan_results(const std::string &sta_iface, bool sta_iface_filter_low,
+                          const std::vector<bwl::SScanResult> &scan_results);
+
+    /**
+     * @brief Gets a candidate seen in the last scan round, if not blacklisted.
+     *
+     * @param bssid BSSID of the candidate.
+     * @param[out] selection The candidate, through its best STA interface.
+     * @return True if found and false otherwise.
+     */
+    bool get_candidate(const sMacAddr &bssid, sSelection &selection);
+
+    /**
+     * @brief Selects the best candidate seen in the last scan round, skipping the blacklisted
+     * ones.
+     *
+     * Ties are broken by RSSI and then by BSSID, so the selection does not depend on the order
+     * of the scan results.
+     *
+     * @param[out] selection The best candidate, through its best STA interface.
+     * @return True if a candidate was found and false otherwise.
+     */
+    bool select(sSelection &selection);
+
+    /**
+     * @brief Gets all the candidates, including the ones not seen in the last scan round.
+     */
+    const std::unordered_map<sMacAddr, sCandidate> &get_candidates() const { return m_candidates; }
+
+    /**
+     * @brief Gets the current scan round.
+     */
+    uint32_t get_scan_round() const { return m_scan_round; }
+
+    /**
+     * @brief Scoring function of a candidate seen through a given STA interface.
+     *
+     * The score is the average RSSI of the candidate, increased by RSSI_BAND_DELTA_THRESHOLD on
+     * 5GHz (and by far more above RSSI_THRESHOLD_5GHZ) and decreased by SUBBAND_MISMATCH_PENALTY
+     * if the subband does not match the filter of the STA interface.
+     *
+     * @return Score, the higher the better.
+     */
+    int get_score(const sCandidate &candidate, const sObservation &observation) const;
+
+    /**
+     * @brief Counts a failed connection attempt to a BSSID.
+     *
+     * @return Number of failed attempts so far.
+     */
+    int add_failed_attempt(const sMacAddr &bssid);
+
+    /**
+     * @brief Blacklists a BSSID for BLACKLIST_TIMEOUT_SECONDS.
+     */
+    void blacklist(const sMacAddr &bssid);
+
+    /**
+     * @brief Checks if a BSSID is blacklisted, removing it from the blacklist if expired.
+     */
+    bool is_blacklisted(const sMacAddr &bssid);
+
+    void clear_blacklist() { m_blacklist.clear(); }
+
+private:
+    /**
+     * @brief Blacklist entry, for the BSSIDs which failed to connect.
+     */
+    struct sBlacklistEntry {
+        std::chrono::steady_clock::time_point timestamp;
+        int attempts = 0;
+    };
+
+    /**
+     * @brief Gets the best STA interface to connect to a candidate.
+     *
+     * @return The best observation, or nullptr if not seen in the last scan round.
+     */
+    const sObservation *get_best_observation(const sCandidate &candidate) const;
+
+    float m_rssi_ewma_weight;
+    uint32_t m_scan_round = 0;
+
+    std::unordered_map<sMacAddr, sCandidate> m_candidates;
+    std::unordered_map<sMacAddr, sBlacklistEntry> m_blacklist;
+};
+
+} // namespace beerocks
+
+#endif // _BACKHAUL_CANDIDATES_H_
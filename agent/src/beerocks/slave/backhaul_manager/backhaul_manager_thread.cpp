@@ -121,28 +121,6 @@ namespace beerocks {
 
 const char *backhaul_manager::s_arrStates[] = {FOREACH_STATE(GENERATE_STRING)};
 
-/**
- * @brief Gets the MAC address of given interface.
- *
- * @param[in] iface_name Name of the network interface.
- * @param[out] iface_mac MAC address of the network interface on success and ZERO_MAC on error.
- *
- * @return True on success and false otherwise.
- */
-static bool get_iface_mac(const std::string &iface_name, sMacAddr &iface_mac)
-{
-    std::string mac;
-    if (network_utils::linux_iface_get_mac(iface_name, mac)) {
-        iface_mac = tlvf::mac_from_string(mac);
-        return true;
-    }
-
-    LOG(ERROR) << "Failed getting MAC address for interface: " << iface_name;
-    iface_mac = network_utils::ZERO_MAC;
-
-    return false;
-}
-
 /**
  * @brief Gets the name of the interface with given MAC address.
  *
@@ -171,7 +149,9 @@ backhaul_manager::backhaul_manager(const config_file::sConfigSlave &config,
                                    const std::set<std::string> &slave_ap_ifaces_,
                                    const std::set<std::string> &slave_sta_ifaces_,
                                    int stop_on_failure_attempts_)
-    : transport_socket_thread(config.temp_path + std::string(BEEROCKS_BACKHAUL_MGR_UDS)),
+    // Topology and AP Metrics Responses grow with the number of associated stations
+    : transport_socket_thread(config.temp_path + std::string(BEEROCKS_BACKHAUL_MGR_UDS),
+                              message::MESSAGE_BUFFER_LENGTH_MAX),
       beerocks_temp_path(config.temp_path), slave_ap_ifaces(slave_ap_ifaces_),
       slave_sta_ifaces(slave_sta_ifaces_), config_const_bh_slave(config.const_backhaul_slave)
 {
@@ -184,6 +164,11 @@ backhaul_manager::backhaul_manager(const config_file::sConfigSlave &config,
     m_sConfig.vendor            = config.vendor;
     m_sConfig.model             = config.model;
 
+    link_metrics_sampling_info.sampling_interval = std::chrono::milliseconds(
+        config.link_metrics_sampling_interval_ms.empty()
+            ? DEFAULT_LINK_METRICS_SAMPLING_INTERVAL_MS
+            : string_utils::stoi(config.link_metrics_sampling_interval_ms));
+
     m_eFSMState = EState::INIT;
     set_select_timeout(SELECT_TIMEOUT_MSC);
 
@@ -192,6 +177,12 @@ backhaul_manager::backhaul_manager(const config_file::sConfigSlave &config,
         LOG(ERROR) << "failed to allocate Topology Task!";
     }
     m_task_pool.add_task(topology_task);
+
+    m_iface_registry.set_change_handler(
+        [&](const net::InterfaceRegistry::sInterface &iface,
+            net::InterfaceRegistry::eChangeType change_type, uint32_t previous_master_index) {
+            handle_interface_change(iface, change_type, previous_master_index);
+        });
 }
 
 backhaul_manager::~backhaul_manager() { backhaul_manager::on_thread_stop(); }
@@ -205,6 +196,14 @@ bool backhaul_manager::init()
         return false;
     }
 
+    if (!m_iface_registry.open()) {
+        LOG(ERROR) << "Failed to open the interface registry!";
+        stop();
+        return false;
+    }
+    m_iface_registry_socket = new Socket(m_iface_registry.get_fd());
+    add_socket(m_iface_registry_socket);
+
     if (!broker_subscribe(std::vector<ieee1905_1::eMessageType>{
             ieee1905_1::eMessageType::ACK_MESSAGE,
             ieee1905_1::eMessageType::AP_AUTOCONFIGURATION_RENEW_MESSAGE,
@@ -251,6 +250,13 @@ bool backhaul_manager::work()
 
 void backhaul_manager::on_thread_stop()
 {
+    if (m_iface_registry_socket) {
+        remove_socket(m_iface_registry_socket);
+        delete m_iface_registry_socket;
+        m_iface_registry_socket = nullptr;
+    }
+    m_iface_registry.close();
+
     // Close the socket with the platform manager
     if (m_scPlatform) {
         m_scPlatform.reset();
@@ -422,6 +428,13 @@ void backhaul_manager::after_select(bool timeout)
         m_agent_ucc_listener->lock();
     }
 
+    // Process local interface events
+    if (read_ready(m_iface_registry_socket)) {
+        // A callback (handle_interface_change()) will be invoked for each change
+        m_iface_registry.process_events();
+        clear_ready(m_iface_registry_socket);
+    }
+
     for (auto &soc : slaves_sockets) {
         if (soc->sta_iface.empty() || !soc->sta_wlan_hal)
             continue;
@@ -435,7 +448,9 @@ void backhaul_manager::after_select(bool timeout)
         // Process internal events
         if (read_ready(soc->sta_hal_int_events)) {
             // A callback (hal_event_handler()) will invoked for pending events
-            soc->sta_wlan_hal->process_int_events();
+            if (!soc->sta_wlan_hal->process_int_events()) {
+                LOG(ERROR) << "process_int_events() failed on iface " << soc->sta_iface;
+            }
             clear_ready(soc->sta_hal_int_events);
         }
     }
@@ -733,7 +748,7 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
             db->backhaul.selected_iface_name.clear();
         } else { // link establish
 
-            auto ifaces = network_utils::linux_get_iface_list_from_bridge(db->bridge.iface_name);
+            auto ifaces = m_iface_registry.get_bridge_members(db->bridge.iface_name);
 
             // If a wired (WAN) interface was provided, try it first, check if the interface is UP
             wan_monitor::ELinkState wired_link_state = wan_monitor::ELinkState::eInvalid;
@@ -805,7 +820,7 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
         // Update bridge parameters on AgentDB.
         db->bridge.mac = tlvf::mac_from_string(bridge_info.mac);
 
-        auto ifaces = network_utils::linux_get_iface_list_from_bridge(db->bridge.iface_name);
+        auto ifaces = m_iface_registry.get_bridge_members(db->bridge.iface_name);
         if (!configure_ieee1905_transport_interfaces(db->bridge.iface_name, ifaces)) {
             LOG(ERROR) << "configure_ieee1905_transport_interfaces() failed!";
             FSM_MOVE_STATE(RESTART);
@@ -885,12 +900,11 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
         stop_on_failure_attempts = configuration_stop_on_failure_attempts;
 
         LOG(DEBUG) << "clearing blacklist";
-        ap_blacklist.clear();
+        m_backhaul_candidates.clear_blacklist();
 
         auto db = AgentDB::get();
 
-        eth_link_poll_timer = std::chrono::steady_clock::now();
-        m_eth_link_up       = network_utils::linux_iface_is_up_and_running(db->ethernet.iface_name);
+        m_eth_link_up = m_iface_registry.is_up_and_running(db->ethernet.iface_name);
         FSM_MOVE_STATE(OPERATIONAL);
 
         // This event may come as a result of enabling the backhaul, but also as a result
@@ -917,30 +931,11 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
 
         /*
         * TODO
-        * This code segment is commented out since wireless-backhaul is not yet supported and
-        * the current implementation causes high CPU load on steady-state.
-        * The high CPU load is due to a call to linux_iface_is_up_and_running() performed every
-        * second to check if the wired interface changed its state. The implementation of the above
-        * polls the interface flags using ioctl() which is very costly (~120 milliseconds).
-        *
-        * An event-driven solution will be implemented as part of the task:
+        * Changes of the wired link state are tracked by handle_interface_change(), but switching
+        * between wired and wireless backhaul is not supported yet:
         * [TASK] Dynamic switching between wired and wireless
         * https://github.com/prplfoundation/prplMesh/issues/866
         */
-        // auto db = AgentDB::get();
-        // int time_elapsed_ms =
-        //     std::chrono::duration_cast<std::chrono::milliseconds>(now - eth_link_poll_timer)
-        //         .count();
-        // //pooling eth link status every second to notice if there been a change.
-        // if (time_elapsed_ms > POLL_TIMER_TIMEOUT_MS) {
-
-        //     eth_link_poll_timer = now;
-        //     bool eth_link_up = network_utils::linux_iface_is_up_and_running(db->ethernet.iface_name);
-        //     if (eth_link_up != m_eth_link_up) {
-        //         m_eth_link_up = network_utils::linux_iface_is_up_and_running(db->ethernet.iface_name);
-        //         FSM_MOVE_STATE(RESTART);
-        //     }
-        // } else {
         auto db = AgentDB::get();
         if (pending_enable &&
             db->backhaul.connection_type != AgentDB::sBackhaul::eConnectionType::Invalid) {
@@ -972,6 +967,26 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
             }
         }
 
+        /**
+         * If periodic link metrics sampling is enabled, check if time interval has elapsed and
+         * if so, then sample the link metrics of all the neighbors.
+         */
+        if (link_metrics_sampling_info.sampling_interval.count() != 0 &&
+            now - link_metrics_sampling_info.last_sampling_time_point >=
+                link_metrics_sampling_info.sampling_interval) {
+            link_metrics_sampling_info.last_sampling_time_point = now;
+
+            if (!sample_link_metrics()) {
+                LOG(ERROR) << "Failed to sample link metrics";
+            }
+        }
+
+        if (now - m_db_lock_stats_time_point >=
+            std::chrono::seconds(DB_LOCK_STATS_INTERVAL_SECONDS)) {
+            m_db_lock_stats_time_point = now;
+            log_db_lock_stats();
+        }
+
         break;
     }
     case EState::RESTART: {
@@ -990,6 +1005,7 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
             }
             // Clear the backhaul interface mac.
             radio->back.iface_mac = network_utils::ZERO_MAC;
+            AgentDB::increment_topology_generation();
 
             if (soc->sta_wlan_hal) {
                 soc->sta_wlan_hal.reset();
@@ -1030,7 +1046,7 @@ bool backhaul_manager::backhaul_fsm_main(bool &skip_select)
             FSM_MOVE_STATE(INIT);
         }
 
-        ap_blacklist.clear();
+        m_backhaul_candidates.clear_blacklist();
 
         break;
     }
@@ -1293,6 +1309,7 @@ bool backhaul_manager::backhaul_fsm_wireless(bool &skip_select)
                 }
                 // Update the backhaul interface mac.
                 radio->back.iface_mac = tlvf::mac_from_string(soc->sta_wlan_hal->get_radio_mac());
+                AgentDB::increment_topology_generation();
 
             } else if (attach_state == bwl::HALState::Failed) {
                 // Delete the HAL instance
@@ -1570,11 +1587,10 @@ bool backhaul_manager::backhaul_fsm_wireless(bool &skip_select)
                                           db->backhaul.selected_iface_name + "'");
 
                 if (!selected_bssid.empty()) {
-                    ap_blacklist_entry &entry = ap_blacklist[selected_bssid];
-                    entry.timestamp           = now;
-                    entry.attempts++;
+                    int attempts = m_backhaul_candidates.add_failed_attempt(
+                        tlvf::mac_from_string(selected_bssid));
                     LOG(DEBUG) << "updating bssid " << selected_bssid
-                               << " blacklist entry, attempts=" << entry.attempts;
+                               << " blacklist entry, attempts=" << attempts;
                 }
                 roam_flag = false;
             }
@@ -1589,12 +1605,11 @@ bool backhaul_manager::backhaul_fsm_wireless(bool &skip_select)
 
             // increment attempts count in blacklist
             if (!selected_bssid.empty()) {
-                auto &entry     = ap_blacklist[selected_bssid];
-                entry.timestamp = now;
-                entry.attempts++;
+                int attempts =
+                    m_backhaul_candidates.add_failed_attempt(tlvf::mac_from_string(selected_bssid));
                 LOG(DEBUG) << "updating bssid " << selected_bssid
-                           << " blacklist entry, attempts=" << entry.attempts
-                           << ", max_allowed attempts=" << AP_BLACK_LIST_FAILED_ATTEMPTS_THRESHOLD;
+                           << " blacklist entry, attempts=" << attempts << ", max_allowed attempts="
+                           << backhaul_candidates::BLACKLIST_FAILED_ATTEMPTS_THRESHOLD;
             }
 
             FSM_MOVE_STATE(INITIATE_SCAN);
@@ -2015,23 +2030,22 @@ bool backhaul_manager::handle_slave_backhaul_message(std::shared_ptr<sRadioInfo>
 
         response_out->sta_mac() = response_in->sta_mac();
 
-        auto db = AgentDB::get();
-
         for (size_t i = 0; i < response_out->bssid_info_list_length(); ++i) {
             auto &bss_in  = std::get<1>(response_in->bssid_info_list(i));
             auto &bss_out = std::get<1>(response_out->bssid_info_list(i));
 
             auto &client_mac = response_out->sta_mac();
 
-            auto radio = db->get_radio_by_mac(client_mac, AgentDB::eMacType::CLIENT);
-            if (!radio) {
-                LOG(ERROR) << "radio for client mac " << client_mac << " not found";
-                return false;
+            // Clients are added to the associated clients only if associated to one of our radios
+            {
+                auto associated_clients = AgentDB::get_associated_clients();
+                auto client_it          = associated_clients->find(client_mac);
+                if (client_it == associated_clients->end()) {
+                    LOG(ERROR) << "radio for client mac " << client_mac << " not found";
+                    return false;
+                }
+                bss_out.bssid = client_it->second.bssid;
             }
-
-            // If get_radio_by_mac() found the radio, it means that 'client_mac' is on the radio
-            // 'associated_clients' list.
-            bss_out.bssid = radio->associated_clients.at(client_mac).bssid;
             if (bss_out.bssid == network_utils::ZERO_MAC) {
                 LOG(ERROR) << "bssid is ZERO_MAC";
                 return false;
@@ -2046,7 +2060,8 @@ bool backhaul_manager::handle_slave_backhaul_message(std::shared_ptr<sRadioInfo>
         }
 
         LOG(DEBUG) << "Send AssociatedStaLinkMetrics to controller, mid = " << mid;
-        send_cmdu_to_broker(cmdu_tx, controller_bridge_mac, tlvf::mac_to_string(db->bridge.mac));
+        send_cmdu_to_broker(cmdu_tx, controller_bridge_mac,
+                            tlvf::mac_to_string(AgentDB::get_config_snapshot()->bridge.mac));
         break;
     }
     default: {
@@ -2181,7 +2196,10 @@ bool backhaul_manager::handle_multi_ap_policy_config_request(ieee1905_1::CmduMes
          * sent by the controller and received by the backhaul manager.
          * The backhaul manager forwards the request message "as is" to all the slaves managing the
          * radios which Radio Unique Identifier has been specified.
+         * The radios are collected first so the message is swapped back to network byte order
+         * only once, whatever the number of radios it is forwarded to.
          */
+        std::vector<std::shared_ptr<sRadioInfo>> radios;
         for (size_t i = 0; i < metric_reporting_policy_tlv->metrics_reporting_conf_list_length();
              i++) {
             auto tuple = metric_reporting_policy_tlv->metrics_reporting_conf_list(i);
@@ -2194,17 +2212,23 @@ bool backhaul_manager::handle_multi_ap_policy_config_request(ieee1905_1::CmduMes
             auto metrics_reporting_conf = std::get<1>(tuple);
 
             std::shared_ptr<sRadioInfo> radio = get_radio(metrics_reporting_conf.radio_uid);
-            if (radio) {
-                uint16_t length = message_com::get_uds_header(cmdu_rx)->length;
-                cmdu_rx.swap(); // swap back before forwarding
+            if (!radio) {
+                LOG(INFO) << "Radio Unique Identifier " << metrics_reporting_conf.radio_uid
+                          << " not found";
+            } else if (std::find(radios.begin(), radios.end(), radio) == radios.end()) {
+                radios.push_back(radio);
+            }
+        }
+
+        if (!radios.empty()) {
+            uint16_t length = message_com::get_uds_header(cmdu_rx)->length;
+            cmdu_rx.swap(); // swap back before forwarding
+            for (const auto &radio : radios) {
                 if (!message_com::forward_cmdu_to_uds(radio->slave, cmdu_rx, length)) {
                     LOG(ERROR) << "Failed to forward message to slave " << radio->radio_mac;
                 }
-                cmdu_rx.swap(); // swap back to normal after forwarding, for next iteration
-            } else {
-                LOG(INFO) << "Radio Unique Identifier " << metrics_reporting_conf.radio_uid
-                          << " not found";
             }
+            cmdu_rx.swap(); // swap back to normal after forwarding
         }
 
         /**
@@ -2276,17 +2300,22 @@ bool backhaul_manager::handle_associated_sta_link_metrics_query(ieee1905_1::Cmdu
         LOG(DEBUG) << "Send a ASSOCIATED_STA_LINK_METRICS_RESPONSE_MESSAGE back to controller";
         return send_cmdu_to_broker(cmdu_tx, src_mac, tlvf::mac_to_string(db->bridge.mac));
     }
-    auto client_it = radio->associated_clients.find(mac->sta_mac());
-    if (client_it == radio->associated_clients.end()) {
-        LOG(ERROR) << "Cannot find sta sta " << mac->sta_mac();
-        return false;
+    sMacAddr client_bssid;
+    {
+        auto associated_clients = AgentDB::get_associated_clients();
+        auto client_it          = associated_clients->find(mac->sta_mac());
+        if (client_it == associated_clients->end()) {
+            LOG(ERROR) << "Cannot find sta sta " << mac->sta_mac();
+            return false;
+        }
+        client_bssid = client_it->second.bssid;
     }
-    if (client_it->second.bssid == network_utils::ZERO_MAC) {
+    if (client_bssid == network_utils::ZERO_MAC) {
         LOG(ERROR) << "Cannot find sta bssid";
         return false;
     }
     LOG(DEBUG) << "Client with mac address " << mac->sta_mac() << " connected to "
-               << client_it->second.bssid;
+               << client_bssid;
 
     auto request_out = message_com::create_vs_message<
         beerocks_message::cACTION_BACKHAUL_ASSOCIATED_STA_LINK_METRICS_REQUEST>(cmdu_tx, mid);
@@ -2371,9 +2400,17 @@ bool backhaul_manager::handle_client_capability_query(ieee1905_1::CmduMessageRx
     LOG(DEBUG) << "Result Code: SUCCESS";
 
     // Add frame body of the most recently received (Re)Association Request frame from this client.
-    auto &client_info = radio->associated_clients.at(client_info_tlv_r->client_mac());
-    client_capability_report_tlv->set_association_frame(client_info.association_frame.data(),
-                                                        client_info.association_frame_length);
+    {
+        auto associated_clients = AgentDB::get_associated_clients();
+        auto client_it          = associated_clients->find(client_info_tlv_r->client_mac());
+        if (client_it == associated_clients->end()) {
+            LOG(ERROR) << "Client " << client_info_tlv_r->client_mac() << " disassociated";
+            return false;
+        }
+        auto &client_info = client_it->second;
+        client_capability_report_tlv->set_association_frame(client_info.association_frame.data(),
+                                                            client_info.association_frame_length);
+    }
 
     LOG(DEBUG) << "Send a CLIENT_CAPABILITY_REPORT_MESSAGE back to controller";
     return send_cmdu_to_broker(cmdu_tx, src_mac, tlvf::mac_to_string(db->bridge.mac));
@@ -2763,23 +2800,47 @@ bool backhaul_manager::handle_1905_link_metric_query(ieee1905_1::CmduMessageRx &
          * Report link metrics for the link with specific neighbor or for all neighbors, as
          * obtained from topology database
          */
+        const auto &sampling_interval = link_metrics_sampling_info.sampling_interval;
+        auto now                      = std::chrono::steady_clock::now();
+
         for (const auto &entry : neighbor_links_map) {
             auto interface        = entry.first;
             const auto &neighbors = entry.second;
 
-            std::unique_ptr<link_metrics_collector> collector =
-                create_link_metrics_collector(interface);
-            if (!collector) {
-                continue;
-            }
+            /**
+             * The collector is only created if some link has not been sampled recently enough.
+             */
+            std::unique_ptr<link_metrics_collector> collector;
 
             for (const auto &neighbor : neighbors) {
 
+                /**
+                 * Links sampled within the last two sampling intervals are reported from the
+                 * cache, so a burst of queries does not read the link statistics again and again.
+                 */
+                sLinkMetrics link_metrics;
+                if (m_link_metrics_cache.get_link_metrics(interface.iface_name,
+                                                          neighbor.iface_mac,
+                                                          2 * sampling_interval, now,
+                                                          link_metrics)) {
+                    if (!add_link_metrics(reporter_al_mac, interface, neighbor, link_metrics,
+                                          link_metrics_type)) {
+                        return false;
+                    }
+                    continue;
+                }
+
+                if (!collector) {
+                    collector = create_link_metrics_collector(interface);
+                    if (!collector) {
+                        break;
+                    }
+                }
+
                 LOG(TRACE) << "Getting link metrics for interface " << interface.iface_name
                            << " (MediaType = " << std::hex << (int)interface.media_type
                            << ") and neighbor " << neighbor.iface_mac;
 
-                sLinkMetrics link_metrics;
                 if (!collector->get_link_metrics(interface.iface_name, neighbor.iface_mac,
                                                  link_metrics)) {
                     LOG(ERROR) << "Unable to get link metrics for interface "
@@ -2787,6 +2848,11 @@ bool backhaul_manager::handle_1905_link_metric_query(ieee1905_1::CmduMessageRx &
                     return false;
                 }
 
+                if (sampling_interval.count() != 0) {
+                    m_link_metrics_cache.update(interface.iface_name, neighbor.iface_mac,
+                                                link_metrics, now);
+                }
+
                 if (!add_link_metrics(reporter_al_mac, interface, neighbor, link_metrics,
                                       link_metrics_type)) {
                     return false;
@@ -3165,13 +3231,9 @@ bool backhaul_manager::hal_event_handler(bwl::base_wlan_hal::hal_event_ptr_t eve
                     static_cast<bwl::sACTION_BACKHAUL_DISCONNECT_REASON_NOTIFICATION *>(data);
                 if (msg->disconnect_reason == uint32_t(DEAUTH_REASON_PASSPHRASE_MISMACH)) {
                     //enter bssid to black_list trigger timer
-                    auto local_time_stamp = std::chrono::steady_clock::now();
-                    auto local_bssid      = tlvf::mac_to_string(msg->bssid);
+                    auto local_bssid = tlvf::mac_to_string(msg->bssid);
                     LOG(DEBUG) << "insert bssid = " << local_bssid << " to backhaul blacklist";
-                    ap_blacklist_entry entry;
-                    entry.timestamp           = local_time_stamp;
-                    entry.attempts            = AP_BLACK_LIST_FAILED_ATTEMPTS_THRESHOLD;
-                    ap_blacklist[local_bssid] = entry;
+                    m_backhaul_candidates.blacklist(msg->bssid);
                     platform_notify_error(bpl::eErrorCode::BH_ASSOCIATE_4ADDR_FAILURE,
                                           "SSID='" + m_sConfig.ssid + "', BSSID='" + local_bssid +
                                               "', DEAUTH_REASON='" +
@@ -3214,6 +3276,7 @@ bool backhaul_manager::hal_event_handler(bwl::base_wlan_hal::hal_event_ptr_t eve
 
         if (pending_slave_sta_ifaces.empty()) {
             LOG(DEBUG) << "scan results ready";
+            update_backhaul_candidates();
             get_scan_measurement();
             if (!select_bssid()) {
                 LOG(DEBUG) << "couldn't find a suitable BSSID";
@@ -3286,204 +3349,69 @@ bool backhaul_manager::hal_event_handler(bwl::base_wlan_hal::hal_event_ptr_t eve
     return true;
 } // namespace beerocks
 
-bool backhaul_manager::select_bssid()
+void backhaul_manager::update_backhaul_candidates()
 {
-    int max_rssi_24     = beerocks::RSSI_INVALID;
-    int max_rssi_5_best = beerocks::RSSI_INVALID;
-    int max_rssi_5_high = beerocks::RSSI_INVALID;
-    int max_rssi_5_low  = beerocks::RSSI_INVALID;
-    std::string best_bssid_5, best_bssid_5_high, best_bssid_5_low, best_bssid_24;
-    int best_bssid_channel_5 = 0, best_bssid_channel_5_high = 0, best_bssid_channel_5_low = 0,
-        best_bssid_channel_24 = 0;
-    std::string best_24_sta_iface, best_5_high_sta_iface, best_5_low_sta_iface, best_5_sta_iface;
-
-    // Support up to 256 scan results
-    std::vector<bwl::SScanResult> scan_results;
+    LOG(DEBUG) << "update_backhaul_candidates: SSID = " << m_sConfig.ssid;
 
-    auto db = AgentDB::get();
-
-    LOG(DEBUG) << "select_bssid: SSID = " << m_sConfig.ssid;
+    m_backhaul_candidates.start_scan_round();
 
-    for (auto soc : slaves_sockets) {
+    for (auto &soc : slaves_sockets) {
 
         if (soc->sta_iface.empty() || !soc->sta_wlan_hal) {
             LOG(DEBUG) << "skipping empty iface";
             continue;
         }
 
-        std::string iface = soc->sta_iface;
-
-        LOG(DEBUG) << "select_bssid: iface  = " << iface;
-        int num_of_results = soc->sta_wlan_hal->get_scan_results(m_sConfig.ssid, scan_results);
-        LOG(DEBUG) << "Scan Results: " << num_of_results;
-
-        for (auto &scan_result : scan_results) {
-
-            auto bssid = tlvf::mac_to_string(scan_result.bssid);
-            LOG(DEBUG) << "select_bssid: bssid = " << bssid
-                       << ", channel = " << int(scan_result.channel) << " iface = " << iface
-                       << ", rssi=" << int(scan_result.rssi);
-
-            auto ap_blacklist_it = ap_blacklist.find(bssid);
-            if (ap_blacklist_it != ap_blacklist.end()) {
-                ap_blacklist_entry &entry = ap_blacklist_it->second;
-                if (std::chrono::steady_clock::now() >
-                    (entry.timestamp + std::chrono::seconds(AP_BLACK_LIST_TIMEOUT_SECONDS))) {
-                    LOG(DEBUG) << " bssid = " << bssid
-                               << " aged and removed from backhaul blacklist";
-                    ap_blacklist.erase(bssid);
-                } else if (entry.attempts >= AP_BLACK_LIST_FAILED_ATTEMPTS_THRESHOLD) {
-                    LOG(DEBUG) << " bssid = " << bssid << " is blacklisted, skipping";
-                    continue;
-                }
-            }
-            if (roam_flag) {
-                if ((bssid == roam_selected_bssid) &&
-                    (scan_result.channel == roam_selected_bssid_channel)) {
-                    LOG(DEBUG) << "roaming flag on  - found bssid match = " << roam_selected_bssid
-                               << " roam_selected_bssid_channel = "
-                               << int(roam_selected_bssid_channel);
-                    db->backhaul.selected_iface_name = iface;
-                    return true;
-                }
-            } else if (!m_sConfig.preferred_bssid.empty() && bssid == m_sConfig.preferred_bssid) {
-                LOG(DEBUG) << "preferred bssid - found bssid match = " << bssid;
-                selected_bssid_channel           = scan_result.channel;
-                selected_bssid                   = bssid;
-                db->backhaul.selected_iface_name = iface;
-                return true;
-            } else if (son::wireless_utils::which_freq(scan_result.channel) == eFreqType::FREQ_5G) {
-                if (soc->sta_iface_filter_low &&
-                    son::wireless_utils::which_subband(scan_result.channel) ==
-                        beerocks::LOW_SUBBAND) {
-                    // iface with low filter - best low
-                    if (scan_result.rssi > max_rssi_5_low) {
-                        max_rssi_5_low           = scan_result.rssi;
-                        best_bssid_5_low         = bssid;
-                        best_bssid_channel_5_low = scan_result.channel;
-                        best_5_low_sta_iface     = iface;
-                    }
-
-                } else if (!soc->sta_iface_filter_low &&
-                           son::wireless_utils::which_subband(scan_result.channel) ==
-                               beerocks::HIGH_SUBBAND) {
-                    // iface without low filter (high filter or bypass) - best high
-                    if (scan_result.rssi > max_rssi_5_high) {
-                        max_rssi_5_high           = scan_result.rssi;
-                        best_bssid_5_high         = bssid;
-                        best_bssid_channel_5_high = scan_result.channel;
-                        best_5_high_sta_iface     = iface;
-                    }
-                }
-
-                if (scan_result.rssi > max_rssi_5_best) {
-                    // best 5G (low/high)
-                    max_rssi_5_best      = scan_result.rssi;
-                    best_bssid_5         = bssid;
-                    best_bssid_channel_5 = scan_result.channel;
-                    best_5_sta_iface     = iface;
-                }
-
-            } else {
-                // best 2.4G
-                if (scan_result.rssi > max_rssi_24) {
-                    max_rssi_24           = scan_result.rssi;
-                    best_bssid_24         = bssid;
-                    best_bssid_channel_24 = scan_result.channel;
-                    best_24_sta_iface     = iface;
-                }
-            }
+        // The HAL appends to the given list, so it must be cleared for each interface
+        m_scan_results.clear();
+        int num_of_results = soc->sta_wlan_hal->get_scan_results(m_sConfig.ssid, m_scan_results);
+        LOG(DEBUG) << "Scan Results: " << num_of_results << " on iface " << soc->sta_iface;
+        if (num_of_results < 0) {
+            LOG(ERROR) << "get_scan_results failed on iface " << soc->sta_iface;
+            continue;
         }
-    }
 
-    if (!best_bssid_24.empty()) {
-        LOG(DEBUG) << "BEST - 2.4Ghz          - " << best_24_sta_iface
-                   << " - BSSID: " << best_bssid_24 << ", Channel: " << int(best_bssid_channel_24)
-                   << ", RSSI: " << int(max_rssi_24);
-    } else {
-        LOG(DEBUG) << "BEST - 2.4Ghz          - Not Found!";
-    }
-
-    if (!best_bssid_5_low.empty()) {
-        LOG(DEBUG) << "BEST - 5Ghz (Low)      - " << best_5_low_sta_iface
-                   << " - BSSID: " << best_bssid_5_low
-                   << ", Channel: " << int(best_bssid_channel_5_low)
-                   << ", RSSI: " << int(max_rssi_5_low);
-    } else {
-        LOG(DEBUG) << "BEST - 5Ghz (Low)      - Not Found!";
+        m_backhaul_candidates.add_scan_results(soc->sta_iface, soc->sta_iface_filter_low,
+                                               m_scan_results);
     }
+}
 
-    if (!best_bssid_5_high.empty()) {
-        LOG(DEBUG) << "BEST - 5Ghz (High)     - " << best_5_high_sta_iface
-                   << " - BSSID: " << best_bssid_5_high
-                   << ", Channel: " << int(best_bssid_channel_5_high)
-                   << ", RSSI: " << int(max_rssi_5_high);
-    } else {
-        LOG(DEBUG) << "BEST - 5Ghz (High)     - Not Found!";
-    }
-
-    if (!best_bssid_5.empty()) {
-        LOG(DEBUG) << "BEST - 5Ghz (Absolute) - " << best_5_sta_iface
-                   << " - BSSID: " << best_bssid_5 << ", Channel: " << int(best_bssid_channel_5)
-                   << ", RSSI: " << int(max_rssi_5_best);
-    } else {
-        LOG(DEBUG) << "BEST - 5Ghz (Absolute) - Not Found!";
-    }
-
-    if (max_rssi_5_high != beerocks::RSSI_INVALID &&
-        (best_5_sta_iface == best_5_low_sta_iface || best_5_low_sta_iface.empty()) &&
-        son::wireless_utils::which_subband(best_bssid_channel_5) == beerocks::HIGH_SUBBAND) {
-
-        max_rssi_5_best      = max_rssi_5_high;
-        best_bssid_5         = best_bssid_5_high;
-        best_bssid_channel_5 = best_bssid_channel_5_high;
-        best_5_sta_iface     = best_5_high_sta_iface;
+bool backhaul_manager::select_bssid()
+{
+    auto db = AgentDB::get();
 
-    } else if (max_rssi_5_low != beerocks::RSSI_INVALID &&
-               (best_5_sta_iface == best_5_high_sta_iface || best_5_high_sta_iface.empty()) &&
-               son::wireless_utils::which_subband(best_bssid_channel_5) == beerocks::LOW_SUBBAND) {
+    LOG(DEBUG) << "select_bssid: SSID = " << m_sConfig.ssid;
 
-        max_rssi_5_best      = max_rssi_5_low;
-        best_bssid_5         = best_bssid_5_low;
-        best_bssid_channel_5 = best_bssid_channel_5_low;
-        best_5_sta_iface     = best_5_low_sta_iface;
-    }
+    backhaul_candidates::sSelection selection;
 
-    if (!best_bssid_5.empty()) {
-        LOG(DEBUG) << "Selected 5Ghz - " << best_5_sta_iface << " - BSSID: " << best_bssid_5
-                   << ", Channel: " << int(best_bssid_channel_5)
-                   << ", RSSI: " << int(max_rssi_5_best);
-    } else {
-        LOG(DEBUG) << "Selected 5Ghz - Not Found!";
+    if (roam_flag) {
+        if (m_backhaul_candidates.get_candidate(tlvf::mac_from_string(roam_selected_bssid),
+                                                selection) &&
+            selection.channel == roam_selected_bssid_channel) {
+            LOG(DEBUG) << "roaming flag on  - found bssid match = " << roam_selected_bssid
+                       << " roam_selected_bssid_channel = " << int(roam_selected_bssid_channel);
+            db->backhaul.selected_iface_name = selection.sta_iface;
+            return true;
+        }
+        return false;
     }
 
-    // Select the base backhaul interface
-    if (((max_rssi_24 == beerocks::RSSI_INVALID) && (max_rssi_5_best == beerocks::RSSI_INVALID)) ||
-        roam_flag) {
-        // TODO: ???
+    if (!m_sConfig.preferred_bssid.empty() &&
+        m_backhaul_candidates.get_candidate(tlvf::mac_from_string(m_sConfig.preferred_bssid),
+                                            selection)) {
+        LOG(DEBUG) << "preferred bssid - found bssid match = " << m_sConfig.preferred_bssid;
+    } else if (!m_backhaul_candidates.select(selection)) {
         return false;
-    } else if (max_rssi_24 == beerocks::RSSI_INVALID) {
-        selected_bssid                   = best_bssid_5;
-        selected_bssid_channel           = best_bssid_channel_5;
-        db->backhaul.selected_iface_name = best_5_sta_iface;
-    } else if (max_rssi_5_best == beerocks::RSSI_INVALID) {
-        selected_bssid                   = best_bssid_24;
-        selected_bssid_channel           = best_bssid_channel_24;
-        db->backhaul.selected_iface_name = best_24_sta_iface;
-    } else if ((max_rssi_5_best > RSSI_THRESHOLD_5GHZ)) {
-        selected_bssid                   = best_bssid_5;
-        selected_bssid_channel           = best_bssid_channel_5;
-        db->backhaul.selected_iface_name = best_5_sta_iface;
-    } else if (max_rssi_24 < max_rssi_5_best + RSSI_BAND_DELTA_THRESHOLD) {
-        selected_bssid                   = best_bssid_5;
-        selected_bssid_channel           = best_bssid_channel_5;
-        db->backhaul.selected_iface_name = best_5_sta_iface;
-    } else {
-        selected_bssid                   = best_bssid_24;
-        selected_bssid_channel           = best_bssid_channel_24;
-        db->backhaul.selected_iface_name = best_24_sta_iface;
     }
 
+    LOG(DEBUG) << "Selected - " << selection.sta_iface << " - BSSID: " << selection.bssid
+               << ", Channel: " << int(selection.channel) << ", RSSI: " << selection.rssi
+               << ", Score: " << selection.score;
+
+    selected_bssid                   = tlvf::mac_to_string(selection.bssid);
+    selected_bssid_channel           = selection.channel;
+    db->backhaul.selected_iface_name = selection.sta_iface;
+
     if (!get_wireless_hal()) {
         LOG(ERROR) << "Slave for interface " << db->backhaul.selected_iface_name << " NOT found!";
         return false;
@@ -3494,61 +3422,25 @@ bool backhaul_manager::select_bssid()
 
 void backhaul_manager::get_scan_measurement()
 {
-    // Support up to 256 scan results
-    std::vector<bwl::SScanResult> scan_results;
-
-    LOG(DEBUG) << "get_scan_measurement: SSID = " << m_sConfig.ssid;
     scan_measurement_list.clear();
-    for (auto &soc : slaves_sockets) {
 
-        if (soc->sta_iface.empty()) {
-            LOG(DEBUG) << "skipping empty iface";
-            continue;
-        }
-        if (!soc->sta_wlan_hal) {
-            continue;
-        }
+    for (const auto &entry : m_backhaul_candidates.get_candidates()) {
+        const auto &candidate = entry.second;
 
-        std::string iface = soc->sta_iface;
-        LOG(DEBUG) << "get_scan_measurement: iface  = " << iface;
-        int num_of_results = soc->sta_wlan_hal->get_scan_results(m_sConfig.ssid, scan_results);
-        LOG(DEBUG) << "Scan Results: " << int(num_of_results);
-        if (num_of_results < 0) {
-            LOG(ERROR) << "get_scan_results failed!";
-            return;
-        } else if (num_of_results == 0) {
+        // Skip the candidates not seen in the last scan round
+        if (candidate.observations.empty()) {
             continue;
         }
 
-        for (auto &scan_result : scan_results) {
-
-            auto bssid = tlvf::mac_to_string(scan_result.bssid);
-            LOG(DEBUG) << "get_scan_measurement: bssid = " << bssid
-                       << ", channel = " << int(scan_result.channel) << " iface = " << iface;
+        auto bssid = tlvf::mac_to_string(candidate.bssid);
+        LOG(DEBUG) << "insert scan to list bssid = " << bssid
+                   << " channel = " << int(candidate.channel) << " rssi = " << candidate.rssi;
 
-            auto it = scan_measurement_list.find(bssid);
-            if (it != scan_measurement_list.end()) {
-                //updating rssi if stronger
-                if (scan_result.rssi > it->second.rssi) {
-                    LOG(DEBUG) << "updating scan rssi for bssid = " << bssid
-                               << " channel = " << int(scan_result.channel)
-                               << " rssi = " << int(it->second.rssi) << " to -> "
-                               << int(scan_result.rssi);
-                    it->second.rssi = scan_result.rssi;
-                }
-            } else {
-                //insert new entry
-                sScanResult scan_measurement;
-
-                std::copy_n(scan_result.bssid.oct, MAC_ADDR_LEN, scan_measurement.mac.oct);
-                scan_measurement.channel     = scan_result.channel;
-                scan_measurement.rssi        = scan_result.rssi;
-                scan_measurement_list[bssid] = scan_measurement;
-                LOG(DEBUG) << "insert scan to list bssid = " << bssid
-                           << " channel = " << int(scan_result.channel)
-                           << " rssi = " << int(scan_result.rssi);
-            }
-        }
+        sScanResult scan_measurement;
+        scan_measurement.mac         = candidate.bssid;
+        scan_measurement.channel     = candidate.channel;
+        scan_measurement.rssi        = candidate.rssi;
+        scan_measurement_list[bssid] = scan_measurement;
     }
 }
 
@@ -3569,14 +3461,14 @@ std::shared_ptr<bwl::sta_wlan_hal> backhaul_manager::get_wireless_hal(std::strin
 }
 
 std::unique_ptr<link_metrics_collector>
-backhaul_manager::create_link_metrics_collector(const sLinkInterface &link_interface) const
+backhaul_manager::create_link_metrics_collector(const sLinkInterface &link_interface)
 {
     ieee1905_1::eMediaType media_type = link_interface.media_type;
     ieee1905_1::eMediaTypeGroup media_type_group =
         static_cast<ieee1905_1::eMediaTypeGroup>(media_type >> 8);
 
     if (ieee1905_1::eMediaTypeGroup::IEEE_802_3 == media_type_group) {
-        return std::make_unique<ieee802_3_link_metrics_collector>();
+        return std::make_unique<ieee802_3_link_metrics_collector>(m_iface_stats_cache);
     }
 
     if (ieee1905_1::eMediaTypeGroup::IEEE_802_11 == media_type_group) {
@@ -3601,9 +3493,11 @@ bool backhaul_manager::get_neighbor_links(
     // address of the transmitting device together with the interface that such message is
     // received through.
     sLinkInterface wired_interface;
-    auto db = AgentDB::get();
 
-    wired_interface.iface_name = db->ethernet.iface_name;
+    // Called periodically by the link metrics sampler, so the database is not locked.
+    auto config = AgentDB::get_config_snapshot();
+
+    wired_interface.iface_name = config->ethernet.iface_name;
 
     if (!MediaType::get_media_type(wired_interface.iface_name,
                                    ieee1905_1::eMediaTypeGroup::IEEE_802_3,
@@ -3612,66 +3506,134 @@ bool backhaul_manager::get_neighbor_links(
         return false;
     }
 
-    if (!get_iface_mac(wired_interface.iface_name, wired_interface.iface_mac)) {
+    if (!m_iface_registry.get_mac(wired_interface.iface_name, wired_interface.iface_mac)) {
+        LOG(ERROR) << "Failed getting MAC address for interface: " << wired_interface.iface_name;
         return false;
     }
 
-    for (const auto &neighbors_on_local_iface : db->neighbor_devices) {
-        auto &neighbors = neighbors_on_local_iface.second;
-        for (const auto &neighbor_entry : neighbors) {
-            sLinkNeighbor neighbor;
-            neighbor.al_mac    = neighbor_entry.first;
-            neighbor.iface_mac = neighbor_entry.second.transmitting_iface_mac;
-            if ((neighbor_mac_filter == network_utils::ZERO_MAC) ||
-                (neighbor_mac_filter == neighbor.al_mac)) {
-                neighbor_links_map[wired_interface].push_back(neighbor);
+    {
+        auto neighbor_devices = AgentDB::get_neighbor_devices();
+        for (const auto &neighbors_on_local_iface : *neighbor_devices) {
+            auto &neighbors = neighbors_on_local_iface.second;
+            for (const auto &neighbor_entry : neighbors) {
+                sLinkNeighbor neighbor;
+                neighbor.al_mac    = neighbor_entry.first;
+                neighbor.iface_mac = neighbor_entry.second.transmitting_iface_mac;
+                if ((neighbor_mac_filter == network_utils::ZERO_MAC) ||
+                    (neighbor_mac_filter == neighbor.al_mac)) {
+                    neighbor_links_map[wired_interface].push_back(neighbor);
+                }
             }
         }
     }
 
     // Also include a link for each associated client
-    for (const auto radio : db->get_radios_list()) {
-        if (!radio) {
+    auto associated_clients = AgentDB::get_associated_clients();
+    for (const auto &associated_client : *associated_clients) {
+        auto &bssid = associated_client.second.bssid;
+
+        auto radio = std::find_if(
+            config->radios.begin(), config->radios.end(), [&](const AgentDB::sRadio &radio_entry) {
+                auto &bssids = radio_entry.front.bssids;
+                return std::find_if(bssids.begin(), bssids.end(),
+                                    [&](const AgentDB::sRadio::sFront::sBssid &radio_bssid) {
+                                        return radio_bssid.mac == bssid;
+                                    }) != bssids.end();
+            });
+        if (radio == config->radios.end()) {
             continue;
         }
 
-        for (const auto &associated_client : radio->associated_clients) {
-            auto &bssid = associated_client.second.bssid;
+        sLinkInterface interface;
+        if (!get_iface_name(bssid, interface.iface_name)) {
+            LOG(ERROR) << "Unable to get interface name for BSSID " << bssid;
+            return false;
+        }
 
-            sLinkInterface interface;
-            if (!get_iface_name(bssid, interface.iface_name)) {
-                LOG(ERROR) << "Unable to get interface name for BSSID " << bssid;
-                return false;
-            }
+        interface.iface_mac  = bssid;
+        interface.media_type = MediaType::get_802_11_media_type(radio->front.freq_type,
+                                                                radio->front.max_supported_bw);
 
-            interface.iface_mac  = bssid;
-            interface.media_type = MediaType::get_802_11_media_type(radio->front.freq_type,
-                                                                    radio->front.max_supported_bw);
+        if (ieee1905_1::eMediaType::UNKNOWN_MEDIA == interface.media_type) {
+            LOG(ERROR) << "Unknown media type for interface " << interface.iface_name;
+            return false;
+        }
 
-            if (ieee1905_1::eMediaType::UNKNOWN_MEDIA == interface.media_type) {
-                LOG(ERROR) << "Unknown media type for interface " << interface.iface_name;
-                return false;
-            }
+        LOG(TRACE) << "Getting neighbors connected to interface " << interface.iface_name
+                   << " with BSSID " << bssid;
+
+        // TODO: This is not correct... We actually have to get this from the topology
+        // discovery message, which will give us the neighbor interface and AL MAC addresses.
+        sLinkNeighbor neighbor;
+        neighbor.iface_mac = associated_client.first;
+        neighbor.al_mac    = neighbor.iface_mac;
+
+        if ((neighbor_mac_filter == network_utils::ZERO_MAC) ||
+            (neighbor_mac_filter == neighbor.al_mac)) {
+            neighbor_links_map[interface].push_back(neighbor);
+        }
+    }
+
+    return true;
+}
+
+bool backhaul_manager::sample_link_metrics()
+{
+    std::map<sLinkInterface, std::vector<sLinkNeighbor>> neighbor_links_map;
+    if (!get_neighbor_links(network_utils::ZERO_MAC, neighbor_links_map)) {
+        LOG(ERROR) << "Failed to get the list of neighbor links";
+        return false;
+    }
 
-            LOG(TRACE) << "Getting neighbors connected to interface " << interface.iface_name
-                       << " with BSSID " << bssid;
+    auto now = std::chrono::steady_clock::now();
 
-            // TODO: This is not correct... We actually have to get this from the topology
-            // discovery message, which will give us the neighbor interface and AL MAC addresses.
-            sLinkNeighbor neighbor;
-            neighbor.iface_mac = associated_client.first;
-            neighbor.al_mac    = neighbor.iface_mac;
+    for (const auto &entry : neighbor_links_map) {
+        const auto &interface = entry.first;
+        const auto &neighbors = entry.second;
 
-            if ((neighbor_mac_filter == network_utils::ZERO_MAC) ||
-                (neighbor_mac_filter == neighbor.al_mac)) {
-                neighbor_links_map[interface].push_back(neighbor);
+        std::unique_ptr<link_metrics_collector> collector =
+            create_link_metrics_collector(interface);
+        if (!collector) {
+            continue;
+        }
+
+        for (const auto &neighbor : neighbors) {
+            sLinkMetrics link_metrics;
+            if (!collector->get_link_metrics(interface.iface_name, neighbor.iface_mac,
+                                             link_metrics)) {
+                LOG(WARNING) << "Unable to sample link metrics for interface "
+                             << interface.iface_name << " and neighbor " << neighbor.iface_mac;
+                continue;
             }
+
+            m_link_metrics_cache.update(interface.iface_name, neighbor.iface_mac, link_metrics,
+                                        now);
         }
     }
 
+    m_link_metrics_cache.remove_older_than(now -
+                                           3 * link_metrics_sampling_info.sampling_interval);
+
     return true;
 }
 
+void backhaul_manager::log_db_lock_stats()
+{
+    auto stats = AgentDB::get_lock_stats();
+
+    auto log_counters = [](const std::string &name, const AgentDB::sLockCounters &counters) {
+        LOG(DEBUG) << "AgentDB " << name << " lock: acquisitions=" << counters.acquisitions
+                   << ", contentions=" << counters.contentions
+                   << ", wait_time_us=" << counters.wait_time_us;
+    };
+
+    log_counters("database", stats.db);
+    log_counters("associated clients", stats.associated_clients);
+    log_counters("neighbor devices", stats.neighbor_devices);
+    LOG(DEBUG) << "AgentDB configuration snapshot: reads=" << stats.config_snapshot_reads
+               << ", publications=" << stats.config_snapshot_publications;
+}
+
 bool backhaul_manager::add_ap_ht_capabilities(const sRadioInfo &radio_info)
 {
     if (!radio_info.ht_supported) {
@@ -4033,9 +3995,11 @@ bool backhaul_manager::create_backhaul_steering_response(
         return false;
     }
 
-    sMacAddr sta_mac;
-    auto interface = active_hal->get_iface_name();
-    get_iface_mac(interface, sta_mac);
+    sMacAddr sta_mac = network_utils::ZERO_MAC;
+    auto interface   = active_hal->get_iface_name();
+    if (!m_iface_registry.get_mac(interface, sta_mac)) {
+        LOG(ERROR) << "Failed getting MAC address for interface: " << interface;
+    }
 
     LOG(DEBUG) << "Interface: " << interface << "MAC: " << sta_mac;
 
@@ -4125,4 +4089,38 @@ std::shared_ptr<bwl::sta_wlan_hal> backhaul_manager::get_selected_backhaul_sta_w
     return (*selected_backhaul_it)->sta_wlan_hal;
 }
 
+void backhaul_manager::handle_interface_change(const net::InterfaceRegistry::sInterface &iface,
+                                               net::InterfaceRegistry::eChangeType change_type,
+                                               uint32_t previous_master_index)
+{
+    auto db = AgentDB::get();
+
+    // Only the bridge, its members (including a port which has just left it) and the wired
+    // interface are of interest
+    auto bridge        = m_iface_registry.get_interface(db->bridge.iface_name);
+    bool bridge_member = bridge && (iface.master_index == bridge->index ||
+                                    previous_master_index == bridge->index);
+    if (!bridge_member && iface.name != db->bridge.iface_name &&
+        iface.name != db->ethernet.iface_name) {
+        return;
+    }
+
+    LOG(DEBUG) << "Interface " << iface.name << " changed, change_type=" << int(change_type)
+               << ", flags=0x" << std::hex << iface.flags;
+
+    if (iface.name == db->ethernet.iface_name) {
+        bool eth_link_up = (change_type != net::InterfaceRegistry::eChangeType::Removed) &&
+                           iface.is_up_and_running();
+        if (eth_link_up != m_eth_link_up) {
+            LOG(INFO) << "Wired interface " << iface.name << " is "
+                      << (eth_link_up ? "up" : "down");
+            m_eth_link_up = eth_link_up;
+        }
+    }
+
+    // The Topology Response message reports the state and MAC address of the local interfaces
+    m_task_pool.send_event(eTaskType::TOPOLOGY,
+                           TopologyTask::eEvent::AGENT_INTERFACE_STATE_CHANGED);
+}
+
 } // namespace beerocks
@@ -16,6 +16,8 @@
 #include <bcl/beerocks_config_file.h>
 #include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_socket_thread.h>
+#include <bcl/network/interface_registry.h>
+#include <bcl/network/interface_stats_cache.h>
 #include <bcl/network/network_utils.h>
 #include <btl/btl.h>
 #include <bwl/sta_wlan_hal.h>
@@ -33,6 +35,8 @@
 
 #include "../agent_ucc_listener.h"
 #include "../link_metrics/link_metrics.h"
+#include "../link_metrics/link_metrics_cache.h"
+#include "backhaul_candidates.h"
 
 #include <future>
 #include <list>
@@ -72,6 +76,12 @@ public:
      */
     bool start_wps_pbc(const sMacAddr &radio_mac);
 
+    /**
+     * @brief Gets the registry of the local network interfaces, kept up to date by the kernel
+     * events processed in this thread.
+     */
+    const net::InterfaceRegistry &get_interface_registry() const { return m_iface_registry; }
+
 private:
     // Forward declaration
     struct sRadioInfo;
@@ -156,6 +166,7 @@ private:
     bool hal_event_handler(bwl::base_wlan_hal::hal_event_ptr_t event_ptr, std::string iface);
 
     bool is_eth_link_up();
+    void update_backhaul_candidates();
     void get_scan_measurement();
     bool select_bssid();
     void platform_notify_error(bpl::eErrorCode code, const std::string &error_data);
@@ -208,12 +219,16 @@ private:
     int stop_on_failure_attempts;
     bool onboarding = true;
 
-    //backlist bssid and timers (remove con(or wrong passphrase) ap from select bssid for limited time )
-    struct ap_blacklist_entry {
-        std::chrono::steady_clock::time_point timestamp;
-        int attempts = 0;
-    };
-    std::unordered_map<std::string, ap_blacklist_entry> ap_blacklist;
+    /**
+     * Candidate BSSIDs for the wireless backhaul, merged from the scan results of all the STA
+     * interfaces, and blacklist of the BSSIDs which failed to connect.
+     */
+    backhaul_candidates m_backhaul_candidates;
+
+    /**
+     * Scan results buffer, reused for each STA interface.
+     */
+    std::vector<bwl::SScanResult> m_scan_results;
 
     wan_monitor wan_mon;
 
@@ -221,30 +236,30 @@ private:
     std::future<int> m_ftDHCPRetCode;
 
     // state switch mechanism
-    const int SELECT_TIMEOUT_MSC                      = 500;
-    const int DEVICE_QUERY_RESPONSE_TIMEOUT_SECONDS   = 3;
-    const int WAIT_FOR_SCAN_RESULTS_TIMEOUT_SECONDS   = 20;
-    const int WPA_ATTACH_TIMEOUT_SECONDS              = 5;
-    const int CONNECTING_TO_MASTER_TIMEOUT_SECONDS    = 30;
-    const int MAX_FAILED_SCAN_ATTEMPTS                = 3;
-    const int MAX_FAILED_ROAM_SCAN_ATTEMPTS           = 4;
-    const int MAX_FAILED_DHCP_ATTEMPTS                = 2;
-    const int MAX_WIRELESS_ASSOCIATE_TIMEOUT_SECONDS  = 10;
-    const int MAX_WIRELESS_ASSOCIATE_3ADDR_ATTEMPTS   = 2;
-    const int POLL_TIMER_TIMEOUT_MS                   = 1000;
-    const int WIRELESS_WAIT_FOR_RECONNECT_TIMEOUT     = 2;
-    const int RSSI_POLL_INTERVAL_MS                   = 1000;
-    const int STATE_WAIT_ENABLE_TIMEOUT_SECONDS       = 600;
-    const int STATE_WAIT_WPS_TIMEOUT_SECONDS          = 600;
-    const int AP_BLACK_LIST_TIMEOUT_SECONDS           = 120;
-    const int AP_BLACK_LIST_FAILED_ATTEMPTS_THRESHOLD = 2;
-    const int INTERFACE_BRING_UP_TIMEOUT_SECONDS      = 600;
-    const int DEAUTH_REASON_PASSPHRASE_MISMACH        = 2;
-    const int AUTOCONFIG_DISCOVERY_TIMEOUT_SECONDS    = 1;
-    const int MAX_FAILED_AUTOCONFIG_SEARCH_ATTEMPTS   = 20;
+    const int SELECT_TIMEOUT_MSC                     = 500;
+    const int DEVICE_QUERY_RESPONSE_TIMEOUT_SECONDS  = 3;
+    const int WAIT_FOR_SCAN_RESULTS_TIMEOUT_SECONDS  = 20;
+    const int WPA_ATTACH_TIMEOUT_SECONDS             = 5;
+    const int CONNECTING_TO_MASTER_TIMEOUT_SECONDS   = 30;
+    const int MAX_FAILED_SCAN_ATTEMPTS               = 3;
+    const int MAX_FAILED_ROAM_SCAN_ATTEMPTS          = 4;
+    const int MAX_FAILED_DHCP_ATTEMPTS               = 2;
+    const int MAX_WIRELESS_ASSOCIATE_TIMEOUT_SECONDS = 10;
+    const int MAX_WIRELESS_ASSOCIATE_3ADDR_ATTEMPTS  = 2;
+    const int WIRELESS_WAIT_FOR_RECONNECT_TIMEOUT    = 2;
+    const int RSSI_POLL_INTERVAL_MS                  = 1000;
+    const int STATE_WAIT_ENABLE_TIMEOUT_SECONDS      = 600;
+    const int STATE_WAIT_WPS_TIMEOUT_SECONDS         = 600;
+    const int INTERFACE_BRING_UP_TIMEOUT_SECONDS     = 600;
+    const int DEAUTH_REASON_PASSPHRASE_MISMACH       = 2;
+    const int AUTOCONFIG_DISCOVERY_TIMEOUT_SECONDS   = 1;
+    const int MAX_FAILED_AUTOCONFIG_SEARCH_ATTEMPTS  = 20;
     const int DISCOVERY_NEIGHBOUR_REMOVAL_TIMEOUT =
         ieee1905_1_consts::DISCOVERY_NOTIFICATION_TIMEOUT_SEC + 3; // 3 seconds grace period
 
+    const int DEFAULT_LINK_METRICS_SAMPLING_INTERVAL_MS = 1000;
+    const int DB_LOCK_STATS_INTERVAL_SECONDS            = 60;
+
     std::chrono::steady_clock::time_point state_time_stamp_timeout;
     int state_attempts;
 
@@ -257,11 +272,7 @@ private:
     bool roam_flag = false;
     std::unordered_map<std::string, net::sScanResult> scan_measurement_list;
 
-    const int RSSI_THRESHOLD_5GHZ       = -80;
-    const int RSSI_BAND_DELTA_THRESHOLD = 5;
-
     std::chrono::steady_clock::time_point rssi_poll_timer;
-    std::chrono::steady_clock::time_point eth_link_poll_timer;
     bool m_eth_link_up  = false;
     bool pending_enable = false;
 
@@ -273,6 +284,30 @@ private:
 
     TaskPool m_task_pool;
 
+    /**
+     * Statistics of the local interfaces, shared by the link metrics collectors of the Ethernet
+     * interfaces.
+     */
+    net::InterfaceStatsCache m_iface_stats_cache;
+
+    /**
+     * State of the local interfaces (flags, MAC address, bridge membership), updated from the
+     * kernel interface events instead of polled.
+     */
+    net::InterfaceRegistry m_iface_registry;
+    Socket *m_iface_registry_socket = nullptr;
+
+    /**
+     * @brief Handles a change of a local interface reported by the interface registry.
+     *
+     * @param iface Interface information after the change.
+     * @param change_type Type of change.
+     * @param previous_master_index Index of the master of the interface before the change.
+     */
+    void handle_interface_change(const net::InterfaceRegistry::sInterface &iface,
+                                 net::InterfaceRegistry::eChangeType change_type,
+                                 uint32_t previous_master_index);
+
     /**
      * AP Metrics Reporting configuration and status information type.
      */
@@ -295,6 +330,37 @@ private:
      */
     sApMetricsReportingInfo ap_metrics_reporting_info;
 
+    /**
+     * Link metrics sampling configuration and status information type.
+     */
+    struct sLinkMetricsSamplingInfo {
+        /**
+         * Link metrics sampling interval (0: do not sample link metrics periodically, but collect
+         * them on each Link Metric Query message). This value comes from the configuration file.
+         */
+        std::chrono::milliseconds sampling_interval{0};
+
+        /**
+         * Time point at which link metrics were sampled for the last time.
+         */
+        std::chrono::steady_clock::time_point last_sampling_time_point;
+    };
+
+    /**
+     * Link metrics sampling configuration and status information.
+     */
+    sLinkMetricsSamplingInfo link_metrics_sampling_info;
+
+    /**
+     * Link metrics of the links to the neighbors, as sampled periodically.
+     */
+    link_metrics_cache m_link_metrics_cache;
+
+    /**
+     * Time point at which the AgentDB lock statistics were logged for the last time.
+     */
+    std::chrono::steady_clock::time_point m_db_lock_stats_time_point;
+
     /**
      * @brief Information gathered about a radio (= slave).
      *
@@ -376,7 +442,7 @@ private:
      * @return Link metrics collector on success and nullptr otherwise.
      */
     std::unique_ptr<link_metrics_collector>
-    create_link_metrics_collector(const sLinkInterface &link_interface) const;
+    create_link_metrics_collector(const sLinkInterface &link_interface);
 
     /**
      * @brief Gets the list of neighbors connected to this device (from topology database).
@@ -395,6 +461,22 @@ private:
     get_neighbor_links(const sMacAddr &neighbor_mac_filter,
                        std::map<sLinkInterface, std::vector<sLinkNeighbor>> &neighbor_links_map);
 
+    /**
+     * @brief Samples the link metrics of the links to all the neighbors into the link metrics
+     * cache.
+     *
+     * Links which have not been sampled for a few sampling intervals (e.g. links to neighbors
+     * which are gone) are removed from the cache.
+     *
+     * @return True on success and false otherwise.
+     */
+    bool sample_link_metrics();
+
+    /**
+     * @brief Logs the lock contention statistics of the AgentDB.
+     */
+    void log_db_lock_stats();
+
     /**
      * @brief Adds an AP HT Capabilities TLV to AP Capability Report message.
      *
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "backhaul_candidates.h"
+
+#include <gtest/gtest.h>
+
+using namespace beerocks;
+
+namespace {
+
+const auto bssid_1 = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+const auto bssid_2 = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+
+const uint8_t channel_24      = 6;
+const uint8_t channel_5_low   = 36;
+const uint8_t channel_5_high  = 149;
+const std::string sta_iface_1 = "wlan1";
+const std::string sta_iface_2 = "wlan3";
+
+bwl::SScanResult scan_result(const sMacAddr &bssid, uint8_t channel, int8_t rssi)
+{
+    bwl::SScanResult result;
+    result.bssid   = bssid;
+    result.channel = channel;
+    result.rssi    = rssi;
+    return result;
+}
+
+TEST(backhaul_candidates_test, scan_results_of_all_interfaces_should_be_merged)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_1, channel_24, -60)});
+    candidates.add_scan_results(sta_iface_2, false, {scan_result(bssid_1, channel_24, -50)});
+
+    ASSERT_EQ(candidates.get_candidates().size(), 1U);
+    const auto &candidate = candidates.get_candidates().at(bssid_1);
+    EXPECT_EQ(candidate.observations.size(), 2U);
+    EXPECT_EQ(candidate.rssi, -50);
+
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_1);
+    EXPECT_EQ(selection.channel, channel_24);
+    EXPECT_EQ(selection.sta_iface, sta_iface_2);
+    EXPECT_EQ(selection.rssi, -50);
+}
+
+TEST(backhaul_candidates_test, select_without_scan_results_should_fail)
+{
+    backhaul_candidates candidates;
+    candidates.start_scan_round();
+
+    backhaul_candidates::sSelection selection;
+    EXPECT_FALSE(candidates.select(selection));
+    EXPECT_FALSE(candidates.get_candidate(bssid_1, selection));
+}
+
+TEST(backhaul_candidates_test, 5ghz_above_threshold_should_be_preferred)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false,
+                                {scan_result(bssid_1, channel_24, -40),
+                                 scan_result(bssid_2, channel_5_high, -70)});
+
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_2);
+}
+
+TEST(backhaul_candidates_test, weak_5ghz_should_be_preferred_within_band_delta)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false,
+                                {scan_result(bssid_1, channel_24, -60),
+                                 scan_result(bssid_2, channel_5_high, -85)});
+
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_1);
+
+    backhaul_candidates other_candidates;
+
+    other_candidates.start_scan_round();
+    other_candidates.add_scan_results(sta_iface_1, false,
+                                      {scan_result(bssid_1, channel_24, -84),
+                                       scan_result(bssid_2, channel_5_high, -85)});
+
+    ASSERT_TRUE(other_candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_2);
+}
+
+TEST(backhaul_candidates_test, interface_matching_the_subband_should_be_preferred)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, true, {scan_result(bssid_1, channel_5_high, -50),
+                                                    scan_result(bssid_2, channel_5_low, -70)});
+    candidates.add_scan_results(sta_iface_2, false, {scan_result(bssid_1, channel_5_high, -55),
+                                                     scan_result(bssid_2, channel_5_low, -60)});
+
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.get_candidate(bssid_1, selection));
+    EXPECT_EQ(selection.sta_iface, sta_iface_2);
+
+    ASSERT_TRUE(candidates.get_candidate(bssid_2, selection));
+    EXPECT_EQ(selection.sta_iface, sta_iface_2);
+}
+
+TEST(backhaul_candidates_test, blacklisted_bssid_should_be_skipped)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_1, channel_24, -40),
+                                                     scan_result(bssid_2, channel_24, -60)});
+
+    EXPECT_EQ(candidates.add_failed_attempt(bssid_1), 1);
+    EXPECT_FALSE(candidates.is_blacklisted(bssid_1));
+
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_1);
+
+    EXPECT_EQ(candidates.add_failed_attempt(bssid_1), 2);
+    EXPECT_TRUE(candidates.is_blacklisted(bssid_1));
+    EXPECT_FALSE(candidates.get_candidate(bssid_1, selection));
+
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_2);
+
+    candidates.blacklist(bssid_2);
+    EXPECT_FALSE(candidates.select(selection));
+
+    candidates.clear_blacklist();
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_1);
+}
+
+TEST(backhaul_candidates_test, rssi_history_should_smooth_the_selection)
+{
+    backhaul_candidates candidates(0.5);
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_1, channel_24, -50)});
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_1, channel_24, -70),
+                                                     scan_result(bssid_2, channel_24, -62)});
+
+    // Average RSSI of bssid_1 is -60, better than the -62 of bssid_2
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_1);
+    EXPECT_EQ(selection.score, -60);
+}
+
+TEST(backhaul_candidates_test, missing_bssid_should_not_be_selected_and_expire)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_1, channel_24, -40)});
+
+    for (uint32_t i = 0; i <= backhaul_candidates::MAX_MISSED_SCAN_ROUNDS; i++) {
+        candidates.start_scan_round();
+        candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_2, channel_24, -60)});
+
+        backhaul_candidates::sSelection selection;
+        ASSERT_TRUE(candidates.select(selection));
+        EXPECT_EQ(selection.bssid, bssid_2);
+    }
+
+    EXPECT_EQ(candidates.get_candidates().count(bssid_1), 0U);
+    EXPECT_EQ(candidates.get_candidates().count(bssid_2), 1U);
+}
+
+TEST(backhaul_candidates_test, ties_should_be_broken_by_bssid)
+{
+    backhaul_candidates candidates;
+
+    candidates.start_scan_round();
+    candidates.add_scan_results(sta_iface_1, false, {scan_result(bssid_2, channel_24, -50),
+                                                     scan_result(bssid_1, channel_24, -50)});
+
+    backhaul_candidates::sSelection selection;
+    ASSERT_TRUE(candidates.select(selection));
+    EXPECT_EQ(selection.bssid, bssid_1);
+}
+
+} // namespace
@@ -12,6 +12,7 @@
 
 #include <bcl/beerocks_config_file.h>
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_metrics.h>
 #include <bcl/beerocks_utils.h>
 #include <bcl/beerocks_version.h>
 #include <bcl/network/network_utils.h>
@@ -293,6 +294,10 @@ static int run_beerocks_slave(beerocks::config_file::sConfigSlave &beerocks_slav
     std::string pid_file_path =
         beerocks_slave_conf.temp_path + "pid/" + base_agent_name; // for file touching
 
+    // Failing to export the metrics is not fatal
+    beerocks::metrics::start_export(beerocks_slave_conf.temp_path + BEEROCKS_METRICS_UDS +
+                                    base_agent_name);
+
     std::set<std::string> slave_ap_ifaces;
     for (auto &elm : interfaces_map) {
         if (!elm.second.empty()) {
@@ -391,6 +396,8 @@ static int run_beerocks_slave(beerocks::config_file::sConfigSlave &beerocks_slav
     LOG(DEBUG) << "platform_mgr.stop()";
     platform_mgr.stop();
 
+    beerocks::metrics::stop_export();
+
     LOG(DEBUG) << "Bye Bye!";
 
     return 0;
@@ -22,7 +22,7 @@ bool ieee802_3_link_metrics_collector::get_link_metrics(
     [[gnu::unused]] const sMacAddr &neighbor_interface_address, sLinkMetrics &link_metrics)
 {
     net::sInterfaceStats iface_stats;
-    if (!net::network_utils::get_iface_stats(local_interface_name, iface_stats)) {
+    if (!m_iface_stats_cache.get_stats(local_interface_name, iface_stats)) {
         LOG(ERROR) << "Failed getting interface statistics for interface " << local_interface_name;
         return false;
     }
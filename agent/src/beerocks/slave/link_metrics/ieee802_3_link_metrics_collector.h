@@ -10,11 +10,24 @@
 
 #include "link_metrics.h"
 
+#include <bcl/network/interface_stats_cache.h>
+
 namespace beerocks {
 
 class ieee802_3_link_metrics_collector : public link_metrics_collector {
 
 public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param iface_stats_cache Interface statistics cache shared by all the collectors, so the
+     * link metrics of all the interfaces of a query are read from a single Netlink dump.
+     */
+    explicit ieee802_3_link_metrics_collector(net::InterfaceStatsCache &iface_stats_cache)
+        : m_iface_stats_cache(iface_stats_cache)
+    {
+    }
+
     /**
      * @brief Gets link metrics information.
      *
@@ -38,6 +51,9 @@ public:
     virtual bool get_link_metrics(const std::string &local_interface_name,
                                   const sMacAddr &neighbor_interface_address,
                                   sLinkMetrics &link_metrics) override;
+
+private:
+    net::InterfaceStatsCache &m_iface_stats_cache;
 };
 
 } // namespace beerocks
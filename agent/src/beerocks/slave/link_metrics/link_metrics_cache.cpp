@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "link_metrics_cache.h"
+
+namespace beerocks {
+
+constexpr float link_metrics_cache::DEFAULT_EWMA_WEIGHT;
+
+link_metrics_cache::link_metrics_cache(float ewma_weight) : m_ewma_weight(ewma_weight) {}
+
+void link_metrics_cache::update(const std::string &iface_name, const sMacAddr &neighbor_iface_mac,
+                                const sLinkMetrics &sample,
+                                std::chrono::steady_clock::time_point now)
+{
+    auto &entry = m_entries[iface_name][neighbor_iface_mac];
+
+    if (entry.sample_count == 0) {
+        entry.mac_throughput_capacity_mbps = sample.transmitter.mac_throughput_capacity_mbps;
+    } else {
+        entry.mac_throughput_capacity_mbps +=
+            m_ewma_weight * (float(sample.transmitter.mac_throughput_capacity_mbps) -
+                             entry.mac_throughput_capacity_mbps);
+    }
+
+    entry.link_metrics = sample;
+    entry.link_metrics.transmitter.mac_throughput_capacity_mbps =
+        entry.mac_throughput_capacity_mbps + 0.5;
+    entry.sample_time = now;
+    entry.sample_count++;
+}
+
+bool link_metrics_cache::get_link_metrics(const std::string &iface_name,
+                                          const sMacAddr &neighbor_iface_mac,
+                                          std::chrono::steady_clock::duration max_age,
+                                          std::chrono::steady_clock::time_point now,
+                                          sLinkMetrics &link_metrics) const
+{
+    auto entry = get_entry(iface_name, neighbor_iface_mac);
+    if (!entry || now - entry->sample_time > max_age) {
+        return false;
+    }
+
+    link_metrics = entry->link_metrics;
+    return true;
+}
+
+const link_metrics_cache::sEntry *
+link_metrics_cache::get_entry(const std::string &iface_name,
+                              const sMacAddr &neighbor_iface_mac) const
+{
+    auto iface_it = m_entries.find(iface_name);
+    if (iface_it == m_entries.end()) {
+        return nullptr;
+    }
+
+    auto entry_it = iface_it->second.find(neighbor_iface_mac);
+    if (entry_it == iface_it->second.end()) {
+        return nullptr;
+    }
+
+    return &entry_it->second;
+}
+
+void link_metrics_cache::remove_older_than(std::chrono::steady_clock::time_point time)
+{
+    for (auto iface_it = m_entries.begin(); iface_it != m_entries.end();) {
+        auto &entries = iface_it->second;
+        for (auto entry_it = entries.begin(); entry_it != entries.end();) {
+            if (entry_it->second.sample_time < time) {
+                entry_it = entries.erase(entry_it);
+            } else {
+                entry_it++;
+            }
+        }
+
+        if (entries.empty()) {
+            iface_it = m_entries.erase(iface_it);
+        } else {
+            iface_it++;
+        }
+    }
+}
+
+} // namespace beerocks
@@ -0,0 +1,112 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+#ifndef __LINK_METRICS_CACHE_H__
+#define __LINK_METRICS_CACHE_H__
+
+#include "link_metrics.h"
+
+#include <tlvf/tlvftypes.h>
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+namespace beerocks {
+
+/**
+ * @brief Cache of the link metrics of the links to the 1905.1 neighbors.
+ *
+ * The cache is filled by a periodic sampler (see backhaul_manager) using the link metrics
+ * collectors, and read when building Link Metric Response messages, so a burst of link metric
+ * queries (e.g. a controller building the combined infrastructure metrics of a large network) is
+ * served from memory instead of reading the kernel for each neighbor of each query.
+ *
+ * Besides the last sample, the cache keeps an exponentially weighted moving average (EWMA) of the
+ * MAC throughput capacity, which fluctuates between samples. The reported MAC throughput capacity
+ * is the average, while the packet counters and the RSSI are reported as sampled.
+ */
+class link_metrics_cache {
+public:
+    static constexpr float DEFAULT_EWMA_WEIGHT = 0.25;
+
+    /**
+     * @brief Cached link metrics of a link.
+     */
+    struct sEntry {
+        /**
+         * Link metrics of the last sample, with the MAC throughput capacity replaced by its
+         * average.
+         */
+        sLinkMetrics link_metrics;
+
+        float mac_throughput_capacity_mbps = 0; /**< EWMA of the MAC throughput capacity. */
+
+        std::chrono::steady_clock::time_point sample_time; /**< Time of the last sample. */
+        uint32_t sample_count = 0;                         /**< Number of samples taken. */
+    };
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param ewma_weight Weight of a new sample in the moving averages, between 0 and 1.
+     */
+    explicit link_metrics_cache(float ewma_weight = DEFAULT_EWMA_WEIGHT);
+
+    /**
+     * @brief Adds a new sample of the link metrics of a link.
+     *
+     * @param[in] iface_name Name of the local interface.
+     * @param[in] neighbor_iface_mac MAC address of the neighbor's interface.
+     * @param[in] sample Link metrics, as read by a link metrics collector.
+     * @param[in] now Time of the sample.
+     */
+    void update(const std::string &iface_name, const sMacAddr &neighbor_iface_mac,
+                const sLinkMetrics &sample, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Gets the link metrics of a link, if sampled recently enough.
+     *
+     * @param[in] iface_name Name of the local interface.
+     * @param[in] neighbor_iface_mac MAC address of the neighbor's interface.
+     * @param[in] max_age Maximum age of the last sample.
+     * @param[in] now Current time.
+     * @param[out] link_metrics Link metrics information.
+     *
+     * @return True if the link was sampled within max_age and false otherwise.
+     */
+    bool get_link_metrics(const std::string &iface_name, const sMacAddr &neighbor_iface_mac,
+                          std::chrono::steady_clock::duration max_age,
+                          std::chrono::steady_clock::time_point now,
+                          sLinkMetrics &link_metrics) const;
+
+    /**
+     * @brief Gets the cached entry of a link.
+     *
+     * @return The cached entry, or nullptr if the link was never sampled.
+     */
+    const sEntry *get_entry(const std::string &iface_name,
+                            const sMacAddr &neighbor_iface_mac) const;
+
+    /**
+     * @brief Removes the links which were not sampled since the given time (e.g. links to
+     * neighbors which are gone).
+     */
+    void remove_older_than(std::chrono::steady_clock::time_point time);
+
+private:
+    float m_ewma_weight;
+
+    /**
+     * Cached entries, by local interface name and then by neighbor interface MAC address.
+     */
+    std::unordered_map<std::string, std::unordered_map<sMacAddr, sEntry>> m_entries;
+};
+
+} // namespace beerocks
+
+#endif
@@ -0,0 +1,149 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "link_metrics_cache.h"
+
+#include <gtest/gtest.h>
+
+using namespace beerocks;
+
+namespace {
+
+const auto neighbor_1 = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+const auto neighbor_2 = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+
+const std::string iface_1 = "eth0";
+const std::string iface_2 = "wlan0";
+
+const auto sampling_interval = std::chrono::seconds(1);
+
+sLinkMetrics sample(uint16_t mac_throughput_capacity_mbps, uint32_t transmitted_packets = 0,
+                    uint32_t packets_received = 0)
+{
+    sLinkMetrics link_metrics;
+    link_metrics.transmitter.mac_throughput_capacity_mbps = mac_throughput_capacity_mbps;
+    link_metrics.transmitter.transmitted_packets          = transmitted_packets;
+    link_metrics.receiver.packets_received                = packets_received;
+    return link_metrics;
+}
+
+TEST(link_metrics_cache_test, first_sample_should_seed_the_average)
+{
+    link_metrics_cache cache;
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100), now);
+
+    auto entry = cache.get_entry(iface_1, neighbor_1);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->sample_count, 1U);
+    EXPECT_FLOAT_EQ(entry->mac_throughput_capacity_mbps, 100);
+    EXPECT_EQ(entry->link_metrics.transmitter.mac_throughput_capacity_mbps, 100);
+}
+
+TEST(link_metrics_cache_test, average_should_weight_new_samples)
+{
+    link_metrics_cache cache(0.25);
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100), now);
+    cache.update(iface_1, neighbor_1, sample(200), now);
+
+    // 100 + 0.25 * (200 - 100)
+    auto entry = cache.get_entry(iface_1, neighbor_1);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FLOAT_EQ(entry->mac_throughput_capacity_mbps, 125);
+    EXPECT_EQ(entry->link_metrics.transmitter.mac_throughput_capacity_mbps, 125);
+
+    // 125 + 0.25 * (0 - 125), rounded to the nearest integer when reported
+    cache.update(iface_1, neighbor_1, sample(0), now);
+    EXPECT_FLOAT_EQ(entry->mac_throughput_capacity_mbps, 93.75);
+    EXPECT_EQ(entry->link_metrics.transmitter.mac_throughput_capacity_mbps, 94);
+    EXPECT_EQ(entry->sample_count, 3U);
+}
+
+TEST(link_metrics_cache_test, weight_of_one_should_keep_the_last_sample)
+{
+    link_metrics_cache cache(1);
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100), now);
+    cache.update(iface_1, neighbor_1, sample(300), now);
+
+    auto entry = cache.get_entry(iface_1, neighbor_1);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FLOAT_EQ(entry->mac_throughput_capacity_mbps, 300);
+}
+
+TEST(link_metrics_cache_test, counters_should_be_reported_as_sampled)
+{
+    link_metrics_cache cache;
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100, 1000, 2000), now);
+    cache.update(iface_1, neighbor_1, sample(100, 1500, 2600), now);
+    // A counter reset is reported as is
+    cache.update(iface_1, neighbor_1, sample(100, 10, 20), now);
+
+    sLinkMetrics link_metrics;
+    ASSERT_TRUE(
+        cache.get_link_metrics(iface_1, neighbor_1, sampling_interval, now, link_metrics));
+    EXPECT_EQ(link_metrics.transmitter.transmitted_packets, 10U);
+    EXPECT_EQ(link_metrics.receiver.packets_received, 20U);
+}
+
+TEST(link_metrics_cache_test, links_should_be_cached_separately)
+{
+    link_metrics_cache cache(1);
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100), now);
+    cache.update(iface_1, neighbor_2, sample(200), now);
+    cache.update(iface_2, neighbor_1, sample(300), now);
+
+    sLinkMetrics link_metrics;
+    ASSERT_TRUE(
+        cache.get_link_metrics(iface_1, neighbor_2, sampling_interval, now, link_metrics));
+    EXPECT_EQ(link_metrics.transmitter.mac_throughput_capacity_mbps, 200);
+    ASSERT_TRUE(
+        cache.get_link_metrics(iface_2, neighbor_1, sampling_interval, now, link_metrics));
+    EXPECT_EQ(link_metrics.transmitter.mac_throughput_capacity_mbps, 300);
+    EXPECT_EQ(cache.get_entry(iface_2, neighbor_2), nullptr);
+}
+
+TEST(link_metrics_cache_test, old_samples_should_not_be_reported)
+{
+    link_metrics_cache cache;
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100), now);
+
+    sLinkMetrics link_metrics;
+    EXPECT_TRUE(cache.get_link_metrics(iface_1, neighbor_1, sampling_interval,
+                                       now + sampling_interval, link_metrics));
+    EXPECT_FALSE(cache.get_link_metrics(iface_1, neighbor_1, sampling_interval,
+                                        now + 2 * sampling_interval, link_metrics));
+    EXPECT_FALSE(
+        cache.get_link_metrics(iface_2, neighbor_1, sampling_interval, now, link_metrics));
+}
+
+TEST(link_metrics_cache_test, links_not_sampled_should_be_removed)
+{
+    link_metrics_cache cache;
+    auto now = std::chrono::steady_clock::now();
+
+    cache.update(iface_1, neighbor_1, sample(100), now);
+    cache.update(iface_1, neighbor_2, sample(100), now + sampling_interval);
+
+    cache.remove_older_than(now + sampling_interval);
+
+    EXPECT_EQ(cache.get_entry(iface_1, neighbor_1), nullptr);
+    EXPECT_NE(cache.get_entry(iface_1, neighbor_2), nullptr);
+}
+
+} // namespace
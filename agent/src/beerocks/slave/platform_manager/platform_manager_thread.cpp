@@ -38,6 +38,7 @@ static const uint8_t s_arrBCastMac[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
 #define ARP_NOTIF_INTERVAL (90000)                  // 1.5 minutes
 #define ARP_CLEAN_INTERVAL (ARP_NOTIF_INTERVAL * 2) // 2 notif. intervals
+#define ARP_MON_BULK_SIZE (64)                      // ARP monitor entries read at once
 
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// Local Module Functions ///////////////////////////
@@ -1032,21 +1033,30 @@ bool main_thread::handle_cmdu(Socket *sd, ieee1905_1::CmduMessageRx &cmdu_rx)
 
 bool main_thread::handle_arp_monitor()
 {
-    auto arp_notif =
-        message_com::create_vs_message<beerocks_message::cACTION_PLATFORM_ARP_MONITOR_NOTIFICATION>(
-            cmdu_tx);
-    if (arp_notif == nullptr) {
-        LOG(ERROR) << "Failed building message!";
-        return false;
-    }
+    // Process all the entries available on the monitoring socket, resolving the name of each
+    // interface only once
+    bpl::BPL_ARP_MON_ENTRY entries[ARP_MON_BULK_SIZE];
+    std::unordered_map<uint32_t, std::string> iface_names;
+
+    int num_of_entries;
+    do {
+        num_of_entries = bpl::arp_mon_process(m_ctxArpMon, entries, ARP_MON_BULK_SIZE);
+        if (num_of_entries < 0) {
+            LOG(ERROR) << "Failed processing ARP monitor message!";
+            return false;
+        }
 
-    // Process the message
-    bpl::BPL_ARP_MON_ENTRY entry;
-    if (bpl::arp_mon_process(m_ctxArpMon, &entry) != 0) {
-        LOG(ERROR) << "Failed processing ARP monitor message!";
-        return (false);
-    }
+        for (int i = 0; i < num_of_entries; i++) {
+            handle_arp_monitor_entry(entries[i], iface_names);
+        }
+    } while (num_of_entries == ARP_MON_BULK_SIZE);
 
+    return true;
+}
+
+bool main_thread::handle_arp_monitor_entry(bpl::BPL_ARP_MON_ENTRY &entry,
+                                           std::unordered_map<uint32_t, std::string> &iface_names)
+{
     // Ignore IPs outside the monitored network, zeroed MACs or invalid state
     if (((network_utils::uint_ipv4_from_array(entry.ip) & m_uiArpMonMask) !=
          (m_uiArpMonIP & m_uiArpMonMask)) ||
@@ -1063,6 +1073,14 @@ bool main_thread::handle_arp_monitor()
         return true;
     }
 
+    auto arp_notif =
+        message_com::create_vs_message<beerocks_message::cACTION_PLATFORM_ARP_MONITOR_NOTIFICATION>(
+            cmdu_tx);
+    if (arp_notif == nullptr) {
+        LOG(ERROR) << "Failed building message!";
+        return false;
+    }
+
     // Copy entry values
     std::copy_n(entry.mac, sizeof(sMacAddr::oct), arp_notif->params().mac.oct);
     std::copy_n(entry.ip, sizeof(sIpv4Addr::oct), arp_notif->params().ipv4.oct);
@@ -1078,7 +1096,13 @@ bool main_thread::handle_arp_monitor()
     Socket *sd       = nullptr;
     auto iIfaceIndex = arp_notif->params().iface_idx;
 
-    auto iface_name = network_utils::linux_get_iface_name(iIfaceIndex);
+    auto iface_name_it = iface_names.find(iIfaceIndex);
+    if (iface_name_it == iface_names.end()) {
+        iface_name_it =
+            iface_names.emplace(iIfaceIndex, network_utils::linux_get_iface_name(iIfaceIndex))
+                .first;
+    }
+    auto &iface_name = iface_name_it->second;
 
     if (iface_name.empty()) {
         LOG(ERROR) << "Failed to find iface of iface_index" << int(iIfaceIndex);
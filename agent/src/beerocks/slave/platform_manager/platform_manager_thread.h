@@ -65,6 +65,16 @@ protected:
     bool handle_arp_monitor();
     bool handle_arp_raw();
 
+    /**
+     * @brief Handles an entry read from the ARP monitor, notifying the slave about the client.
+     *
+     * @param entry ARP monitor entry.
+     * @param iface_names Names of the interfaces resolved so far, by interface index.
+     * @return True on success and false otherwise.
+     */
+    bool handle_arp_monitor_entry(bpl::BPL_ARP_MON_ENTRY &entry,
+                                  std::unordered_map<uint32_t, std::string> &iface_names);
+
 private:
     void add_slave_socket(Socket *sd, const std::string &iface_name);
     void del_slave_socket(Socket *sd);
@@ -24,6 +24,7 @@
 #include <beerocks/tlvf/beerocks_message_control.h>
 #include <beerocks/tlvf/beerocks_message_monitor.h>
 #include <beerocks/tlvf/beerocks_message_platform.h>
+#include <beerocks/tlvf/beerocks_stats_record.h>
 
 #include <tlvf/WSC/AttrList.h>
 #include <tlvf/ieee_1905_1/tlvAlMacAddress.h>
@@ -164,6 +165,7 @@ void slave_thread::slave_reset()
     }
     // Clear the front interface mac.
     radio->front.iface_mac = network_utils::ZERO_MAC;
+    AgentDB::increment_topology_generation();
 
     if (configuration_stop_on_failure_attempts && !stop_on_failure_attempts) {
         LOG(ERROR) << "Reached to max stop on failure attempts!";
@@ -246,6 +248,15 @@ bool slave_thread::socket_disconnected(Socket *sd)
     return true;
 }
 
+void slave_thread::after_select(bool timeout)
+{
+    // The eventfd of the ring is not a socket, handle it before the socket_thread reads from it
+    if (m_stats_ring_socket && read_ready(m_stats_ring_socket)) {
+        clear_ready(m_stats_ring_socket);
+        handle_stats_ring();
+    }
+}
+
 std::string slave_thread::print_cmdu_types(const message::sUdsHeader *cmdu_header)
 {
     return message_com::print_cmdu_types(cmdu_header);
@@ -1528,6 +1539,7 @@ bool slave_thread::handle_cmdu_ap_manager_message(Socket *sd,
 
         radio->front.iface_mac = hostap_params.iface_mac;
         hostap_cs_params       = notification->cs_params();
+        AgentDB::increment_topology_generation();
 
         auto tuple_preferred_channels = notification->preferred_channels(0);
         if (!std::get<0>(tuple_preferred_channels)) {
@@ -1674,6 +1686,7 @@ bool slave_thread::handle_cmdu_ap_manager_message(Socket *sd,
                                                     ? AgentDB::sRadio::sFront::sBssid::eType::bAP
                                                     : AgentDB::sRadio::sFront::sBssid::eType::fAP;
         }
+        AgentDB::increment_topology_generation();
 
         auto notification_out = message_com::create_vs_message<
             beerocks_message::cACTION_CONTROL_HOSTAP_VAPS_LIST_UPDATE_NOTIFICATION>(cmdu_tx);
@@ -1815,8 +1828,7 @@ bool slave_thread::handle_cmdu_ap_manager_message(Socket *sd,
         }
 
         // If exists, remove client association information for disconnected client.
-        auto db = AgentDB::get();
-        db->erase_client(client_mac, bssid);
+        AgentDB::erase_client(client_mac, bssid);
 
         // build 1905.1 message CMDU to send to the controller
         if (!cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_NOTIFICATION_MESSAGE)) {
@@ -1987,19 +1999,18 @@ bool slave_thread::handle_cmdu_ap_manager_message(Socket *sd,
         }
 
         // Save information AgentDB
-        auto db = AgentDB::get();
-        db->erase_client(client_mac);
+        AgentDB::erase_client(client_mac);
 
         // Set client association information for associated client
-        auto radio = db->get_radio_by_mac(bssid, AgentDB::eMacType::BSSID);
-        if (!radio) {
+        if (!AgentDB::get()->get_radio_by_mac(bssid, AgentDB::eMacType::BSSID)) {
             LOG(DEBUG) << "Radio containing bssid " << bssid << " not found";
             break;
         }
 
-        radio->associated_clients.emplace(
-            client_mac, AgentDB::sRadio::sClient{bssid, notification_in->association_frame_length(),
-                                                 notification_in->association_frame()});
+        AgentDB::get_associated_clients()->emplace(
+            client_mac, AgentDB::sClient{bssid, notification_in->association_frame_length(),
+                                         notification_in->association_frame()});
+        AgentDB::increment_topology_generation();
 
         // build 1905.1 message CMDU to send to the controller
         if (!cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_NOTIFICATION_MESSAGE)) {
@@ -2256,6 +2267,7 @@ bool slave_thread::handle_cmdu_monitor_message(Socket *sd,
         }
 
         monitor_socket = sd;
+        stats_ring_attach(*sd);
         break;
     }
     case beerocks_message::ACTION_MONITOR_HOSTAP_AP_DISABLED_NOTIFICATION: {
@@ -3127,6 +3139,7 @@ bool slave_thread::slave_fsm(bool &call_slave_select)
 
         radio->front.freq_type        = hostap_params.frequency_band;
         radio->front.max_supported_bw = hostap_params.max_bandwidth;
+        AgentDB::increment_topology_generation();
 
         bh_enable->ht_supported()  = hostap_params.ht_supported;
         bh_enable->ht_capability() = hostap_params.ht_capability;
@@ -3472,6 +3485,8 @@ void slave_thread::fronthaul_stop()
 {
     LOG(INFO) << "fronthaul stop";
 
+    stats_ring_detach();
+
     if (monitor_socket) {
         remove_socket(monitor_socket);
         delete monitor_socket;
@@ -4815,3 +4830,139 @@ bool slave_thread::autoconfig_wsc_add_m1()
     std::copy_n(attributes->buffer(), m1_auth_buf_len, m1_auth_buf);
     return true;
 }
+
+void slave_thread::stats_ring_attach(Socket &sd)
+{
+    stats_ring_detach();
+
+    auto fds = sd.takeReceivedFds();
+    if (fds.empty()) {
+        return;
+    }
+
+    if (fds.size() != 2) {
+        LOG(ERROR) << "Unexpected number of file descriptors from the monitor: " << fds.size();
+        for (auto fd : fds) {
+            close(fd);
+        }
+        return;
+    }
+
+    m_stats_ring = shm_ring::attach(fds[0], fds[1], sizeof(sStatsRecord));
+    if (!m_stats_ring) {
+        LOG(ERROR) << "Failed attaching the statistics ring of the monitor";
+        return;
+    }
+
+    m_stats_ring_socket = new Socket(m_stats_ring->get_eventfd());
+    add_socket(m_stats_ring_socket);
+
+    LOG(INFO) << "Statistics ring attached, capacity=" << m_stats_ring->get_capacity();
+}
+
+void slave_thread::stats_ring_detach()
+{
+    if (m_stats_ring_socket) {
+        remove_socket(m_stats_ring_socket);
+        delete m_stats_ring_socket;
+        m_stats_ring_socket = nullptr;
+    }
+
+    if (m_stats_ring) {
+        LOG(DEBUG) << "Statistics ring detached, dropped records: "
+                   << m_stats_ring->get_dropped_count();
+        m_stats_ring.reset();
+    }
+}
+
+void slave_thread::handle_stats_ring()
+{
+    m_stats_ring->clear_notification();
+
+    // The monitor publishes complete reports, so a report never spans two wake-ups
+    sStatsRecord record;
+    beerocks_message::sApStatsParams ap_stats = {};
+    std::vector<beerocks_message::sStaStatsParams> sta_stats;
+    bool in_report = false;
+
+    while (m_stats_ring->pop(&record)) {
+        switch (record.type) {
+        case sStatsRecord::STATS_RECORD_AP: {
+            ap_stats = record.ap_stats;
+            sta_stats.clear();
+            in_report = true;
+            break;
+        }
+        case sStatsRecord::STATS_RECORD_STA: {
+            sta_stats.push_back(record.sta_stats);
+            break;
+        }
+        default: {
+            LOG(ERROR) << "Unknown statistics record type: " << int(record.type);
+            continue;
+        }
+        }
+
+        if (!in_report) {
+            LOG(ERROR) << "Statistics record out of a report, type: " << int(record.type);
+            continue;
+        }
+
+        if (record.last) {
+            send_stats_measurement_response(record.message_id, ap_stats, sta_stats);
+            in_report = false;
+        }
+    }
+}
+
+bool slave_thread::send_stats_measurement_response(
+    uint16_t message_id, const beerocks_message::sApStatsParams &ap_stats,
+    const std::vector<beerocks_message::sStaStatsParams> &sta_stats)
+{
+    size_t offset = 0;
+
+    do {
+        auto response = message_com::create_vs_message<
+            beerocks_message::cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE>(cmdu_tx);
+        if (!response) {
+            LOG(ERROR) << "Failed building cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE!";
+            return false;
+        }
+
+        if (offset == 0) {
+            if (!response->alloc_ap_stats()) {
+                LOG(ERROR) << "Failed allocating ap_stats";
+                return false;
+            }
+            std::get<1>(response->ap_stats(0)) = ap_stats;
+        }
+
+        size_t count = std::min(sta_stats.size() - offset,
+                                cmdu_tx.elements_in_message(sizeof(sta_stats[0])));
+        if (count > 0) {
+            if (!response->alloc_sta_stats(count)) {
+                LOG(ERROR) << "Failed allocating sta_stats, count=" << count;
+                return false;
+            }
+            std::copy_n(&sta_stats[offset], count, &std::get<1>(response->sta_stats(0)));
+            offset += count;
+        } else if (offset < sta_stats.size()) {
+            LOG(ERROR) << "No room left for the sta_stats";
+            return false;
+        }
+
+        // Like the monitor, only the last CMDU of a split response carries the request id
+        if (offset == sta_stats.size()) {
+            auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
+            if (!beerocks_header) {
+                LOG(ERROR) << "Failed getting beerocks_header!";
+                return false;
+            }
+            beerocks_header->actionhdr()->id() = message_id;
+        }
+
+        send_cmdu_to_controller(cmdu_tx);
+    } while (offset < sta_stats.size());
+
+    return true;
+}
@@ -11,6 +11,7 @@
 
 #include <bcl/beerocks_backport.h>
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_shm_ring.h>
 #include <bcl/beerocks_socket_thread.h>
 #include <bcl/son/son_wireless_utils.h>
 
@@ -107,6 +108,7 @@ public:
 
 protected:
     virtual bool handle_cmdu(Socket *sd, ieee1905_1::CmduMessageRx &cmdu_rx) override;
+    virtual void after_select(bool timeout) override;
     virtual void on_thread_stop() override;
     virtual bool socket_disconnected(Socket *sd) override;
     virtual std::string print_cmdu_types(const beerocks::message::sUdsHeader *cmdu_header) override;
@@ -140,6 +142,33 @@ private:
     bool ap_manager_heartbeat_check();
     bool send_cmdu_to_controller(ieee1905_1::CmduMessageTx &cmdu_tx);
 
+    /**
+     * @brief Attaches to the statistics ring of the monitor, if it was shared along the
+     * monitor joined notification.
+     *
+     * @param sd Socket of the monitor.
+     */
+    void stats_ring_attach(Socket &sd);
+    void stats_ring_detach();
+
+    /**
+     * @brief Forwards the statistics reports pushed by the monitor to the controller.
+     */
+    void handle_stats_ring();
+
+    /**
+     * @brief Sends a statistics measurement response to the controller, split over several
+     * CMDUs if the stations do not fit in one.
+     *
+     * @param message_id Id of the measurement request.
+     * @param ap_stats Statistics of the radio.
+     * @param sta_stats Statistics of the associated stations.
+     * @return True on success and false otherwise.
+     */
+    bool send_stats_measurement_response(
+        uint16_t message_id, const beerocks_message::sApStatsParams &ap_stats,
+        const std::vector<beerocks_message::sStaStatsParams> &sta_stats);
+
 private:
     const int SELECT_TIMEOUT_MSEC                                     = 200;
     const int SLAVE_INIT_DELAY_SEC                                    = 4;
@@ -198,6 +227,12 @@ private:
     Socket *ap_manager_socket = nullptr;
     std::string m_fronthaul_iface;
 
+    /**
+     * Statistics ring shared by the monitor, and the socket wrapping its eventfd.
+     */
+    std::unique_ptr<beerocks::shm_ring> m_stats_ring;
+    Socket *m_stats_ring_socket = nullptr;
+
     std::chrono::steady_clock::time_point monitor_last_seen;
     std::chrono::steady_clock::time_point ap_manager_last_seen;
     int monitor_retries_counter    = 0;
@@ -58,26 +58,30 @@ void TopologyTask::work()
     static constexpr uint8_t DISCOVERY_NEIGHBOUR_REMOVAL_TIMEOUT_SEC =
         ieee1905_1_consts::DISCOVERY_NOTIFICATION_TIMEOUT_SEC + 3; // 3 seconds grace period.
 
-    auto db = AgentDB::get();
-
     bool neighbors_list_changed = false;
-    for (auto &neighbors_on_local_iface_entry : db->neighbor_devices) {
-        auto &neighbors_on_local_iface = neighbors_on_local_iface_entry.second;
-        for (auto it = neighbors_on_local_iface.begin(); it != neighbors_on_local_iface.end();) {
-            auto &last_topology_discovery = it->second.timestamp;
-            if (now - last_topology_discovery >
-                std::chrono::seconds(DISCOVERY_NEIGHBOUR_REMOVAL_TIMEOUT_SEC)) {
-                auto &device_al_mac = it->first;
-                LOG(INFO) << "Removed 1905.1 device " << device_al_mac << " from neighbors list";
-                it                     = neighbors_on_local_iface.erase(it);
-                neighbors_list_changed = true;
-                continue;
+    {
+        auto neighbor_devices = AgentDB::get_neighbor_devices();
+        for (auto &neighbors_on_local_iface_entry : *neighbor_devices) {
+            auto &neighbors_on_local_iface = neighbors_on_local_iface_entry.second;
+            for (auto it = neighbors_on_local_iface.begin();
+                 it != neighbors_on_local_iface.end();) {
+                auto &last_topology_discovery = it->second.timestamp;
+                if (now - last_topology_discovery >
+                    std::chrono::seconds(DISCOVERY_NEIGHBOUR_REMOVAL_TIMEOUT_SEC)) {
+                    auto &device_al_mac = it->first;
+                    LOG(INFO) << "Removed 1905.1 device " << device_al_mac
+                              << " from neighbors list";
+                    it                     = neighbors_on_local_iface.erase(it);
+                    neighbors_list_changed = true;
+                    continue;
+                }
+                it++;
             }
-            it++;
         }
     }
 
     if (neighbors_list_changed) {
+        AgentDB::increment_topology_generation();
         LOG(INFO) << "Sending topology notification on removeing of 1905.1 neighbors";
         send_topology_notification();
     }
@@ -87,6 +91,7 @@ void TopologyTask::handle_event(uint8_t event_enum_value)
 {
     switch (eEvent(event_enum_value)) {
     case AGENT_RADIO_STATE_CHANGED: {
+        m_topology_response.buffer.clear();
         send_topology_notification();
         break;
     }
@@ -94,6 +99,10 @@ void TopologyTask::handle_event(uint8_t event_enum_value)
         send_topology_discovery();
         break;
     }
+    case AGENT_INTERFACE_STATE_CHANGED: {
+        m_topology_response.buffer.clear();
+        break;
+    }
     default: {
         LOG(DEBUG) << "Message handler doesn't exists for event type " << event_enum_value;
         break;
@@ -133,10 +142,12 @@ void TopologyTask::handle_topology_discovery(ieee1905_1::CmduMessageRx &cmdu_rx,
         return;
     }
 
-    auto db = AgentDB::get();
+    // Topology Discovery messages are received from every neighbor on every interface, so they
+    // are handled without locking the database.
+    auto config = AgentDB::get_config_snapshot();
 
     // Filter out the messages we have sent.
-    if (tlvAlMac->mac() == db->bridge.mac) {
+    if (tlvAlMac->mac() == config->bridge.mac) {
         return;
     }
 
@@ -150,43 +161,45 @@ void TopologyTask::handle_topology_discovery(ieee1905_1::CmduMessageRx &cmdu_rx,
         return;
     }
 
-    uint32_t if_index                      = message_com::get_uds_header(cmdu_rx)->if_index;
-    std::string local_receiving_iface_name = network_utils::linux_get_iface_name(if_index);
-    if (local_receiving_iface_name.empty()) {
-        LOG(ERROR) << "Failed getting interface name for index: " << if_index;
-        return;
-    }
-
-    std::string local_receiving_iface_mac_str;
-    if (!network_utils::linux_iface_get_mac(local_receiving_iface_name,
-                                            local_receiving_iface_mac_str)) {
-        LOG(ERROR) << "Failed getting MAC address for interface: " << local_receiving_iface_name;
+    uint32_t if_index          = message_com::get_uds_header(cmdu_rx)->if_index;
+    auto local_receiving_iface = m_btl_ctx.get_interface_registry().get_interface(if_index);
+    if (!local_receiving_iface) {
+        LOG(ERROR) << "Failed getting interface for index: " << if_index;
         return;
     }
 
     LOG(DEBUG) << "sender iface_mac=" << tlvMac->mac()
-               << ", local_receiving_iface=" << local_receiving_iface_name
-               << ", local_receiving_iface_mac=" << local_receiving_iface_mac_str;
+               << ", local_receiving_iface=" << local_receiving_iface->name
+               << ", local_receiving_iface_mac=" << local_receiving_iface->mac;
 
     // Check if it is a new device so if it does, we will send a Topology Notification.
-    bool new_device = false;
-    for (auto &neighbors_on_local_iface_entry : db->neighbor_devices) {
-        auto &neighbors_on_local_iface = neighbors_on_local_iface_entry.second;
-        new_device =
-            neighbors_on_local_iface.find(tlvAlMac->mac()) == neighbors_on_local_iface.end();
-        if (new_device) {
-            break;
+    bool new_device   = false;
+    bool new_on_iface = false;
+    {
+        auto neighbor_devices = AgentDB::get_neighbor_devices();
+        for (auto &neighbors_on_local_iface_entry : *neighbor_devices) {
+            auto &neighbors_on_local_iface = neighbors_on_local_iface_entry.second;
+            new_device =
+                neighbors_on_local_iface.find(tlvAlMac->mac()) == neighbors_on_local_iface.end();
+            if (new_device) {
+                break;
+            }
         }
-    }
 
-    // Add/Update the device on our list.
-    AgentDB::sNeighborDevice neighbor_device;
-    neighbor_device.transmitting_iface_mac = tlvMac->mac();
-    neighbor_device.timestamp              = std::chrono::steady_clock::now();
+        // Add/Update the device on our list.
+        AgentDB::sNeighborDevice neighbor_device;
+        neighbor_device.transmitting_iface_mac = tlvMac->mac();
+        neighbor_device.timestamp              = std::chrono::steady_clock::now();
 
-    auto &neighbor_devices_by_al_mac =
-        db->neighbor_devices[tlvf::mac_from_string(local_receiving_iface_mac_str)];
-    neighbor_devices_by_al_mac[tlvAlMac->mac()] = neighbor_device;
+        auto &neighbor_devices_by_al_mac = (*neighbor_devices)[local_receiving_iface->mac];
+        new_on_iface =
+            neighbor_devices_by_al_mac.find(tlvAlMac->mac()) == neighbor_devices_by_al_mac.end();
+        neighbor_devices_by_al_mac[tlvAlMac->mac()] = neighbor_device;
+    }
+
+    if (new_on_iface) {
+        AgentDB::increment_topology_generation();
+    }
 
     // If it is a new device, then our 1905.1 neighbors list has changed and we are required to send
     // Topology Notification Message.
@@ -199,7 +212,7 @@ void TopologyTask::handle_topology_discovery(ieee1905_1::CmduMessageRx &cmdu_rx,
             return;
         }
         m_btl_ctx.send_cmdu_to_broker(m_cmdu_tx, network_utils::MULTICAST_1905_MAC_ADDR,
-                                      tlvf::mac_to_string(db->bridge.mac));
+                                      tlvf::mac_to_string(config->bridge.mac));
     }
 }
 
@@ -208,38 +221,24 @@ void TopologyTask::handle_topology_query(ieee1905_1::CmduMessageRx &cmdu_rx,
 {
     const auto mid = cmdu_rx.getMessageId();
     LOG(DEBUG) << "Received TOPOLOGY_QUERY_MESSAGE, mid=" << std::hex << mid;
-    auto cmdu_tx_header =
-        m_cmdu_tx.create(mid, ieee1905_1::eMessageType::TOPOLOGY_RESPONSE_MESSAGE);
-    if (!cmdu_tx_header) {
-        LOG(ERROR) << "Failed creating topology response header";
-        return;
-    }
-
-    if (!add_device_information_tlv()) {
-        return;
-    }
-
-    if (!add_1905_neighbor_device_tlv()) {
-        return;
-    }
-
-    if (!add_supported_service_tlv()) {
-        return;
-    }
 
-    if (!add_ap_operational_bss_tlv()) {
-        return;
+    if (!is_topology_response_valid()) {
+        LOG(DEBUG) << "Building topology response message";
+        if (!build_topology_response()) {
+            return;
+        }
     }
 
-    if (!add_associated_clients_tlv()) {
+    if (!load_topology_response(mid)) {
         return;
     }
 
     auto db = AgentDB::get();
 
     LOG(DEBUG) << "Sending topology response message, mid=" << std::hex << mid;
+    uint16_t length = m_topology_response.buffer.size();
     m_btl_ctx.send_cmdu_to_broker(m_cmdu_tx, tlvf::mac_to_string(src_mac),
-                                  tlvf::mac_to_string(db->bridge.mac));
+                                  tlvf::mac_to_string(db->bridge.mac), length);
 }
 
 bool TopologyTask::handle_vendor_specific(ieee1905_1::CmduMessageRx &cmdu_rx,
@@ -286,9 +285,6 @@ void TopologyTask::handle_vs_client_disassociated(ieee1905_1::CmduMessageRx &cmd
 
 void TopologyTask::send_topology_discovery()
 {
-    // TODO: get the list of interfaces that are up_and_running using the event-driven mechanism
-    // to be implemented in #866
-
     /**
      * Transmission type of Topology Discovery message is 'neighbor multicast'.
      * That is, the CMDU must be transmitted once on each and every of its 1905.1 interfaces.
@@ -299,19 +295,15 @@ void TopologyTask::send_topology_discovery()
     auto db = AgentDB::get();
 
     // Make list of ifaces Macs to send on the message.
-    auto ifaces = network_utils::linux_get_iface_list_from_bridge(db->bridge.iface_name);
+    auto &iface_registry = m_btl_ctx.get_interface_registry();
+    auto ifaces          = iface_registry.get_bridge_members(db->bridge.iface_name);
     for (const auto &iface_name : ifaces) {
-        if (!network_utils::linux_iface_is_up_and_running(iface_name)) {
+        auto iface = iface_registry.get_interface(iface_name);
+        if (!iface || !iface->is_up_and_running()) {
             continue;
         }
 
-        std::string iface_mac_str;
-        if (!network_utils::linux_iface_get_mac(iface_name, iface_mac_str)) {
-            LOG(ERROR) << "Failed getting MAC address for interface: " << iface_name;
-            return;
-        }
-
-        auto iface_mac = tlvf::mac_from_string(iface_mac_str);
+        auto iface_mac = iface->mac;
 
         auto cmdu_header =
             m_cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_DISCOVERY_MESSAGE);
@@ -352,6 +344,117 @@ void TopologyTask::send_topology_notification()
                                   tlvf::mac_to_string(db->bridge.mac));
 }
 
+bool TopologyTask::is_topology_response_valid()
+{
+    // The message is dropped on changes of the local interfaces (AGENT_INTERFACE_STATE_CHANGED)
+    if (m_topology_response.buffer.empty()) {
+        return false;
+    }
+
+    auto db = AgentDB::get();
+
+    return m_topology_response.topology_generation == AgentDB::get_topology_generation() &&
+           m_topology_response.bridge_mac == db->bridge.mac &&
+           m_topology_response.backhaul_connection_type == int(db->backhaul.connection_type) &&
+           m_topology_response.backhaul_iface_name == db->backhaul.selected_iface_name &&
+           m_topology_response.local_gw == db->device_conf.local_gw &&
+           m_topology_response.local_controller == db->device_conf.local_controller;
+}
+
+bool TopologyTask::build_topology_response()
+{
+    // Keep the database locked during the whole build, so the message matches the database state
+    // it is tagged with.
+    auto db = AgentDB::get();
+
+    // The associated clients and neighbor devices are changed without the database lock, so take
+    // the generation before reading them: a change during the build makes the message stale.
+    uint32_t topology_generation = AgentDB::get_topology_generation();
+
+    m_topology_response.buffer.clear();
+    m_topology_response.association_times.clear();
+
+    auto cmdu_tx_header = m_cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_RESPONSE_MESSAGE);
+    if (!cmdu_tx_header) {
+        LOG(ERROR) << "Failed creating topology response header";
+        return false;
+    }
+
+    if (!add_device_information_tlv()) {
+        return false;
+    }
+
+    if (!add_1905_neighbor_device_tlv()) {
+        return false;
+    }
+
+    if (!add_supported_service_tlv()) {
+        return false;
+    }
+
+    if (!add_ap_operational_bss_tlv()) {
+        return false;
+    }
+
+    if (!add_associated_clients_tlv()) {
+        return false;
+    }
+
+    if (!m_cmdu_tx.finalize()) {
+        LOG(ERROR) << "Failed finalizing topology response";
+        return false;
+    }
+
+    auto buffer = m_cmdu_tx.getMessageBuff();
+    m_topology_response.buffer.assign(buffer, buffer + m_cmdu_tx.getMessageLength());
+    m_topology_response.topology_generation      = topology_generation;
+    m_topology_response.bridge_mac               = db->bridge.mac;
+    m_topology_response.backhaul_connection_type = int(db->backhaul.connection_type);
+    m_topology_response.backhaul_iface_name      = db->backhaul.selected_iface_name;
+    m_topology_response.local_gw                 = db->device_conf.local_gw;
+    m_topology_response.local_controller         = db->device_conf.local_controller;
+
+    return true;
+}
+
+bool TopologyTask::load_topology_response(uint16_t mid)
+{
+    auto &buffer = m_topology_response.buffer;
+    if (buffer.size() > m_cmdu_tx.getMessageBuffLength()) {
+        LOG(ERROR) << "Topology response of " << buffer.size() << " bytes exceeds tx buffer";
+        return false;
+    }
+    std::copy(buffer.begin(), buffer.end(), m_cmdu_tx.getMessageBuff());
+
+    // Parse the CMDU header only (which converts it to host byte order) to set the MID.
+    auto cmdu_tx_header = m_cmdu_tx.load();
+    if (!cmdu_tx_header) {
+        LOG(ERROR) << "Failed loading topology response header";
+        return false;
+    }
+    cmdu_tx_header->message_id() = mid;
+
+    auto now = std::chrono::steady_clock::now();
+    for (const auto &association_time : m_topology_response.association_times) {
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::seconds>(now - association_time.second)
+                .count();
+        if ((elapsed < 0) || (elapsed > UINT16_MAX)) {
+            elapsed = UINT16_MAX;
+        }
+
+        // The message is in network byte order
+        auto field = m_cmdu_tx.getMessageBuff() + association_time.first;
+        field[0]   = uint8_t(elapsed >> 8);
+        field[1]   = uint8_t(elapsed);
+    }
+
+    // Convert the header back to network byte order
+    m_cmdu_tx.swap();
+
+    return true;
+}
+
 bool TopologyTask::add_device_information_tlv()
 {
     auto tlvDeviceInformation = m_cmdu_tx.addClass<ieee1905_1::tlvDeviceInformation>();
@@ -376,8 +479,9 @@ bool TopologyTask::add_device_information_tlv()
      * Add a LocalInterfaceInfo field for the wired interface, if any.
      */
     std::string &local_eth_iface_name = db->ethernet.iface_name;
-    if (!local_eth_iface_name.empty() &&
-        network_utils::linux_iface_is_up_and_running(local_eth_iface_name)) {
+
+    auto local_eth_iface = m_btl_ctx.get_interface_registry().get_interface(local_eth_iface_name);
+    if (local_eth_iface && local_eth_iface->is_up_and_running()) {
         ieee1905_1::eMediaType media_type = ieee1905_1::eMediaType::UNKNOWN_MEDIA;
         if (!MediaType::get_media_type(local_eth_iface_name,
                                        ieee1905_1::eMediaTypeGroup::IEEE_802_3, media_type)) {
@@ -388,10 +492,7 @@ bool TopologyTask::add_device_information_tlv()
         std::shared_ptr<ieee1905_1::cLocalInterfaceInfo> localInterfaceInfo =
             tlvDeviceInformation->create_local_interface_list();
 
-        // default to zero mac if get_mac fails.
-        std::string eth_iface_mac = network_utils::ZERO_MAC_STRING;
-        network_utils::linux_iface_get_mac(local_eth_iface_name, eth_iface_mac);
-        localInterfaceInfo->mac()               = tlvf::mac_from_string(eth_iface_mac);
+        localInterfaceInfo->mac()               = local_eth_iface->mac;
         localInterfaceInfo->media_type()        = media_type;
         localInterfaceInfo->media_info_length() = 0;
 
@@ -495,8 +596,6 @@ bool TopologyTask::add_device_information_tlv()
 
 bool TopologyTask::add_1905_neighbor_device_tlv()
 {
-    auto db = AgentDB::get();
-
     /**
      * Add a 1905.1 neighbor device TLV for each local interface for which this management entity
      * has inferred the presence of a 1905.1 neighbor device. Include each discovered neighbor
@@ -506,7 +605,8 @@ bool TopologyTask::add_1905_neighbor_device_tlv()
      * a map which key is the name of the local interface and the value is the list of neighbor
      * devices inferred from that interface.
      */
-    for (auto &neighbors_on_local_iface_entry : db->neighbor_devices) {
+    auto neighbor_devices = AgentDB::get_neighbor_devices();
+    for (auto &neighbors_on_local_iface_entry : *neighbor_devices) {
         auto tlv1905NeighborDevice = m_cmdu_tx.addClass<ieee1905_1::tlv1905NeighborDevice>();
         if (!tlv1905NeighborDevice) {
             LOG(ERROR) << "addClass ieee1905_1::tlv1905NeighborDevice failed";
@@ -623,21 +723,21 @@ bool TopologyTask::add_associated_clients_tlv()
 {
     auto db = AgentDB::get();
 
-    // The Multi-AP Agent shall include an Associated Clients TLV in the message if there is at
-    // least one 802.11 client directly associated with any of the BSS(s) that is operated by the
-    // Multi-AP Agent.
-    bool include_associated_clients_tlv = false;
-    for (const auto &radio : db->get_radios_list()) {
-        if (!radio) {
-            continue;
-        }
-        if (radio->associated_clients.size() > 0) {
-            include_associated_clients_tlv = true;
-            break;
+    // Group the clients by bssid in a single pass, and release their lock before building the TLV
+    typedef std::pair<sMacAddr, std::chrono::steady_clock::time_point> ClientEntry;
+    std::unordered_map<sMacAddr, std::vector<ClientEntry>> clients_by_bssid;
+    {
+        auto associated_clients = AgentDB::get_associated_clients();
+        for (const auto &associated_client_entry : *associated_clients) {
+            clients_by_bssid[associated_client_entry.second.bssid].emplace_back(
+                associated_client_entry.first, associated_client_entry.second.association_time);
         }
     }
 
-    if (include_associated_clients_tlv) {
+    // The Multi-AP Agent shall include an Associated Clients TLV in the message if there is at
+    // least one 802.11 client directly associated with any of the BSS(s) that is operated by the
+    // Multi-AP Agent.
+    if (!clients_by_bssid.empty()) {
         auto tlvAssociatedClients = m_cmdu_tx.addClass<wfa_map::tlvAssociatedClients>();
         if (!tlvAssociatedClients) {
             LOG(ERROR) << "addClass wfa_map::tlvAssociatedClients failed";
@@ -657,14 +757,16 @@ bool TopologyTask::add_associated_clients_tlv()
                 auto bss_list     = tlvAssociatedClients->create_bss_list();
                 bss_list->bssid() = bssid.mac;
 
-                for (const auto &associated_client_entry : radio->associated_clients) {
-                    if (associated_client_entry.second.bssid != bssid.mac) {
-                        continue;
-                    }
+                auto bssid_clients_it = clients_by_bssid.find(bssid.mac);
+                if (bssid_clients_it == clients_by_bssid.end()) {
+                    tlvAssociatedClients->add_bss_list(bss_list);
+                    continue;
+                }
 
+                for (const auto &client_entry : bssid_clients_it->second) {
                     auto client_info = bss_list->create_clients_associated_list();
 
-                    auto &association_time = associated_client_entry.second.association_time;
+                    auto &association_time = client_entry.second;
                     auto elapsed =
                         std::chrono::duration_cast<std::chrono::seconds>(now - association_time)
                             .count();
@@ -672,9 +774,15 @@ bool TopologyTask::add_associated_clients_tlv()
                         elapsed = UINT16_MAX;
                     }
 
-                    client_info->mac()                             = associated_client_entry.first;
+                    client_info->mac()                             = client_entry.first;
                     client_info->time_since_last_association_sec() = elapsed;
 
+                    // Keep the field location, to update it when the message is sent again
+                    auto field = reinterpret_cast<uint8_t *>(
+                        &client_info->time_since_last_association_sec());
+                    m_topology_response.association_times.emplace_back(
+                        field - m_cmdu_tx.getMessageBuff(), association_time);
+
                     bss_list->add_clients_associated_list(client_info);
                 }
                 tlvAssociatedClients->add_bss_list(bss_list);
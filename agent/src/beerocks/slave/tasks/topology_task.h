@@ -13,6 +13,9 @@
 
 #include <tlvf/CmduMessageTx.h>
 
+#include <chrono>
+#include <vector>
+
 namespace beerocks {
 
 // Forward decleration for backhaul_manager context saving
@@ -28,6 +31,7 @@ public:
     enum eEvent : uint8_t {
         AGENT_RADIO_STATE_CHANGED,
         AGENT_DEVICE_INITIALIZED,
+        AGENT_INTERFACE_STATE_CHANGED,
     };
 
     void handle_event(uint8_t event_enum_value) override;
@@ -89,6 +93,30 @@ private:
     void send_topology_discovery();
     void send_topology_notification();
 
+    /**
+     * @brief Check if the pre-built Topology Response message still matches the database.
+     *
+     * @return true if the message can be sent as is, otherwise false.
+     */
+    bool is_topology_response_valid();
+
+    /**
+     * @brief Build the Topology Response message and keep a copy of it, finalized, in
+     * m_topology_response.
+     *
+     * @return true on success, otherwise false.
+     */
+    bool build_topology_response();
+
+    /**
+     * @brief Load the pre-built Topology Response message into m_cmdu_tx, stamped with the given
+     * MID and the current elapsed times since the clients association.
+     *
+     * @param[in] mid Message ID of the Topology Query message to respond to.
+     * @return true on success, otherwise false.
+     */
+    bool load_topology_response(uint16_t mid);
+
     /**
      * @brief Add and fill device information tlv.
      * 
@@ -126,6 +154,31 @@ private:
 
     backhaul_manager &m_btl_ctx;
     ieee1905_1::CmduMessageTx &m_cmdu_tx;
+
+    /**
+     * @brief Pre-built Topology Response message.
+     *
+     * Building the message walks the whole database, while the controller and every 1905.1
+     * neighbor query the topology periodically. The message is built once and rebuilt only when
+     * the database data it reports has changed (AgentDB::get_topology_generation(), backhaul and
+     * bridge state), or when a local interface has changed.
+     */
+    struct sTopologyResponse {
+        // Finalized message, in network byte order. Empty if not built.
+        std::vector<uint8_t> buffer;
+
+        // Database state the message was built from.
+        uint32_t topology_generation = 0;
+        sMacAddr bridge_mac;
+        int backhaul_connection_type = 0;
+        std::string backhaul_iface_name;
+        bool local_gw         = false;
+        bool local_controller = false;
+
+        // Offset in the message of the time since last association field of each associated
+        // client, with the association time of the client.
+        std::vector<std::pair<size_t, std::chrono::steady_clock::time_point>> association_times;
+    } m_topology_response;
 };
 
 } // namespace beerocks
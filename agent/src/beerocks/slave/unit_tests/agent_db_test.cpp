@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "agent_db.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace beerocks;
+
+namespace {
+
+const auto bridge_mac = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x10, 0x00};
+const auto radio_mac  = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x20, 0x00};
+const auto bssid_1    = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x20, 0x01};
+const auto bssid_2    = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x20, 0x02};
+const auto client_1   = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x30, 0x01};
+const auto client_2   = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x30, 0x02};
+
+const std::string front_iface = "wlan0";
+const std::string back_iface  = "wlan1";
+
+void add_radio()
+{
+    auto db = AgentDB::get();
+    if (!db->add_radio(front_iface, back_iface)) {
+        return;
+    }
+    auto radio                 = db->radio(front_iface);
+    radio->front.iface_mac     = radio_mac;
+    radio->front.bssids[0].mac = bssid_1;
+    radio->front.bssids[1].mac = bssid_2;
+}
+
+void add_client(const sMacAddr &client_mac, const sMacAddr &bssid)
+{
+    uint8_t association_frame[] = {0x01, 0x02};
+    AgentDB::get_associated_clients()->emplace(
+        client_mac, AgentDB::sClient{bssid, sizeof(association_frame), association_frame});
+}
+
+class agent_db_test : public ::testing::Test {
+protected:
+    // The database is a singleton, start every test from an empty one
+    void SetUp() override { AgentDB::reset(); }
+};
+
+TEST_F(agent_db_test, config_snapshot_should_be_published_on_unlock)
+{
+    {
+        auto db        = AgentDB::get();
+        db->bridge.mac = bridge_mac;
+        auto config    = AgentDB::get_config_snapshot();
+        EXPECT_NE(config->bridge.mac, bridge_mac);
+    }
+
+    auto config = AgentDB::get_config_snapshot();
+    EXPECT_EQ(config->bridge.mac, bridge_mac);
+
+    // The snapshot held by a reader is immutable
+    AgentDB::get()->bridge.iface_name = "br-test";
+    EXPECT_TRUE(config->bridge.iface_name.empty());
+    EXPECT_EQ(AgentDB::get_config_snapshot()->bridge.iface_name, "br-test");
+}
+
+TEST_F(agent_db_test, unchanged_config_should_not_be_published)
+{
+    AgentDB::get()->bridge.mac = bridge_mac;
+
+    auto publications = AgentDB::get_lock_stats().config_snapshot_publications;
+    auto config       = AgentDB::get_config_snapshot();
+
+    AgentDB::get()->backhaul.selected_iface_name = back_iface;
+
+    EXPECT_EQ(AgentDB::get_lock_stats().config_snapshot_publications, publications);
+    EXPECT_EQ(AgentDB::get_config_snapshot(), config);
+}
+
+TEST_F(agent_db_test, config_snapshot_should_include_radios)
+{
+    add_radio();
+
+    auto config = AgentDB::get_config_snapshot();
+    ASSERT_EQ(config->radios.size(), 1U);
+    EXPECT_EQ(config->radios[0].front.iface_name, front_iface);
+    EXPECT_EQ(config->radios[0].front.bssids[1].mac, bssid_2);
+}
+
+TEST_F(agent_db_test, client_should_be_found_through_its_bssid)
+{
+    add_radio();
+    add_client(client_1, bssid_2);
+
+    auto db    = AgentDB::get();
+    auto radio = db->get_radio_by_mac(client_1, AgentDB::eMacType::CLIENT);
+    ASSERT_NE(radio, nullptr);
+    EXPECT_EQ(radio->front.iface_mac, radio_mac);
+    EXPECT_EQ(db->get_radio_by_mac(client_1, AgentDB::eMacType::RADIO), nullptr);
+    EXPECT_EQ(db->get_radio_by_mac(client_2, AgentDB::eMacType::ALL), nullptr);
+}
+
+TEST_F(agent_db_test, erase_client_should_match_the_bssid)
+{
+    add_client(client_2, bssid_1);
+    auto topology_generation = AgentDB::get_topology_generation();
+
+    AgentDB::erase_client(client_2, bssid_2);
+    EXPECT_EQ(AgentDB::get_associated_clients()->count(client_2), 1U);
+    EXPECT_EQ(AgentDB::get_topology_generation(), topology_generation);
+
+    AgentDB::erase_client(client_2, bssid_1);
+    EXPECT_EQ(AgentDB::get_associated_clients()->count(client_2), 0U);
+    EXPECT_NE(AgentDB::get_topology_generation(), topology_generation);
+}
+
+TEST_F(agent_db_test, lock_contention_should_be_counted)
+{
+    auto stats = AgentDB::get_lock_stats();
+
+    std::thread reader;
+    {
+        auto neighbor_devices = AgentDB::get_neighbor_devices();
+        reader                = std::thread([]() { AgentDB::get_neighbor_devices()->clear(); });
+
+        // The contention is counted before the reader blocks, wait for it
+        while (AgentDB::get_lock_stats().neighbor_devices.contentions ==
+               stats.neighbor_devices.contentions) {
+            std::this_thread::yield();
+        }
+
+        // Keep the reader blocked for a known minimal time
+        auto blocked_since = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - blocked_since < std::chrono::milliseconds(1)) {
+            std::this_thread::yield();
+        }
+    }
+    reader.join();
+
+    auto new_stats = AgentDB::get_lock_stats();
+    EXPECT_EQ(new_stats.neighbor_devices.acquisitions, stats.neighbor_devices.acquisitions + 2);
+    EXPECT_EQ(new_stats.neighbor_devices.contentions, stats.neighbor_devices.contentions + 1);
+    EXPECT_GE(new_stats.neighbor_devices.wait_time_us, stats.neighbor_devices.wait_time_us + 1000);
+    EXPECT_EQ(new_stats.associated_clients.contentions, stats.associated_clients.contentions);
+}
+
+} // namespace
@@ -42,6 +42,27 @@ if (NOT BUILD_DATE)
     execute_process(COMMAND "date" "+%F_%H-%M-%S" OUTPUT_STRIP_TRAILING_WHITESPACE OUTPUT_VARIABLE BUILD_DATE)
 endif()
 
+# Compile out the log lines of a target below a minimum level (TRACE, DEBUG, INFO, WARNING or
+# ERROR), e.g. prplmesh_log_min_level(ieee1905_transport_lib INFO) to remove the debug lines of the
+# packet path. The lines written with LAZY_LOG() and the front-ends based on it (MAPF_*, TLVF_LOG)
+# are removed with their operands, LOG() still evaluates them.
+function(prplmesh_log_min_level TARGET MIN_LEVEL)
+    set(LEVELS TRACE DEBUG INFO WARNING ERROR)
+    if (NOT MIN_LEVEL)
+        return()
+    endif()
+    list(FIND LEVELS ${MIN_LEVEL} MIN_INDEX)
+    if (MIN_INDEX EQUAL -1)
+        message(FATAL_ERROR "Invalid log level ${MIN_LEVEL} for ${TARGET}, expected one of ${LEVELS}")
+    endif()
+    foreach(LEVEL IN LISTS LEVELS)
+        list(FIND LEVELS ${LEVEL} INDEX)
+        if (INDEX LESS MIN_INDEX)
+            target_compile_definitions(${TARGET} PRIVATE ELPP_DISABLE_${LEVEL}_LOGS)
+        endif()
+    endforeach()
+endfunction()
+
 message(STATUS "prplmesh Version: ${prplmesh_VERSION}")
 message(STATUS "prplmesh Build Date: ${BUILD_DATE}")
 message(STATUS "prplmesh Revision: ${PRPLMESH_REVISION}")
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_ASYNC_LOG_H_
+#define _BEEROCKS_ASYNC_LOG_H_
+
+#include <cstdint>
+#include <string>
+
+namespace beerocks {
+
+/**
+ * @brief Asynchronous output of the easylogging++ loggers.
+ *
+ * The lines of an attached logger are still formatted by easylogging++ on the logging thread,
+ * but instead of being written there to the file, the console and syslog, they are pushed to a
+ * ring owned by the logging thread (a shm_ring, lock-free, single producer single consumer).
+ * A single writer thread drains the rings of all the threads and writes the lines to the outputs
+ * of their logger, including an optional network log server over a persistent TCP connection.
+ *
+ * When the ring of a thread is full, the line is dropped and counted, and the writer reports
+ * the number of dropped lines in the log. Each ring takes a memfd, an eventfd and 64 KiB until
+ * its thread exits; the number of rings is bounded. The threads which have no ring, because the
+ * bound is reached or creating it failed, queue their lines under a lock in a bounded queue
+ * shared by all of them, whose dropped lines are reported the same way.
+ *
+ * Fatal lines are flushed before returning, since easylogging++ aborts the process right after
+ * logging them.
+ *
+ * The lines of the loggers which are not attached are written synchronously, as before.
+ */
+class async_log {
+public:
+    /**
+     * @brief Moves the outputs of a logger to the writer thread.
+     *
+     * Takes the outputs (file, console, syslog) from the current easylogging++ configuration of
+     * the logger, then disables them in easylogging++. Must be called again after the logger is
+     * reconfigured. The writer thread is started on the first call.
+     *
+     * @param logger_id Id of the easylogging++ logger.
+     * @param auto_roll Roll the log file in place when it reaches half of its maximum size, as
+     * RollMonitor does, instead of leaving it to easylogging++.
+     * @param net_server Address of a network log server (e.g. logmaster), empty for none.
+     * @param net_port TCP port of the network log server.
+     * @return true on success, false otherwise.
+     */
+    static bool attach(const std::string &logger_id, bool auto_roll,
+                       const std::string &net_server = std::string(), uint16_t net_port = 0);
+
+    /**
+     * @brief Waits until the writer thread has written the lines logged so far.
+     *
+     * @param timeout_msec Maximum time to wait.
+     * @return true if the lines were written, false on timeout or if the writer is not started.
+     */
+    static bool flush(int timeout_msec = 1000);
+
+    /**
+     * @brief Gets the number of lines which were dropped because the ring of their thread, or
+     * the queue shared by the threads without a ring, was full.
+     */
+    static uint64_t get_dropped_count();
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_ASYNC_LOG_H_
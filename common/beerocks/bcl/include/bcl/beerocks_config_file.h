@@ -28,6 +28,8 @@ public:
         std::string files_auto_roll;
         std::string stdout_enabled;
         std::string syslog_enabled;
+        std::string async_enabled;
+        std::string net_server;
     };
 
     // config file parameters master / slave
@@ -97,8 +99,10 @@ public:
         std::string backhaul_preferred_bssid;
         std::string backhaul_wire_iface;
         std::string backhaul_wire_iface_type;
+        std::string link_metrics_sampling_interval_ms;
         std::string enable_system_hang_test;
         std::string const_backhaul_slave;
+        std::string enable_stats_ring;
         //[slaveX]
         std::string radio_identifier[IRE_MAX_SLAVES]; // mAP RUID
         std::string enable_repeater_mode[IRE_MAX_SLAVES];
@@ -27,6 +27,7 @@ namespace beerocks {
 #define BEEROCKS_MASTER_UDS "uds_master"
 #define BEEROCKS_PLAT_MGR_UDS "uds_platform_manager"
 #define BEEROCKS_BACKHAUL_MGR_UDS "uds_backhaul_manager"
+#define BEEROCKS_METRICS_UDS "uds_metrics_"
 
 #if __GNUC__ >= 7 || __cplussplus >= 201703L
 #define FALLTHROUGH __attribute__((fallthrough))
@@ -77,6 +78,10 @@ enum eMessageConsts {
     MESSAGE_VERSION       = 6,
     MESSAGE_MAGIC         = 0x55CDABEF,
     MESSAGE_BUFFER_LENGTH = 4096,
+
+    // Ceiling of the message buffers: the UDS header length is 16 bits, and the 1905 transport
+    // reassembles fragmented CMDUs of up to 64KB
+    MESSAGE_BUFFER_LENGTH_MAX = 64 * 1024,
 };
 } //namespace message
 
@@ -17,6 +17,8 @@
 #include "beerocks_defines.h"
 #include "beerocks_string_utils.h"
 
+#include <lazy_log.h>
+
 namespace beerocks {
 #define CONSOLE_MSG(a)                                                                             \
     do {                                                                                           \
@@ -90,6 +92,7 @@ public:
     bool get_log_files_auto_roll();
     bool get_stdout_enabled();
     bool get_syslog_enabled();
+    bool get_async_enabled();
 
     void set_log_level_state(const eLogLevel &log_level, const bool &new_state);
     void attach_current_thread_to_logger_id();
@@ -127,6 +130,9 @@ private:
     log_levels m_syslog_levels;
     bool m_stdout_enabled = true;
     bool m_syslog_enabled = false;
+    bool m_async_enabled  = false;
+    std::string m_net_server;
+    uint16_t m_net_port = 0;
 
     settings_t m_settings_map;
 
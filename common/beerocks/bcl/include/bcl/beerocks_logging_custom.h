@@ -25,9 +25,12 @@
 #include <stophere>
 #endif
 
-#include <easylogging++.h>
+#include <lazy_log.h>
 #undef LOG
 #define LOG(LEVEL) CLOG(LEVEL, BEEROCKS_CUSTOM_LOGGER_ID)
 
 #undef LOG_IF
 #define LOG_IF(condition, LEVEL) CLOG_IF(condition, LEVEL, BEEROCKS_CUSTOM_LOGGER_ID)
+
+#undef LOG_ENABLED
+#define LOG_ENABLED(LEVEL) CLOG_ENABLED(LEVEL, BEEROCKS_CUSTOM_LOGGER_ID)
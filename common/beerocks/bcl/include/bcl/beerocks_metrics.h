@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_METRICS_H_
+#define _BEEROCKS_METRICS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace beerocks {
+
+/**
+ * @brief Lightweight runtime metrics: counters, gauges and latency histograms.
+ *
+ * Metrics are registered once, typically as static objects next to the code they instrument,
+ * and updated on the hot path without locking: the counters and the histograms of each thread
+ * are kept in a block of slots owned by that thread, which only this thread writes (a relaxed
+ * load and store, no read-modify-write). The blocks of all the threads are summed up when the
+ * metrics are read, and the block of a thread is folded into the process totals when the thread
+ * exits.
+ *
+ * The metrics of a process are read with dump(), in the Prometheus text format, or from the unix
+ * socket started by start_export(), e.g. with the "metrics" command of beerocks_cli.
+ */
+namespace metrics {
+
+/**
+ * Histogram buckets, in microseconds: bucket i counts the values up to 2^i usec, the last bucket
+ * counts the values above 2^(HISTOGRAM_BUCKETS - 2) usec (about 1 second).
+ */
+constexpr size_t HISTOGRAM_BUCKETS = 22;
+
+/**
+ * @brief Monotonically increasing counter.
+ */
+class counter {
+public:
+    /**
+     * @brief Registers a counter.
+     *
+     * @param name Name of the metric, e.g. "transport_packets_received".
+     * @param help Description of the metric.
+     */
+    explicit counter(const std::string &name, const std::string &help = std::string());
+
+    /**
+     * @brief Adds to the counter of the current thread.
+     */
+    void add(uint64_t value = 1);
+
+private:
+    // First slot of the metric, or -1 if it could not be registered
+    int m_slot = -1;
+};
+
+/**
+ * @brief Value which can go up and down, e.g. the size of a queue.
+ *
+ * A gauge is shared by all the threads, so it is an atomic variable rather than per-thread slots.
+ */
+class gauge {
+public:
+    explicit gauge(const std::string &name, const std::string &help = std::string());
+
+    void set(int64_t value) { m_value->store(value, std::memory_order_relaxed); }
+    void add(int64_t value) { m_value->fetch_add(value, std::memory_order_relaxed); }
+
+private:
+    // Owned by the registry, which reads it on dump()
+    std::atomic<int64_t> *m_value;
+};
+
+/**
+ * @brief Histogram of durations in microseconds, with HISTOGRAM_BUCKETS power of 2 buckets.
+ */
+class histogram {
+public:
+    /**
+     * @brief Registers a histogram.
+     *
+     * @param name Name of the metric, e.g. "master_cmdu_handling_usec".
+     * @param help Description of the metric.
+     * @param label Label of the histogram when it is part of a histogram_family, in the
+     * Prometheus format (e.g. "type=\"0x8002\""), empty otherwise.
+     */
+    explicit histogram(const std::string &name, const std::string &help = std::string(),
+                       const std::string &label = std::string());
+
+    /**
+     * @brief Adds a value to the histogram of the current thread.
+     */
+    void observe(uint64_t usec);
+
+    void observe(std::chrono::steady_clock::duration duration)
+    {
+        auto usec = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        observe(usec > 0 ? uint64_t(usec) : 0);
+    }
+
+private:
+    // First slot of the metric (the buckets, then the sum), or -1 if it could not be registered
+    int m_slot = -1;
+};
+
+/**
+ * @brief Set of histograms of the same metric, one per value of a label, e.g. one histogram of
+ * the CMDU handling time per message type.
+ *
+ * The histograms are created on the first use of their label value. get() takes a lock, so hot
+ * paths with a fixed set of label values should keep the histogram returned by get().
+ */
+class histogram_family {
+public:
+    /**
+     * @param name Name of the metric.
+     * @param label_name Name of the label, e.g. "type".
+     * @param help Description of the metric.
+     */
+    histogram_family(const std::string &name, const std::string &label_name,
+                     const std::string &help = std::string());
+
+    /**
+     * @brief Gets the histogram of a label value, creating it on first use.
+     */
+    histogram &get(const std::string &label_value);
+
+    /**
+     * @brief Gets the histogram of a numerical label value, printed in hex (e.g. a message type).
+     */
+    histogram &get(uint32_t label_value);
+
+private:
+    const std::string m_name;
+    const std::string m_label_name;
+    const std::string m_help;
+    std::mutex m_mutex;
+    std::map<std::string, std::unique_ptr<histogram>> m_histograms;
+};
+
+/**
+ * @brief Adds the time elapsed from its construction to its destruction to a histogram.
+ */
+class scoped_timer {
+public:
+    explicit scoped_timer(histogram &histogram)
+        : m_histogram(histogram), m_start(std::chrono::steady_clock::now())
+    {
+    }
+    ~scoped_timer() { m_histogram.observe(std::chrono::steady_clock::now() - m_start); }
+
+private:
+    histogram &m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @brief Prints the metrics of the process in the Prometheus text format.
+ */
+std::string dump();
+
+/**
+ * @brief Starts a thread which writes dump() to each client connecting to a unix socket, then
+ * closes the connection.
+ *
+ * The thread runs until stop_export() is called, or until the process exits.
+ *
+ * @param uds_path Path of the unix socket, e.g. temp_path + BEEROCKS_METRICS_UDS + process name.
+ * @return true on success, false otherwise or if the export is already started.
+ */
+bool start_export(const std::string &uds_path);
+
+/**
+ * @brief Stops the thread started by start_export() and closes its unix socket.
+ */
+void stop_export();
+
+} // namespace metrics
+} // namespace beerocks
+
+#endif // _BEEROCKS_METRICS_H_
@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_SHM_RING_H_
+#define _BEEROCKS_SHM_RING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace beerocks {
+
+/**
+ * @brief Single-producer single-consumer ring of fixed-size records in shared memory.
+ *
+ * The ring lives in an anonymous memfd and is paired with an eventfd used by the producer to
+ * wake up the consumer. Both file descriptors are created by the producer with create() and
+ * handed to the consumer process (e.g. over a unix domain socket with SCM_RIGHTS), which maps
+ * the same memory with attach().
+ *
+ * Records are copied as-is, in native byte order, so the ring is only meant for processes
+ * running on the same host. Pushed records are not visible to the consumer until commit() is
+ * called, which allows the producer to publish a group of records (e.g. a complete report) at
+ * once. When the ring is full, push() fails and the record is counted as dropped; it is up to
+ * the producer to fall back to another channel.
+ *
+ * The eventfd is only written when the consumer waits for it: the consumer asks for a wake-up
+ * when pop() finds the ring empty, so it must drain the ring until pop() fails before polling
+ * the eventfd again. A producer committing while the ring is being drained makes no system call.
+ *
+ * push(), commit(), pop() and clear_notification() do not log, so that the ring can carry the
+ * log lines themselves (see async_log). They report failures through their return value only.
+ *
+ * Each side must be used by a single thread.
+ */
+class shm_ring {
+public:
+    /**
+     * @brief Creates a new ring, as the producer.
+     *
+     * @param name Name of the memfd, for debugging purposes only.
+     * @param record_size Size of a record, in bytes.
+     * @param capacity Maximum number of records in the ring, rounded up to a power of 2.
+     * @return The ring on success and nullptr otherwise.
+     */
+    static std::unique_ptr<shm_ring> create(const std::string &name, size_t record_size,
+                                            size_t capacity);
+
+    /**
+     * @brief Attaches to a ring created by another process, as the consumer.
+     *
+     * The ring takes ownership of the file descriptors, which are closed on failure too.
+     *
+     * @param memfd File descriptor of the shared memory of the ring.
+     * @param eventfd File descriptor of the eventfd of the ring.
+     * @param record_size Expected size of a record, in bytes.
+     * @return The ring on success and nullptr otherwise.
+     */
+    static std::unique_ptr<shm_ring> attach(int memfd, int eventfd, size_t record_size);
+
+    ~shm_ring();
+
+    shm_ring(const shm_ring &) = delete;
+    shm_ring &operator=(const shm_ring &) = delete;
+
+    /**
+     * @brief Copies a record into the ring, without publishing it.
+     *
+     * @param record Record to push.
+     * @param size Size of the record, must not exceed the record size of the ring. The rest of
+     * the record is zeroed.
+     * @return True on success and false if the ring is full or the record too big.
+     */
+    bool push(const void *record, size_t size);
+
+    /**
+     * @brief Publishes the pushed records to the consumer and wakes it up if it waits for them.
+     *
+     * @return True on success and false if the eventfd could not be written, with errno set. The
+     * records are published anyway, and the wake-up is retried on the next commit.
+     */
+    bool commit();
+
+    /**
+     * @brief Gets the number of records which can still be pushed.
+     */
+    size_t get_free_count() const;
+
+    /**
+     * @brief Copies the oldest published record out of the ring, as the consumer.
+     *
+     * @param[out] record Buffer for the record, at least get_record_size() bytes long.
+     * @return True if a record was read and false if the ring is empty, in which case the next
+     * commit() wakes up the consumer.
+     */
+    bool pop(void *record);
+
+    /**
+     * @brief Clears the pending wake-up of the consumer.
+     *
+     * Must be called when the eventfd becomes readable, before draining the ring with pop().
+     */
+    void clear_notification();
+
+    int get_memfd() const { return m_memfd; }
+    int get_eventfd() const { return m_eventfd; }
+    size_t get_record_size() const { return m_record_size; }
+    size_t get_capacity() const { return m_mask + 1; }
+
+    /**
+     * @brief Gets the number of records which could not be pushed because the ring was full.
+     */
+    uint64_t get_dropped_count() const;
+
+private:
+    struct sHeader;
+
+    shm_ring(int memfd, int eventfd, void *mapping, size_t mapping_size);
+    static size_t get_records_offset();
+    uint8_t *get_record(uint32_t index) const;
+
+    int m_memfd   = -1;
+    int m_eventfd = -1;
+
+    void *m_mapping       = nullptr;
+    size_t m_mapping_size = 0;
+    sHeader *m_header     = nullptr;
+
+    size_t m_record_size = 0;
+    uint32_t m_mask      = 0;
+
+    /**
+     * Producer only: position of the next record to push, published to the consumer on commit().
+     */
+    uint32_t m_pending_head = 0;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_SHM_RING_H_
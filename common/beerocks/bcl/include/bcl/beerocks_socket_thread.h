@@ -10,6 +10,7 @@
 #define _BEEROCKS_SOCKET_THREAD_H_
 
 #include "beerocks_message_structs.h"
+#include "beerocks_metrics.h"
 #include "beerocks_thread_base.h"
 #include "network/socket.h"
 
@@ -17,6 +18,7 @@
 #include <tlvf/CmduMessageTx.h>
 
 #include <chrono>
+#include <vector>
 
 #define DEFAULT_SELECT_TIMEOUT_MS 500
 
@@ -28,7 +30,17 @@ class transport_socket_thread;
 
 class socket_thread : public thread_base {
 public:
-    socket_thread(const std::string &unix_socket_path_ = std::string());
+    /**
+     * @brief Class constructor.
+     *
+     * @param unix_socket_path_ Path of the UDS server socket, empty for none.
+     * @param tx_buffer_length Length of the buffers cmdu_tx and cert_cmdu_tx are built on, which
+     * is the ceiling on the length of the messages this thread sends. Threads which build
+     * messages that grow with the number of stations should use MESSAGE_BUFFER_LENGTH_MAX.
+     * Messages of any length up to MESSAGE_BUFFER_LENGTH_MAX are received.
+     */
+    socket_thread(const std::string &unix_socket_path_ = std::string(),
+                  size_t tx_buffer_length          = message::MESSAGE_BUFFER_LENGTH);
     virtual ~socket_thread();
     void set_server_max_connections(int connections);
     virtual void set_select_timeout(unsigned msec);
@@ -74,6 +86,13 @@ protected:
         return m_select_wake_up_time + std::chrono::milliseconds(int(0.50 * m_select_timeout_msec));
     }
 
+private:
+    // Declared before the CMDU objects which are built on them
+    std::vector<uint8_t> rx_buffer;
+    std::vector<uint8_t> tx_buffer;
+    std::vector<uint8_t> cert_tx_buffer;
+
+protected:
     ieee1905_1::CmduMessageTx cmdu_tx;
     ieee1905_1::CmduMessageTx cert_cmdu_tx;
     const std::string unix_socket_path;
@@ -87,9 +106,6 @@ private:
     bool handle_cmdu_message_uds(Socket *sd);
     bool verify_cmdu(message::sUdsHeader *uds_header);
 
-    uint8_t rx_buffer[message::MESSAGE_BUFFER_LENGTH];
-    uint8_t tx_buffer[message::MESSAGE_BUFFER_LENGTH];
-    uint8_t cert_tx_buffer[message::MESSAGE_BUFFER_LENGTH];
     ieee1905_1::CmduMessageRx cmdu_rx;
 
     std::unique_ptr<SocketServer> server_socket;
@@ -104,6 +120,9 @@ private:
     bool m_skip_next_select_timeout = false;
     std::chrono::steady_clock::time_point m_select_wake_up_time =
         std::chrono::steady_clock::time_point::max();
+    // Time spent between two select() calls, resolved on the first iteration since the thread
+    // name is set by the derived classes
+    metrics::histogram *m_iteration_time = nullptr;
 };
 
 } // namespace beerocks
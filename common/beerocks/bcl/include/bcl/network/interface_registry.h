@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_INTERFACE_REGISTRY_H_
+#define _BEEROCKS_INTERFACE_REGISTRY_H_
+
+#include "net_struct.h"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct nlmsghdr;
+
+namespace beerocks {
+namespace net {
+
+/**
+ * @brief In-process registry of the network interfaces, kept up to date by Netlink events.
+ *
+ * The registry dumps all the links and IPv4 addresses once when opened, and then follows the
+ * changes through the RTNLGRP_LINK and RTNLGRP_IPV4_IFADDR multicast groups. Queries on the
+ * state, MAC address, addresses or bridge membership of an interface are then memory lookups
+ * instead of ioctl() calls or sysfs reads, and a change handler can react to interface changes
+ * instead of polling them.
+ *
+ * The registry is not thread safe and has no thread of its own: the owner adds the file
+ * descriptor returned by get_fd() to its event loop and calls process_events() when it is
+ * readable.
+ */
+class InterfaceRegistry {
+public:
+    /**
+     * @brief IPv4 address assigned to an interface.
+     */
+    struct sAddress {
+        sIpv4Addr address     = {};
+        uint8_t prefix_length = 0;
+        sIpv4Addr broadcast   = {};
+    };
+
+    /**
+     * @brief Network interface information.
+     */
+    struct sInterface {
+        uint32_t index = 0;
+        std::string name;
+        sMacAddr mac = {};
+        // IFF_* flags
+        uint32_t flags = 0;
+        // Index of the bridge (or bond) the interface is enslaved to, 0 if none
+        uint32_t master_index = 0;
+        std::vector<sAddress> addresses;
+
+        bool is_up() const;
+        bool is_up_and_running() const;
+    };
+
+    enum class eChangeType { Added, Changed, Removed };
+
+    /**
+     * @brief Handler of interface changes, called from process_events() once the registry is
+     * updated. A removed interface is passed with its last known information.
+     *
+     * previous_master_index is the master index before the change, so the owner can recognize an
+     * interface which has just left a bridge (0 for an added interface).
+     */
+    typedef std::function<void(const sInterface &iface, eChangeType change_type,
+                               uint32_t previous_master_index)>
+        ChangeHandler;
+
+    InterfaceRegistry() = default;
+    ~InterfaceRegistry();
+
+    InterfaceRegistry(const InterfaceRegistry &) = delete;
+    InterfaceRegistry &operator=(const InterfaceRegistry &) = delete;
+
+    /**
+     * @brief Subscribe to the interface changes and load the current state of all the
+     * interfaces.
+     *
+     * @return True on success and false otherwise.
+     */
+    bool open();
+
+    void close();
+
+    /**
+     * @brief Gets the file descriptor to wait on for events, -1 if not open.
+     */
+    int get_fd() const { return m_fd; }
+
+    /**
+     * @brief Read and apply all the pending interface events, without blocking.
+     *
+     * If events were lost (the socket receive buffer overflowed), the whole state is loaded
+     * again.
+     *
+     * @return True on success and false otherwise.
+     */
+    bool process_events();
+
+    /**
+     * @brief Set the handler called on every change of an interface.
+     */
+    void set_change_handler(const ChangeHandler &handler) { m_change_handler = handler; }
+
+    /**
+     * @brief Gets an interface by name.
+     *
+     * @return The interface information, or nullptr if there is no such interface. The pointer
+     * is valid until the next call to process_events().
+     */
+    const sInterface *get_interface(const std::string &iface_name) const;
+
+    /**
+     * @brief Gets an interface by index.
+     *
+     * @return The interface information, or nullptr if there is no such interface. The pointer
+     * is valid until the next call to process_events().
+     */
+    const sInterface *get_interface(uint32_t iface_index) const;
+
+    /**
+     * @brief Gets the name of the interface with the given index.
+     *
+     * @return The interface name, or empty string if there is no such interface.
+     */
+    std::string get_iface_name(uint32_t iface_index) const;
+
+    /**
+     * @brief Gets the MAC address of the given interface.
+     *
+     * @param[in] iface_name Name of the network interface.
+     * @param[out] mac MAC address of the network interface.
+     * @return True on success and false if there is no such interface.
+     */
+    bool get_mac(const std::string &iface_name, sMacAddr &mac) const;
+
+    /**
+     * @brief Checks if the given interface is administratively up and has a carrier.
+     */
+    bool is_up_and_running(const std::string &iface_name) const;
+
+    /**
+     * @brief Gets the names of the interfaces enslaved to the given bridge.
+     */
+    std::vector<std::string> get_bridge_members(const std::string &bridge_name) const;
+
+    /**
+     * @brief Gets the number of full state loads done so far (the first one included).
+     */
+    uint32_t get_dump_count() const { return m_dump_count; }
+
+private:
+    bool dump(uint16_t message_type);
+    bool load();
+    bool receive(bool wait, uint32_t sequence, bool &done);
+    void handle_message(const nlmsghdr *msg_ptr);
+    void handle_link(const nlmsghdr *msg_ptr);
+    void handle_address(const nlmsghdr *msg_ptr);
+    void notify(const sInterface &iface, eChangeType change_type, uint32_t previous_master_index);
+
+    int m_fd              = -1;
+    uint32_t m_sequence   = 0;
+    uint32_t m_dump_count = 0;
+    // Set while loading the full state, when the change handler is not called
+    bool m_loading = false;
+    // Set when events were lost and the full state has to be loaded again
+    bool m_resync_needed = false;
+
+    std::unordered_map<uint32_t, sInterface> m_interfaces;
+    std::unordered_map<std::string, uint32_t> m_index_by_name;
+    ChangeHandler m_change_handler;
+    std::vector<char> m_buffer;
+};
+
+} // namespace net
+} // namespace beerocks
+
+#endif // _BEEROCKS_INTERFACE_REGISTRY_H_
@@ -0,0 +1,122 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_INTERFACE_STATS_CACHE_H_
+#define _BEEROCKS_INTERFACE_STATS_CACHE_H_
+
+#include "net_struct.h"
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct nlmsghdr;
+
+namespace beerocks {
+namespace net {
+
+/**
+ * @brief Cache of the statistics of all the network interfaces.
+ *
+ * Unlike network_utils::get_iface_stats(), which opens a Netlink socket and dumps all the links
+ * to find a single interface on every call, this class keeps a Netlink socket open and stores
+ * the result of a single RTM_GETLINK dump for all the interfaces, indexed by interface index.
+ *
+ * The cache is refreshed on demand, when it is older than the configured maximum age, or
+ * explicitly with refresh() (e.g. from a periodic timer). Reading the statistics of any number
+ * of interfaces within the maximum age costs a single dump, so a 1905 link metric response for
+ * all the interfaces of a device no longer issues a dump per interface.
+ *
+ * Counters are kept as 64-bit values (IFLA_STATS64 when the kernel provides it).
+ *
+ * Not thread safe, each thread should use its own instance.
+ */
+class InterfaceStatsCache {
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_MAX_AGE = std::chrono::milliseconds(100);
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param max_age Maximum age of the cached statistics, older statistics are refreshed
+     * when read.
+     */
+    explicit InterfaceStatsCache(std::chrono::milliseconds max_age = DEFAULT_MAX_AGE);
+    ~InterfaceStatsCache();
+
+    InterfaceStatsCache(const InterfaceStatsCache &) = delete;
+    InterfaceStatsCache &operator=(const InterfaceStatsCache &) = delete;
+
+    /**
+     * @brief Dump the statistics of all the interfaces into the cache.
+     *
+     * @return True on success and false otherwise (the cache is left unchanged).
+     */
+    bool refresh();
+
+    /**
+     * @brief Gets interface statistics for the given network interface.
+     *
+     * @param[in] iface_name Name of the network interface.
+     * @param[out] iface_stats Interface statistics structure with values read.
+     * @return True on success and false otherwise.
+     */
+    bool get_stats(const std::string &iface_name, sInterfaceStats &iface_stats);
+
+    /**
+     * @brief Gets interface statistics for the given network interface.
+     *
+     * @param[in] iface_index Index of the network interface.
+     * @param[out] iface_stats Interface statistics structure with values read.
+     * @return True on success and false otherwise.
+     */
+    bool get_stats(uint32_t iface_index, sInterfaceStats &iface_stats);
+
+    /**
+     * @brief Gets the number of dumps done so far.
+     */
+    uint32_t get_dump_count() const { return m_dump_count; }
+
+private:
+    struct sCounters {
+        uint64_t tx_bytes   = 0;
+        uint64_t tx_errors  = 0;
+        uint64_t tx_packets = 0;
+        uint64_t rx_bytes   = 0;
+        uint64_t rx_errors  = 0;
+        uint64_t rx_packets = 0;
+    };
+
+    struct sEntry {
+        std::string name;
+        sCounters counters;
+    };
+
+    bool open_socket();
+    void close_socket();
+    bool refresh_if_stale();
+    bool dump(std::unordered_map<uint32_t, sEntry> &entries);
+    void parse_link(const nlmsghdr *msg_ptr, std::unordered_map<uint32_t, sEntry> &entries);
+
+    int m_fd            = -1;
+    uint32_t m_sequence = 0;
+    std::chrono::milliseconds m_max_age;
+    std::chrono::steady_clock::time_point m_last_refresh;
+    bool m_valid          = false;
+    uint32_t m_dump_count = 0;
+
+    std::unordered_map<uint32_t, sEntry> m_entries;
+    std::unordered_map<std::string, uint32_t> m_index_by_name;
+    std::vector<char> m_buffer;
+};
+
+} // namespace net
+} // namespace beerocks
+
+#endif // _BEEROCKS_INTERFACE_STATS_CACHE_H_
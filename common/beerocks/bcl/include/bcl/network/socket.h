@@ -41,6 +41,8 @@ typedef unsigned __int64 ssize_t;
 #include <string>
 #include <vector>
 
+#define SOCKET_MAX_RECEIVED_FDS 4
+
 class Socket {
 public:
     explicit Socket(SOCKET s, long readTimeout = 1000);
@@ -76,6 +78,12 @@ public:
 
 #ifndef IS_WINDOWS
     size_t getBytesWritePending();
+
+    // Writes the buffer together with file descriptors (SCM_RIGHTS), on unix domain sockets only
+    ssize_t writeBytesWithFds(const uint8_t *buf, size_t buf_len, const std::vector<int> &fds);
+
+    // File descriptors received along the data read so far, the caller takes their ownership
+    std::vector<int> takeReceivedFds();
 #endif
 
 protected:
@@ -92,7 +100,13 @@ protected:
     bool m_is_server        = false;
 
 private:
+    void closeReceivedFds();
+#ifndef IS_WINDOWS
+    ssize_t recvWithFds(uint8_t *buf, size_t buf_len, int flags);
+#endif
+
     static int m_ref;
+    std::vector<int> m_received_fds;
 };
 
 class SocketClient : public Socket {
@@ -25,6 +25,14 @@
 #include <stdint.h>
 #endif
 
+#include <string.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 inline uint64_t htonll(uint64_t x)
 {
     return ((1 == htonl(1)) ? (x) : ((uint64_t)htonl((x)&0xFFFFFFFF) << 32) | htonl((x) >> 32));
@@ -42,50 +50,121 @@ inline void swap_16(int16_t &v) { v = htons(v); }
 
 inline void swap_16(uint16_t &v) { v = htons(v); }
 
+/**
+ * @brief Convert a field between host and network byte order, in place.
+ *
+ * The generated code always passes a constant size, so the switch is folded at compile time and
+ * a field costs a single unaligned-safe load, byte swap and store. Nothing is done on big endian
+ * hosts.
+ *
+ * @param size Size of the field in bits.
+ * @param ptr Pointer to the field, which does not need to be aligned.
+ */
 inline void tlvf_swap(uint8_t size, uint8_t *ptr)
 {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
     switch (size) {
     case 16: {
-        uint16_t *tmp16 = reinterpret_cast<uint16_t *>(ptr);
-        swap_16(*tmp16);
+        uint16_t tmp16;
+        memcpy(&tmp16, ptr, sizeof(tmp16));
+        tmp16 = __builtin_bswap16(tmp16);
+        memcpy(ptr, &tmp16, sizeof(tmp16));
         break;
     }
     case 32: {
-        uint32_t *tmp32 = reinterpret_cast<uint32_t *>(ptr);
-        swap_32(*tmp32);
+        uint32_t tmp32;
+        memcpy(&tmp32, ptr, sizeof(tmp32));
+        tmp32 = __builtin_bswap32(tmp32);
+        memcpy(ptr, &tmp32, sizeof(tmp32));
         break;
     }
     case 64: {
-        uint64_t *tmp64 = reinterpret_cast<uint64_t *>(ptr);
-        swap_64(*tmp64);
+        uint64_t tmp64;
+        memcpy(&tmp64, ptr, sizeof(tmp64));
+        tmp64 = __builtin_bswap64(tmp64);
+        memcpy(ptr, &tmp64, sizeof(tmp64));
         break;
     }
     default:
         break;
     }
+#else
+    (void)size;
+    (void)ptr;
+#endif
 }
 
 inline void tlvf_swap(uint8_t size, int8_t *ptr)
 {
-    switch (size) {
-    case 16: {
-        int16_t *tmp16 = reinterpret_cast<int16_t *>(ptr);
-        swap_16(*tmp16);
-        break;
+    tlvf_swap(size, reinterpret_cast<uint8_t *>(ptr));
+}
+
+/**
+ * @brief Convert an array of fields of the same size between host and network byte order.
+ *
+ * Used by the generated code for lists of integers and enums, instead of swapping the elements
+ * one by one. The array is processed 16 bytes at a time with a byte shuffle when SSSE3 or NEON is
+ * available, the remaining elements are swapped with tlvf_swap().
+ *
+ * @param size Size of an element in bits.
+ * @param ptr Pointer to the first element, which does not need to be aligned.
+ * @param count Number of elements in the array.
+ */
+inline void tlvf_swap_array(uint8_t size, void *ptr, size_t count)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (size != 16 && size != 32 && size != 64) {
+        return;
     }
-    case 32: {
-        int32_t *tmp32 = reinterpret_cast<int32_t *>(ptr);
-        swap_32(*tmp32);
+    size_t element_size = size / 8;
+
+    uint8_t *buf = static_cast<uint8_t *>(ptr);
+    size_t i     = 0;
+
+#if defined(__SSSE3__)
+    __m128i mask;
+    switch (size) {
+    case 16:
+        mask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
         break;
-    }
-    case 64: {
-        int64_t *tmp64 = reinterpret_cast<int64_t *>(ptr);
-        swap_64(*tmp64);
+    case 32:
+        mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
         break;
-    }
     default:
+        mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
         break;
     }
+    for (size_t per_vector = 16 / element_size; i + per_vector <= count; i += per_vector) {
+        __m128i *vec = reinterpret_cast<__m128i *>(buf + i * element_size);
+        _mm_storeu_si128(vec, _mm_shuffle_epi8(_mm_loadu_si128(vec), mask));
+    }
+#elif defined(__ARM_NEON)
+    for (size_t per_vector = 16 / element_size; i + per_vector <= count; i += per_vector) {
+        uint8_t *vec = buf + i * element_size;
+        uint8x16_t v = vld1q_u8(vec);
+        switch (size) {
+        case 16:
+            v = vrev16q_u8(v);
+            break;
+        case 32:
+            v = vrev32q_u8(v);
+            break;
+        default:
+            v = vrev64q_u8(v);
+            break;
+        }
+        vst1q_u8(vec, v);
+    }
+#endif
+
+    for (; i < count; i++) {
+        tlvf_swap(size, buf + i * element_size);
+    }
+#else
+    (void)size;
+    (void)ptr;
+    (void)count;
+#endif
 }
 
 #endif
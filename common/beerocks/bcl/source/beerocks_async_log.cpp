@@ -0,0 +1,721 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_async_log.h>
+#include <bcl/beerocks_shm_ring.h>
+#include <bcl/network/socket.h>
+
+#include <lazy_log.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <syslog.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace beerocks {
+
+static constexpr size_t ASYNC_LOG_RECORD_SIZE = 256;
+
+/**
+ * Records in the ring of each logging thread (64 KiB), enough for a burst of a few hundred lines.
+ */
+static constexpr size_t ASYNC_LOG_RING_CAPACITY = 256;
+
+/**
+ * Lines longer than this number of records are truncated.
+ */
+static constexpr size_t ASYNC_LOG_MAX_LINE_RECORDS = 16;
+
+static constexpr size_t ASYNC_LOG_MAX_LOGGERS = 16;
+
+/**
+ * Each logging thread owns a ring, i.e. a memfd, an eventfd and 64 KiB of memory, until it exits.
+ * prplMesh processes have a handful of logging threads, the rings are bounded in case a process
+ * keeps creating threads (2 MiB and 64 file descriptors at most).
+ */
+static constexpr size_t ASYNC_LOG_MAX_PRODUCERS = 32;
+
+/**
+ * Lines of the threads which have no ring, queued under the lock until the writer wakes up.
+ */
+static constexpr size_t ASYNC_LOG_MAX_SHARED_LINES = 256;
+
+/**
+ * The writer also wakes up periodically to release the rings of the threads which exited.
+ */
+static constexpr int ASYNC_LOG_POLL_TIMEOUT_MSEC = 1000;
+
+static constexpr int ASYNC_LOG_NET_CONNECT_TIMEOUT_MSEC = 1000;
+static constexpr auto ASYNC_LOG_NET_RETRY_INTERVAL      = std::chrono::seconds(10);
+
+static constexpr int ASYNC_LOG_ROLLED_FILES_COUNT = 3;
+
+/**
+ * @brief Chunk of a log line, as pushed to the ring of the logging thread.
+ */
+struct sLogRecord {
+    uint8_t logger;   // Index of the attached logger
+    uint8_t priority; // syslog priority of the line
+    uint8_t last;     // Last chunk of the line
+    uint8_t length;   // Length of the text
+    char text[ASYNC_LOG_RECORD_SIZE - 4];
+};
+static_assert(sizeof(sLogRecord) == ASYNC_LOG_RECORD_SIZE, "Unexpected sLogRecord size");
+
+/**
+ * @brief The ring of a logging thread.
+ */
+struct sProducer {
+    std::unique_ptr<shm_ring> ring;
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> exited{false};
+
+    // Writer only
+    std::string line;
+    uint64_t reported_dropped = 0;
+};
+
+/**
+ * @brief Owner of the ring of the current thread, which tells the writer when the thread exits.
+ */
+struct sProducerHolder {
+    std::shared_ptr<sProducer> producer;
+    bool failed      = false; // Creating the ring failed, not retried
+    bool dispatching = false;
+
+    ~sProducerHolder()
+    {
+        if (producer) {
+            producer->exited.store(true, std::memory_order_release);
+        }
+    }
+};
+
+static thread_local sProducerHolder s_producer_holder;
+
+/**
+ * @brief Outputs of an attached logger, owned by the writer thread.
+ */
+struct sLoggerOutputs {
+    bool to_file = false;
+    std::string file_path;
+    size_t roll_size = 0;
+    bool to_stdout   = false;
+    bool to_syslog   = false;
+    std::string net_server;
+    uint16_t net_port = 0;
+
+    // Writer only
+    FILE *file       = nullptr;
+    size_t file_size = 0;
+    std::unique_ptr<SocketClient> net;
+    std::chrono::steady_clock::time_point net_retry_time;
+};
+
+/**
+ * @brief Line of a thread which has no ring.
+ */
+struct sSharedLine {
+    int logger;
+    int priority;
+    std::string text;
+};
+
+class AsyncLogDispatchCallback;
+
+/**
+ * @brief State of the asynchronous log, created on the first attach() and never destroyed, since
+ * the log dispatch may run until the very end of the process.
+ */
+struct sAsyncLog {
+    int control_fd = -1;
+
+    // Loggers ids, read by the logging threads without locking: an id is set before the count is
+    // increased, and never changed
+    std::string logger_ids[ASYNC_LOG_MAX_LOGGERS];
+    std::atomic<size_t> logger_count{0};
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<sProducer>> producers;
+    uint64_t producers_generation = 0;
+    // Outputs set by attach(), taken by the writer
+    std::vector<std::unique_ptr<sLoggerOutputs>> new_outputs;
+    // Lines of the threads which have no ring, taken by the writer
+    std::vector<sSharedLine> shared_lines;
+    uint64_t shared_dropped = 0;
+
+    std::condition_variable flushed_cv;
+    uint64_t flush_requested = 0;
+    uint64_t flushed         = 0;
+
+    std::atomic<uint64_t> dropped{0};
+
+    std::thread writer;
+};
+
+static std::mutex s_async_log_mutex;
+static sAsyncLog *s_async_log = nullptr;
+
+static void wake_up_writer(sAsyncLog &async_log)
+{
+    uint64_t value = 1;
+    if (write(async_log.control_fd, &value, sizeof(value)) < 0) {
+        // EAGAIN means the counter is saturated, so the writer is about to wake up anyway
+    }
+}
+
+static int find_logger(const sAsyncLog &async_log, const std::string &logger_id)
+{
+    auto count = async_log.logger_count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        if (async_log.logger_ids[i] == logger_id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int level_to_syslog_priority(el::Level level)
+{
+    switch (level) {
+    case el::Level::Fatal:
+        return LOG_EMERG;
+    case el::Level::Error:
+        return LOG_ERR;
+    case el::Level::Warning:
+        return LOG_WARNING;
+    case el::Level::Info:
+        return LOG_INFO;
+    case el::Level::Debug:
+        return LOG_DEBUG;
+    default:
+        return LOG_NOTICE;
+    }
+}
+
+//====================================================================================
+// Logging threads
+//====================================================================================
+
+static sProducer *get_producer(sAsyncLog &async_log)
+{
+    auto &holder = s_producer_holder;
+    if (holder.producer) {
+        return holder.producer.get();
+    }
+    if (holder.failed) {
+        return nullptr;
+    }
+
+    // When too many threads log at the same time, the thread gets a ring once another thread
+    // exits, and its lines go through the shared queue meanwhile (see push_shared_line())
+    {
+        std::lock_guard<std::mutex> lock(async_log.mutex);
+        if (async_log.producers.size() >= ASYNC_LOG_MAX_PRODUCERS) {
+            return nullptr;
+        }
+    }
+
+    // Creating the ring fails only when running out of file descriptors or memory
+    std::shared_ptr<sProducer> producer(new sProducer);
+    producer->ring = shm_ring::create("async_log", sizeof(sLogRecord), ASYNC_LOG_RING_CAPACITY);
+    if (!producer->ring) {
+        holder.failed = true;
+        return nullptr;
+    }
+    holder.producer = producer;
+
+    {
+        std::lock_guard<std::mutex> lock(async_log.mutex);
+        async_log.producers.push_back(producer);
+        async_log.producers_generation++;
+    }
+    wake_up_writer(async_log);
+
+    return producer.get();
+}
+
+static bool push_line(sAsyncLog &async_log, sProducer &producer, int logger, int priority,
+                      std::string &&line)
+{
+    size_t records = (line.size() + sizeof(sLogRecord::text) - 1) / sizeof(sLogRecord::text);
+    if (records > ASYNC_LOG_MAX_LINE_RECORDS) {
+        records = ASYNC_LOG_MAX_LINE_RECORDS;
+        line.resize(records * sizeof(sLogRecord::text));
+        line.back() = '\n';
+    }
+
+    // A line is published entirely or not at all
+    if (producer.ring->get_free_count() < records) {
+        producer.dropped.fetch_add(1, std::memory_order_relaxed);
+        async_log.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    sLogRecord record;
+    record.logger   = logger;
+    record.priority = priority;
+    size_t offset   = 0;
+    for (size_t i = 0; i < records; i++) {
+        record.length = std::min(line.size() - offset, sizeof(record.text));
+        record.last   = (i == records - 1);
+        std::memcpy(record.text, line.data() + offset, record.length);
+        offset += record.length;
+        producer.ring->push(&record, offsetof(sLogRecord, text) + record.length);
+    }
+
+    return producer.ring->commit();
+}
+
+/**
+ * @brief Queues the line of a thread which has no ring, under the lock.
+ */
+static bool push_shared_line(sAsyncLog &async_log, int logger, int priority, std::string &&line)
+{
+    {
+        std::lock_guard<std::mutex> lock(async_log.mutex);
+        if (async_log.shared_lines.size() >= ASYNC_LOG_MAX_SHARED_LINES) {
+            async_log.shared_dropped++;
+            async_log.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        async_log.shared_lines.push_back({logger, priority, std::move(line)});
+    }
+    wake_up_writer(async_log);
+
+    return true;
+}
+
+/**
+ * @brief Replaces the default easylogging++ dispatch callback, which it still uses for the
+ * loggers which are not attached.
+ */
+class AsyncLogDispatchCallback : public el::base::DefaultLogDispatchCallback {
+protected:
+    void handle(const el::LogDispatchData *data) override
+    {
+
+        //////////////////////////////
+        // DO NOT USE LOGGING HERE! //
+        //////////////////////////////
+
+        auto async_log = s_async_log;
+        auto &holder   = s_producer_holder;
+        auto message   = data->logMessage();
+
+        int logger = -1;
+        if (async_log && !holder.dispatching &&
+            data->dispatchAction() == el::base::DispatchAction::NormalLog) {
+            logger = find_logger(*async_log, message->logger()->id());
+        }
+
+        if (logger < 0) {
+            el::base::DefaultLogDispatchCallback::handle(data);
+            return;
+        }
+
+        // Guards against recursion, if creating the ring logs
+        holder.dispatching = true;
+        auto producer      = get_producer(*async_log);
+        holder.dispatching = false;
+        auto priority = level_to_syslog_priority(message->level());
+        auto line     = message->logger()->logBuilder()->build(message, true);
+        if (producer) {
+            push_line(*async_log, *producer, logger, priority, std::move(line));
+        } else {
+            // easylogging++ no longer writes the lines of the attached loggers
+            push_shared_line(*async_log, logger, priority, std::move(line));
+        }
+
+        if (message->level() == el::Level::Fatal) {
+            async_log::flush();
+        }
+    }
+};
+
+//====================================================================================
+// Writer thread
+//====================================================================================
+
+static void close_file(sLoggerOutputs &outputs)
+{
+    if (outputs.file) {
+        fclose(outputs.file);
+        outputs.file = nullptr;
+    }
+}
+
+static void open_file(sLoggerOutputs &outputs)
+{
+    close_file(outputs);
+    if (!outputs.to_file || outputs.file_path.empty()) {
+        return;
+    }
+
+    outputs.file = fopen(outputs.file_path.c_str(), "a");
+    if (!outputs.file) {
+        std::cerr << "async_log: failed opening " << outputs.file_path << ": " << strerror(errno)
+                  << std::endl;
+        return;
+    }
+    fseek(outputs.file, 0, SEEK_END);
+    outputs.file_size = ftell(outputs.file);
+}
+
+/**
+ * @brief Rolls the log file in place, like RollMonitor: <file>.1 is the most recent rolled file,
+ * and the oldest one is dropped.
+ */
+static void roll_file(sLoggerOutputs &outputs)
+{
+    const auto &path = outputs.file_path;
+    for (int i = ASYNC_LOG_ROLLED_FILES_COUNT - 1; i > 0; i--) {
+        auto older_name = path + "." + std::to_string(i + 1);
+        auto newer_name = path + "." + std::to_string(i);
+        rename(newer_name.c_str(), older_name.c_str());
+    }
+
+    close_file(outputs);
+    if (rename(path.c_str(), (path + ".1").c_str()) != 0) {
+        std::cerr << "async_log: failed to roll logs" << std::endl;
+    }
+    outputs.file = fopen(path.c_str(), "w");
+    if (!outputs.file) {
+        std::cerr << "async_log: failed opening " << path << ": " << strerror(errno)
+                  << std::endl;
+    }
+    outputs.file_size = 0;
+}
+
+static void write_net(sLoggerOutputs &outputs, const std::string &line)
+{
+    if (outputs.net_server.empty()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (!outputs.net) {
+        if (now < outputs.net_retry_time) {
+            return;
+        }
+        outputs.net.reset(new SocketClient(outputs.net_server, outputs.net_port,
+                                           ASYNC_LOG_NET_CONNECT_TIMEOUT_MSEC));
+    }
+
+    if (outputs.net->writeString(line) != ssize_t(line.size())) {
+        // Lines are lost until the server is reachable again
+        outputs.net.reset();
+        outputs.net_retry_time = now + ASYNC_LOG_NET_RETRY_INTERVAL;
+    }
+}
+
+static void write_line(sLoggerOutputs &outputs, int priority, const std::string &line)
+{
+    if (outputs.file) {
+        fwrite(line.data(), 1, line.size(), outputs.file);
+        outputs.file_size += line.size();
+        if (outputs.roll_size && outputs.file_size >= outputs.roll_size) {
+            roll_file(outputs);
+        }
+    }
+
+    if (outputs.to_stdout) {
+        fwrite(line.data(), 1, line.size(), stdout);
+    }
+
+    if (outputs.to_syslog) {
+        syslog(priority, "%s", line.c_str());
+    }
+
+    write_net(outputs, line);
+}
+
+static void drain_producer(sProducer &producer,
+                           std::vector<std::unique_ptr<sLoggerOutputs>> &loggers)
+{
+    sLogRecord record;
+    while (producer.ring->pop(&record)) {
+        producer.line.append(record.text, record.length);
+        if (!record.last) {
+            continue;
+        }
+
+        if (record.logger < loggers.size() && loggers[record.logger]) {
+            write_line(*loggers[record.logger], record.priority, producer.line);
+        }
+        producer.line.clear();
+    }
+}
+
+static void write_shared_lines(const std::vector<sSharedLine> &lines,
+                               std::vector<std::unique_ptr<sLoggerOutputs>> &loggers)
+{
+    for (const auto &line : lines) {
+        if (size_t(line.logger) < loggers.size() && loggers[line.logger]) {
+            write_line(*loggers[line.logger], line.priority, line.text);
+        }
+    }
+}
+
+static void report_dropped(uint64_t dropped, uint64_t &reported_dropped, const char *reason,
+                           std::vector<std::unique_ptr<sLoggerOutputs>> &loggers)
+{
+    if (dropped == reported_dropped) {
+        return;
+    }
+
+    auto line = "WARNING async_log: " + std::to_string(dropped - reported_dropped) +
+                " lines dropped, " + reason + "\n";
+    reported_dropped = dropped;
+
+    for (auto &outputs : loggers) {
+        if (outputs) {
+            write_line(*outputs, LOG_WARNING, line);
+        }
+    }
+}
+
+/**
+ * @brief Writes the lines of all the logging threads to the outputs of their logger.
+ *
+ * Must not log, its own lines would only be written on its next wake-up.
+ */
+static void writer_thread(sAsyncLog &async_log)
+{
+    std::vector<std::unique_ptr<sLoggerOutputs>> loggers;
+    std::vector<std::shared_ptr<sProducer>> producers;
+    uint64_t producers_generation = UINT64_MAX;
+    std::vector<sSharedLine> shared_lines;
+    uint64_t shared_dropped          = 0;
+    uint64_t reported_shared_dropped = 0;
+    std::vector<struct pollfd> fds;
+
+    while (true) {
+        uint64_t flush_request;
+        {
+            std::lock_guard<std::mutex> lock(async_log.mutex);
+
+            if (producers_generation != async_log.producers_generation) {
+                producers_generation = async_log.producers_generation;
+                producers            = async_log.producers;
+            }
+
+            for (size_t i = 0; i < async_log.new_outputs.size(); i++) {
+                if (!async_log.new_outputs[i]) {
+                    continue;
+                }
+                if (loggers.size() <= i) {
+                    loggers.resize(i + 1);
+                }
+                if (loggers[i]) {
+                    close_file(*loggers[i]);
+                }
+                loggers[i] = std::move(async_log.new_outputs[i]);
+                open_file(*loggers[i]);
+            }
+
+            shared_lines.swap(async_log.shared_lines);
+            shared_dropped = async_log.shared_dropped;
+
+            // Everything logged before the request is in the rings or in the shared lines
+            flush_request = async_log.flush_requested;
+        }
+
+        bool exited = false;
+        for (auto &producer : producers) {
+            // Read the flag before draining, the thread may log until it exits
+            bool producer_exited = producer->exited.load(std::memory_order_acquire);
+            producer->ring->clear_notification();
+            drain_producer(*producer, loggers);
+            report_dropped(producer->dropped.load(std::memory_order_relaxed),
+                           producer->reported_dropped, "the log ring of the thread is full",
+                           loggers);
+            exited |= producer_exited;
+        }
+
+        write_shared_lines(shared_lines, loggers);
+        shared_lines.clear();
+        report_dropped(shared_dropped, reported_shared_dropped,
+                       "too many logging threads without a log ring", loggers);
+
+        for (auto &outputs : loggers) {
+            if (outputs && outputs->file) {
+                fflush(outputs->file);
+            }
+        }
+        fflush(stdout);
+
+        {
+            std::lock_guard<std::mutex> lock(async_log.mutex);
+
+            if (exited) {
+                async_log.producers.erase(
+                    std::remove_if(async_log.producers.begin(), async_log.producers.end(),
+                                   [](const std::shared_ptr<sProducer> &producer) {
+                                       return producer->exited.load(std::memory_order_acquire) &&
+                                              producer->ring->get_free_count() ==
+                                                  producer->ring->get_capacity();
+                                   }),
+                    async_log.producers.end());
+                async_log.producers_generation++;
+            }
+
+            async_log.flushed = flush_request;
+        }
+        async_log.flushed_cv.notify_all();
+
+        fds.clear();
+        fds.push_back({async_log.control_fd, POLLIN, 0});
+        for (auto &producer : producers) {
+            fds.push_back({producer->ring->get_eventfd(), POLLIN, 0});
+        }
+        if (poll(fds.data(), fds.size(), ASYNC_LOG_POLL_TIMEOUT_MSEC) > 0 &&
+            (fds[0].revents & POLLIN)) {
+            uint64_t value;
+            if (read(async_log.control_fd, &value, sizeof(value)) < 0) {
+                // EAGAIN, another wake-up already cleared the counter
+            }
+        }
+    }
+}
+
+static sAsyncLog *start()
+{
+    if (s_async_log) {
+        return s_async_log;
+    }
+
+    std::unique_ptr<sAsyncLog> async_log(new sAsyncLog);
+    async_log->control_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (async_log->control_fd < 0) {
+        LOG(ERROR) << "Failed creating eventfd: " << strerror(errno);
+        return nullptr;
+    }
+
+    async_log->writer = std::thread(writer_thread, std::ref(*async_log));
+
+    {
+        // The callbacks are not protected against concurrent dispatches otherwise
+        el::base::threading::ScopedLock lock(ELPP->lock());
+        el::Helpers::installLogDispatchCallback<AsyncLogDispatchCallback>(
+            "AsyncLogDispatchCallback");
+        el::Helpers::uninstallLogDispatchCallback<el::base::DefaultLogDispatchCallback>(
+            "DefaultLogDispatchCallback");
+    }
+
+    // Never destroyed, see sAsyncLog
+    s_async_log = async_log.release();
+
+    // Write the pending lines when the process exits normally
+    std::atexit([]() { async_log::flush(); });
+
+    return s_async_log;
+}
+
+//====================================================================================
+// async_log
+//====================================================================================
+
+bool async_log::attach(const std::string &logger_id, bool auto_roll,
+                       const std::string &net_server, uint16_t net_port)
+{
+    auto logger = el::Loggers::getLogger(logger_id, false);
+    if (!logger) {
+        LOG(ERROR) << "Unknown logger " << logger_id;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_async_log_mutex);
+
+    auto async_log = start();
+    if (!async_log) {
+        return false;
+    }
+
+    int index = find_logger(*async_log, logger_id);
+    if (index < 0) {
+        index = async_log->logger_count.load(std::memory_order_relaxed);
+        if (size_t(index) >= ASYNC_LOG_MAX_LOGGERS) {
+            LOG(ERROR) << "Too many attached loggers, " << logger_id << " stays synchronous";
+            return false;
+        }
+    }
+
+    // The outputs are the same for all the levels, see logging::apply_settings()
+    auto typed_configurations = logger->typedConfigurations();
+    std::unique_ptr<sLoggerOutputs> outputs(new sLoggerOutputs);
+    outputs->to_file   = typed_configurations->toFile(el::Level::Info);
+    outputs->file_path = typed_configurations->filename(el::Level::Info);
+    outputs->roll_size =
+        auto_roll ? typed_configurations->maxLogFileSize(el::Level::Info) / 2 : 0;
+    outputs->to_stdout  = typed_configurations->toStandardOutput(el::Level::Info);
+    outputs->to_syslog  = typed_configurations->toSyslog(el::Level::Info);
+    outputs->net_server = net_server;
+    outputs->net_port   = net_port;
+
+    {
+        std::lock_guard<std::mutex> async_log_lock(async_log->mutex);
+        if (async_log->new_outputs.size() <= size_t(index)) {
+            async_log->new_outputs.resize(index + 1);
+        }
+        async_log->new_outputs[index] = std::move(outputs);
+    }
+
+    // Lines already dispatched to this logger may be written to the previous outputs, or
+    // synchronously until easylogging++ stops writing them
+    if (size_t(index) == async_log->logger_count.load(std::memory_order_relaxed)) {
+        async_log->logger_ids[index] = logger_id;
+        async_log->logger_count.store(index + 1, std::memory_order_release);
+    }
+    wake_up_writer(*async_log);
+
+    lazy_log::reconfigure_logger(logger_id, el::ConfigurationType::ToFile, "false");
+    lazy_log::reconfigure_logger(logger_id, el::ConfigurationType::ToStandardOutput, "false");
+    lazy_log::reconfigure_logger(logger_id, el::ConfigurationType::ToSyslog, "false");
+
+    return true;
+}
+
+bool async_log::flush(int timeout_msec)
+{
+    auto async_log = s_async_log;
+    if (!async_log) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(async_log->mutex);
+    auto request = ++async_log->flush_requested;
+    wake_up_writer(*async_log);
+
+    return async_log->flushed_cv.wait_for(lock, std::chrono::milliseconds(timeout_msec), [&]() {
+        return async_log->flushed >= request;
+    });
+}
+
+uint64_t async_log::get_dropped_count()
+{
+    auto async_log = s_async_log;
+    if (!async_log) {
+        return 0;
+    }
+
+    return async_log->dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace beerocks
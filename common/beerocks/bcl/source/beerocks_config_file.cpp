@@ -28,7 +28,9 @@ static bool read_log_section(const std::string &config_file_path, config_file::S
         std::make_tuple("log_files_path=", &sLogConf.files_path, mandatory),
         std::make_tuple("log_files_auto_roll=", &sLogConf.files_auto_roll, mandatory),
         std::make_tuple("log_stdout_enabled=", &sLogConf.stdout_enabled, mandatory),
-        std::make_tuple("log_syslog_enabled=", &sLogConf.syslog_enabled, optional)};
+        std::make_tuple("log_syslog_enabled=", &sLogConf.syslog_enabled, optional),
+        std::make_tuple("log_async_enabled=", &sLogConf.async_enabled, optional),
+        std::make_tuple("log_net_server=", &sLogConf.net_server, optional)};
 
     std::string section = "log";
     bool ret_val        = config_file::read_config_file(config_file_path, log_conf_args, section);
@@ -153,6 +155,7 @@ bool config_file::read_slave_config_file(const std::string &config_file_path, sC
             std::make_tuple("bridge_iface=", &conf.bridge_iface, 0),
             std::make_tuple("enable_system_hang_test=", &conf.enable_system_hang_test, 0),
             std::make_tuple("const_backhaul_slave=", &conf.const_backhaul_slave, 0),
+            std::make_tuple("enable_stats_ring=", &conf.enable_stats_ring, 0),
         };
         std::string config_type = "global";
         if (!read_config_file(config_file_path, slave_global_conf_args, config_type)) {
@@ -171,6 +174,8 @@ bool config_file::read_slave_config_file(const std::string &config_file_path, sC
             std::make_tuple("backhaul_wire_iface_type=", &conf.backhaul_wire_iface_type,
                             mandatory_slave),
             std::make_tuple("backhaul_wire_iface=", &conf.backhaul_wire_iface, mandatory_slave),
+            std::make_tuple("link_metrics_sampling_interval_ms=",
+                            &conf.link_metrics_sampling_interval_ms, 0),
         };
         std::string config_type = "backhaul";
         if (!read_config_file(config_file_path, slave_global_conf_args, config_type)) {
@@ -6,9 +6,9 @@
  * See LICENSE file for more details.
  */
 
+#include <bcl/beerocks_async_log.h>
 #include <bcl/beerocks_logging.h>
 #include <bcl/beerocks_os_utils.h>
-#include <bcl/network/socket.h>
 
 #include <algorithm>
 #include <iostream>
@@ -19,6 +19,7 @@
 
 #define LOG_MAX_LEVELS 6
 #define LOGGING_DEFAULT_MAX_SIZE (size_t)100000
+#define LOGGING_ROLLED_FILES_COUNT 3
 
 class RollMonitor : public el::LogDispatchCallback {
 public:
@@ -64,63 +65,38 @@ public:
 
         // Check if rolling should be triggered
         if (logFileSize >= m_szRollLogFileSize) {
-            // get process path
-            std::stringstream exe_path;
-            exe_path << "/proc/" << getpid() << "/exe";
-            char process_dir[1024] = {0};
-            int bytes = readlink(exe_path.str().c_str(), process_dir, sizeof(process_dir));
-
-            if (bytes >= 0) {
-                // remove process name from process path to get process dir path
-                std::string process_dir_str(process_dir);
-                process_dir_str.erase(process_dir_str.rfind("/"));
-
-                std::string fullPathCmd(process_dir_str +
-                                        std::string("/beerocks_utils.sh roll_logs&"));
-
-                if (system(fullPathCmd.c_str()) != 0) {
-                    std::cout << "System returned non-zero" << std::endl;
-                }
-
-                // Disable the callback - it will be reenabled after the roll
-                enable(false);
-            } else {
-                std::cout << "failed to roll logs" << std::endl;
-            }
+            auto logFileName =
+                logData->logMessage()->logger()->typedConfigurations()->filename(el::Level::Info);
+            roll(logFileName);
         }
     }
 
 private:
-    el::base::type::fstream_t *m_fsLogFileStream = nullptr;
-    std::size_t m_szRollLogFileSize              = 0;
-    bool m_enabled                               = true;
-};
-
-class NetLogger : public el::LogDispatchCallback {
-public:
-    void enable(const std::string &server, uint16_t port, const std::string &module_name)
+    /**
+     * @brief Roll the log file in place: <file>.1 is the most recent rolled file, and the oldest
+     * one is dropped. The file keeps its name, so the symbolic link to it stays valid.
+     *
+     * Called from the log dispatch, with the easylogging++ lock held, so no other thread is
+     * writing to the file stream.
+     */
+    void roll(const std::string &logFileName)
     {
-        m_server      = server;
-        m_port        = port;
-        m_module_name = module_name;
-        this->setEnabled(true);
-    }
+        for (int i = LOGGING_ROLLED_FILES_COUNT - 1; i > 0; i--) {
+            auto olderName = logFileName + "." + std::to_string(i + 1);
+            auto newerName = logFileName + "." + std::to_string(i);
+            rename(newerName.c_str(), olderName.c_str());
+        }
 
-protected:
-    void handle(const el::LogDispatchData *logdata) noexcept override
-    {
-        std::string msg = m_module_name + ": " +
-                          logdata->logMessage()->logger()->logBuilder()->build(
-                              logdata->logMessage(),
-                              logdata->dispatchAction() == el::base::DispatchAction::NormalLog);
-        SocketClient logmaster(m_server, m_port);
-        logmaster.writeString(msg);
+        m_fsLogFileStream->close();
+        if (rename(logFileName.c_str(), (logFileName + ".1").c_str()) != 0) {
+            std::cout << "failed to roll logs" << std::endl;
+        }
+        m_fsLogFileStream->open(logFileName, std::fstream::out | std::fstream::trunc);
     }
 
-private:
-    std::string m_server;
-    uint16_t m_port;
-    std::string m_module_name;
+    el::base::type::fstream_t *m_fsLogFileStream = nullptr;
+    std::size_t m_szRollLogFileSize              = 0;
+    bool m_enabled                               = true;
 };
 
 static std::string log_level_to_string(const beerocks::eLogLevel &log_level)
@@ -354,6 +330,11 @@ logging::logging(const std::string &module_name, const beerocks::config_file::SC
     } else {
         m_settings_map.insert({"log_syslog_enabled", "false"});
     }
+    m_settings_map.insert(
+        {"log_async_enabled", settings.async_enabled.empty() ? "false" : settings.async_enabled});
+    if (!settings.net_server.empty()) {
+        m_settings_map.insert({"log_net_server", settings.net_server});
+    }
 
     if (!logger_id.empty()) {
         m_logger_id = logger_id;
@@ -438,6 +419,8 @@ bool logging::get_stdout_enabled() { return m_stdout_enabled; }
 
 bool logging::get_syslog_enabled() { return m_syslog_enabled; }
 
+bool logging::get_async_enabled() { return m_async_enabled; }
+
 void logging::set_log_level_state(const eLogLevel &log_level, const bool &new_state)
 {
     m_levels.set_log_level_state(log_level, new_state);
@@ -446,7 +429,7 @@ void logging::set_log_level_state(const eLogLevel &log_level, const bool &new_st
 
 void logging::attach_current_thread_to_logger_id()
 {
-    el::Helpers::attachLoggerIdThreadId(m_logger_id);
+    lazy_log::attach_current_thread(m_logger_id);
 }
 
 void logging::set_thread_name(const std::string &thread_name)
@@ -470,7 +453,7 @@ void logging::handle_logging_rollover(const char *log_name, std::size_t)
 void logging::apply_settings()
 {
     // Disable The instance of RollMonitor to start fresh
-    if (m_log_files_auto_roll) {
+    if (m_log_files_auto_roll || m_async_enabled) {
         auto roll_monitor = el::Helpers::logDispatchCallback<RollMonitor>("RollMonitor");
         if (roll_monitor) {
             roll_monitor->enable(false);
@@ -537,7 +520,7 @@ void logging::apply_settings()
         return;
     }
 
-    el::Loggers::reconfigureLogger(m_logger_id, defaultConf);
+    lazy_log::reconfigure_logger(m_logger_id, defaultConf);
 
     el::Loggers::addFlag(el::LoggingFlag::ImmediateFlush);
     el::Loggers::addFlag(el::LoggingFlag::LogDetailedCrashReason);
@@ -563,6 +546,14 @@ void logging::apply_settings()
         }
     }
 
+    // Move the outputs to the writer thread of async_log, which also rolls the log file
+    if (m_async_enabled) {
+        if (async_log::attach(m_logger_id, m_log_files_auto_roll, m_net_server, m_net_port)) {
+            return;
+        }
+        LOG(ERROR) << "Failed enabling asynchronous logging";
+    }
+
     // Enable roll monitor
     if (m_log_files_auto_roll) {
         auto roll_monitor = el::Helpers::logDispatchCallback<RollMonitor>("RollMonitor");
@@ -713,6 +704,23 @@ void logging::eval_settings()
     }
     m_syslog_levels = levels & module_levels;
 
+    // async_enabled
+    setting = m_settings_map.find("log_async_enabled");
+    if (setting != m_settings_map.end()) {
+        m_async_enabled = string_utils::trimmed_substr(setting->second) == "true";
+    }
+
+    // net_server, the network log server (e.g. logmaster) which receives the lines, as host:port
+    setting = m_settings_map.find("log_net_server");
+    if (setting != m_settings_map.end()) {
+        auto server = string_utils::trimmed_substr(setting->second);
+        auto pos    = server.find_last_of(':');
+        if (pos != std::string::npos) {
+            m_net_server = server.substr(0, pos);
+            m_net_port   = strtoul(server.substr(pos + 1).c_str(), nullptr, 10);
+        }
+    }
+
     // stdout_enabled
     setting = m_settings_map.find("log_stdout_enabled");
     if (setting != m_settings_map.end()) {
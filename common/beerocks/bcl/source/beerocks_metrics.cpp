@@ -0,0 +1,470 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_metrics.h>
+#include <bcl/network/socket.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <set>
+#include <sstream>
+#include <sys/eventfd.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace beerocks {
+namespace metrics {
+
+/**
+ * Maximum number of slots, one per counter and HISTOGRAM_BUCKETS + 1 per histogram (about 370
+ * histograms).
+ */
+static constexpr int MAX_SLOTS = 8192;
+
+/**
+ * The block of a thread is allocated in chunks of slots (2 KiB), on the first update of a metric
+ * of the chunk, so that a thread only pays for the metrics which are registered and which it
+ * updates.
+ */
+static constexpr int CHUNK_SLOTS = 256;
+static constexpr int MAX_CHUNKS  = MAX_SLOTS / CHUNK_SLOTS;
+
+static constexpr int HISTOGRAM_SLOTS = HISTOGRAM_BUCKETS + 1;
+
+static constexpr int EXPORT_MAX_CONNECTIONS    = 4;
+static constexpr int EXPORT_WRITE_TIMEOUT_MSEC = 1000;
+
+enum class eMetricType { COUNTER, GAUGE, HISTOGRAM };
+
+struct sMetric {
+    eMetricType type;
+    std::string name;
+    std::string help;
+    std::string label;
+    int slot                    = -1;
+    std::atomic<int64_t> *gauge = nullptr;
+};
+
+struct sSlotsChunk {
+    std::atomic<uint64_t> values[CHUNK_SLOTS];
+
+    sSlotsChunk()
+    {
+        for (auto &value : values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * @brief Block of slots of a thread.
+ */
+struct sSlots {
+    // Allocated by the owner thread, read by the other threads under the registry lock
+    std::atomic<sSlotsChunk *> chunks[MAX_CHUNKS];
+
+    sSlots()
+    {
+        for (auto &chunk : chunks) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~sSlots()
+    {
+        for (auto &chunk : chunks) {
+            delete chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Gets a slot to update it, allocating its chunk if needed. Owner thread only.
+     */
+    std::atomic<uint64_t> &get(int slot)
+    {
+        auto &chunk_ptr = chunks[slot / CHUNK_SLOTS];
+        auto chunk      = chunk_ptr.load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new sSlotsChunk;
+            chunk_ptr.store(chunk, std::memory_order_release);
+        }
+        return chunk->values[slot % CHUNK_SLOTS];
+    }
+
+    /**
+     * @brief Reads a slot, 0 if its chunk is not allocated.
+     */
+    uint64_t read(int slot) const
+    {
+        auto chunk = chunks[slot / CHUNK_SLOTS].load(std::memory_order_acquire);
+        return chunk ? chunk->values[slot % CHUNK_SLOTS].load(std::memory_order_relaxed) : 0;
+    }
+};
+
+/**
+ * @brief Registered metrics and blocks of slots of the threads, created on first use and never
+ * destroyed, since metrics may be updated by static objects and threads until the very end of
+ * the process.
+ */
+struct sRegistry {
+    std::mutex mutex;
+    std::vector<sMetric> metrics;
+    int slots_count = 0;
+    std::set<sSlots *> threads_slots;
+    // Totals of the threads which exited, one per registered slot
+    std::vector<uint64_t> retired;
+};
+
+static sRegistry &registry()
+{
+    static sRegistry *s_registry = new sRegistry;
+    return *s_registry;
+}
+
+// Block of the current thread. A plain pointer, so reading it does not go through the lazy
+// initialization of thread_local objects
+static thread_local sSlots *s_slots = nullptr;
+
+/**
+ * @brief Owner of the block of the current thread, which folds it into the totals when the
+ * thread exits.
+ */
+struct sSlotsHolder {
+    std::unique_ptr<sSlots> slots;
+
+    ~sSlotsHolder()
+    {
+        if (!slots) {
+            return;
+        }
+        auto &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (int i = 0; i < reg.slots_count; i++) {
+            reg.retired[i] += slots->read(i);
+        }
+        reg.threads_slots.erase(slots.get());
+        s_slots = nullptr;
+    }
+};
+
+static thread_local sSlotsHolder s_slots_holder;
+
+static sSlots *thread_slots()
+{
+    if (s_slots) {
+        return s_slots;
+    }
+
+    s_slots_holder.slots.reset(new sSlots);
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.threads_slots.insert(s_slots_holder.slots.get());
+    s_slots = s_slots_holder.slots.get();
+    return s_slots;
+}
+
+static inline void slot_add(int slot, uint64_t value)
+{
+    // Only the current thread writes its block
+    auto &slot_value = thread_slots()->get(slot);
+    slot_value.store(slot_value.load(std::memory_order_relaxed) + value,
+                     std::memory_order_relaxed);
+}
+
+static int register_metric(sMetric metric, int slots)
+{
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (slots > 0) {
+        if (reg.slots_count + slots > MAX_SLOTS) {
+            LOG(ERROR) << "No slots left for metric " << metric.name << " " << metric.label;
+            return -1;
+        }
+        metric.slot = reg.slots_count;
+        reg.slots_count += slots;
+        reg.retired.resize(reg.slots_count);
+    }
+    reg.metrics.push_back(metric);
+    return metric.slot;
+}
+
+/**
+ * @brief Sums up a slot over the threads, the registry lock must be held.
+ */
+static uint64_t slot_total(const sRegistry &reg, int slot)
+{
+    uint64_t total = reg.retired[slot];
+    for (auto slots : reg.threads_slots) {
+        total += slots->read(slot);
+    }
+    return total;
+}
+
+static size_t bucket_index(uint64_t usec)
+{
+    if (usec <= 1) {
+        return 0;
+    }
+    // Smallest i such that usec <= 2^i
+    size_t index = 64 - __builtin_clzll(usec - 1);
+    return std::min(index, HISTOGRAM_BUCKETS - 1);
+}
+
+counter::counter(const std::string &name, const std::string &help)
+{
+    sMetric metric;
+    metric.type = eMetricType::COUNTER;
+    metric.name = name;
+    metric.help = help;
+    m_slot      = register_metric(metric, 1);
+}
+
+void counter::add(uint64_t value)
+{
+    if (m_slot < 0) {
+        return;
+    }
+    slot_add(m_slot, value);
+}
+
+gauge::gauge(const std::string &name, const std::string &help)
+    : m_value(new std::atomic<int64_t>(0))
+{
+    sMetric metric;
+    metric.type  = eMetricType::GAUGE;
+    metric.name  = name;
+    metric.help  = help;
+    metric.gauge = m_value;
+    register_metric(metric, 0);
+}
+
+histogram::histogram(const std::string &name, const std::string &help, const std::string &label)
+{
+    sMetric metric;
+    metric.type  = eMetricType::HISTOGRAM;
+    metric.name  = name;
+    metric.help  = help;
+    metric.label = label;
+    m_slot       = register_metric(metric, HISTOGRAM_SLOTS);
+}
+
+void histogram::observe(uint64_t usec)
+{
+    if (m_slot < 0) {
+        return;
+    }
+    slot_add(m_slot + bucket_index(usec), 1);
+    slot_add(m_slot + HISTOGRAM_BUCKETS, usec);
+}
+
+histogram_family::histogram_family(const std::string &name, const std::string &label_name,
+                                   const std::string &help)
+    : m_name(name), m_label_name(label_name), m_help(help)
+{
+}
+
+histogram &histogram_family::get(const std::string &label_value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &histogram_ptr = m_histograms[label_value];
+    if (!histogram_ptr) {
+        histogram_ptr.reset(
+            new histogram(m_name, m_help, m_label_name + "=\"" + label_value + "\""));
+    }
+    return *histogram_ptr;
+}
+
+histogram &histogram_family::get(uint32_t label_value)
+{
+    char label_value_str[11];
+    snprintf(label_value_str, sizeof(label_value_str), "0x%04x", label_value);
+    return get(std::string(label_value_str));
+}
+
+static std::string labels(const std::string &label, const std::string &le = std::string())
+{
+    if (label.empty() && le.empty()) {
+        return std::string();
+    }
+    std::string labels = "{" + label;
+    if (!le.empty()) {
+        labels += (label.empty() ? "le=\"" : ",le=\"") + le + "\"";
+    }
+    return labels + "}";
+}
+
+std::string dump()
+{
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    // The histograms of a family share the name and are printed together, after a single help
+    // and type line
+    std::vector<const sMetric *> metrics;
+    for (const auto &metric : reg.metrics) {
+        metrics.push_back(&metric);
+    }
+    std::stable_sort(metrics.begin(), metrics.end(),
+                     [](const sMetric *a, const sMetric *b) { return a->name < b->name; });
+
+    std::string previous_name;
+    std::stringstream ss;
+    for (auto metric_ptr : metrics) {
+        const auto &metric = *metric_ptr;
+        if (metric.type != eMetricType::GAUGE && metric.slot < 0) {
+            continue;
+        }
+        if (metric.name != previous_name) {
+            previous_name = metric.name;
+            if (!metric.help.empty()) {
+                ss << "# HELP " << metric.name << " " << metric.help << std::endl;
+            }
+            ss << "# TYPE " << metric.name << " "
+               << (metric.type == eMetricType::COUNTER
+                       ? "counter"
+                       : metric.type == eMetricType::GAUGE ? "gauge" : "histogram")
+               << std::endl;
+        }
+
+        switch (metric.type) {
+        case eMetricType::COUNTER: {
+            ss << metric.name << labels(metric.label) << " " << slot_total(reg, metric.slot)
+               << std::endl;
+        } break;
+        case eMetricType::GAUGE: {
+            ss << metric.name << labels(metric.label) << " "
+               << metric.gauge->load(std::memory_order_relaxed) << std::endl;
+        } break;
+        case eMetricType::HISTOGRAM: {
+            uint64_t count = 0;
+            for (size_t i = 0; i < HISTOGRAM_BUCKETS - 1; i++) {
+                count += slot_total(reg, metric.slot + i);
+                ss << metric.name << "_bucket" << labels(metric.label, std::to_string(1ULL << i))
+                   << " " << count << std::endl;
+            }
+            count += slot_total(reg, metric.slot + HISTOGRAM_BUCKETS - 1);
+            ss << metric.name << "_bucket" << labels(metric.label, "+Inf") << " " << count
+               << std::endl;
+            ss << metric.name << "_sum" << labels(metric.label) << " "
+               << slot_total(reg, metric.slot + HISTOGRAM_BUCKETS) << std::endl;
+            ss << metric.name << "_count" << labels(metric.label) << " " << count << std::endl;
+        } break;
+        }
+    }
+    return ss.str();
+}
+
+/**
+ * @brief Export thread started by start_export().
+ */
+struct sExport {
+    std::unique_ptr<SocketServer> server;
+    // Written to stop the thread
+    int stop_fd = -1;
+    std::thread thread;
+
+    ~sExport()
+    {
+        if (thread.joinable()) {
+            uint64_t value = 1;
+            if (write(stop_fd, &value, sizeof(value)) < 0) {
+                LOG(ERROR) << "Failed to stop the metrics export: " << strerror(errno);
+            }
+            thread.join();
+        }
+        if (stop_fd >= 0) {
+            close(stop_fd);
+        }
+    }
+};
+
+static std::mutex s_export_mutex;
+// Destroyed at exit if stop_export() is not called, which stops the thread
+static std::unique_ptr<sExport> s_export;
+
+static void export_thread(sExport &metrics_export)
+{
+    struct pollfd fds[] = {{metrics_export.server->getSocketFd(), POLLIN, 0},
+                           {metrics_export.stop_fd, POLLIN, 0}};
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG(ERROR) << "Metrics export poll failed: " << strerror(errno);
+            return;
+        }
+        if (fds[1].revents) {
+            return;
+        }
+        if (!fds[0].revents) {
+            continue;
+        }
+
+        std::unique_ptr<Socket> client(metrics_export.server->acceptConnections());
+        if (!client) {
+            LOG(ERROR) << "Metrics export accept failed: " << metrics_export.server->getError();
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            continue;
+        }
+        client->setWriteTimeout(EXPORT_WRITE_TIMEOUT_MSEC);
+        auto text      = dump();
+        size_t written = 0;
+        while (written < text.size()) {
+            auto ret =
+                client->writeBytes(reinterpret_cast<const uint8_t *>(text.data()) + written,
+                                   text.size() - written);
+            if (ret <= 0) {
+                break;
+            }
+            written += ret;
+        }
+    }
+}
+
+bool start_export(const std::string &uds_path)
+{
+    std::lock_guard<std::mutex> lock(s_export_mutex);
+    if (s_export) {
+        LOG(ERROR) << "The metrics are already exported";
+        return false;
+    }
+
+    std::unique_ptr<sExport> metrics_export(new sExport);
+    metrics_export->server.reset(new SocketServer(uds_path, EXPORT_MAX_CONNECTIONS));
+    if (!metrics_export->server->getError().empty()) {
+        LOG(ERROR) << "Failed to start the metrics export: " << metrics_export->server->getError();
+        return false;
+    }
+
+    metrics_export->stop_fd = eventfd(0, EFD_CLOEXEC);
+    if (metrics_export->stop_fd < 0) {
+        LOG(ERROR) << "Failed creating eventfd: " << strerror(errno);
+        return false;
+    }
+
+    metrics_export->thread = std::thread(export_thread, std::ref(*metrics_export));
+    s_export               = std::move(metrics_export);
+
+    LOG(INFO) << "Metrics exported on " << uds_path;
+    return true;
+}
+
+void stop_export()
+{
+    std::lock_guard<std::mutex> lock(s_export_mutex);
+    s_export.reset();
+}
+
+} // namespace metrics
+} // namespace beerocks
@@ -0,0 +1,289 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_shm_ring.h>
+
+#include <easylogging++.h>
+
+#include <atomic>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/memfd.h>
+#include <new>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace beerocks {
+
+static constexpr uint32_t SHM_RING_MAGIC = 0x52424853; // "SHBR"
+
+static constexpr size_t SHM_RING_MAX_CAPACITY    = 1 << 16;
+static constexpr size_t SHM_RING_MAX_RECORD_SIZE = 1 << 12;
+
+/**
+ * Alignment of the shared counters, so the producer and the consumer do not write to the same
+ * cache line.
+ */
+static constexpr size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief Header of the ring, at the beginning of the shared memory, followed by the records.
+ */
+struct shm_ring::sHeader {
+    uint32_t magic;
+    uint32_t record_size;
+    uint32_t capacity;
+
+    /**
+     * Written by the producer: free running index of the next record to publish.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> head;
+    std::atomic<uint64_t> dropped;
+
+    /**
+     * Written by the consumer: free running index of the next record to read.
+     */
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> tail;
+
+    /**
+     * Set by the consumer when it found the ring empty and is about to wait for the eventfd,
+     * cleared by the producer when it writes the eventfd.
+     */
+    std::atomic<uint32_t> waiting;
+};
+
+size_t shm_ring::get_records_offset()
+{
+    return (sizeof(sHeader) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+}
+
+static int create_memfd(const std::string &name)
+{
+    // Not all the supported C libraries provide a memfd_create() wrapper
+    return syscall(SYS_memfd_create, name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+}
+
+std::unique_ptr<shm_ring> shm_ring::create(const std::string &name, size_t record_size,
+                                           size_t capacity)
+{
+    if (record_size == 0 || record_size > SHM_RING_MAX_RECORD_SIZE || capacity == 0 ||
+        capacity > SHM_RING_MAX_CAPACITY) {
+        LOG(ERROR) << "Invalid ring size, record_size=" << record_size
+                   << ", capacity=" << capacity;
+        return nullptr;
+    }
+
+    size_t rounded_capacity = 1;
+    while (rounded_capacity < capacity) {
+        rounded_capacity <<= 1;
+    }
+
+    int memfd = create_memfd(name);
+    if (memfd < 0) {
+        LOG(ERROR) << "Failed creating memfd: " << strerror(errno);
+        return nullptr;
+    }
+
+    size_t mapping_size = get_records_offset() + record_size * rounded_capacity;
+
+    // Seal the size, so the consumer can safely map the whole ring
+    if (ftruncate(memfd, mapping_size) < 0 ||
+        fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0) {
+        LOG(ERROR) << "Failed setting the memfd size: " << strerror(errno);
+        close(memfd);
+        return nullptr;
+    }
+
+    int event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd < 0) {
+        LOG(ERROR) << "Failed creating eventfd: " << strerror(errno);
+        close(memfd);
+        return nullptr;
+    }
+
+    void *mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (mapping == MAP_FAILED) {
+        LOG(ERROR) << "Failed mapping memfd: " << strerror(errno);
+        close(memfd);
+        close(event_fd);
+        return nullptr;
+    }
+
+    auto header         = new (mapping) sHeader;
+    header->magic       = SHM_RING_MAGIC;
+    header->record_size = record_size;
+    header->capacity    = rounded_capacity;
+    header->head.store(0, std::memory_order_relaxed);
+    header->dropped.store(0, std::memory_order_relaxed);
+    header->tail.store(0, std::memory_order_relaxed);
+    header->waiting.store(1, std::memory_order_relaxed);
+
+    return std::unique_ptr<shm_ring>(new shm_ring(memfd, event_fd, mapping, mapping_size));
+}
+
+std::unique_ptr<shm_ring> shm_ring::attach(int memfd, int eventfd, size_t record_size)
+{
+    auto close_fds = [&]() {
+        close(memfd);
+        close(eventfd);
+    };
+
+    // The producer may not be trusted to keep the size, a shrinking memfd would fault
+    int seals = fcntl(memfd, F_GET_SEALS);
+    if (seals < 0 || !(seals & F_SEAL_SHRINK)) {
+        LOG(ERROR) << "Ring memfd is not sealed";
+        close_fds();
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(memfd, &st) < 0 || size_t(st.st_size) < get_records_offset()) {
+        LOG(ERROR) << "Invalid ring memfd size";
+        close_fds();
+        return nullptr;
+    }
+
+    size_t mapping_size = st.st_size;
+    void *mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (mapping == MAP_FAILED) {
+        LOG(ERROR) << "Failed mapping memfd: " << strerror(errno);
+        close_fds();
+        return nullptr;
+    }
+
+    auto header = static_cast<sHeader *>(mapping);
+    if (header->magic != SHM_RING_MAGIC || header->record_size != record_size ||
+        header->capacity == 0 || header->capacity > SHM_RING_MAX_CAPACITY ||
+        (header->capacity & (header->capacity - 1)) ||
+        get_records_offset() + record_size * header->capacity > mapping_size) {
+        LOG(ERROR) << "Invalid ring header, record_size=" << header->record_size
+                   << ", capacity=" << header->capacity;
+        munmap(mapping, mapping_size);
+        close_fds();
+        return nullptr;
+    }
+
+    return std::unique_ptr<shm_ring>(new shm_ring(memfd, eventfd, mapping, mapping_size));
+}
+
+shm_ring::shm_ring(int memfd, int eventfd, void *mapping, size_t mapping_size)
+    : m_memfd(memfd), m_eventfd(eventfd), m_mapping(mapping), m_mapping_size(mapping_size),
+      m_header(static_cast<sHeader *>(mapping)), m_record_size(m_header->record_size),
+      m_mask(m_header->capacity - 1),
+      m_pending_head(m_header->head.load(std::memory_order_relaxed))
+{
+}
+
+shm_ring::~shm_ring()
+{
+    munmap(m_mapping, m_mapping_size);
+    close(m_memfd);
+    close(m_eventfd);
+}
+
+uint8_t *shm_ring::get_record(uint32_t index) const
+{
+    return static_cast<uint8_t *>(m_mapping) + get_records_offset() +
+           (index & m_mask) * m_record_size;
+}
+
+bool shm_ring::push(const void *record, size_t size)
+{
+    if (size > m_record_size) {
+        return false;
+    }
+
+    if (get_free_count() == 0) {
+        m_header->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto dst = get_record(m_pending_head);
+    std::memcpy(dst, record, size);
+    std::memset(dst + size, 0, m_record_size - size);
+    m_pending_head++;
+
+    return true;
+}
+
+bool shm_ring::commit()
+{
+    if (m_pending_head == m_header->head.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    // Sequentially consistent with the flag, see pop(): either the consumer sees the new head
+    // before waiting, or the producer sees it waiting
+    m_header->head.store(m_pending_head, std::memory_order_seq_cst);
+    if (!m_header->waiting.exchange(0, std::memory_order_seq_cst)) {
+        // The consumer is draining the ring, it will pop these records too
+        return true;
+    }
+
+    uint64_t value = 1;
+    // EAGAIN means the counter is saturated, so the consumer is about to wake up anyway
+    if (write(m_eventfd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+        // Wake it up on the next commit
+        m_header->waiting.store(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+size_t shm_ring::get_free_count() const
+{
+    auto tail = m_header->tail.load(std::memory_order_acquire);
+    return get_capacity() - uint32_t(m_pending_head - tail);
+}
+
+bool shm_ring::pop(void *record)
+{
+    auto tail = m_header->tail.load(std::memory_order_relaxed);
+    auto head = m_header->head.load(std::memory_order_acquire);
+    if (head == tail) {
+        // Ask for a wake-up, then check again for a commit which did not see the request
+        m_header->waiting.store(1, std::memory_order_seq_cst);
+        head = m_header->head.load(std::memory_order_seq_cst);
+        if (head == tail) {
+            return false;
+        }
+    }
+
+    if (uint32_t(head - tail) > get_capacity()) {
+        // Only a corrupted head gets here, skip to it
+        m_header->dropped.fetch_add(uint32_t(head - tail), std::memory_order_relaxed);
+        m_header->tail.store(head, std::memory_order_release);
+        m_header->waiting.store(1, std::memory_order_seq_cst);
+        return false;
+    }
+
+    std::memcpy(record, get_record(tail), m_record_size);
+    m_header->tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+void shm_ring::clear_notification()
+{
+    uint64_t value;
+    if (read(m_eventfd, &value, sizeof(value)) < 0) {
+        // EAGAIN, the counter is already cleared
+    }
+}
+
+uint64_t shm_ring::get_dropped_count() const
+{
+    return m_header->dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace beerocks
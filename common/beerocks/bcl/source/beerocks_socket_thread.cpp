@@ -14,23 +14,29 @@
 
 #include <tlvf/CmduMessageRx.h>
 #include <tlvf/ieee_1905_1/eTlvType.h>
+#include <tlvf/ieee_1905_1/tlvVendorSpecificView.h>
 
 using namespace beerocks;
 
 #define DEFAULT_MAX_SOCKET_CONNECTIONS 10
-#define TX_BUFFER_UDS (tx_buffer + sizeof(beerocks::message::sUdsHeader))
-#define TX_BUFFER_UDS_SIZE (sizeof(tx_buffer) - sizeof(beerocks::message::sUdsHeader))
-#define CERT_TX_BUFFER_UDS (cert_tx_buffer + sizeof(beerocks::message::sUdsHeader))
-#define CERT_TX_BUFFER_UDS_SIZE (sizeof(cert_tx_buffer) - sizeof(beerocks::message::sUdsHeader))
-
-socket_thread::socket_thread(const std::string &unix_socket_path_)
-    : thread_base(), cmdu_tx(TX_BUFFER_UDS, TX_BUFFER_UDS_SIZE),
+#define TX_BUFFER_UDS (tx_buffer.data() + sizeof(beerocks::message::sUdsHeader))
+#define TX_BUFFER_UDS_SIZE (tx_buffer.size() - sizeof(beerocks::message::sUdsHeader))
+#define CERT_TX_BUFFER_UDS (cert_tx_buffer.data() + sizeof(beerocks::message::sUdsHeader))
+#define CERT_TX_BUFFER_UDS_SIZE (cert_tx_buffer.size() - sizeof(beerocks::message::sUdsHeader))
+#define RX_BUFFER_UDS (rx_buffer.data() + sizeof(beerocks::message::sUdsHeader))
+#define RX_BUFFER_UDS_SIZE (rx_buffer.size() - sizeof(beerocks::message::sUdsHeader))
+
+static metrics::histogram_family
+    s_iteration_time("socket_thread_iteration_usec", "thread",
+                     "Time spent by the event loop of a thread handling the events of a select()");
+
+socket_thread::socket_thread(const std::string &unix_socket_path_, size_t tx_buffer_length)
+    : thread_base(), rx_buffer(message::MESSAGE_BUFFER_LENGTH_MAX), tx_buffer(tx_buffer_length),
+      cert_tx_buffer(tx_buffer_length), cmdu_tx(TX_BUFFER_UDS, TX_BUFFER_UDS_SIZE),
       cert_cmdu_tx(CERT_TX_BUFFER_UDS, CERT_TX_BUFFER_UDS_SIZE),
-      unix_socket_path(unix_socket_path_), cmdu_rx(rx_buffer + sizeof(message::sUdsHeader),
-                                                   sizeof(rx_buffer) - sizeof(message::sUdsHeader)),
+      unix_socket_path(unix_socket_path_), cmdu_rx(RX_BUFFER_UDS, RX_BUFFER_UDS_SIZE),
       server_socket(nullptr), server_max_connections(DEFAULT_MAX_SOCKET_CONNECTIONS)
 {
-    memset(TX_BUFFER_UDS, 0, TX_BUFFER_UDS_SIZE);
     socket_thread::set_select_timeout(500);
 }
 
@@ -123,7 +129,7 @@ int socket_thread::socket_disconnected_uds(Socket *sd)
 {
     // Dummy read for disconnected check
 
-    ssize_t available_bytes = sd->readBytes(rx_buffer, sizeof(rx_buffer), false, 1,
+    ssize_t available_bytes = sd->readBytes(rx_buffer.data(), rx_buffer.size(), false, 1,
                                             true); // try to read 1 byte, non-blocking
     if (available_bytes > 0) {
         return 0;
@@ -150,7 +156,8 @@ bool socket_thread::handle_cmdu_message_uds(Socket *sd)
     ssize_t available_bytes;
 
     // Check if UDS Header exists
-    available_bytes = sd->readBytes(rx_buffer, sizeof(rx_buffer), true, sizeof(message::sUdsHeader),
+    available_bytes = sd->readBytes(rx_buffer.data(), rx_buffer.size(), true,
+                                    sizeof(message::sUdsHeader),
                                     true); // PEEK UDS Header, blocking
     if (available_bytes < 0) {
         LOG(ERROR) << "Error reading from socket";
@@ -164,12 +171,12 @@ bool socket_thread::handle_cmdu_message_uds(Socket *sd)
     }
 
     // Header ready
-    message::sUdsHeader *uds_header = (message::sUdsHeader *)rx_buffer;
+    message::sUdsHeader *uds_header = (message::sUdsHeader *)rx_buffer.data();
     size_t message_size             = uds_header->length + sizeof(message::sUdsHeader);
 
     // Try to read all message
     available_bytes =
-        sd->readBytes(rx_buffer, sizeof(rx_buffer), true, message_size); // blocking read
+        sd->readBytes(rx_buffer.data(), rx_buffer.size(), true, message_size); // blocking read
 
     if (static_cast<size_t>(available_bytes) != message_size) {
         THREAD_LOG(ERROR) << "available bytes = " << available_bytes
@@ -183,8 +190,8 @@ bool socket_thread::handle_cmdu_message_uds(Socket *sd)
     }
 
     if (!cmdu_rx.parse()) {
-        THREAD_LOG(ERROR) << "parsing cmdu failure, rx_buffer" << std::hex << rx_buffer << std::dec
-                          << ", uds_header->length=" << int(uds_header->length);
+        THREAD_LOG(ERROR) << "parsing cmdu failure, rx_buffer" << std::hex << rx_buffer.data()
+                          << std::dec << ", uds_header->length=" << int(uds_header->length);
         return false;
     }
 
@@ -217,10 +224,11 @@ bool socket_thread::verify_cmdu(message::sUdsHeader *uds_header)
 
         swap_16(length);
         if (static_cast<ieee1905_1::eTlvType>(type) == ieee1905_1::eTlvType::TLV_VENDOR_SPECIFIC) {
-            auto tlv_vendor_specific = ieee1905_1::tlvVendorSpecific(
-                (uint8_t *)tlv, length + sizeof(ieee1905_1::sTlvHeader), true);
-            if (!tlv_vendor_specific.isInitialized()) {
-                LOG(ERROR) << "tlvVendorSpecific init() failure";
+            // Read the TLV in place, the message is parsed (and swapped) only once it is verified
+            ieee1905_1::tlvVendorSpecificView tlv_vendor_specific;
+            if (!tlv_vendor_specific.parse((uint8_t *)tlv,
+                                           length + sizeof(ieee1905_1::sTlvHeader))) {
+                LOG(ERROR) << "tlvVendorSpecific parse failure";
                 ret = false;
                 break;
             }
@@ -228,8 +236,13 @@ bool socket_thread::verify_cmdu(message::sUdsHeader *uds_header)
             if (tlv_vendor_specific.vendor_oui() ==
                 ieee1905_1::tlvVendorSpecific::eVendorOUI::OUI_INTEL) {
                 // assuming that the magic is the first data on the beerocks header
-                auto beerocks_magic = *(uint32_t *)(tlv_vendor_specific.payload());
-                swap_32(beerocks_magic);
+                auto magic = tlv_vendor_specific.payload();
+                if (!magic || tlv_vendor_specific.payload_length() < sizeof(uint32_t)) {
+                    LOG(ERROR) << "tlvVendorSpecific payload is too short";
+                    ret = false;
+                    break;
+                }
+                auto beerocks_magic = tlvf_view_read<uint32_t>(magic);
                 if (beerocks_magic != message::MESSAGE_MAGIC) {
                     THREAD_LOG(WARNING) << "mismatch magic " << std::hex << int(beerocks_magic)
                                         << " != " << int(message::MESSAGE_MAGIC) << std::dec;
@@ -240,9 +253,6 @@ bool socket_thread::verify_cmdu(message::sUdsHeader *uds_header)
             } else {
                 THREAD_LOG(INFO) << "Not an Intel vendor specific message!";
             }
-
-            // cancel the swap we did
-            tlv_vendor_specific.class_swap();
         } else if (static_cast<ieee1905_1::eTlvType>(type) ==
                        ieee1905_1::eTlvType::TLV_END_OF_MESSAGE &&
                    length == 0) {
@@ -270,9 +280,15 @@ bool socket_thread::work()
 {
     before_select();
 
-    auto awake_time_msec = std::chrono::duration_cast<std::chrono::milliseconds>(
-                               std::chrono::steady_clock::now() - m_select_wake_up_time)
-                               .count();
+    auto awake_time = std::chrono::steady_clock::now() - m_select_wake_up_time;
+    auto awake_time_msec =
+        std::chrono::duration_cast<std::chrono::milliseconds>(awake_time).count();
+
+    if (!m_iteration_time) {
+        m_iteration_time = &s_iteration_time.get(get_name());
+    } else {
+        m_iteration_time->observe(awake_time);
+    }
 
     if (m_select_timeout_msec > 0 && awake_time_msec > m_select_timeout_msec) {
         THREAD_LOG(WARNING) << "Thread awake time is exceptionally long: " << int(awake_time_msec)
@@ -342,7 +358,7 @@ bool socket_thread::work()
                     break;
                 }
 
-                if (custom_message_handler(sd, rx_buffer, sizeof(rx_buffer))) {
+                if (custom_message_handler(sd, rx_buffer.data(), rx_buffer.size())) {
                     continue;
                 }
 
@@ -0,0 +1,490 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/interface_registry.h>
+
+#include <easylogging++.h>
+
+#include <net/if.h>
+
+#include <algorithm>
+#include <cstring>
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Large enough for the biggest message the kernel puts in a dump part
+#define NETLINK_BUFFER_SIZE 32768
+
+namespace beerocks {
+namespace net {
+
+static bool is_same_interface(const InterfaceRegistry::sInterface &lhs,
+                              const InterfaceRegistry::sInterface &rhs)
+{
+    if (lhs.index != rhs.index || lhs.name != rhs.name || lhs.mac != rhs.mac ||
+        lhs.flags != rhs.flags || lhs.master_index != rhs.master_index ||
+        lhs.addresses.size() != rhs.addresses.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < lhs.addresses.size(); i++) {
+        if (lhs.addresses[i].address != rhs.addresses[i].address ||
+            lhs.addresses[i].prefix_length != rhs.addresses[i].prefix_length ||
+            lhs.addresses[i].broadcast != rhs.addresses[i].broadcast) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool InterfaceRegistry::sInterface::is_up() const { return flags & IFF_UP; }
+
+bool InterfaceRegistry::sInterface::is_up_and_running() const
+{
+    return (flags & IFF_UP) && (flags & IFF_RUNNING);
+}
+
+InterfaceRegistry::~InterfaceRegistry() { close(); }
+
+bool InterfaceRegistry::open()
+{
+    if (m_fd >= 0) {
+        return true;
+    }
+
+    m_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (m_fd < 0) {
+        LOG(ERROR) << "Failed creating Netlink socket: " << strerror(errno);
+        return false;
+    }
+
+    sockaddr_nl addr{};
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR;
+
+    if (bind(m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) {
+        LOG(ERROR) << "Failed binding the Netlink socket: " << strerror(errno);
+        close();
+        return false;
+    }
+
+    m_buffer.resize(NETLINK_BUFFER_SIZE);
+
+    if (!load()) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void InterfaceRegistry::close()
+{
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool InterfaceRegistry::process_events()
+{
+    if (m_fd < 0) {
+        LOG(ERROR) << "Interface registry is not open";
+        return false;
+    }
+
+    bool done = false;
+    while (!done) {
+        if (!receive(false, 0, done)) {
+            return false;
+        }
+    }
+
+    if (m_resync_needed) {
+        LOG(WARNING) << "Interface events were lost, reloading all the interfaces";
+        return load();
+    }
+
+    return true;
+}
+
+const InterfaceRegistry::sInterface *
+InterfaceRegistry::get_interface(const std::string &iface_name) const
+{
+    auto index_it = m_index_by_name.find(iface_name);
+    if (index_it == m_index_by_name.end()) {
+        return nullptr;
+    }
+    return get_interface(index_it->second);
+}
+
+const InterfaceRegistry::sInterface *InterfaceRegistry::get_interface(uint32_t iface_index) const
+{
+    auto it = m_interfaces.find(iface_index);
+    if (it == m_interfaces.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+std::string InterfaceRegistry::get_iface_name(uint32_t iface_index) const
+{
+    auto iface = get_interface(iface_index);
+    if (!iface) {
+        return std::string();
+    }
+    return iface->name;
+}
+
+bool InterfaceRegistry::get_mac(const std::string &iface_name, sMacAddr &mac) const
+{
+    auto iface = get_interface(iface_name);
+    if (!iface) {
+        return false;
+    }
+    mac = iface->mac;
+    return true;
+}
+
+bool InterfaceRegistry::is_up_and_running(const std::string &iface_name) const
+{
+    auto iface = get_interface(iface_name);
+    return iface && iface->is_up_and_running();
+}
+
+std::vector<std::string> InterfaceRegistry::get_bridge_members(const std::string &bridge_name) const
+{
+    std::vector<std::string> members;
+
+    auto bridge = get_interface(bridge_name);
+    if (!bridge) {
+        return members;
+    }
+
+    for (const auto &entry : m_interfaces) {
+        if (entry.second.master_index == bridge->index) {
+            members.push_back(entry.second.name);
+        }
+    }
+    std::sort(members.begin(), members.end());
+
+    return members;
+}
+
+bool InterfaceRegistry::load()
+{
+    auto previous = std::move(m_interfaces);
+    m_interfaces.clear();
+    m_index_by_name.clear();
+    m_resync_needed = false;
+
+    m_loading   = true;
+    bool result = dump(RTM_GETLINK) && dump(RTM_GETADDR);
+    m_loading   = false;
+
+    if (!result) {
+        m_interfaces = std::move(previous);
+        m_index_by_name.clear();
+        for (const auto &entry : m_interfaces) {
+            m_index_by_name[entry.second.name] = entry.first;
+        }
+        return false;
+    }
+
+    m_dump_count++;
+
+    // Nothing changed from the owner's point of view on the first load
+    if (m_dump_count == 1) {
+        return true;
+    }
+
+    // Report the changes which were missed
+    for (const auto &entry : m_interfaces) {
+        auto previous_it = previous.find(entry.first);
+        if (previous_it == previous.end()) {
+            notify(entry.second, eChangeType::Added, 0);
+        } else if (!is_same_interface(previous_it->second, entry.second)) {
+            notify(entry.second, eChangeType::Changed, previous_it->second.master_index);
+        }
+    }
+    for (const auto &entry : previous) {
+        if (m_interfaces.find(entry.first) == m_interfaces.end()) {
+            notify(entry.second, eChangeType::Removed, entry.second.master_index);
+        }
+    }
+
+    return true;
+}
+
+bool InterfaceRegistry::dump(uint16_t message_type)
+{
+    struct {
+        nlmsghdr hdr;
+        rtgenmsg gen;
+    } req{};
+
+    req.hdr.nlmsg_len    = NLMSG_LENGTH(sizeof(rtgenmsg));
+    req.hdr.nlmsg_type   = message_type;
+    req.hdr.nlmsg_flags  = NLM_F_REQUEST | NLM_F_DUMP;
+    req.hdr.nlmsg_seq    = ++m_sequence;
+    req.gen.rtgen_family = (message_type == RTM_GETADDR) ? AF_INET : AF_PACKET;
+
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+
+    if (sendto(m_fd, &req, req.hdr.nlmsg_len, 0, reinterpret_cast<sockaddr *>(&kernel),
+               sizeof(kernel)) < 0) {
+        LOG(ERROR) << "Unable to send message through Netlink socket: " << strerror(errno);
+        return false;
+    }
+
+    // Events received in the middle of the dump are applied as well, in order
+    bool done = false;
+    while (!done) {
+        if (!receive(true, m_sequence, done)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool InterfaceRegistry::receive(bool wait, uint32_t sequence, bool &done)
+{
+    iovec io{m_buffer.data(), m_buffer.size()};
+    msghdr reply{};
+    reply.msg_iov    = &io;
+    reply.msg_iovlen = 1;
+
+    int length = recvmsg(m_fd, &reply, wait ? 0 : MSG_DONTWAIT);
+    if (length < 0) {
+        if (errno == EINTR) {
+            return true;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            done = true;
+            return true;
+        }
+        if (errno == ENOBUFS) {
+            // The kernel dropped events, the state has to be loaded again
+            m_resync_needed = true;
+            return true;
+        }
+        LOG(ERROR) << "Failed receiving from Netlink socket: " << strerror(errno);
+        return false;
+    }
+    if (reply.msg_flags & MSG_TRUNC) {
+        LOG(ERROR) << "Truncated Netlink message";
+        m_resync_needed = true;
+        return true;
+    }
+
+    for (const nlmsghdr *msg_ptr = reinterpret_cast<const nlmsghdr *>(m_buffer.data());
+         NLMSG_OK(msg_ptr, length); msg_ptr = NLMSG_NEXT(msg_ptr, length)) {
+        bool dump_reply = (sequence != 0) && (msg_ptr->nlmsg_seq == sequence);
+        if (dump_reply && msg_ptr->nlmsg_type == NLMSG_DONE) {
+            done = true;
+            continue;
+        }
+        if (msg_ptr->nlmsg_type == NLMSG_ERROR) {
+            auto error = static_cast<const nlmsgerr *>(NLMSG_DATA(msg_ptr));
+            LOG(ERROR) << "Netlink request failed: " << strerror(-error->error);
+            if (dump_reply) {
+                return false;
+            }
+            continue;
+        }
+        handle_message(msg_ptr);
+    }
+
+    return true;
+}
+
+void InterfaceRegistry::handle_message(const nlmsghdr *msg_ptr)
+{
+    switch (msg_ptr->nlmsg_type) {
+    case RTM_NEWLINK:
+    case RTM_DELLINK:
+        handle_link(msg_ptr);
+        break;
+    case RTM_NEWADDR:
+    case RTM_DELADDR:
+        handle_address(msg_ptr);
+        break;
+    default:
+        break;
+    }
+}
+
+void InterfaceRegistry::handle_link(const nlmsghdr *msg_ptr)
+{
+    if (msg_ptr->nlmsg_len < NLMSG_LENGTH(sizeof(ifinfomsg))) {
+        return;
+    }
+
+    auto iface_info = static_cast<const ifinfomsg *>(NLMSG_DATA(msg_ptr));
+
+    // The bridge module notifies about its ports with AF_BRIDGE messages (including an
+    // RTM_DELLINK when a port leaves the bridge), the interfaces themselves are AF_UNSPEC.
+    if (iface_info->ifi_family == AF_BRIDGE) {
+        return;
+    }
+
+    uint32_t index = iface_info->ifi_index;
+    auto it        = m_interfaces.find(index);
+
+    if (msg_ptr->nlmsg_type == RTM_DELLINK) {
+        if (it == m_interfaces.end()) {
+            return;
+        }
+        sInterface removed = std::move(it->second);
+        m_interfaces.erase(it);
+        m_index_by_name.erase(removed.name);
+        notify(removed, eChangeType::Removed, removed.master_index);
+        return;
+    }
+
+    sInterface iface;
+    iface.index = index;
+    iface.flags = iface_info->ifi_flags;
+
+    auto length = msg_ptr->nlmsg_len - NLMSG_LENGTH(sizeof(ifinfomsg));
+    for (const rtattr *attribute = IFLA_RTA(iface_info); RTA_OK(attribute, length);
+         attribute               = RTA_NEXT(attribute, length)) {
+        switch (attribute->rta_type) {
+        case IFLA_IFNAME:
+            iface.name = static_cast<const char *>(RTA_DATA(attribute));
+            break;
+        case IFLA_ADDRESS:
+            if (RTA_PAYLOAD(attribute) == sizeof(iface.mac.oct)) {
+                std::copy_n(static_cast<const uint8_t *>(RTA_DATA(attribute)),
+                            sizeof(iface.mac.oct), iface.mac.oct);
+            }
+            break;
+        case IFLA_MASTER:
+            if (RTA_PAYLOAD(attribute) >= sizeof(uint32_t)) {
+                std::memcpy(&iface.master_index, RTA_DATA(attribute), sizeof(uint32_t));
+            }
+            break;
+        }
+    }
+
+    if (iface.name.empty()) {
+        return;
+    }
+
+    if (it == m_interfaces.end()) {
+        m_index_by_name[iface.name] = index;
+        auto &added                 = m_interfaces[index];
+        added                       = std::move(iface);
+        notify(added, eChangeType::Added, 0);
+        return;
+    }
+
+    // Link messages do not carry the addresses
+    iface.addresses = std::move(it->second.addresses);
+
+    if (iface.name != it->second.name) {
+        m_index_by_name.erase(it->second.name);
+        m_index_by_name[iface.name] = index;
+    }
+
+    bool changed                   = !is_same_interface(it->second, iface);
+    uint32_t previous_master_index = it->second.master_index;
+    it->second                     = std::move(iface);
+    if (changed) {
+        notify(it->second, eChangeType::Changed, previous_master_index);
+    }
+}
+
+void InterfaceRegistry::handle_address(const nlmsghdr *msg_ptr)
+{
+    if (msg_ptr->nlmsg_len < NLMSG_LENGTH(sizeof(ifaddrmsg))) {
+        return;
+    }
+
+    auto address_info = static_cast<const ifaddrmsg *>(NLMSG_DATA(msg_ptr));
+    if (address_info->ifa_family != AF_INET) {
+        return;
+    }
+
+    auto it = m_interfaces.find(address_info->ifa_index);
+    if (it == m_interfaces.end()) {
+        return;
+    }
+
+    sAddress address{};
+    address.prefix_length = address_info->ifa_prefixlen;
+
+    // On point to point links IFA_ADDRESS is the peer address, IFA_LOCAL is the local one
+    bool has_local   = false;
+    bool has_address = false;
+    auto length      = msg_ptr->nlmsg_len - NLMSG_LENGTH(sizeof(ifaddrmsg));
+    for (const rtattr *attribute = IFA_RTA(address_info); RTA_OK(attribute, length);
+         attribute               = RTA_NEXT(attribute, length)) {
+        if (RTA_PAYLOAD(attribute) < sizeof(sIpv4Addr)) {
+            continue;
+        }
+        auto data = static_cast<const uint8_t *>(RTA_DATA(attribute));
+        switch (attribute->rta_type) {
+        case IFA_LOCAL:
+            std::copy_n(data, sizeof(sIpv4Addr), address.address.oct);
+            has_local = true;
+            break;
+        case IFA_ADDRESS:
+            if (!has_local) {
+                std::copy_n(data, sizeof(sIpv4Addr), address.address.oct);
+            }
+            has_address = true;
+            break;
+        case IFA_BROADCAST:
+            std::copy_n(data, sizeof(sIpv4Addr), address.broadcast.oct);
+            break;
+        }
+    }
+
+    if (!has_local && !has_address) {
+        return;
+    }
+
+    auto &addresses = it->second.addresses;
+    auto existing   = std::find_if(addresses.begin(), addresses.end(),
+                                 [&](const sAddress &entry) {
+                                     return entry.address == address.address &&
+                                            entry.prefix_length == address.prefix_length;
+                                 });
+
+    if (msg_ptr->nlmsg_type == RTM_DELADDR) {
+        if (existing == addresses.end()) {
+            return;
+        }
+        addresses.erase(existing);
+    } else if (existing == addresses.end()) {
+        addresses.push_back(address);
+    } else {
+        *existing = address;
+    }
+
+    notify(it->second, eChangeType::Changed, it->second.master_index);
+}
+
+void InterfaceRegistry::notify(const sInterface &iface, eChangeType change_type,
+                               uint32_t previous_master_index)
+{
+    if (m_loading || !m_change_handler) {
+        return;
+    }
+    m_change_handler(iface, change_type, previous_master_index);
+}
+
+} // namespace net
+} // namespace beerocks
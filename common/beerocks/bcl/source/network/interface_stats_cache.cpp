@@ -0,0 +1,255 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/interface_stats_cache.h>
+
+#include <easylogging++.h>
+
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <cstring>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Large enough for the biggest message the kernel puts in a dump part
+#define DUMP_BUFFER_SIZE 32768
+
+namespace beerocks {
+namespace net {
+
+constexpr std::chrono::milliseconds InterfaceStatsCache::DEFAULT_MAX_AGE;
+
+InterfaceStatsCache::InterfaceStatsCache(std::chrono::milliseconds max_age)
+    : m_max_age(max_age), m_buffer(DUMP_BUFFER_SIZE)
+{
+}
+
+InterfaceStatsCache::~InterfaceStatsCache() { close_socket(); }
+
+bool InterfaceStatsCache::open_socket()
+{
+    if (m_fd >= 0) {
+        return true;
+    }
+
+    m_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (m_fd < 0) {
+        LOG(ERROR) << "Failed creating Netlink socket: " << strerror(errno);
+        return false;
+    }
+
+    return true;
+}
+
+void InterfaceStatsCache::close_socket()
+{
+    if (m_fd >= 0) {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool InterfaceStatsCache::refresh()
+{
+    if (!open_socket()) {
+        return false;
+    }
+
+    std::unordered_map<uint32_t, sEntry> entries;
+    if (!dump(entries)) {
+        // The socket may hold the rest of the failed dump, start over with a new one
+        close_socket();
+        return false;
+    }
+
+    m_entries.swap(entries);
+    m_index_by_name.clear();
+    for (const auto &entry : m_entries) {
+        m_index_by_name[entry.second.name] = entry.first;
+    }
+
+    m_last_refresh = std::chrono::steady_clock::now();
+    m_valid        = true;
+    return true;
+}
+
+bool InterfaceStatsCache::refresh_if_stale()
+{
+    if (m_valid && std::chrono::steady_clock::now() - m_last_refresh < m_max_age) {
+        return true;
+    }
+    return refresh();
+}
+
+bool InterfaceStatsCache::dump(std::unordered_map<uint32_t, sEntry> &entries)
+{
+    struct {
+        nlmsghdr hdr;
+        rtgenmsg gen;
+    } req{};
+
+    req.hdr.nlmsg_len    = NLMSG_LENGTH(sizeof(rtgenmsg));
+    req.hdr.nlmsg_type   = RTM_GETLINK;
+    req.hdr.nlmsg_flags  = NLM_F_REQUEST | NLM_F_DUMP;
+    req.hdr.nlmsg_seq    = ++m_sequence;
+    req.gen.rtgen_family = AF_PACKET; /* no preferred AF, we will get *all* interfaces */
+
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+
+    if (sendto(m_fd, &req, req.hdr.nlmsg_len, 0, reinterpret_cast<sockaddr *>(&kernel),
+               sizeof(kernel)) < 0) {
+        LOG(ERROR) << "Unable to send message through Netlink socket: " << strerror(errno);
+        return false;
+    }
+
+    m_dump_count++;
+
+    bool done = false;
+    while (!done) {
+        iovec io{m_buffer.data(), m_buffer.size()};
+        msghdr reply{};
+        reply.msg_iov    = &io;
+        reply.msg_iovlen = 1;
+
+        int length = recvmsg(m_fd, &reply, 0);
+        if (length < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG(ERROR) << "Failed receiving from Netlink socket: " << strerror(errno);
+            return false;
+        }
+        if (reply.msg_flags & MSG_TRUNC) {
+            LOG(ERROR) << "Truncated Netlink message";
+            return false;
+        }
+
+        for (const nlmsghdr *msg_ptr = reinterpret_cast<const nlmsghdr *>(m_buffer.data());
+             NLMSG_OK(msg_ptr, length); msg_ptr = NLMSG_NEXT(msg_ptr, length)) {
+            if (msg_ptr->nlmsg_seq != m_sequence) {
+                // Leftover of a previous request
+                continue;
+            }
+            if (msg_ptr->nlmsg_type == NLMSG_DONE) {
+                done = true;
+                break;
+            }
+            if (msg_ptr->nlmsg_type == NLMSG_ERROR) {
+                auto error = static_cast<const nlmsgerr *>(NLMSG_DATA(msg_ptr));
+                LOG(ERROR) << "RTM_GETLINK dump failed: " << strerror(-error->error);
+                return false;
+            }
+            if (msg_ptr->nlmsg_type == RTM_NEWLINK) {
+                parse_link(msg_ptr, entries);
+            }
+        }
+    }
+
+    return true;
+}
+
+void InterfaceStatsCache::parse_link(const nlmsghdr *msg_ptr,
+                                     std::unordered_map<uint32_t, sEntry> &entries)
+{
+    if (msg_ptr->nlmsg_len < NLMSG_LENGTH(sizeof(ifinfomsg))) {
+        return;
+    }
+
+    auto iface  = static_cast<const ifinfomsg *>(NLMSG_DATA(msg_ptr));
+    auto length = msg_ptr->nlmsg_len - NLMSG_LENGTH(sizeof(ifinfomsg));
+
+    std::string name;
+    const rtnl_link_stats *stats     = nullptr;
+    const rtnl_link_stats64 *stats64 = nullptr;
+    for (const rtattr *attribute = IFLA_RTA(iface); RTA_OK(attribute, length);
+         attribute               = RTA_NEXT(attribute, length)) {
+        switch (attribute->rta_type) {
+        case IFLA_IFNAME:
+            name = static_cast<const char *>(RTA_DATA(attribute));
+            break;
+        case IFLA_STATS:
+            if (RTA_PAYLOAD(attribute) >= sizeof(rtnl_link_stats)) {
+                stats = static_cast<const rtnl_link_stats *>(RTA_DATA(attribute));
+            }
+            break;
+        case IFLA_STATS64:
+            if (RTA_PAYLOAD(attribute) >= sizeof(rtnl_link_stats64)) {
+                stats64 = static_cast<const rtnl_link_stats64 *>(RTA_DATA(attribute));
+            }
+            break;
+        }
+    }
+
+    if (name.empty() || (!stats && !stats64)) {
+        return;
+    }
+
+    auto &entry = entries[iface->ifi_index];
+    entry.name  = name;
+
+    // The 64-bit attribute is not subject to wrap-around, prefer it
+    if (stats64) {
+        rtnl_link_stats64 aligned;
+        std::memcpy(&aligned, stats64, sizeof(aligned));
+        entry.counters.tx_bytes   = aligned.tx_bytes;
+        entry.counters.tx_errors  = aligned.tx_errors;
+        entry.counters.tx_packets = aligned.tx_packets;
+        entry.counters.rx_bytes   = aligned.rx_bytes;
+        entry.counters.rx_errors  = aligned.rx_errors;
+        entry.counters.rx_packets = aligned.rx_packets;
+    } else {
+        entry.counters.tx_bytes   = stats->tx_bytes;
+        entry.counters.tx_errors  = stats->tx_errors;
+        entry.counters.tx_packets = stats->tx_packets;
+        entry.counters.rx_bytes   = stats->rx_bytes;
+        entry.counters.rx_errors  = stats->rx_errors;
+        entry.counters.rx_packets = stats->rx_packets;
+    }
+}
+
+bool InterfaceStatsCache::get_stats(const std::string &iface_name, sInterfaceStats &iface_stats)
+{
+    if (!refresh_if_stale()) {
+        return false;
+    }
+
+    auto index_it = m_index_by_name.find(iface_name);
+    if (index_it == m_index_by_name.end()) {
+        return false;
+    }
+
+    return get_stats(index_it->second, iface_stats);
+}
+
+bool InterfaceStatsCache::get_stats(uint32_t iface_index, sInterfaceStats &iface_stats)
+{
+    if (!refresh_if_stale()) {
+        return false;
+    }
+
+    auto it = m_entries.find(iface_index);
+    if (it == m_entries.end()) {
+        return false;
+    }
+
+    // sInterfaceStats holds 32-bit counters, like IFLA_STATS
+    const auto &counters   = it->second.counters;
+    iface_stats.tx_bytes   = counters.tx_bytes;
+    iface_stats.tx_errors  = counters.tx_errors;
+    iface_stats.tx_packets = counters.tx_packets;
+    iface_stats.rx_bytes   = counters.rx_bytes;
+    iface_stats.rx_errors  = counters.rx_errors;
+    iface_stats.rx_packets = counters.rx_packets;
+
+    return true;
+}
+
+} // namespace net
+} // namespace beerocks
@@ -15,7 +15,6 @@
 #include <errno.h>
 #include <limits.h>
 #include <linux/ethtool.h>
-#include <linux/if_bridge.h>
 #include <linux/if_ether.h>  // ETH_P_ARP = 0x0806
 #include <linux/if_packet.h> // struct sockaddr_ll (see man 7 packet)
 #include <linux/netlink.h>
@@ -24,6 +23,7 @@
 #include <net/if.h>
 #include <netinet/in.h>
 #include <netinet/ip_icmp.h>
+#include <netlink/route/link.h>
 #include <netlink/route/neighbour.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -70,6 +70,51 @@ static int read_iface_flags(const std::string &strIface, struct ifreq &if_req)
     return 0;
 }
 
+typedef std::unique_ptr<nl_sock, decltype(&nl_socket_free)> nl_socket_ptr;
+typedef std::unique_ptr<rtnl_link, decltype(&rtnl_link_put)> rtnl_link_ptr;
+
+/**
+ * @brief Resolves the indexes of a bridge and of an interface, and connects a netlink route
+ * socket to add or remove the interface as a port of the bridge.
+ *
+ * @param[in] bridge Name of the bridge.
+ * @param[in] iface Name of the interface.
+ * @param[out] bridge_index Index of the bridge.
+ * @param[out] iface_index Index of the interface.
+ * @return The connected socket on success and nullptr otherwise.
+ */
+static nl_socket_ptr open_bridge_port(const std::string &bridge, const std::string &iface,
+                                      int &bridge_index, int &iface_index)
+{
+    nl_socket_ptr nl_socket(nullptr, &nl_socket_free);
+
+    bridge_index = if_nametoindex(bridge.c_str());
+    if (bridge_index == 0) {
+        LOG(ERROR) << "invalid bridge index=" << bridge_index << " for " << bridge;
+        return nl_socket;
+    }
+
+    iface_index = if_nametoindex(iface.c_str());
+    if (iface_index == 0) {
+        LOG(ERROR) << "invalid iface index=" << iface_index << " for " << iface;
+        return nl_socket;
+    }
+
+    nl_socket.reset(nl_socket_alloc());
+    if (!nl_socket) {
+        LOG(ERROR) << "Failed allocating netlink socket!";
+        return nl_socket;
+    }
+
+    int err = nl_connect(nl_socket.get(), NETLINK_ROUTE);
+    if (err != 0) {
+        LOG(ERROR) << "Failed connecting the netlink socket: " << nl_geterror(err);
+        nl_socket.reset();
+    }
+
+    return nl_socket;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// Local Module Constants ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -553,42 +598,22 @@ bool network_utils::linux_add_iface_to_bridge(const std::string &bridge, const s
 {
     LOG(DEBUG) << "add iface " << iface << " to bridge " << bridge;
 
-    struct ifreq ifr;
-    int err;
-    unsigned long ifindex = if_nametoindex(iface.c_str());
-    if (ifindex == 0) {
-        LOG(ERROR) << "invalid iface index=" << ifindex << " for " << iface;
+    int bridge_index;
+    int iface_index;
+    auto nl_socket = open_bridge_port(bridge, iface, bridge_index, iface_index);
+    if (!nl_socket) {
         return false;
     }
 
-    int br_socket_fd;
-    if ((br_socket_fd = socket(AF_LOCAL, SOCK_STREAM, 0)) < 0) {
-        LOG(ERROR) << "can't open br_socket_fd";
+    // Sends RTM_NEWLINK with IFLA_MASTER set to the bridge, and reads the link back to verify it
+    int err = rtnl_link_enslave_ifindex(nl_socket.get(), bridge_index, iface_index);
+    if (err != 0) {
+        LOG(ERROR) << "Failed adding iface " << iface << " to bridge " << bridge << ": "
+                   << nl_geterror(err);
         return false;
     }
 
-    string_utils::copy_string(ifr.ifr_name, bridge.c_str(), IFNAMSIZ);
-#ifdef SIOCBRADDIF
-    ifr.ifr_ifindex = ifindex;
-    err             = ioctl(br_socket_fd, SIOCBRADDIF, &ifr);
-    if (err < 0)
-#endif
-    {
-        unsigned long args[4] = {BRCTL_ADD_IF, ifindex, 0, 0};
-
-        ifr.ifr_data = (char *)args;
-        err          = ioctl(br_socket_fd, SIOCDEVPRIVATE, &ifr);
-    }
-
-    close(br_socket_fd);
-    return err < 0 ? false : true;
-    /*
-    std::string cmd;
-    cmd = "brctl addif " + bridge + " " + iface;
-    system(cmd.c_str());
-    LOG(DEBUG) << cmd;
     return true;
-    */
 }
 
 bool network_utils::linux_remove_iface_from_bridge(const std::string &bridge,
@@ -596,43 +621,36 @@ bool network_utils::linux_remove_iface_from_bridge(const std::string &bridge,
 {
     LOG(DEBUG) << "remove iface " << iface << " from bridge " << bridge;
 
-    struct ifreq ifr;
-    int err;
-    unsigned long ifindex = if_nametoindex(iface.c_str());
-
-    if (ifindex == 0) {
-        LOG(ERROR) << "invalid iface index=" << ifindex << " for " << iface;
+    int bridge_index;
+    int iface_index;
+    auto nl_socket = open_bridge_port(bridge, iface, bridge_index, iface_index);
+    if (!nl_socket) {
         return false;
     }
 
-    int br_socket_fd;
-    if ((br_socket_fd = socket(AF_LOCAL, SOCK_STREAM, 0)) < 0) {
-        LOG(ERROR) << "can't open br_socket_fd";
+    // Releasing the interface detaches it from any master, make sure it is a port of this bridge
+    rtnl_link *link = nullptr;
+    int err         = rtnl_link_get_kernel(nl_socket.get(), iface_index, nullptr, &link);
+    if (err != 0) {
+        LOG(ERROR) << "Failed reading iface " << iface << ": " << nl_geterror(err);
         return false;
     }
+    rtnl_link_ptr iface_link(link, &rtnl_link_put);
 
-    string_utils::copy_string(ifr.ifr_name, bridge.c_str(), IFNAMSIZ);
-#ifdef SIOCBRDELIF
-    ifr.ifr_ifindex = ifindex;
-    err             = ioctl(br_socket_fd, SIOCBRDELIF, &ifr);
-    if (err < 0)
-#endif
-    {
-        unsigned long args[4] = {BRCTL_DEL_IF, ifindex, 0, 0};
+    if (rtnl_link_get_master(iface_link.get()) != bridge_index) {
+        LOG(ERROR) << "iface " << iface << " is not on bridge " << bridge;
+        return false;
+    }
 
-        ifr.ifr_data = (char *)args;
-        err          = ioctl(br_socket_fd, SIOCDEVPRIVATE, &ifr);
+    // Sends RTM_NEWLINK with IFLA_MASTER set to 0, and reads the link back to verify it
+    err = rtnl_link_release_ifindex(nl_socket.get(), iface_index);
+    if (err != 0) {
+        LOG(ERROR) << "Failed removing iface " << iface << " from bridge " << bridge << ": "
+                   << nl_geterror(err);
+        return false;
     }
 
-    close(br_socket_fd);
-    return err < 0 ? false : true;
-    /*
-    std::string cmd;
-    cmd = "brctl delif " + bridge + " " + iface;
-    system(cmd.c_str());
-    LOG(DEBUG) << cmd;
     return true;
-    */
 }
 
 bool network_utils::linux_iface_ctrl(const std::string &iface, bool up, std::string ip,
@@ -8,6 +8,7 @@
 
 #include <bcl/network/socket.h>
 
+#include <algorithm>
 #include <errno.h>
 
 #ifdef IS_WINDOWS
@@ -19,6 +20,7 @@ typedef int socklen_t;
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 
 #include <bcl/beerocks_string_utils.h>
@@ -92,6 +94,7 @@ Socket::Socket(SOCKET s, const std::string &peer_ip, int port_port, long readTim
 
 Socket::~Socket()
 {
+    closeReceivedFds();
     if (m_external_handler)
         return;
     closeSocket();
@@ -152,12 +155,23 @@ bool Socket::setReadTimeout(long msec)
 
 void Socket::closeSocket()
 {
+    closeReceivedFds();
     if ((m_socket != INVALID_SOCKET) && ((!m_external_handler) || (m_accepted_socket))) {
         closesocket(m_socket);
         m_socket = INVALID_SOCKET;
     }
 }
 
+void Socket::closeReceivedFds()
+{
+#ifndef IS_WINDOWS
+    for (auto fd : m_received_fds) {
+        close(fd);
+    }
+    m_received_fds.clear();
+#endif
+}
+
 bool Socket::isOpen() { return (m_socket != INVALID_SOCKET); }
 
 ssize_t Socket::getBytesReady()
@@ -196,7 +210,16 @@ ssize_t Socket::readBytes(uint8_t *buf, size_t buf_size, bool blocking, size_t b
         flags |= MSG_DONTWAIT;
     }
 
+#ifdef IS_WINDOWS
     len = recv(m_socket, (char *)buf, (int)buf_len, flags);
+#else
+    if (isPeek) {
+        // File descriptors are received only once the data they are attached to is consumed
+        len = recv(m_socket, (char *)buf, (int)buf_len, flags);
+    } else {
+        len = recvWithFds(buf, buf_len, flags);
+    }
+#endif
 
     if (len < 0) {
         LOG(ERROR) << "Error reading from socket (" << m_socket << "): " << strerror(errno);
@@ -205,6 +228,82 @@ ssize_t Socket::readBytes(uint8_t *buf, size_t buf_size, bool blocking, size_t b
     return len;
 }
 
+#ifndef IS_WINDOWS
+ssize_t Socket::recvWithFds(uint8_t *buf, size_t buf_len, int flags)
+{
+    char control[CMSG_SPACE(sizeof(int) * SOCKET_MAX_RECEIVED_FDS)];
+
+    struct iovec iov;
+    iov.iov_base = buf;
+    iov.iov_len  = buf_len;
+
+    struct msghdr msg = {};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t len = recvmsg(m_socket, &msg, flags | MSG_CMSG_CLOEXEC);
+    if (len < 0) {
+        return len;
+    }
+
+    if (msg.msg_flags & MSG_CTRUNC) {
+        LOG(WARNING) << "Ancillary data truncated, file descriptors were lost";
+    }
+
+    for (auto cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        auto fds     = reinterpret_cast<int *>(CMSG_DATA(cmsg));
+        m_received_fds.insert(m_received_fds.end(), fds, fds + count);
+    }
+
+    return len;
+}
+
+ssize_t Socket::writeBytesWithFds(const uint8_t *buf, size_t buf_len, const std::vector<int> &fds)
+{
+    if (m_socket == INVALID_SOCKET) {
+        return 0;
+    }
+
+    if (fds.empty() || fds.size() > SOCKET_MAX_RECEIVED_FDS) {
+        LOG(ERROR) << "Invalid number of file descriptors: " << fds.size();
+        return -1;
+    }
+
+    char control[CMSG_SPACE(sizeof(int) * SOCKET_MAX_RECEIVED_FDS)] = {};
+
+    struct iovec iov;
+    iov.iov_base = const_cast<uint8_t *>(buf);
+    iov.iov_len  = buf_len;
+
+    struct msghdr msg = {};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * fds.size());
+
+    auto cmsg        = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type  = SCM_RIGHTS;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(int) * fds.size());
+    std::copy(fds.begin(), fds.end(), reinterpret_cast<int *>(CMSG_DATA(cmsg)));
+
+    return sendmsg(m_socket, &msg, MSG_NOSIGNAL);
+}
+
+std::vector<int> Socket::takeReceivedFds()
+{
+    std::vector<int> fds;
+    fds.swap(m_received_fds);
+    return fds;
+}
+#endif
+
 ssize_t Socket::writeBytes(const uint8_t *buf, size_t buf_len, int port, struct sockaddr_in addr_in)
 {
     if (m_socket == INVALID_SOCKET) {
@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_async_log.h>
+
+#include <easylogging++.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <fstream>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace beerocks;
+
+namespace {
+
+constexpr int threads_count    = 4;
+constexpr int lines_per_thread = 100;
+
+class async_log_test : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        char path[] = "/tmp/async_log_test_XXXXXX";
+        ASSERT_NE(mkdtemp(path), nullptr);
+        m_dir      = path;
+        m_log_file = m_dir + "/test.log";
+    }
+
+    void TearDown() override
+    {
+        for (auto suffix : {"", ".1", ".2", ".3"}) {
+            unlink((m_log_file + suffix).c_str());
+        }
+        rmdir(m_dir.c_str());
+    }
+
+    /**
+     * @brief Configures a logger writing to the test log file, the way logging::apply_settings()
+     * does.
+     */
+    void configure_logger(const std::string &logger_id, size_t max_file_size)
+    {
+        el::Configurations conf;
+        conf.setToDefault();
+        conf.setGlobally(el::ConfigurationType::Format, "%level %msg");
+        conf.setGlobally(el::ConfigurationType::ToStandardOutput, "false");
+        conf.setGlobally(el::ConfigurationType::ToFile, "true");
+        conf.setGlobally(el::ConfigurationType::Filename, m_log_file);
+        conf.setGlobally(el::ConfigurationType::MaxLogFileSize, std::to_string(max_file_size));
+        el::Loggers::getLogger(logger_id);
+        el::Loggers::reconfigureLogger(logger_id, conf);
+    }
+
+    std::vector<std::string> read_lines(const std::string &path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    std::string m_dir;
+    std::string m_log_file;
+};
+
+TEST_F(async_log_test, lines_of_all_threads_should_be_written)
+{
+    configure_logger("async_log_test", 0);
+    ASSERT_TRUE(async_log::attach("async_log_test", false));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; t++) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < lines_per_thread; i++) {
+                CLOG(INFO, "async_log_test") << "thread " << t << " line " << i;
+                // Keeps the rings from overflowing
+                if (i % 50 == 49) {
+                    async_log::flush();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(async_log::flush());
+
+    auto lines = read_lines(m_log_file);
+    EXPECT_EQ(lines.size() + async_log::get_dropped_count(),
+              size_t(threads_count * lines_per_thread));
+
+    // The lines of a thread are written in order
+    std::vector<int> next_line(threads_count, 0);
+    for (auto &line : lines) {
+        int t, i;
+        ASSERT_EQ(sscanf(line.c_str(), "INFO thread %d line %d", &t, &i), 2) << line;
+        ASSERT_LT(t, threads_count);
+        EXPECT_GE(i, next_line[t]);
+        next_line[t] = i + 1;
+    }
+}
+
+TEST_F(async_log_test, lines_of_threads_without_a_ring_should_be_written)
+{
+    configure_logger("async_log_test_many", 0);
+    ASSERT_TRUE(async_log::attach("async_log_test_many", false));
+
+    // More threads than rings, all alive until every thread has logged
+    constexpr int many_threads_count = 48;
+    std::atomic<int> logged(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < many_threads_count; t++) {
+        threads.emplace_back([t, &logged]() {
+            CLOG(ERROR, "async_log_test_many") << "thread " << t;
+            logged++;
+            while (logged < many_threads_count) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(async_log::flush());
+
+    auto lines = read_lines(m_log_file);
+    std::vector<bool> written(many_threads_count, false);
+    for (auto &line : lines) {
+        int t;
+        ASSERT_EQ(sscanf(line.c_str(), "ERROR thread %d", &t), 1) << line;
+        ASSERT_LT(t, many_threads_count);
+        written[t] = true;
+    }
+    for (int t = 0; t < many_threads_count; t++) {
+        EXPECT_TRUE(written[t]) << "thread " << t;
+    }
+}
+
+TEST_F(async_log_test, long_lines_should_be_written_whole)
+{
+    configure_logger("async_log_test_long", 0);
+    ASSERT_TRUE(async_log::attach("async_log_test_long", false));
+
+    std::string message(1000, 'x');
+    CLOG(INFO, "async_log_test_long") << message;
+    ASSERT_TRUE(async_log::flush());
+
+    auto lines = read_lines(m_log_file);
+    ASSERT_EQ(lines.size(), 1U);
+    EXPECT_EQ(lines[0], "INFO " + message);
+}
+
+TEST_F(async_log_test, file_should_be_rolled)
+{
+    // Rolled when reaching half of the maximum size
+    configure_logger("async_log_test_roll", 2000);
+    ASSERT_TRUE(async_log::attach("async_log_test_roll", true));
+
+    for (int i = 0; i < 100; i++) {
+        CLOG(INFO, "async_log_test_roll") << "line " << i;
+    }
+    ASSERT_TRUE(async_log::flush());
+
+    EXPECT_LT(read_lines(m_log_file).size(), 100U);
+    EXPECT_FALSE(read_lines(m_log_file + ".1").empty());
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/interface_registry.h>
+
+#include <dirent.h>
+#include <net/if.h>
+
+#include <gtest/gtest.h>
+
+using namespace beerocks::net;
+
+namespace {
+
+std::vector<std::string> get_iface_names()
+{
+    std::vector<std::string> iface_names;
+
+    const char *path = "/sys/class/net";
+
+    DIR *dir = opendir(path);
+    if (dir) {
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL) {
+            std::string iface_name = entry->d_name;
+            if (iface_name == "." || iface_name == "..") {
+                continue;
+            }
+            iface_names.push_back(iface_name);
+        }
+        closedir(dir);
+    }
+
+    return iface_names;
+}
+
+TEST(InterfaceRegistryTest, open_should_load_all_interfaces)
+{
+    InterfaceRegistry registry;
+
+    ASSERT_TRUE(registry.open());
+    EXPECT_GE(registry.get_fd(), 0);
+    EXPECT_EQ(registry.get_dump_count(), 1U);
+
+    auto iface_names = get_iface_names();
+    ASSERT_FALSE(iface_names.empty());
+
+    for (const auto &iface_name : iface_names) {
+        auto iface = registry.get_interface(iface_name);
+        ASSERT_NE(iface, nullptr) << iface_name;
+        EXPECT_EQ(iface->index, if_nametoindex(iface_name.c_str())) << iface_name;
+        EXPECT_EQ(registry.get_iface_name(iface->index), iface_name);
+    }
+}
+
+TEST(InterfaceRegistryTest, loopback_should_be_up_with_an_address)
+{
+    InterfaceRegistry registry;
+    ASSERT_TRUE(registry.open());
+
+    auto iface = registry.get_interface("lo");
+    ASSERT_NE(iface, nullptr);
+    EXPECT_TRUE(iface->is_up());
+    EXPECT_EQ(registry.get_interface(iface->index), iface);
+
+    sMacAddr mac;
+    EXPECT_TRUE(registry.get_mac("lo", mac));
+    EXPECT_EQ(mac, iface->mac);
+
+    ASSERT_FALSE(iface->addresses.empty());
+    EXPECT_EQ(iface->addresses[0].address.oct[0], 127);
+    EXPECT_EQ(iface->addresses[0].prefix_length, 8);
+}
+
+TEST(InterfaceRegistryTest, unknown_interface_should_not_be_found)
+{
+    InterfaceRegistry registry;
+    ASSERT_TRUE(registry.open());
+
+    sMacAddr mac;
+    EXPECT_EQ(registry.get_interface("no_such_iface0"), nullptr);
+    EXPECT_FALSE(registry.get_mac("no_such_iface0", mac));
+    EXPECT_FALSE(registry.is_up_and_running("no_such_iface0"));
+    EXPECT_TRUE(registry.get_bridge_members("no_such_iface0").empty());
+    EXPECT_TRUE(registry.get_iface_name(0).empty());
+}
+
+TEST(InterfaceRegistryTest, process_events_without_events_should_succeed)
+{
+    InterfaceRegistry registry;
+
+    EXPECT_FALSE(registry.process_events());
+
+    ASSERT_TRUE(registry.open());
+    EXPECT_TRUE(registry.process_events());
+    EXPECT_EQ(registry.get_dump_count(), 1U);
+}
+
+TEST(InterfaceRegistryTest, loopback_should_have_no_bridge_members)
+{
+    InterfaceRegistry registry;
+    ASSERT_TRUE(registry.open());
+
+    EXPECT_TRUE(registry.get_bridge_members("lo").empty());
+}
+
+} // namespace
@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/interface_stats_cache.h>
+
+#include <dirent.h>
+#include <net/if.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace beerocks::net;
+
+namespace {
+
+std::vector<std::string> get_iface_names()
+{
+    std::vector<std::string> iface_names;
+
+    const char *path = "/sys/class/net";
+
+    DIR *dir = opendir(path);
+    if (dir) {
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL) {
+            std::string iface_name = entry->d_name;
+            if (iface_name == "." || iface_name == "..") {
+                continue;
+            }
+            iface_names.push_back(iface_name);
+        }
+        closedir(dir);
+    }
+
+    return iface_names;
+}
+
+TEST(InterfaceStatsCacheTest, get_stats_of_all_interfaces_should_take_a_single_dump)
+{
+    InterfaceStatsCache cache(std::chrono::seconds(60));
+    sInterfaceStats iface_stats;
+
+    auto iface_names = get_iface_names();
+    ASSERT_FALSE(iface_names.empty());
+
+    for (const auto &iface_name : iface_names) {
+        EXPECT_TRUE(cache.get_stats(iface_name, iface_stats)) << iface_name;
+    }
+    EXPECT_EQ(cache.get_dump_count(), 1U);
+}
+
+TEST(InterfaceStatsCacheTest, get_stats_by_index_should_match_get_stats_by_name)
+{
+    InterfaceStatsCache cache(std::chrono::seconds(60));
+
+    for (const auto &iface_name : get_iface_names()) {
+        uint32_t iface_index = if_nametoindex(iface_name.c_str());
+        ASSERT_NE(iface_index, 0U) << iface_name;
+
+        sInterfaceStats stats_by_name;
+        sInterfaceStats stats_by_index;
+        ASSERT_TRUE(cache.get_stats(iface_name, stats_by_name));
+        ASSERT_TRUE(cache.get_stats(iface_index, stats_by_index));
+        EXPECT_EQ(stats_by_name.tx_bytes, stats_by_index.tx_bytes);
+        EXPECT_EQ(stats_by_name.rx_packets, stats_by_index.rx_packets);
+    }
+}
+
+TEST(InterfaceStatsCacheTest, get_stats_of_unknown_interface_should_fail)
+{
+    InterfaceStatsCache cache;
+    sInterfaceStats iface_stats;
+
+    EXPECT_FALSE(cache.get_stats("no_such_iface0", iface_stats));
+}
+
+TEST(InterfaceStatsCacheTest, stale_cache_should_be_refreshed)
+{
+    InterfaceStatsCache cache(std::chrono::milliseconds(1));
+    sInterfaceStats iface_stats;
+
+    ASSERT_TRUE(cache.get_stats("lo", iface_stats));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(cache.get_stats("lo", iface_stats));
+    EXPECT_EQ(cache.get_dump_count(), 2U);
+
+    ASSERT_TRUE(cache.refresh());
+    EXPECT_EQ(cache.get_dump_count(), 3U);
+}
+
+} // namespace
@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_metrics.h>
+#include <bcl/network/socket.h>
+
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace beerocks;
+
+namespace {
+
+/**
+ * @brief Gets the value of a line of the dump, e.g. "name{label} value".
+ */
+std::string dump_value(const std::string &series)
+{
+    auto text = metrics::dump();
+    auto pos  = text.find("\n" + series + " ");
+    if (pos == std::string::npos) {
+        return std::string();
+    }
+    pos += series.size() + 2;
+    return text.substr(pos, text.find('\n', pos) - pos);
+}
+
+TEST(metrics_test, counter_should_sum_up_all_threads)
+{
+    static metrics::counter counter("test_counter_total", "Test counter");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 1000; i++) {
+                counter.add();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    counter.add(5);
+
+    EXPECT_EQ(dump_value("test_counter_total"), "4005");
+    EXPECT_NE(metrics::dump().find("# HELP test_counter_total Test counter\n"
+                                   "# TYPE test_counter_total counter\n"),
+              std::string::npos);
+}
+
+TEST(metrics_test, gauge_should_be_set)
+{
+    static metrics::gauge gauge("test_gauge");
+
+    gauge.set(10);
+    gauge.add(-3);
+    EXPECT_EQ(dump_value("test_gauge"), "7");
+}
+
+TEST(metrics_test, histogram_should_count_values_in_buckets)
+{
+    static metrics::histogram histogram("test_histogram_usec");
+
+    histogram.observe(uint64_t(0));
+    histogram.observe(uint64_t(3));
+    histogram.observe(uint64_t(4));
+    histogram.observe(uint64_t(1000));
+    histogram.observe(std::chrono::seconds(10));
+
+    EXPECT_EQ(dump_value("test_histogram_usec_bucket{le=\"1\"}"), "1");
+    EXPECT_EQ(dump_value("test_histogram_usec_bucket{le=\"2\"}"), "1");
+    EXPECT_EQ(dump_value("test_histogram_usec_bucket{le=\"4\"}"), "3");
+    EXPECT_EQ(dump_value("test_histogram_usec_bucket{le=\"1024\"}"), "4");
+    EXPECT_EQ(dump_value("test_histogram_usec_bucket{le=\"1048576\"}"), "4");
+    EXPECT_EQ(dump_value("test_histogram_usec_bucket{le=\"+Inf\"}"), "5");
+    EXPECT_EQ(dump_value("test_histogram_usec_sum"), "10001007");
+    EXPECT_EQ(dump_value("test_histogram_usec_count"), "5");
+}
+
+TEST(metrics_test, histogram_family_should_have_a_histogram_per_label)
+{
+    static metrics::histogram_family family("test_family_usec", "type");
+
+    family.get(0x8002).observe(uint64_t(10));
+    family.get(0x8002).observe(uint64_t(20));
+    family.get("other").observe(uint64_t(30));
+
+    EXPECT_EQ(&family.get(0x8002), &family.get("0x8002"));
+    EXPECT_EQ(dump_value("test_family_usec_count{type=\"0x8002\"}"), "2");
+    EXPECT_EQ(dump_value("test_family_usec_sum{type=\"other\"}"), "30");
+}
+
+TEST(metrics_test, export_should_write_the_dump)
+{
+    static metrics::counter counter("test_export_total");
+    counter.add(3);
+
+    char dir[] = "/tmp/metrics_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    std::string uds_path = std::string(dir) + "/uds_metrics_test";
+    ASSERT_TRUE(metrics::start_export(uds_path));
+
+    SocketClient client(uds_path);
+    ASSERT_TRUE(client.getError().empty()) << client.getError();
+    std::string text;
+    uint8_t buffer[1024];
+    ssize_t length;
+    while ((length = client.readBytes(buffer, sizeof(buffer), true, sizeof(buffer))) > 0) {
+        text.append(reinterpret_cast<char *>(buffer), length);
+    }
+    EXPECT_NE(text.find("\ntest_export_total 3\n"), std::string::npos);
+
+    // The export can be restarted once stopped
+    EXPECT_FALSE(metrics::start_export(uds_path));
+    metrics::stop_export();
+    unlink(uds_path.c_str());
+    ASSERT_TRUE(metrics::start_export(uds_path));
+    metrics::stop_export();
+
+    unlink(uds_path.c_str());
+    rmdir(dir);
+}
+
+} // namespace
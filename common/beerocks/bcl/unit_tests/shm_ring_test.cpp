@@ -0,0 +1,238 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_shm_ring.h>
+#include <bcl/network/socket.h>
+
+#include <gtest/gtest.h>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace beerocks;
+
+namespace {
+
+struct sTestRecord {
+    uint32_t id;
+    uint8_t payload[20];
+};
+
+constexpr size_t capacity = 8;
+
+/**
+ * @brief Attaches a consumer to the ring through duplicated file descriptors, as a process
+ * receiving them over a unix domain socket would.
+ */
+std::unique_ptr<shm_ring> attach_consumer(const shm_ring &producer)
+{
+    return shm_ring::attach(dup(producer.get_memfd()), dup(producer.get_eventfd()),
+                            sizeof(sTestRecord));
+}
+
+bool is_notified(const shm_ring &consumer)
+{
+    struct pollfd pfd = {consumer.get_eventfd(), POLLIN, 0};
+    return poll(&pfd, 1, 0) == 1;
+}
+
+TEST(shm_ring_test, capacity_should_be_rounded_to_power_of_2)
+{
+    auto ring = shm_ring::create("test", sizeof(sTestRecord), 5);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->get_capacity(), 8U);
+    EXPECT_EQ(ring->get_record_size(), sizeof(sTestRecord));
+
+    EXPECT_EQ(shm_ring::create("test", 0, capacity), nullptr);
+    EXPECT_EQ(shm_ring::create("test", sizeof(sTestRecord), 0), nullptr);
+}
+
+TEST(shm_ring_test, records_should_be_visible_after_commit)
+{
+    auto producer = shm_ring::create("test", sizeof(sTestRecord), capacity);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = attach_consumer(*producer);
+    ASSERT_NE(consumer, nullptr);
+
+    sTestRecord record = {1, {0xaa}};
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    record.id = 2;
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+
+    sTestRecord out;
+    EXPECT_FALSE(consumer->pop(&out));
+    EXPECT_FALSE(is_notified(*consumer));
+
+    ASSERT_TRUE(producer->commit());
+    EXPECT_TRUE(is_notified(*consumer));
+    consumer->clear_notification();
+    EXPECT_FALSE(is_notified(*consumer));
+
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 1U);
+    EXPECT_EQ(out.payload[0], 0xaa);
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 2U);
+    EXPECT_FALSE(consumer->pop(&out));
+}
+
+TEST(shm_ring_test, consumer_should_be_woken_up_only_when_waiting)
+{
+    auto producer = shm_ring::create("test", sizeof(sTestRecord), capacity);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = attach_consumer(*producer);
+    ASSERT_NE(consumer, nullptr);
+
+    sTestRecord record = {1, {}};
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    ASSERT_TRUE(producer->commit());
+    EXPECT_TRUE(is_notified(*consumer));
+    consumer->clear_notification();
+
+    // The consumer is draining the ring, it doesn't need to be woken up
+    sTestRecord out;
+    ASSERT_TRUE(consumer->pop(&out));
+    record.id = 2;
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    ASSERT_TRUE(producer->commit());
+    EXPECT_FALSE(is_notified(*consumer));
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 2U);
+
+    // Finding the ring empty asks for a wake-up, once
+    EXPECT_FALSE(consumer->pop(&out));
+    record.id = 3;
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    ASSERT_TRUE(producer->commit());
+    EXPECT_TRUE(is_notified(*consumer));
+    consumer->clear_notification();
+    record.id = 4;
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    ASSERT_TRUE(producer->commit());
+    EXPECT_FALSE(is_notified(*consumer));
+
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 3U);
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 4U);
+    EXPECT_FALSE(consumer->pop(&out));
+}
+
+TEST(shm_ring_test, full_ring_should_count_dropped_records)
+{
+    auto producer = shm_ring::create("test", sizeof(sTestRecord), capacity);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = attach_consumer(*producer);
+    ASSERT_NE(consumer, nullptr);
+
+    sTestRecord record = {};
+    for (size_t i = 0; i < capacity; i++) {
+        record.id = i;
+        ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    }
+    EXPECT_EQ(producer->get_free_count(), 0U);
+    EXPECT_FALSE(producer->push(&record, sizeof(record)));
+    EXPECT_EQ(consumer->get_dropped_count(), 1U);
+    ASSERT_TRUE(producer->commit());
+
+    // Records wrap around once the consumer makes room
+    sTestRecord out;
+    ASSERT_TRUE(consumer->pop(&out));
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(producer->get_free_count(), 2U);
+
+    record.id = 100;
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    ASSERT_TRUE(producer->commit());
+
+    for (uint32_t id = 2; id < capacity; id++) {
+        ASSERT_TRUE(consumer->pop(&out));
+        EXPECT_EQ(out.id, id);
+    }
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 100U);
+    EXPECT_FALSE(consumer->pop(&out));
+}
+
+TEST(shm_ring_test, short_record_should_be_zero_padded)
+{
+    auto producer = shm_ring::create("test", sizeof(sTestRecord), capacity);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = attach_consumer(*producer);
+    ASSERT_NE(consumer, nullptr);
+
+    uint32_t id = 7;
+    ASSERT_TRUE(producer->push(&id, sizeof(id)));
+    ASSERT_TRUE(producer->commit());
+
+    sTestRecord out;
+    memset(&out, 0xff, sizeof(out));
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, id);
+    EXPECT_EQ(out.payload[sizeof(out.payload) - 1], 0);
+
+    uint8_t too_big[sizeof(sTestRecord) + 1] = {};
+    EXPECT_FALSE(producer->push(too_big, sizeof(too_big)));
+}
+
+TEST(shm_ring_test, attach_with_other_record_size_should_fail)
+{
+    auto producer = shm_ring::create("test", sizeof(sTestRecord), capacity);
+    ASSERT_NE(producer, nullptr);
+
+    EXPECT_EQ(shm_ring::attach(dup(producer->get_memfd()), dup(producer->get_eventfd()),
+                               sizeof(sTestRecord) + 1),
+              nullptr);
+}
+
+TEST(shm_ring_test, ring_should_be_shared_over_unix_socket)
+{
+    int sv[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    Socket sender(sv[0]);
+    Socket receiver(sv[1]);
+
+    auto producer = shm_ring::create("test", sizeof(sTestRecord), capacity);
+    ASSERT_NE(producer, nullptr);
+
+    const uint8_t message[] = {1, 2, 3, 4};
+    ASSERT_EQ(sender.writeBytesWithFds(message, sizeof(message),
+                                       {producer->get_memfd(), producer->get_eventfd()}),
+              ssize_t(sizeof(message)));
+
+    // Peeking does not consume the file descriptors
+    uint8_t buffer[sizeof(message)];
+    ASSERT_EQ(receiver.readBytes(buffer, sizeof(buffer), true, 1, true), 1);
+    EXPECT_TRUE(receiver.takeReceivedFds().empty());
+
+    ASSERT_EQ(receiver.readBytes(buffer, sizeof(buffer), true, sizeof(buffer)),
+              ssize_t(sizeof(message)));
+    EXPECT_EQ(buffer[3], 4);
+
+    auto fds = receiver.takeReceivedFds();
+    ASSERT_EQ(fds.size(), 2U);
+    EXPECT_TRUE(receiver.takeReceivedFds().empty());
+
+    auto consumer = shm_ring::attach(fds[0], fds[1], sizeof(sTestRecord));
+    ASSERT_NE(consumer, nullptr);
+
+    sTestRecord record = {42, {}};
+    ASSERT_TRUE(producer->push(&record, sizeof(record)));
+    ASSERT_TRUE(producer->commit());
+    EXPECT_TRUE(is_notified(*consumer));
+
+    sTestRecord out;
+    ASSERT_TRUE(consumer->pop(&out));
+    EXPECT_EQ(out.id, 42U);
+
+    close(sv[0]);
+    close(sv[1]);
+}
+
+} // namespace
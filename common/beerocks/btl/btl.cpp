@@ -13,8 +13,9 @@
 using namespace beerocks::btl;
 using namespace beerocks::net;
 
-transport_socket_thread::transport_socket_thread(const std::string &unix_socket_path_)
-    : socket_thread(unix_socket_path_)
+transport_socket_thread::transport_socket_thread(const std::string &unix_socket_path_,
+                                                 size_t tx_buffer_length)
+    : socket_thread(unix_socket_path_, tx_buffer_length)
 {
     transport_socket_thread::set_select_timeout(DEFAULT_SELECT_TIMEOUT_MS);
 }
@@ -15,6 +15,7 @@
 #include <mapf/transport/ieee1905_transport_messages.h>
 
 #include <sys/uio.h>
+#include <unordered_map>
 
 #include <easylogging++.h>
 
@@ -22,6 +23,51 @@ using namespace beerocks::btl;
 using namespace beerocks::net;
 using namespace beerocks::transport::messages;
 
+#ifdef BEEROCKS_CMDU_TRACE
+// Latency of the stages of the received CMDUs
+static beerocks::metrics::histogram_family
+    s_rx_defragmentation_time("cmdu_rx_defragmentation_usec", "type",
+                              "From the first fragment to the last");
+static beerocks::metrics::histogram_family s_rx_transport_time("cmdu_rx_transport_usec", "type",
+                                                               "From the network to the broker");
+static beerocks::metrics::histogram_family s_rx_broker_time("cmdu_rx_broker_usec", "type",
+                                                            "From the broker to the subscriber");
+static beerocks::metrics::histogram_family s_rx_handler_time("cmdu_rx_handler_usec", "type",
+                                                             "Handling by the subscriber");
+static beerocks::metrics::histogram_family
+    s_rx_total_time("cmdu_rx_total_usec", "type", "From the network to the end of the handling");
+
+/**
+ * @brief Histograms of the stages of the received CMDUs of a message type.
+ */
+struct sRxTraceHistograms {
+    beerocks::metrics::histogram *defragmentation;
+    beerocks::metrics::histogram *transport;
+    beerocks::metrics::histogram *broker;
+    beerocks::metrics::histogram *handler;
+    beerocks::metrics::histogram *total;
+};
+
+/**
+ * @brief Gets the histograms of a message type, resolved once per message type since
+ * histogram_family::get() takes a lock.
+ */
+static const sRxTraceHistograms &get_rx_trace_histograms(uint16_t msg_type)
+{
+    // A process may run several socket threads
+    static thread_local std::unordered_map<uint16_t, sRxTraceHistograms> s_histograms;
+    auto it = s_histograms.find(msg_type);
+    if (it == s_histograms.end()) {
+        sRxTraceHistograms histograms = {
+            &s_rx_defragmentation_time.get(msg_type), &s_rx_transport_time.get(msg_type),
+            &s_rx_broker_time.get(msg_type), &s_rx_handler_time.get(msg_type),
+            &s_rx_total_time.get(msg_type)};
+        it = s_histograms.emplace(msg_type, histograms).first;
+    }
+    return it->second;
+}
+#endif // BEEROCKS_CMDU_TRACE
+
 bool transport_socket_thread::broker_init()
 {
     if (m_broker) {
@@ -142,6 +188,7 @@ bool transport_socket_thread::broker_send(ieee1905_1::CmduMessage &cmdu,
     msg.metadata()->if_index          = if_nametoindex(iface_name.c_str());
 
     std::copy_n((uint8_t *)cmdu.getMessageBuff(), msg.metadata()->length, (uint8_t *)msg.data());
+    msg.trace_stamp(CmduTxMessage::TRACE_TX_SENT);
     return transport::messages::send_transport_message(*m_broker, msg);
 }
 
@@ -160,19 +207,20 @@ bool transport_socket_thread::handle_cmdu_message_broker()
                           << "\n\tFrame: " << msg->frame().str();
         return false;
     }
+    cmdu_rx_msg->trace_stamp(CmduRxMessage::TRACE_RX_DELIVERED);
 
     // Copy the data to rx_buffer
-    if (sizeof(message::sUdsHeader) + cmdu_rx_msg->metadata()->length > sizeof(rx_buffer)) {
+    if (sizeof(message::sUdsHeader) + cmdu_rx_msg->metadata()->length > rx_buffer.size()) {
         THREAD_LOG(ERROR)
-            << "sizeof(message::sUdsHeader) + cmdu_rx_msg->metadata()->length > sizeof(rx_buffer)";
+            << "sizeof(message::sUdsHeader) + cmdu_rx_msg->metadata()->length > rx_buffer.size()";
         return false;
     }
 
     std::copy_n((uint8_t *)cmdu_rx_msg->data(), cmdu_rx_msg->metadata()->length,
-                rx_buffer + sizeof(message::sUdsHeader));
+                rx_buffer.data() + sizeof(message::sUdsHeader));
 
     // fill UDS Header
-    message::sUdsHeader *uds_header = (message::sUdsHeader *)rx_buffer;
+    message::sUdsHeader *uds_header = (message::sUdsHeader *)rx_buffer.data();
     uds_header->if_index            = cmdu_rx_msg->metadata()->if_index;
     std::copy_n((uint8_t *)cmdu_rx_msg->metadata()->src, sizeof(CmduRxMessage::Metadata::src),
                 uds_header->src_bridge_mac);
@@ -186,16 +234,30 @@ bool transport_socket_thread::handle_cmdu_message_broker()
     }
 
     if (!cmdu_rx.parse()) {
-        THREAD_LOG(ERROR) << "parsing cmdu failure, rx_buffer" << std::hex << rx_buffer << std::dec
-                          << ", uds_header->length=" << int(uds_header->length);
+        THREAD_LOG(ERROR) << "parsing cmdu failure, rx_buffer" << std::hex << rx_buffer.data()
+                          << std::dec << ", uds_header->length=" << int(uds_header->length);
         return false;
     }
 
-    if (!handle_cmdu(m_broker.get(), cmdu_rx)) {
-        return false;
-    }
-
-    return true;
+    auto handled = handle_cmdu(m_broker.get(), cmdu_rx);
+
+#ifdef BEEROCKS_CMDU_TRACE
+    auto trace       = cmdu_rx_msg->metadata()->trace;
+    auto now         = CmduRxMessage::trace_now();
+    auto &histograms = get_rx_trace_histograms(cmdu_rx_msg->metadata()->msg_type);
+    CmduRxMessage::trace_observe(*histograms.defragmentation,
+                                 trace[CmduRxMessage::TRACE_RX_RECEIVED],
+                                 trace[CmduRxMessage::TRACE_RX_REASSEMBLED]);
+    CmduRxMessage::trace_observe(*histograms.transport, trace[CmduRxMessage::TRACE_RX_REASSEMBLED],
+                                 trace[CmduRxMessage::TRACE_RX_PUBLISHED]);
+    CmduRxMessage::trace_observe(*histograms.broker, trace[CmduRxMessage::TRACE_RX_PUBLISHED],
+                                 trace[CmduRxMessage::TRACE_RX_DELIVERED]);
+    CmduRxMessage::trace_observe(*histograms.handler, trace[CmduRxMessage::TRACE_RX_DELIVERED],
+                                 now);
+    CmduRxMessage::trace_observe(*histograms.total, trace[CmduRxMessage::TRACE_RX_RECEIVED], now);
+#endif
+
+    return handled;
 }
 
 bool transport_socket_thread::from_broker(Socket *sd)
@@ -21,7 +21,8 @@ namespace beerocks {
 namespace btl {
 class transport_socket_thread : public socket_thread {
 public:
-    transport_socket_thread(const std::string &unix_socket_path_ = std::string());
+    transport_socket_thread(const std::string &unix_socket_path_ = std::string(),
+                            size_t tx_buffer_length          = message::MESSAGE_BUFFER_LENGTH);
     virtual ~transport_socket_thread();
 
     virtual bool init() override;
@@ -41,19 +42,12 @@ public:
     bool send_cmdu_to_broker(ieee1905_1::CmduMessageTx &cmdu, const std::string &dst_mac,
                              const std::string &src_mac, const std::string &iface_name = "");
 
-protected:
-    void add_socket(Socket *s, bool add_to_vector = true) override;
-    bool configure_ieee1905_transport_interfaces(const std::string &bridge_iface,
-                                                 const std::vector<std::string> &ifaces);
-
-    bool from_broker(Socket *sd);
-
-    bool broker_connect(const std::string &beerocks_temp_path, const bool local_master);
-    bool broker_subscribe(const std::vector<ieee1905_1::eMessageType> &msg_types);
-
     /**
      * @brief Sends CDMU to transport for dispatching.
      *
+     * The CMDU must be already finalized, e.g. a received CMDU being forwarded or a CMDU
+     * serialized in advance.
+     *
      * @param cmdu Control Message Data Unit to send.
      * @param dst_mac Destination MAC address.
      * @param src_mac Source MAC address.
@@ -66,6 +60,16 @@ protected:
                              const std::string &src_mac, uint16_t length,
                              const std::string &iface_name = "");
 
+protected:
+    void add_socket(Socket *s, bool add_to_vector = true) override;
+    bool configure_ieee1905_transport_interfaces(const std::string &bridge_iface,
+                                                 const std::vector<std::string> &ifaces);
+
+    bool from_broker(Socket *sd);
+
+    bool broker_connect(const std::string &beerocks_temp_path, const bool local_master);
+    bool broker_subscribe(const std::vector<ieee1905_1::eMessageType> &msg_types);
+
 private:
     bool broker_init();
     bool broker_send(ieee1905_1::CmduMessage &cmdu, const std::string &iface_name,
@@ -0,0 +1,172 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/*
+ * Synthetic benchmark of the HAL event processing.
+ *
+ * Writes bursts of station connect events to the EVENT file of a dummy AP HAL, every 4th station
+ * disconnecting right after connecting, and processes them the way ap_manager_thread does: the
+ * external events when the inotify file descriptor is readable, then the internal events when the
+ * eventfd is readable.
+ * Prints the number of events per second, the latency of the events (from writing the burst to
+ * delivering the event to the callback), the number of wake-ups and the number of superseded
+ * events which were not delivered.
+ *
+ * Usage: hal_events_benchmark [burst size] [bursts]
+ */
+
+#include <bwl/ap_wlan_hal.h>
+
+#include <easylogging++.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <poll.h>
+#include <sys/stat.h>
+
+INITIALIZE_EASYLOGGINGPP
+
+static const int DEFAULT_BURST_SIZE = 64;
+static const int DEFAULT_BURSTS     = 100;
+
+static const char BENCHMARK_IFACE[] = "wlan_bench";
+
+static const char STATION_CAPABILITIES[] = " SupportedRates=8c HT_CAP=01ef HT_MCS=ffff0000"
+                                           " VHT_CAP=0f825832 VHT_MCS=fffa0000";
+
+// Idle time after which the burst is considered lost
+static const int POLL_TIMEOUT_MSEC = 1000;
+
+typedef std::chrono::steady_clock clock_type;
+
+static clock_type::time_point s_burst_start;
+static int s_delivered_events;
+static double s_total_latency_us;
+static double s_max_latency_us;
+
+static bool hal_event_handler(bwl::base_wlan_hal::hal_event_ptr_t event)
+{
+    double latency_us =
+        std::chrono::duration<double, std::micro>(clock_type::now() - s_burst_start).count();
+
+    s_delivered_events++;
+    s_total_latency_us += latency_us;
+    if (latency_us > s_max_latency_us) {
+        s_max_latency_us = latency_us;
+    }
+
+    return true;
+}
+
+static std::string station_mac(int station)
+{
+    char mac[18];
+    snprintf(mac, sizeof(mac), "02:00:00:00:%02x:%02x", (station >> 8) & 0xff, station & 0xff);
+    return mac;
+}
+
+static bool write_burst(const std::string &event_file, int burst_size, int &pushed_events)
+{
+    std::ofstream stream(event_file, std::ofstream::trunc);
+    if (!stream.is_open()) {
+        return false;
+    }
+
+    for (int i = 0; i < burst_size; i++) {
+        stream << "EVENT AP-STA-CONNECTED " << station_mac(i) << STATION_CAPABILITIES << "\n";
+        pushed_events++;
+        if (i % 4 == 0) {
+            stream << "EVENT AP-STA-DISCONNECTED " << station_mac(i) << "\n";
+            pushed_events++;
+        }
+    }
+
+    return bool(stream.flush());
+}
+
+static bool process_burst(bwl::ap_wlan_hal &hal, int expected_events, int &wakeups)
+{
+    struct pollfd fds[] = {
+        {hal.get_ext_events_fd(), POLLIN, 0},
+        {hal.get_int_events_fd(), POLLIN, 0},
+    };
+
+    while (s_delivered_events < expected_events) {
+        if (poll(fds, 2, POLL_TIMEOUT_MSEC) <= 0) {
+            return false;
+        }
+
+        if ((fds[0].revents & POLLIN) && !hal.process_ext_events()) {
+            return false;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            wakeups++;
+            if (!hal.process_int_events()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int burst_size = argc > 1 ? std::atoi(argv[1]) : DEFAULT_BURST_SIZE;
+    int bursts     = argc > 2 ? std::atoi(argv[2]) : DEFAULT_BURSTS;
+    if (burst_size <= 0 || burst_size > 0xffff || bursts <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [burst size] [bursts]" << std::endl;
+        return 1;
+    }
+
+    el::Loggers::addFlag(el::LoggingFlag::HierarchicalLogging);
+    el::Loggers::setLoggingLevel(el::Level::Error);
+
+    // The dummy HAL only creates the last level of its status directory
+    mkdir(BEEROCKS_TMP_PATH, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+    auto hal = bwl::ap_wlan_hal_create(BENCHMARK_IFACE, {}, hal_event_handler);
+    if (!hal) {
+        std::cerr << "Failed creating the dummy HAL" << std::endl;
+        return 1;
+    }
+
+    std::string event_file = std::string(BEEROCKS_TMP_PATH) + "/" + BENCHMARK_IFACE + "/EVENT";
+
+    int pushed_events = 0;
+    int wakeups       = 0;
+    auto start        = clock_type::now();
+    for (int i = 0; i < bursts; i++) {
+        s_burst_start = clock_type::now();
+
+        // Every station ends up with a single delivered event, the disconnect events supersede
+        // the preceding connect events
+        int expected_events = s_delivered_events + burst_size;
+        if (!write_burst(event_file, burst_size, pushed_events) ||
+            !process_burst(*hal, expected_events, wakeups)) {
+            std::cerr << "Burst " << i << " failed" << std::endl;
+            return 1;
+        }
+    }
+    double elapsed_sec = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::cout << "burst size: " << burst_size << " stations, bursts: " << bursts << std::endl;
+    std::cout << "events:     " << pushed_events << " pushed, " << s_delivered_events
+              << " delivered, " << pushed_events - s_delivered_events << " superseded"
+              << std::endl;
+    std::cout << "wake-ups:   " << wakeups << " (" << double(pushed_events) / wakeups
+              << " events/wake-up)" << std::endl;
+    std::cout << "throughput: " << pushed_events / elapsed_sec << " events/s" << std::endl;
+    std::cout << "latency:    " << s_total_latency_us / s_delivered_events << " us average, "
+              << s_max_latency_us << " us max" << std::endl;
+
+    return 0;
+}
@@ -13,6 +13,8 @@
 #include <errno.h>
 #include <sys/eventfd.h>
 #include <unistd.h>
+#include <unordered_set>
+#include <vector>
 
 namespace bwl {
 
@@ -25,8 +27,10 @@ base_wlan_hal::base_wlan_hal(HALType type, std::string iface_name, IfaceType ifa
     m_radio_info.iface_name = iface_name;
     m_radio_info.iface_type = iface_type;
 
-    // Create an eventfd for internal events
-    if ((m_fd_int_events = eventfd(0, EFD_SEMAPHORE)) < 0) {
+    // Create an eventfd for internal events.
+    // Not in semaphore mode: reading the counter returns the number of queued events, so all of
+    // them are processed on a single wake-up.
+    if ((m_fd_int_events = eventfd(0, 0)) < 0) {
         LOG(FATAL) << "Failed creating eventfd: " << strerror(errno);
     }
 
@@ -64,30 +68,76 @@ bool base_wlan_hal::event_queue_push(int event, std::shared_ptr<void> data)
 
 bool base_wlan_hal::process_int_events()
 {
-    // Read the counter value of the eventfd
+    // Read (and reset) the counter value of the eventfd
     uint64_t counter = 0;
     if (read(m_fd_int_events, &counter, sizeof(counter)) < 0) {
         LOG(ERROR) << "Failed reading eventfd counter: " << strerror(errno);
         return false;
     }
 
-    // Pop an event from the queue
-    auto event = m_queue_events.pop(false);
+    // Every event is pushed into the queue before the counter is incremented, so there are at
+    // least "counter" events in the queue
+    std::vector<hal_event_ptr_t> events;
+    events.reserve(counter);
+    for (uint64_t i = 0; i < counter; i++) {
+        auto event = m_queue_events.pop(false);
+        if (!event) {
+            break;
+        }
+        events.push_back(event);
+    }
 
-    if (!event || !counter) {
-        LOG(WARNING) << "process_int_events() called by the event queue pointer is " << event
-                     << " and/or eventfd counter = " << counter;
+    if (events.empty()) {
+        LOG(WARNING) << "process_int_events() called but the event queue is empty, "
+                     << "eventfd counter = " << counter;
 
         return false;
     }
 
-    // Call the callback for handling the event
+    // Call the callback for handling the events
     if (!m_int_event_cb) {
         LOG(ERROR) << "Event callback not registered!";
         return false;
     }
 
-    return m_int_event_cb(event);
+    // Drop the connect events of stations which disconnected later in the same batch
+    std::unordered_set<sMacAddr> disconnected_stations;
+    std::vector<bool> superseded(events.size(), false);
+    size_t superseded_count = 0;
+    for (size_t i = events.size(); i-- > 0;) {
+        sMacAddr sta_mac;
+        bool connected;
+        if (!get_sta_connection_event(*events[i], sta_mac, connected)) {
+            continue;
+        }
+
+        if (!connected) {
+            disconnected_stations.insert(sta_mac);
+        } else if (disconnected_stations.find(sta_mac) != disconnected_stations.end()) {
+            superseded[i] = true;
+            superseded_count++;
+        }
+    }
+
+    if (superseded_count > 0) {
+        LOG(DEBUG) << "Dropping " << superseded_count << " superseded events out of "
+                   << events.size();
+    }
+
+    // The events are already out of the queue, so a failing event does not stop the batch
+    bool success = true;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (superseded[i]) {
+            continue;
+        }
+
+        if (!m_int_event_cb(events[i])) {
+            LOG(ERROR) << "Failed handling event " << events[i]->first;
+            success = false;
+        }
+    }
+
+    return success;
 }
 
 void base_wlan_hal::calc_curr_traffic(uint64_t val, uint64_t &total, uint32_t &curr)
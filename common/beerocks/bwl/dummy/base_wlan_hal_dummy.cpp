@@ -389,6 +389,8 @@ bool base_wlan_hal_dummy::refresh_vaps_info(int id) { return true; }
  *        string to the first line in the EVENT file.
  *        For example, simulating client connected event:
  *        echo "STA_CONNECTED,11:22:33:44:55:66"
+ *        A burst of events can be simulated by writing one event per line,
+ *        all of them are processed on the same wake-up.
  *
  * @return true on success
  * @return false on failure
@@ -425,35 +427,41 @@ bool base_wlan_hal_dummy::process_ext_events()
         return true;
     }
     std::string event;
-    std::getline(stream, event);
-    if (event.empty()) {
-        LOG(DEBUG) << "Received empty event, ignoring";
-        return true;
-    }
-    LOG(DEBUG) << "Received event " << event;
-
-    parsed_obj_map_t event_obj;
-    map_event_obj_parser(event, event_obj);
-    //base_wlan_hal_dummy::parsed_obj_debug(event_obj);
-
-    // Process the event
-    if (event_obj[DUMMY_EVENT_KEYLESS_PARAM_TYPE] == "EVENT") {
-        if (!process_dummy_event(event_obj)) {
-            LOG(ERROR) << "Failed processing DUMMY event: "
-                       << event_obj[DUMMY_EVENT_KEYLESS_PARAM_OPCODE];
-            return false;
+    int events_count = 0;
+    while (std::getline(stream, event)) {
+        if (event.empty()) {
+            continue;
         }
-    }
-    // Process data
-    else if (event_obj[DUMMY_EVENT_KEYLESS_PARAM_TYPE] == "DATA") {
-        if (!process_dummy_data(event_obj)) {
-            LOG(ERROR) << "Failed processing DUMMY data: "
-                       << event_obj[DUMMY_EVENT_KEYLESS_PARAM_OPCODE];
+        events_count++;
+        LOG(DEBUG) << "Received event " << event;
+
+        parsed_obj_map_t event_obj;
+        map_event_obj_parser(event, event_obj);
+        //base_wlan_hal_dummy::parsed_obj_debug(event_obj);
+
+        // Process the event
+        if (event_obj[DUMMY_EVENT_KEYLESS_PARAM_TYPE] == "EVENT") {
+            if (!process_dummy_event(event_obj)) {
+                LOG(ERROR) << "Failed processing DUMMY event: "
+                           << event_obj[DUMMY_EVENT_KEYLESS_PARAM_OPCODE];
+                return false;
+            }
+        }
+        // Process data
+        else if (event_obj[DUMMY_EVENT_KEYLESS_PARAM_TYPE] == "DATA") {
+            if (!process_dummy_data(event_obj)) {
+                LOG(ERROR) << "Failed processing DUMMY data: "
+                           << event_obj[DUMMY_EVENT_KEYLESS_PARAM_OPCODE];
+                return false;
+            }
+        } else {
+            LOG(ERROR) << "Unsupported type " << event_obj[DUMMY_EVENT_KEYLESS_PARAM_TYPE];
             return false;
         }
-    } else {
-        LOG(ERROR) << "Unsupported type " << event_obj[DUMMY_EVENT_KEYLESS_PARAM_TYPE];
-        return false;
+    }
+
+    if (events_count == 0) {
+        LOG(DEBUG) << "Received empty event, ignoring";
     }
 
     stream.close();
@@ -1008,50 +1008,56 @@ bool base_wlan_hal_dwpal::process_ext_events()
         return false;
     }
 
-    auto buffer         = m_wpa_ctrl_buffer;
-    auto buff_size_copy = m_wpa_ctrl_buffer_size;
+    // Drain the pending events, so a burst of events is handled on a single wake-up
+    for (int i = 0; i < MAX_EXT_EVENTS_PER_WAKEUP; i++) {
+        auto buffer         = m_wpa_ctrl_buffer;
+        auto buff_size_copy = m_wpa_ctrl_buffer_size;
 
-    // Check if there are pending event and get it
-    int status = dwpal_hostap_event_get(m_dwpal_ctx[0], buffer, &buff_size_copy, opCode);
+        // Check if there are pending event and get it
+        int status = dwpal_hostap_event_get(m_dwpal_ctx[0], buffer, &buff_size_copy, opCode);
 
-    if (status == DWPAL_FAILURE) {
-        LOG(ERROR) << "Failed reading event from DWPAL socket --> detaching!";
-        detach();
-        return false;
-    } else if (status == DWPAL_NO_PENDING_MESSAGES) {
-        // No pending messages
-        LOG(WARNING) << "base_wlan_hal_dwpal::process_ext_events() called but there are no pending "
-                        "messages...";
-        return false;
-    }
+        if (status == DWPAL_FAILURE) {
+            LOG(ERROR) << "Failed reading event from DWPAL socket --> detaching!";
+            detach();
+            return false;
+        } else if (status == DWPAL_NO_PENDING_MESSAGES) {
+            // No (more) pending messages
+            if (i > 0) {
+                break;
+            }
+            LOG(WARNING) << "base_wlan_hal_dwpal::process_ext_events() called but there are no "
+                            "pending messages...";
+            return false;
+        }
 
-    /* Silencing unhandled multiple events */
-    if (!strncmp(opCode, "WPS-ENROLLEE-SEEN", sizeof(opCode))) {
-        LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
-            << "DWPAL unhandled event opcode recieved: " << opCode;
-        return true;
-    } else if (!strncmp(opCode, "AP-PROBE-REQ-RECEIVED", sizeof(opCode))) {
-        LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
-            << "DWPAL unhandled event opcode recieved: " << opCode;
-        return true;
-    } else if (!strncmp(opCode, "BEACON-REQ-TX-STATUS", sizeof(opCode))) {
-        LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
-            << "DWPAL unhandled event opcode recieved: " << opCode;
-        return true;
-    } else if (!strncmp(opCode, "CTRL-EVENT-BSS-ADDED", sizeof(opCode))) {
-        LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
-            << "DWPAL unhandled event opcode recieved: " << opCode;
-        return true;
-    } else if (!strncmp(opCode, "CTRL-EVENT-BSS-REMOVED", sizeof(opCode))) {
-        LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
-            << "DWPAL unhandled event opcode recieved: " << opCode;
-        return true;
-    }
+        /* Silencing unhandled multiple events */
+        if (!strncmp(opCode, "WPS-ENROLLEE-SEEN", sizeof(opCode))) {
+            LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
+                << "DWPAL unhandled event opcode recieved: " << opCode;
+            continue;
+        } else if (!strncmp(opCode, "AP-PROBE-REQ-RECEIVED", sizeof(opCode))) {
+            LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
+                << "DWPAL unhandled event opcode recieved: " << opCode;
+            continue;
+        } else if (!strncmp(opCode, "BEACON-REQ-TX-STATUS", sizeof(opCode))) {
+            LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
+                << "DWPAL unhandled event opcode recieved: " << opCode;
+            continue;
+        } else if (!strncmp(opCode, "CTRL-EVENT-BSS-ADDED", sizeof(opCode))) {
+            LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
+                << "DWPAL unhandled event opcode recieved: " << opCode;
+            continue;
+        } else if (!strncmp(opCode, "CTRL-EVENT-BSS-REMOVED", sizeof(opCode))) {
+            LOG_EVERY_N(UNHANDLED_EVENTS_LOGS, DEBUG)
+                << "DWPAL unhandled event opcode recieved: " << opCode;
+            continue;
+        }
 
-    // Process the event with the DWPAL parser
-    if (!process_dwpal_event(buffer, buff_size_copy, std::string(opCode))) {
-        LOG(ERROR) << "Failed processing DWPAL event with DWPAL parser";
-        return false;
+        // Process the event with the DWPAL parser
+        if (!process_dwpal_event(buffer, buff_size_copy, std::string(opCode))) {
+            LOG(ERROR) << "Failed processing DWPAL event with DWPAL parser";
+            return false;
+        }
     }
 
     return true;
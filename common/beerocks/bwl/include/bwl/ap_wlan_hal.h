@@ -375,6 +375,33 @@ protected:
         //convert the hex string to binary
         return beerocks::string_utils::hex_to_char_string(sub_str);
     };
+
+    virtual bool get_sta_connection_event(const hal_event_t &event, sMacAddr &sta_mac,
+                                          bool &connected) const override
+    {
+        if (!event.second) {
+            return false;
+        }
+
+        switch (Event(event.first)) {
+        case Event::STA_Connected: {
+            auto msg = static_cast<sACTION_APMANAGER_CLIENT_ASSOCIATED_NOTIFICATION *>(
+                event.second.get());
+            sta_mac   = msg->params.mac;
+            connected = true;
+        } break;
+        case Event::STA_Disconnected: {
+            auto msg = static_cast<sACTION_APMANAGER_CLIENT_DISCONNECTED_NOTIFICATION *>(
+                event.second.get());
+            sta_mac   = msg->params.mac;
+            connected = false;
+        } break;
+        default:
+            return false;
+        }
+
+        return true;
+    }
 };
 
 // AP HAL factory types
@@ -106,7 +106,12 @@ public:
      * This method should be called if the file descriptor returned by
      * get_int_events_fd() generated an event.
      *
-     * @return true on success or false on error.
+     * All the events queued since the last call are processed as a single
+     * batch, in order, dropping the events superseded by a later event of
+     * the same batch (see get_sta_connection_event()). An event that fails
+     * to be handled does not prevent handling the rest of the batch.
+     *
+     * @return true on success or false if any event failed to be handled.
      */
     virtual bool process_int_events();
 
@@ -206,6 +211,23 @@ protected:
      */
     bool event_queue_push(int event, std::shared_ptr<void> data = {});
 
+    /*!
+     * Get the station a connect/disconnect event refers to.
+     * Used for dropping a station connect event followed by a disconnect
+     * event of the same station in the same batch of internal events.
+     *
+     * @param [in] event Internal event.
+     * @param [out] sta_mac MAC address of the station.
+     * @param [out] connected true for a connect event and false for a disconnect event.
+     *
+     * @return true if the event is a station connect/disconnect event or false otherwise.
+     */
+    virtual bool get_sta_connection_event(const hal_event_t &event, sMacAddr &sta_mac,
+                                          bool &connected) const
+    {
+        return false;
+    }
+
     /*!
      * set a parameter in the interface
      *
@@ -222,6 +244,12 @@ protected:
 
     // Protected data-members:
 protected:
+    /*!
+     * Maximal number of external events processed by a single call to
+     * process_ext_events(), so a flood of events does not starve the thread.
+     */
+    static constexpr int MAX_EXT_EVENTS_PER_WAKEUP = 64;
+
     RadioInfo m_radio_info;
 
     HALState m_hal_state = HALState::Uninitialized;
@@ -58,6 +58,35 @@ public:
                                       const std::vector<unsigned int> &channel_pool)     = 0;
     virtual bool channel_scan_dump_results()                                             = 0;
     virtual bool generate_connected_clients_events()                                     = 0;
+
+    // Protected methods:
+protected:
+    virtual bool get_sta_connection_event(const hal_event_t &event, sMacAddr &sta_mac,
+                                          bool &connected) const override
+    {
+        if (!event.second) {
+            return false;
+        }
+
+        switch (Event(event.first)) {
+        case Event::STA_Connected: {
+            auto msg =
+                static_cast<sACTION_MONITOR_CLIENT_ASSOCIATED_NOTIFICATION *>(event.second.get());
+            sta_mac   = msg->mac;
+            connected = true;
+        } break;
+        case Event::STA_Disconnected: {
+            auto msg =
+                static_cast<sACTION_MONITOR_CLIENT_DISCONNECTED_NOTIFICATION *>(event.second.get());
+            sta_mac   = msg->mac;
+            connected = false;
+        } break;
+        default:
+            return false;
+        }
+
+        return true;
+    }
 };
 
 // mon HAL factory types
@@ -817,42 +817,49 @@ bool base_wlan_hal_nl80211::process_ext_events()
         return false;
     }
 
-    // Check if there are pending events
-    int status = wpa_ctrl_pending(m_wpa_ctrl_event);
+    // Drain the pending events, so a burst of events is handled on a single wake-up
+    for (int i = 0; i < MAX_EXT_EVENTS_PER_WAKEUP; i++) {
 
-    // No pending messages
-    if (status == 0) {
-        LOG(WARNING) << "Process external events called but there are no pending messages...";
-        return false;
-    } else if (status < 0) {
-        LOG(ERROR) << "Invalid WPA Control socket status: " << status << " --> detaching!";
-        detach();
-        return false;
-    }
+        // Check if there are pending events
+        int status = wpa_ctrl_pending(m_wpa_ctrl_event);
 
-    auto buffer         = m_wpa_ctrl_buffer.get();
-    auto buff_size_copy = m_wpa_ctrl_buffer_size;
+        // No (more) pending messages
+        if (status == 0) {
+            if (i > 0) {
+                break;
+            }
+            LOG(WARNING) << "Process external events called but there are no pending messages...";
+            return false;
+        } else if (status < 0) {
+            LOG(ERROR) << "Invalid WPA Control socket status: " << status << " --> detaching!";
+            detach();
+            return false;
+        }
 
-    if (wpa_ctrl_recv(m_wpa_ctrl_event, buffer, &buff_size_copy) < 0) {
-        LOG(ERROR) << "wpa_ctrl_recv() failed!";
-        return false;
-    }
+        auto buffer         = m_wpa_ctrl_buffer.get();
+        auto buff_size_copy = m_wpa_ctrl_buffer_size;
+
+        if (wpa_ctrl_recv(m_wpa_ctrl_event, buffer, &buff_size_copy) < 0) {
+            LOG(ERROR) << "wpa_ctrl_recv() failed!";
+            return false;
+        }
 
-    // the wpa_ctrl does not put null termintaor at the and of the string
-    buffer[buff_size_copy] = 0;
+        // the wpa_ctrl does not put null termintaor at the and of the string
+        buffer[buff_size_copy] = 0;
 
-    LOG(DEBUG) << "event received:" << buffer;
+        LOG(DEBUG) << "event received:" << buffer;
 
-    parsed_obj_map_t event_obj;
-    map_event_obj_parser(buffer, event_obj);
+        parsed_obj_map_t event_obj;
+        map_event_obj_parser(buffer, event_obj);
 
-    // parsed_obj_debug(event_obj);
+        // parsed_obj_debug(event_obj);
 
-    // Process the event
-    if (!process_nl80211_event(event_obj)) {
-        // LOG(ERROR) << "Failed processing NL80211 event: " << event_obj[WAV_EVENT_KEYLESS_PARAM_OPCODE];
-        LOG(ERROR) << "Failed processing NL80211 event: " << event_obj["_opcode"];
-        return false;
+        // Process the event
+        if (!process_nl80211_event(event_obj)) {
+            // LOG(ERROR) << "Failed processing NL80211 event: " << event_obj[WAV_EVENT_KEYLESS_PARAM_OPCODE];
+            LOG(ERROR) << "Failed processing NL80211 event: " << event_obj["_opcode"];
+            return false;
+        }
     }
 
     return true;
@@ -96,7 +96,7 @@ mon_wlan_hal_nl80211::~mon_wlan_hal_nl80211() {}
 bool mon_wlan_hal_nl80211::update_radio_stats(SRadioStats &radio_stats)
 {
     beerocks::net::sInterfaceStats iface_stats;
-    if (!beerocks::net::network_utils::get_iface_stats(get_iface_name(), iface_stats)) {
+    if (!m_iface_stats_cache.get_stats(get_iface_name(), iface_stats)) {
         LOG(ERROR) << "Failed to get interface statistics for interface " << get_iface_name();
         return false;
     }
@@ -116,7 +116,7 @@ bool mon_wlan_hal_nl80211::update_radio_stats(SRadioStats &radio_stats)
 bool mon_wlan_hal_nl80211::update_vap_stats(const std::string &vap_iface_name, SVapStats &vap_stats)
 {
     beerocks::net::sInterfaceStats iface_stats;
-    if (!beerocks::net::network_utils::get_iface_stats(vap_iface_name, iface_stats)) {
+    if (!m_iface_stats_cache.get_stats(vap_iface_name, iface_stats)) {
         LOG(ERROR) << "Failed to get interface statistics for interface " << vap_iface_name;
         return false;
     }
@@ -12,6 +12,8 @@
 #include "base_wlan_hal_nl80211.h"
 #include <bwl/mon_wlan_hal.h>
 
+#include <bcl/network/interface_stats_cache.h>
+
 namespace bwl {
 namespace nl80211 {
 
@@ -57,6 +59,9 @@ protected:
     // Private data-members:
 private:
     std::shared_ptr<char> m_temp_wav_value;
+
+    // Statistics of the radio and all its VAPs, read with a single Netlink dump per poll
+    beerocks::net::InterfaceStatsCache m_iface_stats_cache;
 };
 
 } // namespace nl80211
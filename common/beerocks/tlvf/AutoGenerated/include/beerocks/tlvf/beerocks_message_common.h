@@ -709,9 +709,7 @@ typedef struct sStatisticsResponse11k {
     void struct_swap(){
         tlvf_swap(16, reinterpret_cast<uint8_t*>(&statistics_group_data_size));
         tlvf_swap(16, reinterpret_cast<uint8_t*>(&duration));
-        for (size_t i = 0; i < 13; i++){
-            tlvf_swap(32, reinterpret_cast<uint8_t*>(&(statistics_group_data[i])));
-        }
+        tlvf_swap_array(32, statistics_group_data, 13);
         sta_mac.struct_swap();
     }
     void struct_init(){
@@ -1320,12 +1318,8 @@ typedef struct sChannelScanResults {
         tlvf_swap(32, reinterpret_cast<uint8_t*>(&signal_strength_dBm));
         tlvf_swap(32, reinterpret_cast<uint8_t*>(&beacon_period_ms));
         tlvf_swap(32, reinterpret_cast<uint8_t*>(&noise_dBm));
-        for (size_t i = 0; i < beerocks::message::CHANNEL_SCAN_LIST_LENGTH; i++){
-            tlvf_swap(32, reinterpret_cast<uint8_t*>(&(basic_data_transfer_rates_kbps[i])));
-        }
-        for (size_t i = 0; i < beerocks::message::CHANNEL_SCAN_LIST_LENGTH; i++){
-            tlvf_swap(32, reinterpret_cast<uint8_t*>(&(supported_data_transfer_rates_kbps[i])));
-        }
+        tlvf_swap_array(32, basic_data_transfer_rates_kbps, beerocks::message::CHANNEL_SCAN_LIST_LENGTH);
+        tlvf_swap_array(32, supported_data_transfer_rates_kbps, beerocks::message::CHANNEL_SCAN_LIST_LENGTH);
         tlvf_swap(32, reinterpret_cast<uint8_t*>(&dtim_period));
         tlvf_swap(32, reinterpret_cast<uint8_t*>(&channel_utilization));
     }
@@ -59,7 +59,7 @@ bool cACTION_APMANAGER_UP_NOTIFICATION::alloc_iface_name(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -67,7 +67,7 @@ bool cACTION_APMANAGER_UP_NOTIFICATION::alloc_iface_name(size_t count) {
     uint8_t *src = (uint8_t *)&m_iface_name[*m_iface_name_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_iface_name_idx__ += count;
@@ -246,7 +246,7 @@ bool cACTION_APMANAGER_JOINED_NOTIFICATION::alloc_preferred_channels(size_t coun
         return false;
     }
     size_t len = sizeof(beerocks::message::sWifiChannel) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -254,7 +254,7 @@ bool cACTION_APMANAGER_JOINED_NOTIFICATION::alloc_preferred_channels(size_t coun
     uint8_t *src = (uint8_t *)&m_preferred_channels[*m_preferred_channels_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_supported_channels_size = (uint8_t *)((uint8_t *)(m_supported_channels_size) + len);
@@ -290,7 +290,7 @@ bool cACTION_APMANAGER_JOINED_NOTIFICATION::alloc_supported_channels(size_t coun
         return false;
     }
     size_t len = sizeof(beerocks::message::sWifiChannel) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -298,7 +298,7 @@ bool cACTION_APMANAGER_JOINED_NOTIFICATION::alloc_supported_channels(size_t coun
     uint8_t *src = (uint8_t *)&m_supported_channels[*m_supported_channels_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_supported_channels_idx__ += count;
@@ -1373,7 +1373,7 @@ bool cACTION_APMANAGER_HOSTAP_ACS_NOTIFICATION::alloc_preferred_channels(size_t
         return false;
     }
     size_t len = sizeof(beerocks::message::sWifiChannel) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -1381,7 +1381,7 @@ bool cACTION_APMANAGER_HOSTAP_ACS_NOTIFICATION::alloc_preferred_channels(size_t
     uint8_t *src = (uint8_t *)&m_preferred_channels[*m_preferred_channels_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_preferred_channels_idx__ += count;
@@ -1938,15 +1938,15 @@ bool cACTION_APMANAGER_CLIENT_ASSOCIATED_NOTIFICATION::alloc_association_frame(s
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_association_frame;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_association_frame_idx__ += count;
@@ -3193,7 +3193,7 @@ std::shared_ptr<WSC::cConfigData> cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_REQU
         return nullptr;
     }
     size_t len = WSC::cConfigData::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -3205,10 +3205,14 @@ std::shared_ptr<WSC::cConfigData> cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_REQU
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<WSC::cConfigData>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<WSC::cConfigData>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_REQUEST::add_wifi_credentials(std::shared_ptr<WSC::cConfigData> ptr) {
@@ -3521,7 +3525,7 @@ bool cACTION_APMANAGER_READ_ACS_REPORT_RESPONSE::alloc_preferred_channels(size_t
         return false;
     }
     size_t len = sizeof(beerocks::message::sWifiChannel) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -3529,7 +3533,7 @@ bool cACTION_APMANAGER_READ_ACS_REPORT_RESPONSE::alloc_preferred_channels(size_t
     uint8_t *src = (uint8_t *)&m_preferred_channels[*m_preferred_channels_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_preferred_channels_idx__ += count;
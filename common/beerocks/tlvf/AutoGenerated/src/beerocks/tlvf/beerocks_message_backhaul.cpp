@@ -546,7 +546,7 @@ bool cACTION_BACKHAUL_ENABLE::alloc_preferred_channels(size_t count) {
         return false;
     }
     size_t len = sizeof(beerocks::message::sWifiChannel) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -554,7 +554,7 @@ bool cACTION_BACKHAUL_ENABLE::alloc_preferred_channels(size_t count) {
     uint8_t *src = (uint8_t *)&m_preferred_channels[*m_preferred_channels_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_preferred_channels_idx__ += count;
@@ -1722,7 +1722,7 @@ bool cACTION_BACKHAUL_ASSOCIATED_STA_LINK_METRICS_RESPONSE::alloc_bssid_info_lis
         return false;
     }
     size_t len = sizeof(sBssidInfo) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -1730,7 +1730,7 @@ bool cACTION_BACKHAUL_ASSOCIATED_STA_LINK_METRICS_RESPONSE::alloc_bssid_info_lis
     uint8_t *src = (uint8_t *)&m_bssid_info_list[*m_bssid_info_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_info_list_idx__ += count;
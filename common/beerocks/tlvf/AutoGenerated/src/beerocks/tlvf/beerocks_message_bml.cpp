@@ -237,7 +237,7 @@ bool cACTION_BML_NW_MAP_RESPONSE::alloc_buffer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -245,7 +245,7 @@ bool cACTION_BML_NW_MAP_RESPONSE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -376,7 +376,7 @@ bool cACTION_BML_NW_MAP_UPDATE::alloc_buffer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -384,7 +384,7 @@ bool cACTION_BML_NW_MAP_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -515,7 +515,7 @@ bool cACTION_BML_STATS_UPDATE::alloc_buffer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -523,7 +523,7 @@ bool cACTION_BML_STATS_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -650,7 +650,7 @@ bool cACTION_BML_EVENTS_UPDATE::alloc_buffer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -658,7 +658,7 @@ bool cACTION_BML_EVENTS_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -3638,7 +3638,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_ssid(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -3646,7 +3646,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_network_key_size = (uint8_t *)((uint8_t *)(m_network_key_size) + len);
@@ -3696,7 +3696,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_network_key(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -3704,7 +3704,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_network_key(size_t count) {
     uint8_t *src = (uint8_t *)&m_network_key[*m_network_key_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_operating_classes_size = (uint8_t *)((uint8_t *)(m_operating_classes_size) + len);
@@ -3745,7 +3745,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_operating_classes(size_t co
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -3753,7 +3753,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_operating_classes(size_t co
     uint8_t *src = (uint8_t *)&m_operating_classes[*m_operating_classes_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_operating_classes_idx__ += count;
@@ -4522,7 +4522,7 @@ bool cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::alloc_vap_list(size_t count)
         return false;
     }
     size_t len = sizeof(sConfigVapInfo) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -4530,7 +4530,7 @@ bool cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::alloc_vap_list(size_t count)
     uint8_t *src = (uint8_t *)&m_vap_list[*m_vap_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_vap_list_idx__ += count;
@@ -4719,7 +4719,7 @@ bool cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::alloc_vap_list(size_t count)
         return false;
     }
     size_t len = sizeof(sConfigVapInfo) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -4727,7 +4727,7 @@ bool cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::alloc_vap_list(size_t count)
     uint8_t *src = (uint8_t *)&m_vap_list[*m_vap_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_vap_list_idx__ += count;
@@ -5766,7 +5766,7 @@ bool cACTION_BML_STEERING_EVENTS_UPDATE::alloc_buffer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -5774,7 +5774,7 @@ bool cACTION_BML_STEERING_EVENTS_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -7034,7 +7034,7 @@ bool cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::alloc_results(size_t count)
         return false;
     }
     size_t len = sizeof(sChannelScanResults) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -7042,7 +7042,7 @@ bool cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::alloc_results(size_t count)
     uint8_t *src = (uint8_t *)&m_results[*m_results_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_results_idx__ += count;
@@ -7625,7 +7625,7 @@ bool cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::alloc_client_list(size_t count
         return false;
     }
     size_t len = sizeof(sMacAddr) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -7633,7 +7633,7 @@ bool cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::alloc_client_list(size_t count
     uint8_t *src = (uint8_t *)&m_client_list[*m_client_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_client_list_idx__ += count;
@@ -410,7 +410,7 @@ bool cACTION_CLI_RESPONSE_STR::alloc_buffer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -418,7 +418,7 @@ bool cACTION_CLI_RESPONSE_STR::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
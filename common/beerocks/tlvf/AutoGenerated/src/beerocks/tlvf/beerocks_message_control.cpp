@@ -1160,7 +1160,7 @@ bool cACTION_CONTROL_HOSTAP_ACS_NOTIFICATION::alloc_preferred_channels(size_t co
         return false;
     }
     size_t len = sizeof(beerocks::message::sWifiChannel) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -1168,7 +1168,7 @@ bool cACTION_CONTROL_HOSTAP_ACS_NOTIFICATION::alloc_preferred_channels(size_t co
     uint8_t *src = (uint8_t *)&m_preferred_channels[*m_preferred_channels_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_preferred_channels_idx__ += count;
@@ -1828,7 +1828,7 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_ap_stats(size_t co
         return false;
     }
     size_t len = sizeof(sApStatsParams) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -1836,7 +1836,7 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_ap_stats(size_t co
     uint8_t *src = (uint8_t *)&m_ap_stats[*m_ap_stats_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_sta_stats_size = (uint8_t *)((uint8_t *)(m_sta_stats_size) + len);
@@ -1872,7 +1872,7 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_sta_stats(size_t c
         return false;
     }
     size_t len = sizeof(sStaStatsParams) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -1880,7 +1880,7 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_sta_stats(size_t c
     uint8_t *src = (uint8_t *)&m_sta_stats[*m_sta_stats_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_sta_stats_idx__ += count;
@@ -18,6 +18,7 @@
 #include <bcl/network/socket.h>
 
 #include <type_traits>
+#include <vector>
 
 #define GET_MESSAGE_POINTER(MSG, TX_B, SIZE_VAR)                                                   \
     (MSG *)(TX_B + SIZE_VAR);                                                                      \
@@ -163,8 +164,21 @@ public:
     static bool send_cmdu(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
                           const std::string &dst_mac = std::string(),
                           const std::string &src_mac = std::string());
+    /**
+     * @brief Sends a CMDU over a unix domain socket together with file descriptors.
+     *
+     * The receiver gets the file descriptors with Socket::takeReceivedFds() while handling
+     * the CMDU.
+     */
+    static bool send_cmdu_with_fds(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
+                                   const std::vector<int> &fds);
     static bool forward_cmdu_to_uds(Socket *sd, ieee1905_1::CmduMessageRx &cmdu_rx,
                                     uint16_t length);
+
+private:
+    static message::sUdsHeader *finalize_cmdu(ieee1905_1::CmduMessageTx &cmdu_tx,
+                                              const std::string &dst_mac,
+                                              const std::string &src_mac);
 };
 
 } // namespace beerocks
@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_BEEROCKS_STATS_RECORD_H_
+#define _TLVF_BEEROCKS_STATS_RECORD_H_
+
+#include <beerocks/tlvf/beerocks_message_common.h>
+
+namespace beerocks {
+
+/**
+ * @brief Record of the statistics ring between the monitor and the slave.
+ *
+ * A statistics report, which replaces a cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE, is
+ * one STATS_RECORD_AP record followed by a STATS_RECORD_STA record per station, the last record
+ * of the report being flagged. The parameters are kept in native byte order, they are swapped
+ * only when the slave builds the CMDU to the controller.
+ */
+struct sStatsRecord {
+    enum eType : uint8_t {
+        STATS_RECORD_AP  = 1,
+        STATS_RECORD_STA = 2,
+    };
+
+    eType type;
+    uint8_t last;
+    uint16_t message_id;
+    union {
+        beerocks_message::sApStatsParams ap_stats;
+        beerocks_message::sStaStatsParams sta_stats;
+    };
+};
+
+/**
+ * Number of records of the statistics ring, enough for the report of a radio with the maximum
+ * number of associated stations.
+ */
+static constexpr size_t STATS_RING_CAPACITY = 512;
+
+} // namespace beerocks
+
+#endif // _TLVF_BEEROCKS_STATS_RECORD_H_
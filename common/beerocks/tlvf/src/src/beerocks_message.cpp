@@ -136,14 +136,15 @@ std::string message_com::print_cmdu_types(ieee1905_1::CmduMessageRx &cmdu_rx, sC
     return info;
 }
 
-bool message_com::send_cmdu(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
-                            const std::string &dst_mac, const std::string &src_mac)
+message::sUdsHeader *message_com::finalize_cmdu(ieee1905_1::CmduMessageTx &cmdu_tx,
+                                                const std::string &dst_mac,
+                                                const std::string &src_mac)
 {
     auto uds_header = get_uds_header(cmdu_tx);
 
     if (!uds_header) {
         LOG(ERROR) << "uds_header=nullptr";
-        return false;
+        return nullptr;
     }
 
     if (!cmdu_tx.finalize()) {
@@ -152,14 +153,14 @@ bool message_com::send_cmdu(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
                    << utils::dump_buffer(
                           (uint8_t *)(cmdu_tx.getMessageBuff() - sizeof(message::sUdsHeader)),
                           cmdu_tx.getMessageLength() + sizeof(message::sUdsHeader));
-        return false;
+        return nullptr;
     }
 
     // update src & dst bridge mac on uds_header
     if (!dst_mac.empty()) {
         if (src_mac.empty()) {
             LOG(ERROR) << "src_mac is empty!";
-            return false;
+            return nullptr;
         }
 
         tlvf::mac_from_string(uds_header->src_bridge_mac, src_mac);
@@ -171,10 +172,46 @@ bool message_com::send_cmdu(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
 
     uds_header->length = cmdu_tx.getMessageLength();
 
+    return uds_header;
+}
+
+bool message_com::send_cmdu(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
+                            const std::string &dst_mac, const std::string &src_mac)
+{
+    auto uds_header = finalize_cmdu(cmdu_tx, dst_mac, src_mac);
+    if (!uds_header) {
+        return false;
+    }
+
     return send_data(sd, cmdu_tx.getMessageBuff() - sizeof(message::sUdsHeader),
                      uds_header->length + sizeof(message::sUdsHeader));
 }
 
+bool message_com::send_cmdu_with_fds(Socket *sd, ieee1905_1::CmduMessageTx &cmdu_tx,
+                                     const std::vector<int> &fds)
+{
+    if (sd == nullptr) {
+        LOG(ERROR) << "sd is nullptr";
+        return false;
+    }
+
+    auto uds_header = finalize_cmdu(cmdu_tx, std::string(), std::string());
+    if (!uds_header) {
+        return false;
+    }
+
+    size_t size = uds_header->length + sizeof(message::sUdsHeader);
+    ssize_t written_size =
+        sd->writeBytesWithFds(cmdu_tx.getMessageBuff() - sizeof(message::sUdsHeader), size, fds);
+    if (written_size != ssize_t(size)) {
+        LOG(ERROR) << "writeBytesWithFds() failed, written " << written_size << " out of " << size
+                   << " bytes, error=" << strerror(errno);
+        return false;
+    }
+
+    return true;
+}
+
 bool message_com::forward_cmdu_to_uds(Socket *sd, ieee1905_1::CmduMessageRx &cmdu_rx,
                                       uint16_t length)
 {
@@ -13,7 +13,7 @@
 
 #include <bcl/beerocks_message_structs.h>
 #include <bcl/beerocks_utils.h>
-#include <easylogging++.h>
+#include <lazy_log.h>
 
 #include <beerocks/tlvf/beerocks_message_bml.h>
 
@@ -60,6 +60,7 @@ static void config_logger(const std::string log_file = std::string())
         defaultConf.setGlobally(el::ConfigurationType::ToStandardOutput, "false");
     }
     el::Loggers::reconfigureAllLoggers(defaultConf);
+    lazy_log::reconfigured();
 }
 
 #endif // BEEROCKS_DEBUG
@@ -8,6 +8,7 @@
 
 #include "beerocks_cli_socket.h"
 
+#include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_string_utils.h>
 #include <bcl/beerocks_utils.h>
 #include <bcl/son/son_wireless_utils.h>
@@ -173,6 +174,10 @@ void cli_socket::setFunctionsMapAndArray()
                        "remove 'bssid' from  11k neighbor list of 'hostap_mac' 'vap_id'",
                        static_cast<pFunction>(&cli_socket::rm_neighbor_11k_caller), 3, 3,
                        STRING_ARG, STRING_ARG);
+    insertCommandToMap("metrics", "[<process_name>]",
+                       "print the metrics of 'process_name' (e.g. beerocks_agent, "
+                       "ieee1905_transport), by default of the controller",
+                       static_cast<pFunction>(&cli_socket::metrics_caller), 0, 1, STRING_ARG);
 }
 
 bool cli_socket::waitResponseReady()
@@ -436,6 +441,14 @@ int cli_socket::rm_neighbor_11k_caller(int numOfArgs)
     return -1;
 }
 
+int cli_socket::metrics_caller(int numOfArgs)
+{
+    if (numOfArgs == 1) {
+        return metrics(args.stringArgs[0]);
+    }
+    return metrics();
+}
+
 //
 // Functions
 //
@@ -763,4 +776,23 @@ int cli_socket::rm_neighbor_11k(std::string ap_mac, std::string bssid, int8_t va
     return 0;
 }
 
+int cli_socket::metrics(std::string process_name)
+{
+    SocketClient metrics_socket(temp_path + BEEROCKS_METRICS_UDS + process_name);
+    if (!metrics_socket.getError().empty()) {
+        std::cout << "failed to connect to the metrics of " << process_name << ": "
+                  << metrics_socket.getError() << std::endl;
+        return -1;
+    }
+
+    // The process writes its metrics, then closes the connection
+    uint8_t buffer[1024];
+    ssize_t length;
+    while ((length = metrics_socket.readBytes(buffer, sizeof(buffer), true, sizeof(buffer))) > 0) {
+        std::cout.write(reinterpret_cast<char *>(buffer), length);
+    }
+    std::cout << std::flush;
+    return 0;
+}
+
 } // namespace beerocks
@@ -79,6 +79,8 @@ private:
 
     int client_beacon_11k_req_caller(int numOfArgs);
 
+    int metrics_caller(int numOfArgs);
+
     // Functions
 
     int enable_debug(int8_t isEnable = -1);
@@ -122,6 +124,8 @@ private:
                               std::string ssid, uint16_t duration, uint16_t rand_ival,
                               uint16_t repeats, int16_t op_class, std::string mode);
 
+    int metrics(std::string process_name = BEEROCKS_CONTROLLER);
+
     // Variables
     std::string temp_path;
     SocketClient *master_socket = nullptr;
@@ -8,6 +8,7 @@
 
 #include <bcl/beerocks_config_file.h>
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_metrics.h>
 #include <bcl/beerocks_version.h>
 #include <bcl/network/network_utils.h>
 #include <bpl/bpl_cfg.h>
@@ -327,6 +328,10 @@ int main(int argc, char *argv[])
     std::string pid_file_path =
         beerocks_master_conf.temp_path + "pid/" + base_master_name; // for file touching
 
+    // Failing to export the metrics is not fatal
+    beerocks::metrics::start_export(beerocks_master_conf.temp_path + BEEROCKS_METRICS_UDS +
+                                    base_master_name);
+
     // fill master configuration
     son::db::sDbMasterConfig master_conf;
     fill_master_config(master_conf, beerocks_master_conf);
@@ -371,6 +376,7 @@ int main(int argc, char *argv[])
     s_pLogger = nullptr;
 
     son_master.stop();
+    beerocks::metrics::stop_export();
 
     return 0;
 }
@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/*
+ * Synthetic benchmark of the channel ranking engine.
+ *
+ * Ranks the channels of a 2.4GHz and a 5GHz radio against a scan of 200 neighbor BSSs spread
+ * over both bands, and prints the time per ranking and the best candidates.
+ *
+ * Usage: channel_ranking_benchmark [iterations]
+ */
+
+#include "../db/channel_ranking.h"
+
+#include <bcl/beerocks_utils.h>
+#include <bcl/son/son_wireless_utils.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+using namespace son;
+
+static const int NEIGHBORS_COUNT    = 200;
+static const int DEFAULT_ITERATIONS = 10000;
+
+static const uint8_t channels_24g[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+static const uint8_t channels_5g[]  = {36,  40,  44,  48,  52,  56,  60,  64,  100,
+                                      104, 108, 112, 116, 120, 124, 128, 132, 136,
+                                      140, 144, 149, 153, 157, 161, 165};
+
+static void add_supported_channel(std::vector<beerocks::message::sWifiChannel> &channels,
+                                  uint8_t channel, beerocks::eWiFiBandwidth bandwidth)
+{
+    beerocks::message::sWifiChannel supported_channel;
+    supported_channel.channel           = channel;
+    supported_channel.channel_bandwidth = bandwidth;
+    supported_channel.is_dfs_channel    = wireless_utils::is_dfs_channel(channel);
+    supported_channel.noise             = -92;
+    channels.push_back(supported_channel);
+}
+
+static std::vector<beerocks::message::sWifiChannel> make_supported_channels_24g()
+{
+    std::vector<beerocks::message::sWifiChannel> channels;
+    for (auto channel : channels_24g) {
+        add_supported_channel(channels, channel, beerocks::BANDWIDTH_20);
+        add_supported_channel(channels, channel, beerocks::BANDWIDTH_40);
+    }
+    return channels;
+}
+
+static std::vector<beerocks::message::sWifiChannel> make_supported_channels_5g()
+{
+    std::vector<beerocks::message::sWifiChannel> channels;
+    for (auto channel : channels_5g) {
+        add_supported_channel(channels, channel, beerocks::BANDWIDTH_20);
+        if (channel == 165) {
+            continue;
+        }
+        add_supported_channel(channels, channel, beerocks::BANDWIDTH_40);
+        add_supported_channel(channels, channel, beerocks::BANDWIDTH_80);
+        if (channel < 149) {
+            add_supported_channel(channels, channel, beerocks::BANDWIDTH_160);
+        }
+    }
+    // Mark one DFS channel as radar affected
+    for (auto &channel : channels) {
+        if (channel.channel == 120 && channel.channel_bandwidth == beerocks::BANDWIDTH_20) {
+            channel.radar_affected = 1;
+        }
+    }
+    return channels;
+}
+
+static void make_scan_results(channel_scan_result_ring &scan_results)
+{
+    std::mt19937 generator(1905);
+    std::uniform_int_distribution<int> rssi(-90, -35);
+    std::uniform_int_distribution<int> utilization(0, 255);
+    std::uniform_int_distribution<size_t> pick_24g(0, sizeof(channels_24g) - 1);
+    std::uniform_int_distribution<size_t> pick_5g(0, sizeof(channels_5g) - 1);
+    std::uniform_int_distribution<int> pick_bandwidth(0, 3);
+
+    scan_results.start_generation();
+    for (int i = 0; i < NEIGHBORS_COUNT; i++) {
+        beerocks_message::sChannelScanResults result = {};
+        result.bssid.oct[0] = 0x02;
+        result.bssid.oct[4] = uint8_t(i >> 8);
+        result.bssid.oct[5] = uint8_t(i);
+
+        // Dense deployments are dominated by 2.4GHz neighbors
+        if (i % 5 < 3) {
+            result.channel = channels_24g[pick_24g(generator)];
+            result.operating_channel_bandwidth =
+                (i % 4) ? beerocks_message::eChannelScanResultChannelBandwidth::
+                              eChannel_Bandwidth_20MHz
+                        : beerocks_message::eChannelScanResultChannelBandwidth::
+                              eChannel_Bandwidth_40MHz;
+        } else {
+            result.channel = channels_5g[pick_5g(generator)];
+            result.operating_channel_bandwidth =
+                beerocks_message::eChannelScanResultChannelBandwidth(pick_bandwidth(generator) + 1);
+        }
+        result.signal_strength_dBm = rssi(generator);
+        result.channel_utilization = utilization(generator);
+        scan_results.add(result);
+    }
+}
+
+static void run(const std::string &name,
+                const std::vector<beerocks::message::sWifiChannel> &supported_channels,
+                const channel_scan_result_ring &scan_results, int iterations)
+{
+    channel_ranking::sParams params;
+    std::vector<channel_ranking::sChannelRank> ranking;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        ranking = channel_ranking::rank(supported_channels, scan_results, params);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    std::cout << name << ": " << supported_channels.size() << " candidates, "
+              << scan_results.size() << " neighbors, " << (elapsed_ns / iterations) / 1000.0
+              << " us per ranking" << std::endl;
+
+    for (size_t i = 0; i < ranking.size() && i < 5; i++) {
+        std::cout << "    #" << i + 1 << " channel " << int(ranking[i].channel) << " bw "
+                  << beerocks::utils::convert_bandwidth_to_int(ranking[i].bandwidth)
+                  << "MHz interference " << ranking[i].interference_dbm << " dBm"
+                  << (ranking[i].is_dfs ? " (DFS)" : "") << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = DEFAULT_ITERATIONS;
+    if (argc > 1) {
+        iterations = std::atoi(argv[1]);
+    }
+    if (iterations <= 0) {
+        std::cerr << "invalid iterations count" << std::endl;
+        return 1;
+    }
+
+    channel_scan_result_ring scan_results;
+    make_scan_results(scan_results);
+
+    run("2.4GHz radio", make_supported_channels_24g(), scan_results, iterations);
+    run("5GHz radio", make_supported_channels_5g(), scan_results, iterations);
+
+    return 0;
+}
@@ -0,0 +1,602 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/*
+ * Load benchmark of a running controller with simulated agents.
+ *
+ * Connects to the broker of the local ieee1905 transport and plays the given number of agents
+ * against the beerocks_controller of the same host, without any radio. Each agent first sends an
+ * AP Autoconfiguration Search with the prplMesh handshake, so the controller adds it to its
+ * database, then in turn:
+ * - a Topology Notification with a Client Association Event: a new client joins until the agent
+ *   has the given number of clients, then its clients leave and join again one after the other,
+ * - an AP Metrics Response,
+ * - an Operating Channel Report,
+ * - a Topology Response with the Device Information of the agent.
+ * The CMDUs are built with tlvf and sent at the given rate, round robin over the agents.
+ *
+ * The controller must export its metrics (see metrics::start_export()). Every few seconds, and for
+ * the whole run, prints the CMDUs handled per second by the controller and the percentiles of its
+ * handling time per message type, read from its master_cmdu_handling_usec histograms, along with
+ * its number of scheduled tasks and its resident memory.
+ *
+ * The transport de-duplicates at most 1024 CMDUs per second, CMDUs sent above that rate are
+ * dropped before reaching the controller.
+ *
+ * Usage: controller_load_benchmark <bridge iface> [agents] [clients per agent] [duration sec]
+ *                                  [CMDUs per sec]
+ */
+
+#include <bcl/beerocks_defines.h>
+#include <bcl/beerocks_metrics.h>
+#include <bcl/beerocks_os_utils.h>
+#include <bcl/network/network_utils.h>
+#include <bcl/network/socket.h>
+#include <beerocks/tlvf/beerocks_message.h>
+#include <beerocks/tlvf/beerocks_message_control.h>
+#include <mapf/common/config.h>
+#include <mapf/transport/ieee1905_transport_messages.h>
+#include <tlvf/CmduMessageTx.h>
+#include <tlvf/ieee_1905_1/eMediaType.h>
+#include <tlvf/ieee_1905_1/s802_11SpecificInformation.h>
+#include <tlvf/ieee_1905_1/tlvAlMacAddress.h>
+#include <tlvf/ieee_1905_1/tlvAutoconfigFreqBand.h>
+#include <tlvf/ieee_1905_1/tlvDeviceInformation.h>
+#include <tlvf/ieee_1905_1/tlvSearchedRole.h>
+#include <tlvf/wfa_map/tlvApMetrics.h>
+#include <tlvf/wfa_map/tlvClientAssociationEvent.h>
+#include <tlvf/wfa_map/tlvOperatingChannelReport.h>
+#include <tlvf/wfa_map/tlvSearchedService.h>
+#include <tlvf/wfa_map/tlvSupportedService.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+INITIALIZE_EASYLOGGINGPP
+
+using namespace beerocks;
+
+static const int DEFAULT_AGENTS            = 32;
+static const int DEFAULT_CLIENTS_PER_AGENT = 64;
+static const int DEFAULT_DURATION_SEC      = 60;
+static const int DEFAULT_RATE              = 500;
+static const int REPORT_INTERVAL_SEC       = 5;
+
+static const std::string HANDLING_TIME_METRIC = "master_cmdu_handling_usec";
+static const std::string TASKS_METRIC         = "master_tasks";
+
+struct sAgent {
+    sMacAddr al_mac;
+    // The single radio of the agent, also the BSSID of its single BSS
+    sMacAddr radio_mac;
+    // Clients which joined so far
+    int clients = 0;
+    // Once all the clients joined, the client which leaves or joins next
+    int churn_client = 0;
+    bool churn_left  = false;
+    // Next message of the agent
+    int step = 0;
+};
+
+/**
+ * @brief Cumulative buckets and sum of a histogram, as exported by metrics::dump().
+ */
+struct sHistogram {
+    uint64_t buckets[metrics::HISTOGRAM_BUCKETS] = {};
+    uint64_t sum                                 = 0;
+
+    uint64_t count() const { return buckets[metrics::HISTOGRAM_BUCKETS - 1]; }
+};
+
+struct sControllerState {
+    // Histograms of the handling time by message type
+    std::map<std::string, sHistogram> handling_time;
+    int64_t tasks = 0;
+    // Resident memory of the controller in KiB, 0 if unknown
+    int64_t rss_kb = 0;
+};
+
+static sMacAddr make_mac(uint8_t kind, int agent, int index = 0)
+{
+    return {{0x02, 0x4c, kind, uint8_t(agent), uint8_t(index >> 8), uint8_t(index)}};
+}
+
+static bool build_autoconfig_search(ieee1905_1::CmduMessageTx &cmdu_tx, const sAgent &agent)
+{
+    if (!cmdu_tx.create(0, ieee1905_1::eMessageType::AP_AUTOCONFIGURATION_SEARCH_MESSAGE)) {
+        return false;
+    }
+
+    auto tlvAlMacAddress = cmdu_tx.addClass<ieee1905_1::tlvAlMacAddress>();
+    if (!tlvAlMacAddress) {
+        return false;
+    }
+    tlvAlMacAddress->mac() = agent.al_mac;
+
+    auto tlvSearchedRole = cmdu_tx.addClass<ieee1905_1::tlvSearchedRole>();
+    if (!tlvSearchedRole) {
+        return false;
+    }
+    tlvSearchedRole->value() = ieee1905_1::tlvSearchedRole::REGISTRAR;
+
+    auto tlvAutoconfigFreqBand = cmdu_tx.addClass<ieee1905_1::tlvAutoconfigFreqBand>();
+    if (!tlvAutoconfigFreqBand) {
+        return false;
+    }
+    tlvAutoconfigFreqBand->value() = ieee1905_1::tlvAutoconfigFreqBand::IEEE_802_11_5_GHZ;
+
+    auto tlvSupportedService = cmdu_tx.addClass<wfa_map::tlvSupportedService>();
+    if (!tlvSupportedService || !tlvSupportedService->alloc_supported_service_list()) {
+        return false;
+    }
+    auto supportedServiceTuple = tlvSupportedService->supported_service_list(0);
+    if (!std::get<0>(supportedServiceTuple)) {
+        return false;
+    }
+    std::get<1>(supportedServiceTuple) =
+        wfa_map::tlvSupportedService::eSupportedService::MULTI_AP_AGENT;
+
+    auto tlvSearchedService = cmdu_tx.addClass<wfa_map::tlvSearchedService>();
+    if (!tlvSearchedService || !tlvSearchedService->alloc_searched_service_list()) {
+        return false;
+    }
+    auto searchedServiceTuple = tlvSearchedService->searched_service_list(0);
+    if (!std::get<0>(searchedServiceTuple)) {
+        return false;
+    }
+    std::get<1>(searchedServiceTuple) =
+        wfa_map::tlvSearchedService::eSearchedService::MULTI_AP_CONTROLLER;
+
+    // The handshake makes the controller consider the agent as prplMesh, which it requires to
+    // handle the client association events
+    auto request =
+        message_com::add_vs_tlv<beerocks_message::cACTION_CONTROL_SLAVE_HANDSHAKE_REQUEST>(cmdu_tx);
+    if (!request) {
+        return false;
+    }
+    message_com::get_beerocks_header(cmdu_tx)->actionhdr()->direction() =
+        BEEROCKS_DIRECTION_CONTROLLER;
+
+    return true;
+}
+
+static bool build_topology_notification(ieee1905_1::CmduMessageTx &cmdu_tx, sAgent &agent,
+                                        int agent_index, int clients_per_agent)
+{
+    if (!cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_NOTIFICATION_MESSAGE)) {
+        return false;
+    }
+
+    auto tlvAlMacAddress = cmdu_tx.addClass<ieee1905_1::tlvAlMacAddress>();
+    if (!tlvAlMacAddress) {
+        return false;
+    }
+    tlvAlMacAddress->mac() = agent.al_mac;
+
+    auto tlvClientAssociationEvent = cmdu_tx.addClass<wfa_map::tlvClientAssociationEvent>();
+    if (!tlvClientAssociationEvent) {
+        return false;
+    }
+    tlvClientAssociationEvent->bssid() = agent.radio_mac;
+
+    bool joined = true;
+    int client  = agent.clients;
+    if (agent.clients < clients_per_agent) {
+        agent.clients++;
+    } else {
+        client           = agent.churn_client;
+        joined           = agent.churn_left;
+        agent.churn_left = !agent.churn_left;
+        if (joined) {
+            agent.churn_client = (agent.churn_client + 1) % clients_per_agent;
+        }
+    }
+    tlvClientAssociationEvent->client_mac()        = make_mac(0x02, agent_index, client);
+    tlvClientAssociationEvent->association_event() =
+        joined ? wfa_map::tlvClientAssociationEvent::CLIENT_HAS_JOINED_THE_BSS
+               : wfa_map::tlvClientAssociationEvent::CLIENT_HAS_LEFT_THE_BSS;
+
+    return true;
+}
+
+static bool build_ap_metrics_response(ieee1905_1::CmduMessageTx &cmdu_tx, const sAgent &agent)
+{
+    if (!cmdu_tx.create(0, ieee1905_1::eMessageType::AP_METRICS_RESPONSE_MESSAGE)) {
+        return false;
+    }
+
+    auto tlvApMetrics = cmdu_tx.addClass<wfa_map::tlvApMetrics>();
+    if (!tlvApMetrics || !tlvApMetrics->alloc_estimated_service_info_field(3)) {
+        return false;
+    }
+    tlvApMetrics->bssid()                               = agent.radio_mac;
+    tlvApMetrics->channel_utilization()                 = 100;
+    tlvApMetrics->number_of_stas_currently_associated() = agent.clients;
+
+    return true;
+}
+
+static bool build_operating_channel_report(ieee1905_1::CmduMessageTx &cmdu_tx,
+                                           const sAgent &agent)
+{
+    if (!cmdu_tx.create(0, ieee1905_1::eMessageType::OPERATING_CHANNEL_REPORT_MESSAGE)) {
+        return false;
+    }
+
+    auto tlvOperatingChannelReport = cmdu_tx.addClass<wfa_map::tlvOperatingChannelReport>();
+    if (!tlvOperatingChannelReport ||
+        !tlvOperatingChannelReport->alloc_operating_classes_list()) {
+        return false;
+    }
+    tlvOperatingChannelReport->radio_uid() = agent.radio_mac;
+
+    auto operating_class_tuple = tlvOperatingChannelReport->operating_classes_list(0);
+    if (!std::get<0>(operating_class_tuple)) {
+        return false;
+    }
+    std::get<1>(operating_class_tuple).operating_class = 128;
+    std::get<1>(operating_class_tuple).channel_number  = 36;
+
+    tlvOperatingChannelReport->current_transmit_power() = 20;
+
+    return true;
+}
+
+static bool build_topology_response(ieee1905_1::CmduMessageTx &cmdu_tx, const sAgent &agent)
+{
+    if (!cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_RESPONSE_MESSAGE)) {
+        return false;
+    }
+
+    auto tlvDeviceInformation = cmdu_tx.addClass<ieee1905_1::tlvDeviceInformation>();
+    if (!tlvDeviceInformation) {
+        return false;
+    }
+    tlvDeviceInformation->mac() = agent.al_mac;
+
+    auto localInterfaceInfo = tlvDeviceInformation->create_local_interface_list();
+    if (!localInterfaceInfo) {
+        return false;
+    }
+    localInterfaceInfo->mac()        = agent.radio_mac;
+    localInterfaceInfo->media_type() = ieee1905_1::eMediaType::IEEE_802_11AC_5_GHZ;
+
+    ieee1905_1::s802_11SpecificInformation media_info = {};
+    media_info.role                                   = ieee1905_1::eRole::AP;
+    if (!localInterfaceInfo->alloc_media_info(sizeof(media_info))) {
+        return false;
+    }
+    std::copy_n(reinterpret_cast<uint8_t *>(&media_info), sizeof(media_info),
+                localInterfaceInfo->media_info(0));
+
+    return tlvDeviceInformation->add_local_interface_list(localInterfaceInfo);
+}
+
+/**
+ * @brief Sends a CMDU to the controller through the broker, as the agent would through the
+ * transport of its own device.
+ */
+static bool send_cmdu(Socket &broker, ieee1905_1::CmduMessageTx &cmdu_tx, const sMacAddr &src,
+                      const sMacAddr &dst)
+{
+    if (!cmdu_tx.finalize()) {
+        return false;
+    }
+
+    transport::messages::CmduTxMessage msg;
+    std::copy_n(src.oct, sizeof(src.oct), msg.metadata()->src);
+    std::copy_n(dst.oct, sizeof(dst.oct), msg.metadata()->dst);
+    msg.metadata()->ether_type        = ETH_P_1905_1;
+    msg.metadata()->msg_type          = uint16_t(cmdu_tx.getMessageType());
+    msg.metadata()->preset_message_id = 0;
+    // Delivered to the local subscribers, i.e. the controller, rather than to the network
+    msg.metadata()->if_type = transport::messages::CmduTxMessage::IF_TYPE_LOCAL_BUS;
+    msg.metadata()->length  = cmdu_tx.getMessageLength();
+    std::copy_n(cmdu_tx.getMessageBuff(), msg.metadata()->length, msg.data());
+
+    return transport::messages::send_transport_message(broker, msg);
+}
+
+static bool read_metrics(const std::string &uds_path, std::string &text)
+{
+    SocketClient client(uds_path);
+    if (!client.getError().empty()) {
+        std::cerr << "Failed connecting to " << uds_path << ": " << client.getError()
+                  << std::endl;
+        return false;
+    }
+
+    uint8_t buffer[4096];
+    ssize_t length;
+    while ((length = client.readBytes(buffer, sizeof(buffer), true, sizeof(buffer))) > 0) {
+        text.append(reinterpret_cast<char *>(buffer), length);
+    }
+    return true;
+}
+
+/**
+ * @brief Gets the value of a label in the labels of a series, e.g. "0x8002" for "type" in
+ * {type="0x8002",le="4"}.
+ */
+static std::string label_value(const std::string &series, const std::string &label)
+{
+    auto pos = series.find(label + "=\"");
+    if (pos == std::string::npos) {
+        return std::string();
+    }
+    pos += label.size() + 2;
+    return series.substr(pos, series.find('"', pos) - pos);
+}
+
+static int64_t get_rss_kb(int pid)
+{
+    std::ifstream status("/proc/" + std::to_string(pid) + "/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            return std::atoll(line.c_str() + 6);
+        }
+    }
+    return 0;
+}
+
+static bool read_controller_state(const std::string &temp_path, sControllerState &state)
+{
+    std::string text;
+    if (!read_metrics(temp_path + BEEROCKS_METRICS_UDS + BEEROCKS_CONTROLLER, text)) {
+        return false;
+    }
+
+    state = sControllerState();
+
+    std::stringstream ss(text);
+    std::string line;
+    while (std::getline(ss, line)) {
+        auto separator = line.rfind(' ');
+        if (line.empty() || line[0] == '#' || separator == std::string::npos) {
+            continue;
+        }
+        auto series = line.substr(0, separator);
+        auto value  = std::strtoull(line.c_str() + separator + 1, nullptr, 10);
+
+        if (series == TASKS_METRIC) {
+            state.tasks = value;
+        } else if (series.compare(0, HANDLING_TIME_METRIC.size(), HANDLING_TIME_METRIC) == 0) {
+            auto name       = series.substr(0, series.find('{'));
+            auto &histogram = state.handling_time[label_value(series, "type")];
+            if (name == HANDLING_TIME_METRIC + "_sum") {
+                histogram.sum = value;
+            } else if (name == HANDLING_TIME_METRIC + "_bucket") {
+                auto le = label_value(series, "le");
+                // The bucket of 2^i usec is the i-th one
+                size_t index = (le == "+Inf") ? metrics::HISTOGRAM_BUCKETS - 1
+                                              : __builtin_ctzll(std::strtoull(le.c_str(), 0, 10));
+                if (index < metrics::HISTOGRAM_BUCKETS) {
+                    histogram.buckets[index] = value;
+                }
+            }
+        }
+    }
+
+    int pid;
+    if (os_utils::is_pid_running(temp_path, BEEROCKS_CONTROLLER, &pid)) {
+        state.rss_kb = get_rss_kb(pid);
+    }
+    return true;
+}
+
+static sHistogram histogram_delta(const sHistogram &after, const sHistogram &before)
+{
+    sHistogram delta;
+    for (size_t i = 0; i < metrics::HISTOGRAM_BUCKETS; i++) {
+        delta.buckets[i] = after.buckets[i] - before.buckets[i];
+    }
+    delta.sum = after.sum - before.sum;
+    return delta;
+}
+
+/**
+ * @brief Gets the upper bound of the bucket of a percentile, -1 if above the last bound.
+ */
+static int64_t percentile_usec(const sHistogram &histogram, double percentile)
+{
+    auto rank = uint64_t(histogram.count() * percentile / 100);
+    for (size_t i = 0; i < metrics::HISTOGRAM_BUCKETS - 1; i++) {
+        if (histogram.buckets[i] > rank) {
+            return int64_t(1) << i;
+        }
+    }
+    return -1;
+}
+
+static void print_histogram(const std::string &name, const sHistogram &histogram)
+{
+    std::cout << "  " << std::setw(12) << std::left << name << std::right << std::setw(10)
+              << histogram.count() << std::setw(10) << histogram.sum / histogram.count();
+    for (double percentile : {50.0, 90.0, 99.0}) {
+        auto usec = percentile_usec(histogram, percentile);
+        std::cout << std::setw(10) << (usec < 0 ? std::string(">1s") : std::to_string(usec));
+    }
+    std::cout << std::endl;
+}
+
+static void print_report(const sControllerState &before, const sControllerState &after,
+                         double seconds, int clients, uint64_t sent)
+{
+    sHistogram total;
+    std::map<std::string, sHistogram> deltas;
+    for (const auto &it : after.handling_time) {
+        auto before_it = before.handling_time.find(it.first);
+        auto delta     = before_it == before.handling_time.end()
+                         ? it.second
+                         : histogram_delta(it.second, before_it->second);
+        if (delta.count() == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < metrics::HISTOGRAM_BUCKETS; i++) {
+            total.buckets[i] += delta.buckets[i];
+        }
+        total.sum += delta.sum;
+        deltas[it.first] = delta;
+    }
+
+    std::cout << std::fixed << std::setprecision(0) << "clients: " << clients
+              << ", sent: " << sent / seconds << " CMDUs/s, handled: " << total.count() / seconds
+              << " CMDUs/s, tasks: " << after.tasks << ", memory: " << after.rss_kb << " KiB ("
+              << std::showpos << after.rss_kb - before.rss_kb << std::noshowpos << ")"
+              << std::endl;
+    if (total.count() == 0) {
+        return;
+    }
+    std::cout << "  " << std::setw(12) << std::left << "type" << std::right << std::setw(10)
+              << "count" << std::setw(10) << "mean us" << std::setw(10) << "p50 us"
+              << std::setw(10) << "p90 us" << std::setw(10) << "p99 us" << std::endl;
+    for (const auto &it : deltas) {
+        print_histogram(it.first, it.second);
+    }
+    print_histogram("all", total);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <bridge iface> [agents] [clients per agent] [duration sec] [CMDUs per sec]"
+                  << std::endl;
+        return 1;
+    }
+    std::string bridge_iface = argv[1];
+    int agents_count         = argc > 2 ? std::atoi(argv[2]) : DEFAULT_AGENTS;
+    int clients_per_agent    = argc > 3 ? std::atoi(argv[3]) : DEFAULT_CLIENTS_PER_AGENT;
+    int duration_sec         = argc > 4 ? std::atoi(argv[4]) : DEFAULT_DURATION_SEC;
+    int rate                 = argc > 5 ? std::atoi(argv[5]) : DEFAULT_RATE;
+    if (agents_count <= 0 || agents_count > 0xff || clients_per_agent <= 0 ||
+        clients_per_agent > 0xffff || duration_sec <= 0 || rate <= 0) {
+        std::cerr << "invalid arguments" << std::endl;
+        return 1;
+    }
+
+    el::Configurations conf;
+    conf.setToDefault();
+    conf.setGlobally(el::ConfigurationType::ToStandardOutput, "false");
+    el::Loggers::reconfigureLogger("default", conf);
+
+    // The controller filters out the CMDUs which are not destined to the MAC of its bridge
+    net::network_utils::iface_info bridge_info;
+    if (net::network_utils::get_iface_info(bridge_info, bridge_iface) != 0) {
+        std::cerr << "Failed reading the address of " << bridge_iface << std::endl;
+        return 1;
+    }
+    auto controller_al_mac = tlvf::mac_from_string(bridge_info.mac);
+
+    // Same as the temp_path of the controller configuration
+    std::string temp_path = std::string(TMP_PATH) + "/";
+
+    SocketClient broker(temp_path + BEEROCKS_BROKER_UDS);
+    if (!broker.getError().empty()) {
+        std::cerr << "Failed connecting to the broker: " << broker.getError() << std::endl;
+        return 1;
+    }
+
+    sControllerState start_state;
+    if (!read_controller_state(temp_path, start_state)) {
+        return 1;
+    }
+
+    std::vector<sAgent> agents(agents_count);
+    for (int i = 0; i < agents_count; i++) {
+        agents[i].al_mac    = make_mac(0x00, i);
+        agents[i].radio_mac = make_mac(0x01, i);
+    }
+
+    std::cout << agents_count << " agents, " << clients_per_agent << " clients per agent, "
+              << duration_sec << " s at " << rate << " CMDUs/s" << std::endl;
+
+    std::vector<uint8_t> buffer(message::MESSAGE_BUFFER_LENGTH);
+    ieee1905_1::CmduMessageTx cmdu_tx(buffer.data(), buffer.size());
+
+    auto interval     = std::chrono::nanoseconds(std::chrono::seconds(1)) / rate;
+    auto start        = std::chrono::steady_clock::now();
+    auto end          = start + std::chrono::seconds(duration_sec);
+    auto report_start = start;
+    auto report_state = start_state;
+
+    uint64_t sent = 0, report_sent = 0;
+    int clients   = 0;
+
+    for (uint64_t i = 0;; i++) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= report_start + std::chrono::seconds(REPORT_INTERVAL_SEC) || now >= end) {
+            sControllerState state;
+            if (!read_controller_state(temp_path, state)) {
+                return 1;
+            }
+            if (now >= end) {
+                std::cout << std::endl << "whole run:" << std::endl;
+                print_report(start_state, state,
+                             std::chrono::duration<double>(now - start).count(), clients, sent);
+                break;
+            }
+            print_report(report_state, state,
+                         std::chrono::duration<double>(now - report_start).count(), clients,
+                         sent - report_sent);
+            report_start = now;
+            report_state = state;
+            report_sent  = sent;
+        }
+        std::this_thread::sleep_until(start + interval * i);
+
+        auto agent_index = int(i % agents_count);
+        auto &agent      = agents[agent_index];
+
+        bool built = false;
+        if (i < uint64_t(agents_count)) {
+            built = build_autoconfig_search(cmdu_tx, agent);
+        } else {
+            switch (agent.step++ % 4) {
+            case 0: {
+                if (agent.clients < clients_per_agent) {
+                    clients++;
+                }
+                built = build_topology_notification(cmdu_tx, agent, agent_index, clients_per_agent);
+            } break;
+            case 1: {
+                built = build_ap_metrics_response(cmdu_tx, agent);
+            } break;
+            case 2: {
+                built = build_operating_channel_report(cmdu_tx, agent);
+            } break;
+            case 3: {
+                built = build_topology_response(cmdu_tx, agent);
+            } break;
+            }
+        }
+        if (!built) {
+            std::cerr << "Failed building a CMDU of agent " << agent.al_mac << std::endl;
+            return 1;
+        }
+
+        if (!send_cmdu(broker, cmdu_tx, agent.al_mac, controller_al_mac)) {
+            std::cerr << "Failed sending a CMDU to the broker" << std::endl;
+            return 1;
+        }
+        sent++;
+    }
+
+    return 0;
+}
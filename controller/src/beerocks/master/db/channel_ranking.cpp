@@ -0,0 +1,201 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "channel_ranking.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <unordered_map>
+
+using namespace son;
+
+constexpr int channel_ranking::SLOTS_COUNT;
+
+static const uint8_t LAST_24G_CHANNEL         = 14;
+static const uint8_t FIRST_5G_UPPER_CHANNEL   = 149;
+static const uint8_t FIRST_5G_LOWER_CHANNEL   = 36;
+static const int SLOTS_PER_20MHZ              = 4;
+static const uint32_t MAX_CHANNEL_UTILIZATION = 255;
+
+static double dbm_to_mw(double dbm) { return std::pow(10.0, dbm / 10.0); }
+
+static double mw_to_dbm(double mw) { return 10.0 * std::log10(mw); }
+
+static int bandwidth_to_20mhz_count(beerocks::eWiFiBandwidth bandwidth)
+{
+    switch (bandwidth) {
+    case beerocks::BANDWIDTH_40:
+        return 2;
+    case beerocks::BANDWIDTH_80:
+    case beerocks::BANDWIDTH_80_80: // the second segment is not known, count the first only
+        return 4;
+    case beerocks::BANDWIDTH_160:
+        return 8;
+    default:
+        return 1;
+    }
+}
+
+static beerocks::eWiFiBandwidth
+scan_result_bandwidth(beerocks_message::eChannelScanResultChannelBandwidth bandwidth)
+{
+    switch (bandwidth) {
+    case beerocks_message::eChannelScanResultChannelBandwidth::eChannel_Bandwidth_40MHz:
+        return beerocks::BANDWIDTH_40;
+    case beerocks_message::eChannelScanResultChannelBandwidth::eChannel_Bandwidth_80MHz:
+        return beerocks::BANDWIDTH_80;
+    case beerocks_message::eChannelScanResultChannelBandwidth::eChannel_Bandwidth_160MHz:
+        return beerocks::BANDWIDTH_160;
+    case beerocks_message::eChannelScanResultChannelBandwidth::eChannel_Bandwidth_80_80:
+        return beerocks::BANDWIDTH_80_80;
+    default:
+        return beerocks::BANDWIDTH_20;
+    }
+}
+
+bool channel_ranking::get_occupied_slots(uint8_t channel, beerocks::eWiFiBandwidth bandwidth,
+                                         int &first, int &last)
+{
+    if (channel == 0) {
+        return false;
+    }
+
+    int channels_20mhz = bandwidth_to_20mhz_count(bandwidth);
+
+    if (channel <= LAST_24G_CHANNEL) {
+        // 2.4GHz channels are 5MHz apart, so neighboring channels overlap.
+        // For 40MHz the secondary channel is assumed to be above for the lower channels and
+        // below for the upper ones.
+        first = channel - 2;
+        last  = channel + 2;
+        if (channels_20mhz > 1) {
+            if (channel <= 7) {
+                last += SLOTS_PER_20MHZ;
+            } else {
+                first -= SLOTS_PER_20MHZ;
+            }
+        }
+        first = std::max(first, 0);
+        return true;
+    }
+
+    if (channel < FIRST_5G_LOWER_CHANNEL) {
+        return false;
+    }
+
+    // 5GHz bonded channels are aligned to blocks of 2/4/8 20MHz channels starting at channel 36,
+    // or 149 for the upper band
+    int base   = (channel >= FIRST_5G_UPPER_CHANNEL) ? FIRST_5G_UPPER_CHANNEL
+                                                     : FIRST_5G_LOWER_CHANNEL;
+    int offset = (channel - base) / SLOTS_PER_20MHZ;
+    int start  = base + (offset / channels_20mhz) * channels_20mhz * SLOTS_PER_20MHZ;
+
+    first = start - 2;
+    last  = start + channels_20mhz * SLOTS_PER_20MHZ - 2;
+    return last <= SLOTS_COUNT;
+}
+
+std::vector<channel_ranking::sChannelRank>
+channel_ranking::rank(const std::vector<beerocks::message::sWifiChannel> &supported_channels,
+                      const channel_scan_result_ring &scan_results, const sParams &params)
+{
+    // Interference power density (mW per 5MHz slot), and its prefix sum
+    std::array<double, SLOTS_COUNT> density{};
+    std::array<double, SLOTS_COUNT + 1> accumulated{};
+
+    for (const auto &neighbor : scan_results) {
+        int first, last;
+        if (!get_occupied_slots(uint8_t(neighbor.channel),
+                                scan_result_bandwidth(neighbor.operating_channel_bandwidth), first,
+                                last) ||
+            last <= first) {
+            continue;
+        }
+        // A busy neighbor interferes more than an idle one with the same signal strength
+        uint32_t channel_utilization = neighbor.channel_utilization;
+        double utilization =
+            double(std::min(channel_utilization, MAX_CHANNEL_UTILIZATION)) /
+            MAX_CHANNEL_UTILIZATION;
+        double power      = dbm_to_mw(neighbor.signal_strength_dBm) * (0.5 + utilization);
+        double slot_power = power / (last - first);
+        for (int slot = first; slot < last; slot++) {
+            density[slot] += slot_power;
+        }
+    }
+
+    for (int slot = 0; slot < SLOTS_COUNT; slot++) {
+        accumulated[slot + 1] = accumulated[slot] + density[slot];
+    }
+
+    // 20MHz channel flags, to check every 20MHz channel of the bonded candidates
+    std::unordered_map<uint8_t, const beerocks::message::sWifiChannel *> channels_20mhz;
+    for (const auto &supported_channel : supported_channels) {
+        if (supported_channel.channel_bandwidth == beerocks::BANDWIDTH_20) {
+            channels_20mhz[supported_channel.channel] = &supported_channel;
+        }
+    }
+
+    std::vector<sChannelRank> ranking;
+    ranking.reserve(supported_channels.size());
+
+    for (const auto &candidate : supported_channels) {
+        auto bandwidth = beerocks::eWiFiBandwidth(candidate.channel_bandwidth);
+        int first, last;
+        if (!get_occupied_slots(candidate.channel, bandwidth, first, last)) {
+            continue;
+        }
+
+        int count_20mhz = bandwidth_to_20mhz_count(bandwidth);
+        bool is_dfs     = candidate.is_dfs_channel;
+        bool is_radar   = candidate.radar_affected;
+        double noise_mw = 0;
+        if (candidate.channel <= LAST_24G_CHANNEL) {
+            noise_mw = dbm_to_mw(candidate.noise ? candidate.noise : params.default_noise_dbm) *
+                       count_20mhz;
+        } else {
+            for (int channel = first + 2; channel < last; channel += SLOTS_PER_20MHZ) {
+                auto it       = channels_20mhz.find(channel);
+                int noise_dbm = params.default_noise_dbm;
+                if (it != channels_20mhz.end()) {
+                    is_dfs |= bool(it->second->is_dfs_channel);
+                    is_radar |= bool(it->second->radar_affected);
+                    if (it->second->noise) {
+                        noise_dbm = it->second->noise;
+                    }
+                }
+                noise_mw += dbm_to_mw(noise_dbm);
+            }
+        }
+        if (is_radar) {
+            continue;
+        }
+
+        sChannelRank rank;
+        rank.channel   = candidate.channel;
+        rank.bandwidth = bandwidth;
+        rank.is_dfs    = is_dfs;
+        rank.interference_dbm =
+            mw_to_dbm((accumulated[last] - accumulated[first] + noise_mw) / count_20mhz);
+        rank.cost = rank.interference_dbm + (is_dfs ? params.dfs_penalty_db : 0);
+        ranking.push_back(rank);
+    }
+
+    // On equal cost prefer the wider bandwidth, then the lower channel
+    std::sort(ranking.begin(), ranking.end(), [](const sChannelRank &a, const sChannelRank &b) {
+        if (a.cost != b.cost) {
+            return a.cost < b.cost;
+        }
+        if (a.bandwidth != b.bandwidth) {
+            return a.bandwidth > b.bandwidth;
+        }
+        return a.channel < b.channel;
+    });
+
+    return ranking;
+}
@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _CHANNEL_RANKING_H_
+#define _CHANNEL_RANKING_H_
+
+#include "channel_scan_result_ring.h"
+
+#include <bcl/beerocks_defines.h>
+#include <bcl/beerocks_message_structs.h>
+
+#include <vector>
+
+namespace son {
+
+/**
+ * @brief Ranks the (channel, bandwidth) candidates of a radio by the interference measured on
+ * them in the last channel scan.
+ *
+ * Every neighbor BSS found in the scan is spread over the 5MHz slots it occupies, weighted by
+ * its received power and its reported channel utilization. This is done in a single pass over
+ * the scan results into a per-slot array, followed by a prefix sum, so the interference of any
+ * candidate is then read in O(1) regardless of its bandwidth.
+ *
+ * Candidates that include a radar affected 20MHz channel are left out of the ranking, DFS
+ * candidates get a configurable penalty.
+ */
+class channel_ranking {
+public:
+    struct sParams {
+        // Penalty added to DFS candidates, in dB (CAC time and radar risk)
+        int dfs_penalty_db = 3;
+        // Noise floor used when the radio did not report one for a channel, in dBm
+        int default_noise_dbm = -95;
+    };
+
+    struct sChannelRank {
+        uint8_t channel                    = 0;
+        beerocks::eWiFiBandwidth bandwidth = beerocks::BANDWIDTH_UNKNOWN;
+        bool is_dfs                        = false;
+        // Interference + noise per 20MHz of the candidate, in dBm
+        double interference_dbm = 0;
+        // Ranking score, lower is better
+        double cost = 0;
+    };
+
+    /**
+     * @brief Compute the ranking of the given candidates.
+     *
+     * @param supported_channels Supported channels of the radio, the candidates.
+     * @param scan_results Results of the last channel scan of the radio.
+     * @param params Ranking parameters.
+     * @return Candidates sorted from the best (lowest cost) to the worst.
+     */
+    static std::vector<sChannelRank>
+    rank(const std::vector<beerocks::message::sWifiChannel> &supported_channels,
+         const channel_scan_result_ring &scan_results, const sParams &params);
+
+    /**
+     * @brief Get the 5MHz slots range [first, last) occupied by a transmission.
+     *
+     * @param channel Primary channel.
+     * @param bandwidth Bandwidth of the transmission.
+     * @param first First occupied slot (output).
+     * @param last One past the last occupied slot (output).
+     * @return false if the channel/bandwidth combination is invalid, true otherwise.
+     */
+    static bool get_occupied_slots(uint8_t channel, beerocks::eWiFiBandwidth bandwidth,
+                                   int &first, int &last);
+
+private:
+    // 5MHz slots are numbered like the channels: channel N is centered at slot N
+    static constexpr int SLOTS_COUNT = 200;
+};
+
+} // namespace son
+
+#endif
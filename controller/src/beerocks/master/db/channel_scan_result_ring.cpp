@@ -0,0 +1,60 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "channel_scan_result_ring.h"
+
+using namespace son;
+
+constexpr size_t channel_scan_result_ring::DEFAULT_CAPACITY;
+
+channel_scan_result_ring::channel_scan_result_ring(size_t capacity) : m_capacity(capacity) {}
+
+void channel_scan_result_ring::start_generation()
+{
+    m_records.clear();
+    m_bssid_slots.clear();
+    m_head        = 0;
+    m_size        = 0;
+    m_overwritten = 0;
+    m_generation++;
+}
+
+bool channel_scan_result_ring::add(const beerocks_message::sChannelScanResults &result)
+{
+    if (m_capacity == 0) {
+        return false;
+    }
+
+    auto slot_it = m_bssid_slots.find(result.bssid);
+    if (slot_it != m_bssid_slots.end()) {
+        m_records[slot_it->second] = result;
+        return true;
+    }
+
+    size_t slot;
+    if (m_size < m_capacity) {
+        // Until the ring wraps, the head stays at 0 and records are appended
+        slot = m_size;
+        if (slot == m_records.size()) {
+            m_records.push_back(result);
+        } else {
+            m_records[slot] = result;
+        }
+        m_size++;
+    } else {
+        // Full - overwrite the oldest record
+        slot = m_head;
+        m_bssid_slots.erase(m_records[slot].bssid);
+        m_records[slot] = result;
+        m_head          = (m_head + 1) % m_capacity;
+        m_overwritten++;
+    }
+
+    m_bssid_slots[result.bssid] = slot;
+    return true;
+}
@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _CHANNEL_SCAN_RESULT_RING_H_
+#define _CHANNEL_SCAN_RESULT_RING_H_
+
+#include <beerocks/tlvf/beerocks_message_common.h>
+#include <tlvf/tlvftypes.h>
+
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+namespace son {
+
+/**
+ * @brief Bounded storage of the channel scan results of a single radio.
+ *
+ * Records are kept in their packed tlvf format (sChannelScanResults), contiguously in a ring
+ * that never grows beyond its capacity. When the ring is full the oldest record is overwritten.
+ *
+ * Each scan starts a new generation (start_generation()), which drops the previous results.
+ * Within a generation a BSSID is stored once: a newer report of the same BSSID replaces the
+ * stored record in place.
+ *
+ * Iteration goes from the oldest to the newest record and hands out references to the stored
+ * records, so consumers (BML, NBAPI) can copy them directly into their messages.
+ */
+class channel_scan_result_ring {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 512;
+
+    class const_iterator : public std::iterator<std::forward_iterator_tag,
+                                                const beerocks_message::sChannelScanResults> {
+    public:
+        const_iterator(const channel_scan_result_ring &ring, size_t pos) : m_ring(ring), m_pos(pos)
+        {
+        }
+        const beerocks_message::sChannelScanResults &operator*() const { return m_ring.at(m_pos); }
+        const beerocks_message::sChannelScanResults *operator->() const
+        {
+            return &m_ring.at(m_pos);
+        }
+        const_iterator &operator++()
+        {
+            ++m_pos;
+            return *this;
+        }
+        bool operator==(const const_iterator &other) const { return m_pos == other.m_pos; }
+        bool operator!=(const const_iterator &other) const { return m_pos != other.m_pos; }
+
+    private:
+        const channel_scan_result_ring &m_ring;
+        size_t m_pos;
+    };
+
+    explicit channel_scan_result_ring(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Drop all stored records and start a new scan generation.
+     * The allocated storage is kept for the next scan.
+     */
+    void start_generation();
+
+    /**
+     * @brief Store a scan result.
+     * If the BSSID was already reported in the current generation the stored record is
+     * replaced, otherwise the record is appended and the oldest record is overwritten if the
+     * ring is full.
+     *
+     * @param result Scan result to store.
+     * @return false if the ring has no capacity, true otherwise.
+     */
+    bool add(const beerocks_message::sChannelScanResults &result);
+
+    /**
+     * @brief Get a stored record.
+     *
+     * @param index Logical index, 0 is the oldest record. Must be lower than size().
+     */
+    const beerocks_message::sChannelScanResults &at(size_t index) const
+    {
+        return m_records[(m_head + index) % m_capacity];
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief Get the current scan generation (number of start_generation() calls).
+     */
+    uint32_t get_generation() const { return m_generation; }
+
+    /**
+     * @brief Get the number of records overwritten because the ring was full, since the
+     * beginning of the current generation.
+     */
+    size_t get_overwritten_count() const { return m_overwritten; }
+
+    const_iterator begin() const { return const_iterator(*this, 0); }
+    const_iterator end() const { return const_iterator(*this, m_size); }
+
+private:
+    // Records are allocated on demand up to m_capacity, so idle radios stay small
+    std::vector<beerocks_message::sChannelScanResults> m_records;
+
+    // Physical slot of each BSSID stored in the current generation
+    std::unordered_map<sMacAddr, size_t> m_bssid_slots;
+
+    size_t m_capacity     = 0;
+    size_t m_head         = 0; // physical slot of the oldest record
+    size_t m_size         = 0;
+    size_t m_overwritten  = 0;
+    uint32_t m_generation = 0;
+};
+
+} // namespace son
+
+#endif
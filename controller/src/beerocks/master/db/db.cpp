@@ -10,7 +10,6 @@
 
 #include <bcl/beerocks_utils.h>
 #include <bcl/son/son_wireless_utils.h>
-#include <bpl/bpl_db.h>
 #include <easylogging++.h>
 
 #include <algorithm>
@@ -138,10 +137,28 @@ bool db::add_node(const sMacAddr &mac, const sMacAddr &parent_mac, beerocks::eTy
         return false;
     }
 
+    if (!m_topology.can_set_parent(tlvf::mac_to_string(mac), tlvf::mac_to_string(parent_mac))) {
+        LOG(ERROR) << "can't set " << parent_mac << " as parent of " << mac
+                   << ", it is part of the node's subtree";
+        return false;
+    }
+
+    std::string ruid_key;
+    if (radio_identifier != network_utils::ZERO_MAC) {
+        ruid_key = get_node_key(tlvf::mac_to_string(parent_mac),
+                                tlvf::mac_to_string(radio_identifier));
+        if (ruid_key.empty()) {
+            LOG(ERROR) << "can't insert node with empty RUID";
+            return false;
+        }
+    }
+
     auto n = get_node(mac);
     if (n) { // n is not nullptr
         LOG(DEBUG) << "node with mac " << mac << " already exists, updating";
         n->set_type(type);
+        // The RUID key depends on the parent, it is inserted again below
+        auto old_ruid_key = get_node_key(n->parent_mac, n->radio_identifier);
         if (n->parent_mac != tlvf::mac_to_string(parent_mac)) {
             n->previous_parent_mac = n->parent_mac;
             n->parent_mac          = tlvf::mac_to_string(parent_mac);
@@ -149,6 +166,10 @@ bool db::add_node(const sMacAddr &mac, const sMacAddr &parent_mac, beerocks::eTy
         int old_hierarchy = get_node_hierarchy(n);
         if (old_hierarchy >= 0 && old_hierarchy < HIERARCHY_MAX) {
             nodes[old_hierarchy].erase(tlvf::mac_to_string(mac));
+            auto old_ruid_it = nodes[old_hierarchy].find(old_ruid_key);
+            if (old_ruid_it != nodes[old_hierarchy].end() && old_ruid_it->second == n) {
+                nodes[old_hierarchy].erase(old_ruid_it);
+            }
         } else {
             LOG(ERROR) << "old hierarchy " << old_hierarchy << " for node " << mac
                        << " is invalid!!!";
@@ -165,12 +186,7 @@ bool db::add_node(const sMacAddr &mac, const sMacAddr &parent_mac, beerocks::eTy
     n->hierarchy        = new_hierarchy;
     nodes[new_hierarchy].insert(std::make_pair(tlvf::mac_to_string(mac), n));
 
-    if (radio_identifier != network_utils::ZERO_MAC) {
-        std::string ruid_key = get_node_key(tlvf::mac_to_string(parent_mac), n->radio_identifier);
-        if (ruid_key.empty()) {
-            LOG(ERROR) << "can't insert node with empty RUID";
-            return false;
-        }
+    if (!ruid_key.empty()) {
         // if already exists set instead of insert
         if (get_node(ruid_key)) {
             nodes[new_hierarchy].erase(ruid_key);
@@ -178,6 +194,9 @@ bool db::add_node(const sMacAddr &mac, const sMacAddr &parent_mac, beerocks::eTy
         nodes[new_hierarchy].insert(std::make_pair(ruid_key, n));
     }
 
+    // Checked by can_set_parent() above, the index is only updated once the node is inserted
+    m_topology.set_parent(tlvf::mac_to_string(mac), tlvf::mac_to_string(parent_mac));
+
     return true;
 }
 
@@ -196,6 +215,8 @@ bool db::remove_node(const sMacAddr &mac)
                 last_accessed_node     = nullptr;
             }
 
+            m_topology.remove(node_mac);
+
             // map may include 2 keys to same node - if so remove other key-node pair from map
             // if removed by mac
             if (tlvf::mac_to_string(mac) == node_mac) {
@@ -833,6 +854,11 @@ std::set<std::string> db::get_node_subtree(const std::string &mac)
     return subtree;
 }
 
+bool db::is_node_in_subtree(const std::string &root_mac, const std::string &mac)
+{
+    return m_topology.is_in_subtree(root_mac, mac);
+}
+
 std::string db::get_node_parent(const std::string &mac)
 {
     auto n = get_node(mac);
@@ -918,16 +944,13 @@ std::set<std::string> db::get_node_siblings(const std::string &mac, int type)
         return siblings;
     }
 
-    int hierarchy = get_node_hierarchy(parent) + 1;
-    if (hierarchy >= 0 && hierarchy < HIERARCHY_MAX) {
-        for (auto &it : nodes[hierarchy]) {
-            if (it.first == it.second->mac) {
-                auto sib = it.second;
-                if ((sib->parent_mac == parent->mac) && (mac != sib->mac) &&
-                    (type == beerocks::TYPE_ANY || sib->get_type() == type)) {
-                    siblings.insert(sib->mac);
-                }
-            }
+    for (const auto &sibling_mac : m_topology.get_children(parent->mac)) {
+        if (sibling_mac == n->mac) {
+            continue;
+        }
+        auto sib = get_node(sibling_mac);
+        if (sib && (type == beerocks::TYPE_ANY || sib->get_type() == type)) {
+            siblings.insert(sib->mac);
         }
     }
     return siblings;
@@ -2336,7 +2359,8 @@ bool db::clear_channel_scan_results(const sMacAddr &mac, bool single_scan)
         return false;
     }
 
-    (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results).clear();
+    (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results)
+        .start_generation();
 
     return true;
 }
@@ -2350,16 +2374,43 @@ bool db::add_channel_scan_results(const sMacAddr &mac, const sChannelScanResults
         return false;
     }
 
-    (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results)
-        .push_back(scan_result);
+    return (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results)
+        .add(scan_result);
+}
+
+const channel_scan_result_ring &db::get_channel_scan_results(const sMacAddr &mac,
+                                                             bool single_scan)
+{
+    static const channel_scan_result_ring empty(0);
+
+    auto hostap = get_hostap_by_mac(mac);
+    if (!hostap) {
+        LOG(ERROR) << "unable to get hostap";
+        return empty;
+    }
+
+    return (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results);
+}
+
+bool db::update_channel_ranking(const sMacAddr &mac, bool single_scan)
+{
+    auto hostap = get_hostap_by_mac(mac);
+    if (!hostap) {
+        LOG(ERROR) << "unable to get hostap";
+        return false;
+    }
+
+    channel_ranking::sParams params;
+    hostap->ranked_channels = channel_ranking::rank(
+        hostap->supported_channels,
+        (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results), params);
 
     return true;
 }
 
-const std::list<sChannelScanResults> &db::get_channel_scan_results(const sMacAddr &mac,
-                                                                   bool single_scan)
+const std::vector<channel_ranking::sChannelRank> &db::get_channel_ranking(const sMacAddr &mac)
 {
-    static std::list<sChannelScanResults> empty;
+    static const std::vector<channel_ranking::sChannelRank> empty;
 
     auto hostap = get_hostap_by_mac(mac);
     if (!hostap) {
@@ -2367,7 +2418,7 @@ const std::list<sChannelScanResults> &db::get_channel_scan_results(const sMacAdd
         return empty;
     }
 
-    return (single_scan ? hostap->single_scan_results : hostap->continuous_scan_results);
+    return hostap->ranked_channels;
 }
 
 //
@@ -2377,7 +2428,7 @@ bool db::is_client_in_persistent_db(const sMacAddr &mac)
 {
     auto client_db_entry = client_db_entry_from_mac(mac);
 
-    return bpl::db_has_entry(type_to_string(beerocks::eType::TYPE_CLIENT), client_db_entry);
+    return m_persistent_db_writer.has_entry(client_db_entry);
 }
 
 bool db::add_client_to_persistent_db(const sMacAddr &mac, const ValuesMap &params)
@@ -2390,20 +2441,23 @@ bool db::add_client_to_persistent_db(const sMacAddr &mac, const ValuesMap &param
 
     auto db_entry = client_db_entry_from_mac(mac);
 
-    if (bpl::db_has_entry(type_to_string(beerocks::eType::TYPE_CLIENT), db_entry)) {
+    if (m_persistent_db_writer.has_entry(db_entry)) {
         // if entry already exists in DB
         if (!remove_client_entry_and_update_counter(db_entry)) {
             LOG(ERROR) << "failed to remove client entry " << db_entry
                        << "from persistent db (for re-adding)";
             return false;
         }
-    } else if (bpl::db_has_entry(std::string(), db_entry)) {
+    } else if (m_persistent_db_writer.has_entry_of_other_type(db_entry)) {
         // if entry exists in db but with different type
         LOG(ERROR) << "client entry cannot be added to persistent db, " << db_entry
                    << " already exists but with different type";
         return false;
     }
 
+    // account for the writes the writer gave up
+    m_persistent_db_clients_count += m_persistent_db_writer.take_count_correction();
+
     if (m_persistent_db_clients_count >= config.clients_persistent_db_max_size) {
         LOG(DEBUG) << "reached max clients size in persistent db - removing a client before adding "
                       "new client";
@@ -2722,7 +2776,7 @@ bool db::clear_client_persistent_db(const sMacAddr &mac)
     // if persistent db is enabled
     if (config.persistent_db) {
         auto db_entry = client_db_entry_from_mac(mac);
-        if (!bpl::db_has_entry(type_to_string(beerocks::eType::TYPE_CLIENT), db_entry)) {
+        if (!m_persistent_db_writer.has_entry(db_entry)) {
             LOG(DEBUG) << "client entry does not exist in persistent-db for " << db_entry;
             return true;
         }
@@ -2807,6 +2861,16 @@ bool db::update_client_persistent_db(const sMacAddr &mac)
     return true;
 }
 
+bool db::start_persistent_db_writer()
+{
+    if (!config.persistent_db) {
+        LOG(ERROR) << "Persistent db is disabled";
+        return false;
+    }
+
+    return m_persistent_db_writer.start();
+}
+
 bool db::load_persistent_db_clients()
 {
     // If persistent db is disabled function should not be called
@@ -2815,8 +2879,10 @@ bool db::load_persistent_db_clients()
         return false;
     }
 
+    auto load_start = std::chrono::steady_clock::now();
+
     std::unordered_map<std::string, ValuesMap> clients;
-    if (!bpl::db_get_entries_by_type(type_to_string(beerocks::eType::TYPE_CLIENT), clients)) {
+    if (!m_persistent_db_writer.load(clients)) {
         LOG(ERROR) << "Failed to get all clients from persistent DB";
         return false;
     }
@@ -2863,18 +2929,14 @@ bool db::load_persistent_db_clients()
             return true;
         };
 
-        static const auto type_client_str = db::type_to_string(beerocks::eType::TYPE_CLIENT);
-
         // Clients with invalid mac are invalid.
         // Invalid clients are removed from persistent db and not added to runtime db
         auto client_mac = client_db_entry_to_mac(client_entry);
         if (client_mac == network_utils::ZERO_MAC) {
             LOG(ERROR) << "Invalid entry - not a valid mac as client entry " << client_entry;
-            // Calling BPL API directly as there's no need to increment/decrement counter at this point
-            if (!beerocks::bpl::db_remove_entry(type_client_str, client_entry)) {
-                // Failure to remove the client will not fail the adding rest of valid client
-                LOG(ERROR) << "Failed to remove client entry " << client_entry;
-            }
+            // Not going through remove_client_entry_and_update_counter() as there's no need to
+            // increment/decrement counter at this point
+            m_persistent_db_writer.remove_entry(client_entry);
             continue;
         }
 
@@ -2884,11 +2946,9 @@ bool db::load_persistent_db_clients()
         if (timestamp_it == client_data_map.end()) {
             LOG(ERROR) << "Invalid entry - no timestamp is configured for client entry "
                        << client_entry;
-            // Calling BPL API directly as there's no need to increment/decrement counter at this point
-            if (!beerocks::bpl::db_remove_entry(type_client_str, client_entry)) {
-                // Failure to remove the client will not fail the adding rest of valid client
-                LOG(ERROR) << "Failed to remove client entry " << client_entry;
-            }
+            // Not going through remove_client_entry_and_update_counter() as there's no need to
+            // increment/decrement counter at this point
+            m_persistent_db_writer.remove_entry(client_entry);
             continue;
         }
 
@@ -2912,11 +2972,9 @@ bool db::load_persistent_db_clients()
         if (client_remaining_timelife_sec <= 0) {
             LOG(ERROR) << "Invalid entry - configured data has aged for client entry "
                        << client_entry;
-            // Calling BPL API directly as there's no need to increment/decrement counter at this point
-            if (!beerocks::bpl::db_remove_entry(type_client_str, client_entry)) {
-                // Failure to remove the client will not fail the adding rest of valid client
-                LOG(ERROR) << "Failed to remove client entry " << client_entry;
-            }
+            // Not going through remove_client_entry_and_update_counter() as there's no need to
+            // increment/decrement counter at this point
+            m_persistent_db_writer.remove_entry(client_entry);
             continue;
         }
 
@@ -2954,10 +3012,7 @@ bool db::load_persistent_db_clients()
                 LOG(DEBUG) << "Clients DB is full, client has the least remaining timelife, it is "
                               "not added to the runtime DB and removed from persistent DB: "
                            << client_mac;
-                if (!bpl::db_remove_entry(type_client_str, client_entry)) {
-                    LOG(ERROR) << "Failed to remove entry " << client_entry
-                               << " from persistent db";
-                }
+                m_persistent_db_writer.remove_entry(client_entry);
                 continue;
             }
 
@@ -2991,7 +3046,11 @@ bool db::load_persistent_db_clients()
         << "Filtered clients due to max DB capacity reached: "
         << clients_not_added_or_removed_due_to_full_db
         << ", max-capacity: " << config.clients_persistent_db_max_size;
-    LOG(DEBUG) << "Added " << clients_added_no_error << " clients successfully";
+    LOG(DEBUG) << "Added " << clients_added_no_error << " clients successfully in "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - load_start)
+                      .count()
+               << " ms";
 
     // Set clients count to number of clients added successfully to runtime db
     m_persistent_db_clients_count = clients_added_no_error;
@@ -4132,20 +4191,10 @@ std::set<std::shared_ptr<node>> db::get_node_subtree(std::shared_ptr<node> n)
         return subtree;
     }
 
-    int i = get_node_hierarchy(n) + 1;
-
-    if (i >= HIERARCHY_MAX) {
-        return subtree;
-    }
-
-    for (auto &node_element : nodes[i]) {
-        if (node_element.first == node_element.second->mac) {
-            auto subtree_node = node_element.second;
-            if (subtree_node->parent_mac == n->mac) {
-                subtree.insert(subtree_node);
-                std::set<std::shared_ptr<node>> sub_subtree = get_node_subtree(subtree_node);
-                subtree.insert(sub_subtree.begin(), sub_subtree.end());
-            }
+    for (const auto &subtree_mac : m_topology.get_subtree(n->mac)) {
+        auto subtree_node = get_node(subtree_mac);
+        if (subtree_node) {
+            subtree.insert(subtree_node);
         }
     }
     return subtree;
@@ -4164,16 +4213,14 @@ std::set<std::shared_ptr<node>> db::get_node_children(std::shared_ptr<node> n, i
     auto bssids = get_hostap_vaps_bssids(n->mac);
     bssids.insert(n->mac);
 
-    int hierarchy = get_node_hierarchy(n) + 1;
-
-    if (hierarchy >= 0 && hierarchy < HIERARCHY_MAX) {
-        for (auto &node_element : nodes[hierarchy]) {
-            auto child = node_element.second;
-            if ((child->mac == node_element.first) &&
-                (bssids.find(child->parent_mac) != bssids.end() &&
-                 (type == beerocks::TYPE_ANY || child->get_type() == type) &&
-                 (state == beerocks::STATE_ANY || child->state == state) &&
-                 (parent_mac.empty() || child->parent_mac == parent_mac))) {
+    for (const auto &bssid : bssids) {
+        if (!parent_mac.empty() && bssid != parent_mac) {
+            continue;
+        }
+        for (const auto &child_mac : m_topology.get_children(bssid)) {
+            auto child = get_node(child_mac);
+            if (child && (type == beerocks::TYPE_ANY || child->get_type() == type) &&
+                (state == beerocks::STATE_ANY || child->state == state)) {
                 children.insert(child);
             }
         }
@@ -4181,35 +4228,6 @@ std::set<std::shared_ptr<node>> db::get_node_children(std::shared_ptr<node> n, i
     return children;
 }
 
-void db::adjust_subtree_hierarchy(std::shared_ptr<node> n)
-{
-    if (!n) {
-        LOG(ERROR) << "node is nullptr!";
-        return;
-    }
-
-    int hierarchy = get_node_hierarchy(n);
-
-    for (int i = 0; i < HIERARCHY_MAX; ++i) {
-        for (auto it = nodes[i].begin(); it != nodes[i].end();) {
-            auto subtree_node = it->second;
-            if (subtree_node->parent_mac == n->mac) {
-                int new_hierarchy = hierarchy + 1;
-                if (new_hierarchy >= HIERARCHY_MAX) {
-                    LOG(ERROR) << "new hierarchy is too high!";
-                    return;
-                }
-                it = nodes[i].erase(it);
-                nodes[new_hierarchy].insert(std::make_pair(subtree_node->mac, subtree_node));
-                subtree_node->hierarchy = new_hierarchy;
-                adjust_subtree_hierarchy(subtree_node);
-            } else {
-                ++it;
-            }
-        }
-    }
-}
-
 void db::adjust_subtree_hierarchy(std::set<std::shared_ptr<node>> subtree, int offset)
 {
     for (auto s : subtree) {
@@ -4220,6 +4238,15 @@ void db::adjust_subtree_hierarchy(std::set<std::shared_ptr<node>> subtree, int o
         }
         nodes[s->hierarchy].erase(s->mac);
         nodes[new_hierarchy].insert({s->mac, s});
+
+        // Radios are also keyed by their RUID, move that key along
+        auto ruid_key = get_node_key(s->parent_mac, s->radio_identifier);
+        auto ruid_it  = nodes[s->hierarchy].find(ruid_key);
+        if (ruid_it != nodes[s->hierarchy].end() && ruid_it->second == s) {
+            nodes[s->hierarchy].erase(ruid_it);
+            nodes[new_hierarchy].insert({ruid_key, s});
+        }
+
         s->hierarchy = new_hierarchy;
     }
 }
@@ -4321,19 +4348,18 @@ void db::set_prplmesh(const sMacAddr &mac)
 
 bool db::update_client_entry_in_persistent_db(const sMacAddr &mac, const ValuesMap &values_map)
 {
-    auto db_entry        = client_db_entry_from_mac(mac);
-    auto type_client_str = type_to_string(beerocks::eType::TYPE_CLIENT);
+    auto db_entry = client_db_entry_from_mac(mac);
 
-    if (!bpl::db_has_entry(type_client_str, db_entry)) {
+    if (!m_persistent_db_writer.has_entry(db_entry)) {
         if (!add_client_to_persistent_db(mac, values_map)) {
             LOG(ERROR) << "failed to add client entry in persistent-db for " << mac;
             return false;
         }
-    } else if (!bpl::db_set_entry(type_client_str, db_entry, values_map)) {
-        LOG(ERROR) << "failed to set client in persistent-db for " << mac;
-        return false;
+        return true;
     }
 
+    // Coalesced with the other pending updates of the client, written behind
+    m_persistent_db_writer.set_entry(db_entry, values_map);
     return true;
 }
 
@@ -4397,10 +4423,7 @@ bool db::set_node_params_from_map(const sMacAddr &mac, const ValuesMap &values_m
 bool db::add_client_entry_and_update_counter(const std::string &entry_name,
                                              const ValuesMap &values_map)
 {
-    if (!bpl::db_add_entry(type_to_string(beerocks::eType::TYPE_CLIENT), entry_name, values_map)) {
-        LOG(ERROR) << "failed to add client entry " << entry_name << " to persistent db";
-        return false;
-    }
+    m_persistent_db_writer.add_entry(entry_name, values_map);
 
     ++m_persistent_db_clients_count;
 
@@ -4409,10 +4432,8 @@ bool db::add_client_entry_and_update_counter(const std::string &entry_name,
 
 bool db::remove_client_entry_and_update_counter(const std::string &entry_name)
 {
-    if (!bpl::db_remove_entry(type_to_string(beerocks::eType::TYPE_CLIENT), entry_name)) {
-        LOG(ERROR) << "failed to remove entry " << entry_name << "from persistent db";
-        return false;
-    }
+    m_persistent_db_writer.remove_entry(entry_name);
+
     --m_persistent_db_clients_count;
 
     return true;
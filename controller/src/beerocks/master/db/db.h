@@ -10,6 +10,8 @@
 #define _DB_H_
 
 #include "node.h"
+#include "persistent_db_writer.h"
+#include "topology_graph.h"
 
 #include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_logging.h>
@@ -158,7 +160,8 @@ public:
     } sDbMasterSettings;
 
     db(sDbMasterConfig &config_, beerocks::logging &logger_, const std::string &local_bridge_mac)
-        : config(config_), logger(logger_), m_local_bridge_mac(local_bridge_mac)
+        : config(config_), logger(logger_), m_local_bridge_mac(local_bridge_mac),
+          m_persistent_db_writer(type_to_string(beerocks::eType::TYPE_CLIENT))
     {
         settings.enable_dfs_reentry &= config_.load_dfs_reentry;
         settings.client_band_steering &= config_.load_client_band_steering;
@@ -317,6 +320,16 @@ public:
     std::set<std::string> get_nodes_from_hierarchy(int hierarchy, int type = -1);
     std::string get_gw_mac();
     std::set<std::string> get_node_subtree(const std::string &mac);
+
+    /**
+     * @brief Check if a node is part of the subtree of another node.
+     * Answered from the topology index without building the subtree.
+     *
+     * @param root_mac MAC address of the subtree root node.
+     * @param mac MAC address of the node to check.
+     * @return true if mac is a descendant of root_mac, false otherwise.
+     */
+    bool is_node_in_subtree(const std::string &root_mac, const std::string &mac);
     std::string get_node_parent(const std::string &mac);
 
     std::string get_node_parent_hostap(const std::string &mac);
@@ -622,6 +635,7 @@ public:
 
     /**
      * @brief Adds a new scan result to the current scan results
+     * A result for a BSSID already reported in the current scan replaces the stored one.
      * 
      * @param mac:         MAC address of radio
      * @param scan_result: Scan result to be added to current scan results
@@ -637,10 +651,30 @@ public:
      * 
      * @param mac:         MAC address of radio
      * @param single_scan: Indicated if to use single scan or continuous
-     * @return const std::list<sChannelScanResults>& 
+     * @return const channel_scan_result_ring& referencing the stored results, valid until the
+     * next change of the radio scan results
+     */
+    const channel_scan_result_ring &get_channel_scan_results(const sMacAddr &mac,
+                                                             bool single_scan);
+
+    /**
+     * @brief Rank the supported channels of a radio using its last channel scan results
+     * 
+     * @param mac:         MAC address of radio
+     * @param single_scan: Indicated if to use single scan or continuous results
+     * @return true on success
+     * @return false on failure 
      */
-    const std::list<sChannelScanResults> &get_channel_scan_results(const sMacAddr &mac,
-                                                                   bool single_scan);
+    bool update_channel_ranking(const sMacAddr &mac, bool single_scan);
+
+    /**
+     * @brief Get the channel ranking computed by the last update_channel_ranking()
+     * 
+     * @param mac:         MAC address of radio
+     * @return const std::vector<channel_ranking::sChannelRank>& sorted from best to worst,
+     * empty if no ranking is available
+     */
+    const std::vector<channel_ranking::sChannelRank> &get_channel_ranking(const sMacAddr &mac);
 
     //
     // Client Persistent Data
@@ -791,6 +825,15 @@ public:
      */
     bool load_persistent_db_clients();
 
+    /**
+     * @brief Start writing the persistent db updates behind, from a worker thread.
+     * To be called once the clients are loaded, the worker being the only user of the
+     * persistent db afterwards. Updates queued before are written on its first flush.
+     *
+     * @return true on success, otherwise false.
+     */
+    bool start_persistent_db_writer();
+
     /**
      * @brief Get the clients with persistent data configured object
      * 
@@ -1082,7 +1125,6 @@ private:
     std::shared_ptr<node::radio> get_hostap_by_mac(const sMacAddr &mac);
     int get_node_hierarchy(std::shared_ptr<node> n);
     std::set<std::shared_ptr<node>> get_node_subtree(std::shared_ptr<node> n);
-    void adjust_subtree_hierarchy(std::shared_ptr<node> n);
     void adjust_subtree_hierarchy(std::set<std::shared_ptr<node>> subtree, int offset);
     std::set<std::shared_ptr<node>> get_node_children(std::shared_ptr<node> n,
                                                       int type               = beerocks::TYPE_ANY,
@@ -1114,6 +1156,7 @@ private:
 
     /**
      * @brief Adds a client entry to persistent_db with configured parameters and increments clients counter.
+     * The entry is written behind by m_persistent_db_writer.
      * 
      * @param entry_name Client entry name in persistent db.
      * @param values_map A map of client params and their values.
@@ -1124,6 +1167,7 @@ private:
 
     /**
      * @brief Removes a client entry from persistent_db and decrements clients counter.
+     * The entry is removed behind by m_persistent_db_writer.
      * 
      * @param entry_name Client entry name in persistent db.
      * @return true on success, otherwise false.
@@ -1160,6 +1204,12 @@ private:
 
     std::unordered_map<std::string, std::shared_ptr<node>> nodes[beerocks::HIERARCHY_MAX];
 
+    /*
+     * Parent/children index of the nodes above, kept in sync by add_node() and remove_node().
+     * Used for subtree, children and siblings queries instead of scanning the hierarchy maps.
+     */
+    topology_graph m_topology;
+
     std::queue<std::string> disconnected_slave_mac_queue;
 
     int slaves_stop_on_failure_attempts = 0;
@@ -1209,6 +1259,12 @@ private:
     const std::string m_local_bridge_mac;
 
     int m_persistent_db_clients_count = 0;
+
+    /*
+     * Client entries of the persistent db, written behind from a worker thread so that
+     * updates of the client persistent parameters don't block the master thread.
+     */
+    persistent_db_writer m_persistent_db_writer;
 };
 
 } // namespace son
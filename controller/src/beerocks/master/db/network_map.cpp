@@ -27,50 +27,53 @@ using namespace son;
 void network_map::send_bml_network_map_message(db &database, Socket *sd,
                                                ieee1905_1::CmduMessageTx &cmdu_tx, uint16_t id)
 {
-    auto response =
-        message_com::create_vs_message<beerocks_message::cACTION_BML_NW_MAP_RESPONSE>(cmdu_tx, id);
-    if (response == nullptr) {
-        LOG(ERROR) << "Failed building ACTION_BML_NW_MAP_BRIDGE_RESPONSE message!";
-        return;
-    }
+    std::shared_ptr<beerocks_message::cACTION_BML_NW_MAP_RESPONSE> response;
 
-    auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
+    // Sends the message built so far (if any) and starts a new one
+    auto split = [&]() -> bool {
+        if (response && !message_com::send_cmdu(sd, cmdu_tx)) {
+            LOG(ERROR) << "Failed sending ACTION_BML_NW_MAP_RESPONSE message!";
+            return false;
+        }
 
-    if (!beerocks_header) {
-        LOG(ERROR) << "Failed getting beerocks_header!";
+        response = message_com::create_vs_message<beerocks_message::cACTION_BML_NW_MAP_RESPONSE>(
+            cmdu_tx, id);
+        if (!response) {
+            LOG(ERROR) << "Failed building ACTION_BML_NW_MAP_RESPONSE message!";
+            return false;
+        }
+
+        auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
+        if (!beerocks_header) {
+            LOG(ERROR) << "Failed getting beerocks_header!";
+            return false;
+        }
+
+        beerocks_header->actionhdr()->last() = 0;
+        response->node_num()                 = 0;
+        return true;
+    };
+
+    if (!split()) {
         return;
     }
 
-    beerocks_header->actionhdr()->last() = 0;
-
-    uint8_t *data_start = nullptr;
-    // std::ptrdiff_t size=0, size_left=0, node_len=0;
     const size_t gwIreNodeSize  = sizeof(BML_NODE);
     const size_t clientNodeSize = sizeof(BML_NODE) - sizeof(BML_NODE::N_DATA::N_GW_IRE);
 
-    std::ptrdiff_t size = 0, size_left = 0, node_len = 0;
-    uint32_t &num_of_nodes = response->node_num();
-    num_of_nodes           = 0;
-
     database.rewind();
-    bool last          = false;
-    bool get_next_node = true;
-    beerocks::eType n_type;
+    bool last = false;
     std::shared_ptr<node> n;
 
     // because of virtual nodes (vap nodes) are poiting to the radio node,
     // we want to save the in a list in order to not count them multiple times as the same mac.
     std::unordered_set<std::string> ap_list;
 
-    while (!last || !get_next_node) {
-        if (get_next_node) {
-            n    = nullptr;
-            last = database.get_next_node(n);
-        }
-        // LOG(DEBUG) << "last = " << last << " get_next_node=" << get_next_node;
+    while (!last) {
+        n    = nullptr;
+        last = database.get_next_node(n);
 
         if (n == nullptr) {
-            // LOG(DEBUG) << "n == nullptr";
             continue;
         }
 
@@ -84,65 +87,39 @@ void network_map::send_bml_network_map_message(db &database, Socket *sd,
                 continue;
             }
         }
-        size_left = beerocks_header->getMessageBuffLength() - beerocks_header->getMessageLength();
-
-        // LOG(DEBUG) << "num_of_nodes = " << num_of_nodes << ", size = " << int(size) << ", size_left = " << int(size_left);
 
-        n_type = n->get_type();
-        if (n->state == beerocks::STATE_CONNECTED &&
-            (n_type == beerocks::TYPE_CLIENT || n_type == beerocks::TYPE_IRE ||
-             n_type == beerocks::TYPE_GW)) {
-
-            if (n_type == beerocks::TYPE_CLIENT) {
-                node_len = clientNodeSize;
-            } else {
-                node_len = gwIreNodeSize;
-            }
-
-            if (node_len > size_left && num_of_nodes == 0) {
-                LOG(ERROR) << "node size is bigger than buffer size";
-                return;
-            } else if (node_len > size_left) {
-                message_com::send_cmdu(sd, cmdu_tx);
-
-                get_next_node = false;
-                response =
-                    message_com::create_vs_message<beerocks_message::cACTION_BML_NW_MAP_RESPONSE>(
-                        cmdu_tx, id);
-
-                if (response == nullptr) {
-                    LOG(ERROR) << "Failed building message!";
-                    return;
-                }
+        auto n_type = n->get_type();
+        if (n->state != beerocks::STATE_CONNECTED ||
+            (n_type != beerocks::TYPE_CLIENT && n_type != beerocks::TYPE_IRE &&
+             n_type != beerocks::TYPE_GW)) {
+            continue;
+        }
 
-                beerocks_header                      = message_com::get_beerocks_header(cmdu_tx);
-                beerocks_header->actionhdr()->last() = 0;
-                num_of_nodes = response->node_num(); // prepare for next message
-                num_of_nodes = 0;
-                data_start   = nullptr;
-                size         = 0;
-            } else {
-                if (!response->alloc_buffer(node_len)) {
-                    LOG(ERROR) << "Failed allocating buffer!";
-                    return;
-                }
+        std::ptrdiff_t node_len =
+            (n_type == beerocks::TYPE_CLIENT) ? clientNodeSize : gwIreNodeSize;
+        if (!cmdu_tx.make_room(node_len, split)) {
+            LOG(ERROR) << "Failed adding node " << n->mac << " to the network map";
+            return;
+        }
 
-                if (data_start == nullptr) {
-                    data_start = (uint8_t *)response->buffer(0);
-                }
+        size_t offset = response->buffer_size();
+        if (!response->alloc_buffer(node_len)) {
+            LOG(ERROR) << "Failed allocating buffer!";
+            return;
+        }
 
-                fill_bml_node_data(database, n, data_start + size, size_left);
+        fill_bml_node_data(database, n, (uint8_t *)response->buffer() + offset, node_len);
+        response->node_num()++;
+    }
 
-                num_of_nodes++;
-                size += node_len;
-                get_next_node = true;
-            }
-        }
+    auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
+    if (!beerocks_header) {
+        LOG(ERROR) << "Failed getting beerocks_header!";
+        return;
     }
 
     beerocks_header->actionhdr()->last() = 1;
     message_com::send_cmdu(sd, cmdu_tx);
-    //LOG(DEBUG) << "sending message, last=1";
 }
 
 std::ptrdiff_t network_map::fill_bml_node_data(db &database, std::string node_mac,
@@ -313,146 +290,104 @@ void network_map::send_bml_nodes_statistics_message_to_listeners(
     db &database, ieee1905_1::CmduMessageTx &cmdu_tx, std::vector<Socket *> bml_listeners,
     std::set<std::string> valid_hostaps)
 {
-    auto response =
-        message_com::create_vs_message<beerocks_message::cACTION_BML_STATS_UPDATE>(cmdu_tx);
-    if (response == nullptr) {
-        LOG(ERROR) << "Failed building ACTION_BML_STATS_UPDATE message!";
-        return;
-    }
+    std::shared_ptr<beerocks_message::cACTION_BML_STATS_UPDATE> response;
 
-    auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
-    if (!beerocks_header) {
-        LOG(ERROR) << "Failed getting beerocks_header!";
-        return;
-    }
-    beerocks_header->actionhdr()->last() = 0;
-
-    // nodes iterating
-    //LOG(DEBUG) << "send_bml_nodes_statistics_message, buf_size " << int(tx_buffer_size);
-    uint8_t *data_start = nullptr;
-    std::ptrdiff_t size = 0, size_left = 0, node_len = 0;
-
-    const auto reserved_size =
-        message_com::get_vs_cmdu_size_on_buffer<beerocks_message::cACTION_BML_STATS_UPDATE>();
-
-    // Save room in the output buffer for the number of transmitted nodes
-    uint32_t &num_of_stats_bulks = response->num_of_stats_bulks();
-    num_of_stats_bulks           = 0;
-
-    //LOG(DEBUG) << "tx_buffer = " << int(tx_buffer) << ", data_start = " << int(data_start);
-
-    int get_next_node = 1;
-    beerocks::eType n_type;
-    std::shared_ptr<node> n;
-
-    // common function definition ///////////////////////////////////////////////
-    auto fill_and_send = [&](std::ptrdiff_t &size, std::ptrdiff_t &size_left,
-                             std::ptrdiff_t &node_len, const uint16_t reserved_size,
-                             uint8_t *&data_start) -> int {
-        size_left = cmdu_tx.getMessageBuffLength() - reserved_size - size;
-        //LOG(DEBUG) << "num_of_stats_bulks = " << num_of_stats_bulks << ", size = " << int(size) << ", size_left = " << int(size_left);
+    // Sends the message built so far (if any) to all listeners and starts a new one
+    auto split = [&]() -> bool {
+        if (response) {
+            send_bml_event_to_listeners(cmdu_tx, bml_listeners);
+        }
 
-        size_t node_size = get_bml_node_statistics_len(n);
-        response->alloc_buffer(node_size);
+        response =
+            message_com::create_vs_message<beerocks_message::cACTION_BML_STATS_UPDATE>(cmdu_tx);
+        if (!response) {
+            LOG(ERROR) << "Failed building ACTION_BML_STATS_UPDATE message!";
+            return false;
+        }
 
-        if (data_start == nullptr) {
-            data_start = (uint8_t *)response->buffer(0);
+        auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
+        if (!beerocks_header) {
+            LOG(ERROR) << "Failed getting beerocks_header!";
+            return false;
         }
 
-        if (((reserved_size + size + node_size) >
-             cmdu_tx.getMessageBuffLength()) || // No more size on the buffer
-            !(node_len = fill_bml_node_statistics(database, n, data_start + size, size_left))) {
-            if (num_of_stats_bulks == 0) {
-                LOG(ERROR) << "node size is bigger than buffer size";
-                return -1;
-            }
+        beerocks_header->actionhdr()->last() = 0;
+        response->num_of_stats_bulks()       = 0;
+        return true;
+    };
 
-            //LOG(DEBUG) << "sending message, last=0";
-            // sending to all listeners
-            send_bml_event_to_listeners(cmdu_tx, bml_listeners);
+    // Adds the statistics of a node to the message, splitting it when full
+    auto add_node_statistics = [&](std::shared_ptr<node> n) -> bool {
+        auto node_len = get_bml_node_statistics_len(n);
+        if (!node_len) {
+            return true;
+        }
 
-            // prepare for next message
-            response =
-                message_com::create_vs_message<beerocks_message::cACTION_BML_STATS_UPDATE>(cmdu_tx);
+        if (!cmdu_tx.make_room(node_len, split)) {
+            LOG(ERROR) << "Failed adding the statistics of node " << n->mac;
+            return false;
+        }
 
-            if (response == nullptr) {
-                LOG(ERROR) << "Failed building message!";
-                return -1;
-            }
+        size_t offset = response->buffer_size();
+        if (!response->alloc_buffer(node_len)) {
+            LOG(ERROR) << "Failed allocating buffer!";
+            return false;
+        }
 
-            beerocks_header                      = message_com::get_beerocks_header(cmdu_tx);
-            beerocks_header->actionhdr()->last() = 0;
-            num_of_stats_bulks                   = response->num_of_stats_bulks();
-            num_of_stats_bulks                   = 0;
-            get_next_node                        = 0;
-            size                                 = 0;
-        } else {
-            //LOG(DEBUG) << "node_len = " << int(node_len);
-            num_of_stats_bulks++;
-            size += node_len;
-            get_next_node = 1;
+        if (!fill_bml_node_statistics(database, n, (uint8_t *)response->buffer() + offset,
+                                      node_len)) {
+            LOG(ERROR) << "Failed filling the statistics of node " << n->mac;
+            return false;
         }
-        return get_next_node;
+
+        response->num_of_stats_bulks()++;
+        return true;
     };
-    /////////////////////////////////////////////////////////////////////////
+
+    if (!split()) {
+        return;
+    }
 
     // nodes iterating
-    for (auto radio = valid_hostaps.begin(); radio != valid_hostaps.end();) {
-        std::string hostap_mac = *radio;
-        // LOG(DEBUG) << "radio mac = " << hostap_mac;
-        n = database.get_node(hostap_mac);
+    for (const auto &hostap_mac : valid_hostaps) {
+        auto n = database.get_node(hostap_mac);
         if (!n) {
             LOG(ERROR) << "n == nullptr";
             continue;
         }
-        n_type = n->get_type();
-        if ((n != nullptr && n->state == beerocks::STATE_CONNECTED) &&
-            (n_type == beerocks::TYPE_SLAVE)) {
 
-            get_next_node = fill_and_send(size, size_left, node_len, reserved_size, data_start);
-            if (get_next_node == 0) {
+        if (n->state != beerocks::STATE_CONNECTED || n->get_type() != beerocks::TYPE_SLAVE) {
+            continue;
+        }
+
+        if (!add_node_statistics(n)) {
+            return;
+        }
+
+        // sta's
+        for (const auto &sta_mac : database.get_node_children(hostap_mac)) {
+            auto sta = database.get_node(sta_mac);
+            if (!sta) {
+                LOG(ERROR) << "n == nullptr";
                 continue;
-            } else if (get_next_node < 0) {
-                return;
             }
 
-            // sta's
-            auto sta_clients = database.get_node_children(hostap_mac);
-            for (auto sta = sta_clients.begin(); sta != sta_clients.end();) {
-                std::string sta_mac = *sta;
-                // LOG(DEBUG) << "sta mac = " << sta_mac;
-                n = database.get_node(sta_mac);
-                if (n == nullptr) {
-                    LOG(ERROR) << "n == nullptr";
-                    continue;
-                }
-                if (n != nullptr && n->state == beerocks::STATE_CONNECTED) {
-                    get_next_node =
-                        fill_and_send(size, size_left, node_len, reserved_size, data_start);
-                    if (get_next_node == 0) {
-                        continue;
-                    } else if (get_next_node < 0) {
-                        return;
-                    }
-                }
-
-                if (get_next_node) {
-                    ++sta;
-                }
+            if (sta->state == beerocks::STATE_CONNECTED && !add_node_statistics(sta)) {
+                return;
             }
         }
+    }
 
-        if (get_next_node) {
-            ++radio;
-        }
+    auto beerocks_header = message_com::get_beerocks_header(cmdu_tx);
+    if (!beerocks_header) {
+        LOG(ERROR) << "Failed getting beerocks_header!";
+        return;
     }
 
     beerocks_header->actionhdr()->last() = 1;
 
-    //LOG(DEBUG) << "sending message, last=0";
     // sending to all listeners
     send_bml_event_to_listeners(cmdu_tx, bml_listeners);
-    //LOG(DEBUG) << "sending message, last=1";
 }
 
 void network_map::send_bml_event_to_listeners(ieee1905_1::CmduMessageTx &cmdu_tx,
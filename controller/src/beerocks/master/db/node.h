@@ -10,6 +10,8 @@
 #define _NODE_H_
 
 #include "../tasks/task.h"
+#include "channel_ranking.h"
+#include "channel_scan_result_ring.h"
 #include <bcl/network/network_utils.h>
 #include <tlvf/common/sMacAddr.h>
 #include <tlvf/ieee_1905_1/tlvReceiverLinkMetric.h>
@@ -214,8 +216,7 @@ public:
          */
         channel_scan_config continuous_scan_config; /**< continues scan configuration */
         channel_scan_status continuous_scan_status; /**< continues scan status        */
-        std::list<beerocks_message::sChannelScanResults>
-            continuous_scan_results; /**< continues scan results list  */
+        channel_scan_result_ring continuous_scan_results; /**< continues scan results ring  */
 
         /**
          * These members are part of the single channel scan.
@@ -223,8 +224,13 @@ public:
          */
         channel_scan_config single_scan_config; /**< single scan configuration */
         channel_scan_status single_scan_status; /**< single scan status        */
-        std::list<beerocks_message::sChannelScanResults>
-            single_scan_results; /**< single scan results list  */
+        channel_scan_result_ring single_scan_results; /**< single scan results ring  */
+
+        /**
+         * Supported channels ranked by the interference measured in the last scan,
+         * best candidate first. Empty until the first scan results are ranked.
+         */
+        std::vector<channel_ranking::sChannelRank> ranked_channels;
     };
     std::shared_ptr<radio> hostap;
 
@@ -0,0 +1,298 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "persistent_db_writer.h"
+
+#include <bpl/bpl_db.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace son;
+
+constexpr size_t persistent_db_writer::MAX_PENDING;
+constexpr std::chrono::milliseconds persistent_db_writer::FLUSH_INTERVAL;
+constexpr unsigned persistent_db_writer::MAX_WRITE_ATTEMPTS;
+
+persistent_db_writer::persistent_db_writer(const std::string &entry_type)
+    : m_entry_type(entry_type)
+{
+    thread_name = "persistent_db_writer";
+}
+
+persistent_db_writer::~persistent_db_writer()
+{
+    // Stop the worker before the members it uses are destroyed, it flushes the queue on its way
+    // out. Updates queued while it was never started are flushed here.
+    stop();
+    flush();
+}
+
+bool persistent_db_writer::load(std::unordered_map<std::string, ValuesMap> &entries)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    if (!beerocks::bpl::db_get_entries_by_type(m_entry_type, entries)) {
+        LOG(ERROR) << "Failed to get all " << m_entry_type << " entries from persistent DB";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.reserve(entries.size());
+    for (const auto &entry : entries) {
+        m_entries.insert(entry.first);
+    }
+
+    LOG(DEBUG) << "Loaded " << entries.size() << " " << m_entry_type << " entries in "
+               << std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count()
+               << " us";
+    return true;
+}
+
+bool persistent_db_writer::has_entry(const std::string &entry_name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.find(entry_name) != m_entries.end();
+}
+
+bool persistent_db_writer::has_entry_of_other_type(const std::string &entry_name)
+{
+    std::lock_guard<std::mutex> write_lock(m_write_mutex);
+    return !beerocks::bpl::db_has_entry(m_entry_type, entry_name) &&
+           beerocks::bpl::db_has_entry(std::string(), entry_name);
+}
+
+void persistent_db_writer::add_entry(const std::string &entry_name, const ValuesMap &values_map)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.insert(entry_name);
+
+    auto &pending = m_pending[entry_name];
+    pending.write = true;
+    for (const auto &value : values_map) {
+        pending.values[value.first] = value.second;
+    }
+    m_cv.notify_all();
+}
+
+void persistent_db_writer::set_entry(const std::string &entry_name, const ValuesMap &values_map)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto &pending = m_pending[entry_name];
+    if (pending.write) {
+        m_coalesced_count++;
+    }
+    pending.write = true;
+    for (const auto &value : values_map) {
+        pending.values[value.first] = value.second;
+    }
+    m_cv.notify_all();
+}
+
+void persistent_db_writer::remove_entry(const std::string &entry_name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase(entry_name);
+
+    auto &pending  = m_pending[entry_name];
+    pending.remove = true;
+    pending.write  = false;
+    pending.values.clear();
+    m_cv.notify_all();
+}
+
+bool persistent_db_writer::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_worker_active) {
+        return flush_pending(lock);
+    }
+
+    // The updates queued so far are in the batch being written, if any, and in the next one
+    bool writing = m_batches_done < m_batches_started;
+    if (m_pending.empty() && !writing) {
+        return true;
+    }
+    auto first_batch = writing ? m_batches_started : m_batches_started + 1;
+    auto last_batch  = m_pending.empty() ? m_batches_started : m_batches_started + 1;
+
+    m_flush_requested = true;
+    m_cv.notify_all();
+    m_cv.wait(lock, [&] { return m_batches_done >= last_batch || !m_worker_active; });
+
+    // The worker writes the pending entries before it stops, this is only for a failed start
+    bool result = m_worker_active || flush_pending(lock);
+    return result && m_last_failed_batch < first_batch;
+}
+
+size_t persistent_db_writer::get_pending_count()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending.size();
+}
+
+int persistent_db_writer::take_count_correction()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto count_correction = m_count_correction;
+    m_count_correction    = 0;
+    return count_correction;
+}
+
+uint64_t persistent_db_writer::get_coalesced_count()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_coalesced_count;
+}
+
+bool persistent_db_writer::init()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_worker_active = true;
+    return true;
+}
+
+bool persistent_db_writer::work()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [&] { return should_stop || !m_pending.empty(); });
+    if (should_stop) {
+        return false;
+    }
+
+    // Let more updates of the same entries pile up, unless asked to flush or enough are pending
+    m_cv.wait_for(lock, FLUSH_INTERVAL, [&] {
+        return should_stop || m_flush_requested || m_pending.size() >= MAX_PENDING;
+    });
+
+    m_flush_requested = false;
+    flush_pending(lock);
+    m_cv.notify_all();
+    return true;
+}
+
+void persistent_db_writer::before_stop()
+{
+    // should_stop is already set, wake up the worker to see it
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cv.notify_all();
+}
+
+void persistent_db_writer::on_thread_stop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Failed writes are queued again, until given up
+    while (!m_pending.empty()) {
+        flush_pending(lock);
+    }
+    m_worker_active = false;
+    m_cv.notify_all();
+}
+
+bool persistent_db_writer::flush_pending(std::unique_lock<std::mutex> &lock)
+{
+    if (m_pending.empty()) {
+        return true;
+    }
+
+    std::unordered_map<std::string, sPendingEntry> pending;
+    pending.swap(m_pending);
+    auto batch = ++m_batches_started;
+    lock.unlock();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::string> failed;
+    for (const auto &entry : pending) {
+        std::lock_guard<std::mutex> write_lock(m_write_mutex);
+        if (!write_entry(entry.first, entry.second)) {
+            failed.push_back(entry.first);
+        }
+    }
+    LOG(DEBUG) << "Flushed " << pending.size() << " " << m_entry_type << " entries in "
+               << std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count()
+               << " us";
+
+    lock.lock();
+    for (const auto &entry_name : failed) {
+        requeue_entry(entry_name, pending[entry_name]);
+    }
+    m_batches_done = std::max(m_batches_done, batch);
+    if (!failed.empty()) {
+        m_last_failed_batch = std::max(m_last_failed_batch, batch);
+    }
+    return failed.empty();
+}
+
+void persistent_db_writer::requeue_entry(const std::string &entry_name, sPendingEntry &failed)
+{
+    failed.attempts++;
+
+    auto newer_it = m_pending.find(entry_name);
+    if (newer_it != m_pending.end()) {
+        auto &newer = newer_it->second;
+        if (newer.remove) {
+            // Replaces whatever was stored
+            return;
+        }
+        // The newer values go over the failed ones
+        for (const auto &value : newer.values) {
+            failed.values[value.first] = value.second;
+        }
+        failed.write |= newer.write;
+        newer = std::move(failed);
+        return;
+    }
+
+    if (failed.attempts < MAX_WRITE_ATTEMPTS) {
+        m_pending[entry_name] = std::move(failed);
+        return;
+    }
+
+    // Give up, and make the index follow the storage
+    bool stored = beerocks::bpl::db_has_entry(m_entry_type, entry_name);
+    LOG(ERROR) << "Giving up writing entry " << entry_name << " after " << failed.attempts
+               << " attempts, it is " << (stored ? "" : "not ") << "stored";
+    if (stored) {
+        m_entries.insert(entry_name);
+    } else {
+        m_entries.erase(entry_name);
+    }
+    if (stored != failed.write) {
+        m_count_correction += stored ? 1 : -1;
+    }
+}
+
+bool persistent_db_writer::write_entry(const std::string &entry_name,
+                                       const sPendingEntry &pending)
+{
+    if (pending.remove && !beerocks::bpl::db_remove_entry(m_entry_type, entry_name)) {
+        LOG(ERROR) << "Failed to remove entry " << entry_name << " from persistent db";
+        return false;
+    }
+    if (!pending.write) {
+        return true;
+    }
+
+    if (!pending.remove && beerocks::bpl::db_has_entry(m_entry_type, entry_name)) {
+        if (!beerocks::bpl::db_set_entry(m_entry_type, entry_name, pending.values)) {
+            LOG(ERROR) << "Failed to set entry " << entry_name << " in persistent db";
+            return false;
+        }
+    } else if (!beerocks::bpl::db_add_entry(m_entry_type, entry_name, pending.values)) {
+        LOG(ERROR) << "Failed to add entry " << entry_name << " to persistent db";
+        return false;
+    }
+    return true;
+}
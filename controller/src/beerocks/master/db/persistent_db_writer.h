@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _PERSISTENT_DB_WRITER_H_
+#define _PERSISTENT_DB_WRITER_H_
+
+#include <bcl/beerocks_thread_base.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace son {
+
+/**
+ * @brief Write-behind queue in front of the persistent db (bpl::db_*) for the entries of a
+ * single type.
+ *
+ * Updates are queued per entry and coalesced: any number of parameter updates of the same
+ * entry between two flushes end up as a single bpl::db_set_entry() call. A worker thread
+ * flushes the queue once MAX_PENDING entries are pending or FLUSH_INTERVAL passed since the
+ * first pending update, so the caller (the master thread) never blocks on the storage.
+ *
+ * The names of the stored entries are indexed in memory, so existence checks do not go to the
+ * storage either. While the worker thread is running, it is the only writer of the entry type.
+ *
+ * A failed write is queued again, under the updates of the same entry queued meanwhile, and
+ * given up after MAX_WRITE_ATTEMPTS. The index then follows the storage, and the difference
+ * with the queued state is reported by take_count_correction().
+ */
+class persistent_db_writer : public beerocks::thread_base {
+public:
+    using ValuesMap = std::unordered_map<std::string, std::string>;
+
+    static constexpr size_t MAX_PENDING                       = 64;
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL = std::chrono::milliseconds(1000);
+    static constexpr unsigned MAX_WRITE_ATTEMPTS              = 3;
+
+    explicit persistent_db_writer(const std::string &entry_type);
+    ~persistent_db_writer();
+
+    /**
+     * @brief Load all the stored entries in a single pass and index their names.
+     * Intended to be called once at startup, before any update is queued.
+     *
+     * @param[out] entries Stored entries with their parameters, by entry name.
+     * @return true on success, false otherwise.
+     */
+    bool load(std::unordered_map<std::string, ValuesMap> &entries);
+
+    /**
+     * @brief Check if an entry is stored (or queued to be stored).
+     */
+    bool has_entry(const std::string &entry_name);
+
+    /**
+     * @brief Check if an entry of another type with the same name is stored.
+     * Entry names are unique across the types, such an entry cannot be created.
+     */
+    bool has_entry_of_other_type(const std::string &entry_name);
+
+    /**
+     * @brief Queue the creation of an entry.
+     */
+    void add_entry(const std::string &entry_name, const ValuesMap &values_map);
+
+    /**
+     * @brief Queue an update of an entry's parameters, coalesced with the pending updates.
+     * An empty value removes the parameter.
+     */
+    void set_entry(const std::string &entry_name, const ValuesMap &values_map);
+
+    /**
+     * @brief Queue the removal of an entry, dropping its pending updates.
+     */
+    void remove_entry(const std::string &entry_name);
+
+    /**
+     * @brief Write all the pending updates and wait for them to be stored.
+     *
+     * @return true on success or if nothing is pending, false if any of the updates queued so far
+     * and not yet stored failed.
+     */
+    bool flush();
+
+    size_t get_pending_count();
+
+    /**
+     * @brief Take the difference between the number of stored entries and the number of entries
+     * queued to be stored, caused by the writes given up since the last call.
+     *
+     * @return Number of entries stored although their removal was queued, minus the number of
+     * entries not stored although their creation was queued.
+     */
+    int take_count_correction();
+
+    /**
+     * @brief Get the number of updates merged into an already pending update of the same entry.
+     */
+    uint64_t get_coalesced_count();
+
+protected:
+    bool init() override;
+    bool work() override;
+    void before_stop() override;
+    void on_thread_stop() override;
+
+private:
+    struct sPendingEntry {
+        // Remove the stored entry before writing the values
+        bool remove = false;
+        // Values to be written (created if the entry is not stored)
+        bool write = false;
+        ValuesMap values;
+        // Failed writes of the entry so far
+        unsigned attempts = 0;
+    };
+
+    /**
+     * @brief Write the pending entries to the persistent db, as a new batch.
+     * Called with m_mutex held through @a lock, which is released during the writes.
+     *
+     * @return true on success or if nothing is pending, false if any of the writes failed.
+     */
+    bool flush_pending(std::unique_lock<std::mutex> &lock);
+
+    bool write_entry(const std::string &entry_name, const sPendingEntry &pending);
+
+    /**
+     * @brief Queue a failed write again, or give it up after MAX_WRITE_ATTEMPTS.
+     * Called with m_mutex held.
+     */
+    void requeue_entry(const std::string &entry_name, sPendingEntry &failed);
+
+    const std::string m_entry_type;
+
+    std::mutex m_mutex;
+    // Held while writing an entry, so that reading the storage sees whole writes
+    std::mutex m_write_mutex;
+    std::condition_variable m_cv;
+    std::unordered_map<std::string, sPendingEntry> m_pending;
+    std::unordered_set<std::string> m_entries;
+    // Set from init() until the worker thread is done with its last flush
+    bool m_worker_active   = false;
+    bool m_flush_requested = false;
+
+    // Batches of pending entries written by flush_pending(), numbered from 1
+    uint64_t m_batches_started   = 0;
+    uint64_t m_batches_done      = 0;
+    uint64_t m_last_failed_batch = 0;
+
+    uint64_t m_coalesced_count = 0;
+    int m_count_correction     = 0;
+};
+
+} // namespace son
+
+#endif // _PERSISTENT_DB_WRITER_H_
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "topology_graph.h"
+
+#include <algorithm>
+
+using namespace son;
+
+bool topology_graph::set_parent(const std::string &key, const std::string &parent_key)
+{
+    auto it = m_nodes.find(key);
+    if (it != m_nodes.end() && it->second.parent == parent_key) {
+        return true;
+    }
+    if (!can_set_parent(key, parent_key)) {
+        return false;
+    }
+
+    if (it != m_nodes.end()) {
+        detach_from_parent(key, it->second.parent);
+    } else {
+        it = m_nodes.insert(std::make_pair(key, sGraphNode())).first;
+    }
+
+    it->second.parent = parent_key;
+    m_children[parent_key].push_back(key);
+    m_labels_valid = false;
+    return true;
+}
+
+bool topology_graph::can_set_parent(const std::string &key, const std::string &parent_key) const
+{
+    return key != parent_key && !is_ancestor(key, parent_key);
+}
+
+bool topology_graph::remove(const std::string &key)
+{
+    auto it = m_nodes.find(key);
+    if (it == m_nodes.end()) {
+        return false;
+    }
+    detach_from_parent(key, it->second.parent);
+    m_nodes.erase(it);
+    m_labels_valid = false;
+    return true;
+}
+
+bool topology_graph::has_node(const std::string &key) const
+{
+    return m_nodes.find(key) != m_nodes.end();
+}
+
+std::string topology_graph::get_parent(const std::string &key) const
+{
+    auto it = m_nodes.find(key);
+    if (it == m_nodes.end()) {
+        return std::string();
+    }
+    return it->second.parent;
+}
+
+const std::vector<std::string> &topology_graph::get_children(const std::string &key) const
+{
+    static const std::vector<std::string> no_children;
+    auto it = m_children.find(key);
+    if (it == m_children.end()) {
+        return no_children;
+    }
+    return it->second;
+}
+
+std::vector<std::string> topology_graph::get_subtree(const std::string &key)
+{
+    std::vector<std::string> subtree;
+
+    if (!has_node(key)) {
+        // Not a graph node (e.g. a VAP BSSID) - its children are still indexed by key
+        for (const auto &child : get_children(key)) {
+            subtree.push_back(child);
+            auto child_subtree = get_subtree(child);
+            subtree.insert(subtree.end(), child_subtree.begin(), child_subtree.end());
+        }
+        return subtree;
+    }
+
+    if (!m_labels_valid) {
+        rebuild_labels();
+    }
+
+    const auto &root = m_nodes[key];
+    subtree.assign(m_order.begin() + root.entry + 1, m_order.begin() + root.exit + 1);
+    return subtree;
+}
+
+bool topology_graph::is_in_subtree(const std::string &root_key, const std::string &key)
+{
+    auto root_it = m_nodes.find(root_key);
+    auto it      = m_nodes.find(key);
+    if (root_it == m_nodes.end() || it == m_nodes.end() || root_key == key) {
+        return false;
+    }
+
+    if (!m_labels_valid) {
+        rebuild_labels();
+    }
+
+    return (it->second.entry > root_it->second.entry && it->second.entry <= root_it->second.exit);
+}
+
+void topology_graph::clear()
+{
+    m_nodes.clear();
+    m_children.clear();
+    m_order.clear();
+    m_labels_valid = false;
+}
+
+//
+// PRIVATE FUNCTIONS
+//
+
+void topology_graph::detach_from_parent(const std::string &key, const std::string &parent_key)
+{
+    auto it = m_children.find(parent_key);
+    if (it == m_children.end()) {
+        return;
+    }
+    auto &siblings = it->second;
+    auto child_it  = std::find(siblings.begin(), siblings.end(), key);
+    if (child_it != siblings.end()) {
+        // Order of children is not significant, so swap with the last one instead of shifting
+        std::swap(*child_it, siblings.back());
+        siblings.pop_back();
+    }
+    if (siblings.empty()) {
+        m_children.erase(it);
+    }
+}
+
+bool topology_graph::is_ancestor(const std::string &ancestor_key, const std::string &key) const
+{
+    // Walk up the parent chain, the graph never contains loops so the walk is bounded by the
+    // depth of the tree. The counter is an additional safety net.
+    auto current = key;
+    for (size_t steps = 0; steps <= m_nodes.size(); steps++) {
+        auto it = m_nodes.find(current);
+        if (it == m_nodes.end()) {
+            return false;
+        }
+        if (it->second.parent == ancestor_key) {
+            return true;
+        }
+        current = it->second.parent;
+    }
+    return false;
+}
+
+void topology_graph::rebuild_labels()
+{
+    m_order.clear();
+    m_order.reserve(m_nodes.size());
+
+    // Roots are the nodes whose parent is not a graph node
+    for (const auto &graph_node : m_nodes) {
+        if (m_nodes.find(graph_node.second.parent) == m_nodes.end()) {
+            label_from(graph_node.first);
+        }
+    }
+
+    m_labels_valid = true;
+}
+
+void topology_graph::label_from(const std::string &root_key)
+{
+    // Iterative depth-first walk, each stack entry holds the node key and the index of the next
+    // child to visit
+    std::vector<std::pair<const std::string *, size_t>> stack;
+
+    auto enter = [&](const std::string &key) {
+        m_nodes[key].entry = m_order.size();
+        m_order.push_back(key);
+        stack.emplace_back(&key, 0);
+    };
+
+    enter(root_key);
+    while (!stack.empty()) {
+        auto &top            = stack.back();
+        const auto &children = get_children(*top.first);
+        if (top.second < children.size()) {
+            const auto &child = children[top.second++];
+            enter(child);
+        } else {
+            m_nodes[*top.first].exit = m_order.size() - 1;
+            stack.pop_back();
+        }
+    }
+}
@@ -0,0 +1,135 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TOPOLOGY_GRAPH_H_
+#define _TOPOLOGY_GRAPH_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace son {
+
+/**
+ * @brief Adjacency index of the controller topology tree.
+ *
+ * Every node is kept with its parent key and the list of its direct children, and both are
+ * updated incrementally when a node is added, moved or removed.
+ * On top of the adjacency lists the graph keeps Euler-tour interval labels (entry/exit order of
+ * a depth-first walk). The labels are rebuilt lazily, once after a batch of topology changes, so
+ * subtree membership is answered in O(1) and a subtree is listed in O(subtree size).
+ *
+ * Keys are the same strings used by the db nodes map (node MAC addresses).
+ * A parent key does not need to exist in the graph: clients are attached to VAP BSSIDs and
+ * nodes may be reported before their parent.
+ *
+ * The graph is not thread-safe, same as the db that owns it.
+ */
+class topology_graph {
+public:
+    /**
+     * @brief Add a node to the graph, or move it under a new parent.
+     * The subtree of the node moves along with it.
+     *
+     * @param key Node key.
+     * @param parent_key Key of the parent node, empty for a root node.
+     * @return false if the new parent is part of the node's subtree (the move would create a
+     * loop), true otherwise.
+     */
+    bool set_parent(const std::string &key, const std::string &parent_key);
+
+    /**
+     * @brief Check if set_parent() would accept a parent for a node, without changing the graph.
+     *
+     * @param key Node key.
+     * @param parent_key Key of the parent node.
+     * @return false if the parent is the node itself or part of its subtree, true otherwise.
+     */
+    bool can_set_parent(const std::string &key, const std::string &parent_key) const;
+
+    /**
+     * @brief Remove a node from the graph.
+     * Children of a removed node keep their parent key, so they are attached back when the node
+     * is added again.
+     *
+     * @param key Node key.
+     * @return true if the node existed, false otherwise.
+     */
+    bool remove(const std::string &key);
+
+    /**
+     * @brief Check if a node exists in the graph.
+     */
+    bool has_node(const std::string &key) const;
+
+    /**
+     * @brief Get the parent key of a node, empty string if the node does not exist.
+     */
+    std::string get_parent(const std::string &key) const;
+
+    /**
+     * @brief Get the direct children of a node.
+     *
+     * @param key Node key, does not need to exist in the graph.
+     * @return Reference to the children keys, empty if there are none.
+     * The reference is invalidated by the next change of the graph.
+     */
+    const std::vector<std::string> &get_children(const std::string &key) const;
+
+    /**
+     * @brief Get all the descendants of a node (not including the node itself).
+     * The keys are returned in depth-first order.
+     */
+    std::vector<std::string> get_subtree(const std::string &key);
+
+    /**
+     * @brief Check if a node is a descendant of another node.
+     *
+     * @param root_key Key of the subtree root.
+     * @param key Key of the node to check.
+     * @return true if key is a strict descendant of root_key, false otherwise.
+     */
+    bool is_in_subtree(const std::string &root_key, const std::string &key);
+
+    /**
+     * @brief Get the number of nodes in the graph.
+     */
+    size_t size() const { return m_nodes.size(); }
+
+    /**
+     * @brief Remove all the nodes from the graph.
+     */
+    void clear();
+
+private:
+    struct sGraphNode {
+        std::string parent;
+        // Euler-tour labels, valid only while m_labels_valid is set.
+        // The subtree of a node occupies the positions (entry, exit] of m_order.
+        size_t entry = 0;
+        size_t exit  = 0;
+    };
+
+    void detach_from_parent(const std::string &key, const std::string &parent_key);
+    bool is_ancestor(const std::string &ancestor_key, const std::string &key) const;
+    void rebuild_labels();
+    void label_from(const std::string &root_key);
+
+    std::unordered_map<std::string, sGraphNode> m_nodes;
+
+    // Children are kept per parent key and not inside sGraphNode since the parent may not
+    // exist (yet) in the graph.
+    std::unordered_map<std::string, std::vector<std::string>> m_children;
+
+    std::vector<std::string> m_order;
+    bool m_labels_valid = false;
+};
+
+} // namespace son
+
+#endif
@@ -1871,8 +1871,8 @@ void son_management::handle_bml_message(Socket *sd,
         }
 
         // Get results
-        auto scan_results      = database.get_channel_scan_results(radio_mac, is_single_scan);
-        auto scan_results_size = scan_results.size();
+        const auto &scan_results = database.get_channel_scan_results(radio_mac, is_single_scan);
+        auto scan_results_size   = scan_results.size();
 
         LOG(DEBUG) << "scan_results received for hostap_mac= " << radio_mac << std::endl
                    << "scan_results_size= " << scan_results_size;
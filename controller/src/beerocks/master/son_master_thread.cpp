@@ -26,6 +26,7 @@
 #include "tasks/network_health_check_task.h"
 
 #include <bcl/beerocks_backport.h>
+#include <bcl/beerocks_metrics.h>
 #include <bcl/beerocks_version.h>
 #include <bcl/son/son_wireless_utils.h>
 #include <easylogging++.h>
@@ -72,6 +73,43 @@ using namespace beerocks;
 using namespace net;
 using namespace son;
 
+/**
+ * Labeled with the message type for 1905 messages, and with the action and action op for
+ * vendor specific messages (e.g. "vs_2_17").
+ */
+static metrics::histogram_family
+    s_cmdu_handling_time("master_cmdu_handling_usec", "type",
+                         "Time spent by the controller handling a CMDU");
+
+/**
+ * Key of the handling time histogram of a vendor specific message, see
+ * get_cmdu_handling_histogram(). 1905 message types are 16 bits long.
+ */
+static uint32_t vs_cmdu_handling_key(uint8_t action, uint8_t action_op)
+{
+    return 0x10000 | (uint32_t(action) << 8) | action_op;
+}
+
+/**
+ * @brief Gets the handling time histogram of a message, resolved once per message type since
+ * histogram_family::get() takes a lock and builds the label.
+ *
+ * @param key 1905 message type, or vs_cmdu_handling_key() of a vendor specific message.
+ */
+static metrics::histogram &get_cmdu_handling_histogram(uint32_t key)
+{
+    // Only used by the master thread
+    static std::unordered_map<uint32_t, metrics::histogram *> s_histograms;
+    auto &histogram = s_histograms[key];
+    if (!histogram) {
+        histogram = (key & 0x10000)
+                        ? &s_cmdu_handling_time.get("vs_" + std::to_string((key >> 8) & 0xff) +
+                                                    "_" + std::to_string(key & 0xff))
+                        : &s_cmdu_handling_time.get(key);
+    }
+    return *histogram;
+}
+
 master_thread::master_thread(const std::string &master_uds_, db &database_)
     : transport_socket_thread(master_uds_), database(database_),
       m_controller_ucc_listener(database_, cert_cmdu_tx)
@@ -96,6 +134,10 @@ bool master_thread::init()
         } else {
             LOG(DEBUG) << "load clients from persistent db finished successfully";
         }
+
+        if (!database.start_persistent_db_writer()) {
+            LOG(ERROR) << "failed to start the persistent db writer";
+        }
     }
 
     if (!transport_socket_thread::init()) {
@@ -251,6 +293,7 @@ bool master_thread::handle_cmdu(Socket *sd, ieee1905_1::CmduMessageRx &cmdu_rx)
         // If VS message was sent by Controllers local agent to the controller, it is looped back.
     }
 
+    auto handling_start  = std::chrono::steady_clock::now();
     bool vendor_specific = false;
 
     if (cmdu_rx.getMessageType() == ieee1905_1::eMessageType::VENDOR_SPECIFIC_MESSAGE) {
@@ -277,9 +320,14 @@ bool master_thread::handle_cmdu(Socket *sd, ieee1905_1::CmduMessageRx &cmdu_rx)
             LOG(ERROR) << "Unknown message, action: " << int(beerocks_header->action());
         }
         }
+        get_cmdu_handling_histogram(
+            vs_cmdu_handling_key(beerocks_header->action(), beerocks_header->action_op()))
+            .observe(std::chrono::steady_clock::now() - handling_start);
     } else {
         LOG(DEBUG) << "received 1905.1 cmdu message";
         handle_cmdu_1905_1_message(src_mac, cmdu_rx);
+        get_cmdu_handling_histogram(uint32_t(cmdu_rx.getMessageType()))
+            .observe(std::chrono::steady_clock::now() - handling_start);
     }
 
     return true;
@@ -1541,29 +1541,38 @@ bool channel_selection_task::ccl_fill_channel_switch_request_with_least_used_cha
                         << " channel_switch_request.vht_center_frequency = "
                         << int(channel_switch_request.vht_center_frequency);
     } else {
-        //multiple candidate find lowest score
+        //multiple candidate find lowest score, equal scores are resolved by the scan ranking
         uint8_t min_channel_score         = 255;
         uint8_t min_channel_score_gw_band = 255;
+        double min_channel_cost           = 0;
+        double min_channel_cost_gw_band   = 0;
         auto it_min_gw_band               = min_channels.begin();
         auto it_min                       = min_channels.begin();
         //for(auto min_ch : min_channels) {
         for (auto it = min_channels.begin(); it != min_channels.end(); ++it) {
+            auto cost = get_channel_interference_cost(it->first);
             TASK_LOG(DEBUG) << "min_channel.first = " << int(it->first)
                             << " min_channel.second.score = " << int(it->second.score)
                             << " min_channel.second.channel_ext_above_secondary = "
-                            << int(it->second.channel_ext_above_secondary);
+                            << int(it->second.channel_ext_above_secondary)
+                            << " interference cost = " << cost;
             auto gw_slave_5G_channel = get_gw_slave_5g_channel();
             TASK_LOG(DEBUG) << "gw_slave_5G_channel = " << int(gw_slave_5G_channel);
             if (gw_slave_5G_channel != 0 &&
                 (wireless_utils::is_high_subband(it->first) ==
                  wireless_utils::is_high_subband(gw_slave_5G_channel))) {
-                if (it->second.score < min_channel_score_gw_band) {
+                if (it->second.score < min_channel_score_gw_band ||
+                    (it->second.score == min_channel_score_gw_band &&
+                     cost < min_channel_cost_gw_band)) {
                     min_channel_score_gw_band = it->second.score;
+                    min_channel_cost_gw_band  = cost;
                     it_min_gw_band            = it;
                 }
             } else {
-                if (it->second.score < min_channel_score) {
+                if (it->second.score < min_channel_score ||
+                    (it->second.score == min_channel_score && cost < min_channel_cost)) {
                     min_channel_score = it->second.score;
+                    min_channel_cost  = cost;
                     it_min            = it;
                 }
             }
@@ -1588,6 +1597,25 @@ bool channel_selection_task::ccl_fill_channel_switch_request_with_least_used_cha
     return true;
 }
 
+double channel_selection_task::get_channel_interference_cost(uint8_t channel)
+{
+    // Prefer the cost of the 80MHz candidate, since the selected channel is aligned to 80MHz
+    const auto &ranking = database.get_channel_ranking(tlvf::mac_from_string(hostap_mac));
+    auto it = std::find_if(ranking.begin(), ranking.end(),
+                           [&](const channel_ranking::sChannelRank &rank) {
+                               return rank.channel == channel &&
+                                      rank.bandwidth == beerocks::BANDWIDTH_80;
+                           });
+    if (it == ranking.end()) {
+        it = std::find_if(ranking.begin(), ranking.end(),
+                          [&](const channel_ranking::sChannelRank &rank) {
+                              return rank.channel == channel;
+                          });
+    }
+    // Without scan results all the candidates are considered equal
+    return (it != ranking.end()) ? it->cost : 0;
+}
+
 bool channel_selection_task::fill_restricted_channels_from_ccl_and_supported(uint8_t *channel_list)
 {
     std::set<uint8_t> channel_list_set;
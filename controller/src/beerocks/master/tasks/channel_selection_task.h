@@ -142,6 +142,15 @@ private:
     bool ccl_has_free_dfs_channels(beerocks::eWiFiBandwidth bw);
     bool ccl_has_free_channels_2G();
     bool ccl_fill_channel_switch_request_with_least_used_channel();
+
+    /**
+     * @brief Get the interference cost of a channel from the last channel scan ranking of the
+     * hostap, used to choose between candidates with an equal usage score.
+     *
+     * @param channel Primary channel.
+     * @return Cost of the channel (lower is better), 0 if the channel is not ranked.
+     */
+    double get_channel_interference_cost(uint8_t channel);
     bool fill_restricted_channels_from_ccl_and_supported(uint8_t *channel_list);
     bool get_overlapping_channels_for_24G(uint8_t channel);
     void send_backhaul_reset();
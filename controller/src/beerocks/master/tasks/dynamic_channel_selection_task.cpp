@@ -201,6 +201,18 @@ void dynamic_channel_selection_task::work()
     case eState::SCAN_DONE: {
         LOG(TRACE) << "SCAN_DONE";
 
+        if (!database.update_channel_ranking(m_radio_mac, m_single_scan)) {
+            TASK_LOG(ERROR) << "failed to rank channels of radio " << m_radio_mac;
+        } else {
+            const auto &ranking = database.get_channel_ranking(m_radio_mac);
+            if (!ranking.empty()) {
+                TASK_LOG(DEBUG) << "best ranked channel=" << int(ranking.front().channel)
+                                << " bw=" << int(ranking.front().bandwidth)
+                                << " interference_dbm=" << ranking.front().interference_dbm
+                                << " out of " << ranking.size() << " candidates";
+            }
+        }
+
         //update next continuous scan time
         if (!m_single_scan) {
             auto interval =
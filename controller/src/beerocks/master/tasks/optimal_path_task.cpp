@@ -177,14 +177,15 @@ void optimal_path_task::work()
         }
 
         // build pending mac list //
-        auto ires    = database.get_all_connected_ires();
-        auto subtree = database.get_node_subtree(sta_mac);
+        auto ires = database.get_all_connected_ires();
 
         std::set<std::string> ires_outside_subtree;
         // insert all ires that outside the subtree to "ires_outside_subtree" , because it is impossible to move ire to a child ire. station doesn't has subtree.
-        std::set_difference(ires.begin(), ires.end(), subtree.begin(), subtree.end(),
-                            std::inserter(ires_outside_subtree, ires_outside_subtree.end()));
-        ires_outside_subtree.erase(sta_mac);
+        for (const auto &ire : ires) {
+            if (ire != sta_mac && !database.is_node_in_subtree(sta_mac, ire)) {
+                ires_outside_subtree.insert(ire);
+            }
+        }
         potential_11k_aps.clear();
 
         for (const auto &ire : ires_outside_subtree) {
@@ -670,14 +671,15 @@ void optimal_path_task::work()
             break;
         }
         //build pending mac list //
-        auto ires    = database.get_all_connected_ires();
-        auto subtree = database.get_node_subtree(sta_mac);
+        auto ires = database.get_all_connected_ires();
 
         std::set<std::string> ires_outside_subtree;
         // insert all ires that outside the subtree to "ires_outside_subtree" , because it is impossible to move ire to a child ire. station doesn't has subtree.
-        std::set_difference(ires.begin(), ires.end(), subtree.begin(), subtree.end(),
-                            std::inserter(ires_outside_subtree, ires_outside_subtree.end()));
-        ires_outside_subtree.erase(sta_mac);
+        for (const auto &ire : ires) {
+            if (ire != sta_mac && !database.is_node_in_subtree(sta_mac, ire)) {
+                ires_outside_subtree.insert(ire);
+            }
+        }
         auto channel = database.get_node_channel(sta_mac);
         bool found_band_match;
 
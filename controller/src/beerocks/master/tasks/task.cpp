@@ -14,6 +14,9 @@
 using namespace beerocks;
 using namespace son;
 
+static metrics::histogram_family s_execute_time("master_task_execute_usec", "task",
+                                                "Time spent by a task in a single execution");
+
 int task::latest_id = 1; //can't be 0 since messages without a task id use 0 for that field
 
 task::task(std::string task_name_, std::string node_mac)
@@ -112,6 +115,11 @@ void task::set_events_timeout(int ms)
 
 void task::execute()
 {
+    if (!m_execute_time) {
+        m_execute_time = &s_execute_time.get(task_name);
+    }
+    metrics::scoped_timer timer(*m_execute_time);
+
     auto now = std::chrono::steady_clock::now();
     if (task_timeout_set && now >= task_timeout) {
         TASK_LOG(DEBUG) << "task timeout reached";
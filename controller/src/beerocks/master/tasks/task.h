@@ -11,6 +11,7 @@
 
 #define TASK_LOG(a) (LOG(a) << "task " << task_name << " id " << id << ": ")
 
+#include <bcl/beerocks_metrics.h>
 #include <beerocks/tlvf/beerocks_message.h>
 #include <beerocks/tlvf/beerocks_message_control.h>
 
@@ -89,6 +90,9 @@ private:
     std::chrono::steady_clock::time_point task_timeout;
     std::chrono::steady_clock::time_point next_action_time;
 
+    // Histogram of the execution time of tasks of the same name, resolved on first execution
+    beerocks::metrics::histogram *m_execute_time = nullptr;
+
     static int latest_id;
 };
 
@@ -8,16 +8,21 @@
 
 #include "task_pool.h"
 
+#include <bcl/beerocks_metrics.h>
 #include <easylogging++.h>
 
 using namespace beerocks;
 using namespace son;
 
+static metrics::gauge s_tasks_count("master_tasks", "Number of tasks scheduled by the controller");
+
 bool task_pool::add_task(std::shared_ptr<task> new_task)
 {
     LOG(TRACE) << "inserting new task, id=" << int(new_task->id)
                << " task_name=" << new_task->task_name;
-    return (scheduled_tasks.insert(std::make_pair(new_task->id, new_task))).second;
+    bool inserted = (scheduled_tasks.insert(std::make_pair(new_task->id, new_task))).second;
+    s_tasks_count.set(scheduled_tasks.size());
+    return inserted;
 }
 
 bool task_pool::is_task_running(int id)
@@ -83,4 +88,5 @@ void task_pool::run_tasks()
             ++it;
         }
     }
+    s_tasks_count.set(scheduled_tasks.size());
 }
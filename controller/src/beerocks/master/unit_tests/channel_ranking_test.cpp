@@ -0,0 +1,171 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "channel_ranking.h"
+
+#include <gtest/gtest.h>
+
+using namespace son;
+using namespace beerocks_message;
+
+namespace {
+
+beerocks::message::sWifiChannel make_channel(uint8_t channel, beerocks::eWiFiBandwidth bandwidth,
+                                             bool is_dfs = false, bool radar_affected = false)
+{
+    beerocks::message::sWifiChannel supported_channel;
+    supported_channel.channel           = channel;
+    supported_channel.channel_bandwidth = bandwidth;
+    supported_channel.is_dfs_channel    = is_dfs;
+    supported_channel.radar_affected    = radar_affected;
+    return supported_channel;
+}
+
+sChannelScanResults make_neighbor(uint8_t id, uint32_t channel, int8_t signal_strength_dbm)
+{
+    sChannelScanResults result{};
+    result.bssid                       = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x00, id};
+    result.channel                     = channel;
+    result.signal_strength_dBm         = signal_strength_dbm;
+    result.operating_channel_bandwidth = eChannel_Bandwidth_20MHz;
+    return result;
+}
+
+void expect_slots(uint8_t channel, beerocks::eWiFiBandwidth bandwidth, int expected_first,
+                  int expected_last)
+{
+    int first = -1, last = -1;
+    ASSERT_TRUE(channel_ranking::get_occupied_slots(channel, bandwidth, first, last))
+        << "channel " << int(channel) << " bandwidth " << int(bandwidth);
+    EXPECT_EQ(first, expected_first) << "channel " << int(channel) << " bandwidth "
+                                     << int(bandwidth);
+    EXPECT_EQ(last, expected_last) << "channel " << int(channel) << " bandwidth "
+                                   << int(bandwidth);
+}
+
+TEST(channel_ranking_test, slots_of_24ghz_channels_should_overlap_their_neighbors)
+{
+    expect_slots(1, beerocks::BANDWIDTH_20, 0, 3);
+    expect_slots(6, beerocks::BANDWIDTH_20, 4, 8);
+    expect_slots(7, beerocks::BANDWIDTH_20, 5, 9);
+
+    // The secondary channel is above for the lower channels and below for the upper ones
+    expect_slots(6, beerocks::BANDWIDTH_40, 4, 12);
+    expect_slots(11, beerocks::BANDWIDTH_40, 5, 13);
+}
+
+TEST(channel_ranking_test, slots_of_bonded_5ghz_channels_should_be_aligned_to_the_block)
+{
+    expect_slots(36, beerocks::BANDWIDTH_20, 34, 38);
+    expect_slots(44, beerocks::BANDWIDTH_40, 42, 50);
+    expect_slots(48, beerocks::BANDWIDTH_40, 42, 50);
+    expect_slots(40, beerocks::BANDWIDTH_80, 34, 50);
+    expect_slots(64, beerocks::BANDWIDTH_80, 50, 66);
+    expect_slots(112, beerocks::BANDWIDTH_160, 98, 130);
+    expect_slots(157, beerocks::BANDWIDTH_80, 147, 163);
+
+    int first, last;
+    EXPECT_FALSE(channel_ranking::get_occupied_slots(0, beerocks::BANDWIDTH_20, first, last));
+    EXPECT_FALSE(channel_ranking::get_occupied_slots(20, beerocks::BANDWIDTH_20, first, last));
+}
+
+TEST(channel_ranking_test, dfs_candidates_should_get_the_penalty)
+{
+    std::vector<beerocks::message::sWifiChannel> supported_channels{
+        make_channel(52, beerocks::BANDWIDTH_20, true),
+        make_channel(36, beerocks::BANDWIDTH_20),
+        // Not a DFS channel itself, but bonded with one
+        make_channel(56, beerocks::BANDWIDTH_40),
+        make_channel(60, beerocks::BANDWIDTH_20, true),
+    };
+    channel_scan_result_ring scan_results(8);
+    scan_results.start_generation();
+
+    channel_ranking::sParams params;
+    params.dfs_penalty_db = 7;
+    auto ranking          = channel_ranking::rank(supported_channels, scan_results, params);
+
+    ASSERT_EQ(ranking.size(), 4U);
+    EXPECT_EQ(ranking[0].channel, 36);
+    EXPECT_FALSE(ranking[0].is_dfs);
+    EXPECT_NEAR(ranking[0].cost, params.default_noise_dbm, 1e-9);
+    for (size_t i = 1; i < ranking.size(); i++) {
+        EXPECT_TRUE(ranking[i].is_dfs) << "channel " << int(ranking[i].channel);
+        EXPECT_NEAR(ranking[i].interference_dbm, params.default_noise_dbm, 1e-9);
+        EXPECT_NEAR(ranking[i].cost, params.default_noise_dbm + params.dfs_penalty_db, 1e-9);
+    }
+}
+
+TEST(channel_ranking_test, radar_affected_candidates_should_be_skipped)
+{
+    std::vector<beerocks::message::sWifiChannel> supported_channels{
+        make_channel(36, beerocks::BANDWIDTH_20),
+        make_channel(40, beerocks::BANDWIDTH_20),
+        make_channel(44, beerocks::BANDWIDTH_20),
+        make_channel(48, beerocks::BANDWIDTH_20),
+        make_channel(52, beerocks::BANDWIDTH_20, true),
+        make_channel(56, beerocks::BANDWIDTH_20, true),
+        make_channel(60, beerocks::BANDWIDTH_20, true),
+        make_channel(64, beerocks::BANDWIDTH_20, true),
+        make_channel(36, beerocks::BANDWIDTH_40),
+        make_channel(44, beerocks::BANDWIDTH_40),
+        make_channel(36, beerocks::BANDWIDTH_80),
+        make_channel(52, beerocks::BANDWIDTH_80),
+        // Radar affected itself
+        make_channel(100, beerocks::BANDWIDTH_20, true, true),
+    };
+    // Radar detected on channel 56: the 80MHz candidate at 52 includes it
+    supported_channels[5].radar_affected = true;
+
+    channel_scan_result_ring scan_results(8);
+    scan_results.start_generation();
+    auto ranking = channel_ranking::rank(supported_channels, scan_results, {});
+
+    ASSERT_EQ(ranking.size(), supported_channels.size() - 3);
+    for (const auto &rank : ranking) {
+        EXPECT_NE(rank.channel, 56);
+        EXPECT_NE(rank.channel, 100);
+        EXPECT_FALSE(rank.channel == 52 && rank.bandwidth == beerocks::BANDWIDTH_80);
+    }
+}
+
+TEST(channel_ranking_test, ranking_should_be_sorted_by_cost_then_bandwidth_then_channel)
+{
+    std::vector<beerocks::message::sWifiChannel> supported_channels{
+        make_channel(44, beerocks::BANDWIDTH_20), make_channel(40, beerocks::BANDWIDTH_20),
+        make_channel(36, beerocks::BANDWIDTH_20), make_channel(40, beerocks::BANDWIDTH_40),
+        make_channel(36, beerocks::BANDWIDTH_40), make_channel(149, beerocks::BANDWIDTH_20),
+        make_channel(153, beerocks::BANDWIDTH_20),
+    };
+
+    // A strong neighbor on 149 and a weaker one on 153, none on the lower band
+    channel_scan_result_ring scan_results(8);
+    scan_results.start_generation();
+    ASSERT_TRUE(scan_results.add(make_neighbor(1, 149, -50)));
+    ASSERT_TRUE(scan_results.add(make_neighbor(2, 153, -70)));
+
+    auto ranking = channel_ranking::rank(supported_channels, scan_results, {});
+
+    // Equal cost on the lower band: 40MHz first, then by channel
+    std::vector<std::pair<uint8_t, beerocks::eWiFiBandwidth>> expected{
+        {36, beerocks::BANDWIDTH_40}, {40, beerocks::BANDWIDTH_40}, {36, beerocks::BANDWIDTH_20},
+        {40, beerocks::BANDWIDTH_20}, {44, beerocks::BANDWIDTH_20}, {153, beerocks::BANDWIDTH_20},
+        {149, beerocks::BANDWIDTH_20},
+    };
+    ASSERT_EQ(ranking.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(ranking[i].channel, expected[i].first) << "rank " << i;
+        EXPECT_EQ(ranking[i].bandwidth, expected[i].second) << "rank " << i;
+        if (i > 0) {
+            EXPECT_LE(ranking[i - 1].cost, ranking[i].cost) << "rank " << i;
+        }
+    }
+    EXPECT_GT(ranking[5].cost, ranking[4].cost);
+}
+
+} // namespace
@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "channel_scan_result_ring.h"
+
+#include <beerocks/tlvf/beerocks_message.h>
+#include <beerocks/tlvf/beerocks_message_bml.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace son;
+using namespace beerocks_message;
+
+namespace {
+
+constexpr size_t BUFFER_SIZE = 16384;
+
+sChannelScanResults make_result(uint8_t id, uint32_t channel = 36)
+{
+    sChannelScanResults result{};
+    std::snprintf(result.ssid, sizeof(result.ssid), "ssid_%u", id);
+    result.bssid                                 = sMacAddr{0x02, 0x00, 0x00, 0x00, 0x00, id};
+    result.mode                                  = eMode_Infrastructure;
+    result.channel                               = channel;
+    result.signal_strength_dBm                   = -40 - id;
+    result.security_mode_enabled[0]              = eSecurity_Mode_WPA2;
+    result.encryption_mode[0]                    = eEncryption_Mode_AES;
+    result.operating_frequency_band              = eOperating_Freq_Band_5GHz;
+    result.supported_standards[0]                = eStandard_802_11ac;
+    result.operating_standards                   = eStandard_802_11ac;
+    result.operating_channel_bandwidth           = eChannel_Bandwidth_80MHz;
+    result.beacon_period_ms                      = 100 + id;
+    result.noise_dBm                             = -90 - id;
+    result.basic_data_transfer_rates_kbps[0]     = 6000 + id;
+    result.supported_data_transfer_rates_kbps[0] = 866700 + id;
+    result.dtim_period                           = 2;
+    result.channel_utilization                   = 0x01020300 + id;
+    return result;
+}
+
+TEST(channel_scan_result_ring_test, full_ring_should_overwrite_the_oldest_record)
+{
+    channel_scan_result_ring ring(3);
+    ring.start_generation();
+
+    for (uint8_t id = 1; id <= 5; id++) {
+        ASSERT_TRUE(ring.add(make_result(id)));
+    }
+
+    ASSERT_EQ(ring.size(), 3U);
+    EXPECT_EQ(ring.get_overwritten_count(), 2U);
+    EXPECT_EQ(ring.at(0).bssid, make_result(3).bssid);
+    EXPECT_EQ(ring.at(2).bssid, make_result(5).bssid);
+
+    uint8_t id = 3;
+    for (const auto &result : ring) {
+        EXPECT_EQ(result.bssid, make_result(id++).bssid);
+    }
+}
+
+TEST(channel_scan_result_ring_test, same_bssid_should_replace_the_stored_record)
+{
+    channel_scan_result_ring ring(3);
+    ring.start_generation();
+
+    ASSERT_TRUE(ring.add(make_result(1)));
+    ASSERT_TRUE(ring.add(make_result(2)));
+    ASSERT_TRUE(ring.add(make_result(1, 149)));
+
+    ASSERT_EQ(ring.size(), 2U);
+    EXPECT_EQ(ring.at(0).channel, 149U);
+    EXPECT_EQ(ring.get_overwritten_count(), 0U);
+}
+
+TEST(channel_scan_result_ring_test, new_generation_should_drop_the_results)
+{
+    channel_scan_result_ring ring(3);
+    ring.start_generation();
+
+    ASSERT_TRUE(ring.add(make_result(1)));
+    ring.start_generation();
+
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.get_generation(), 2U);
+
+    // A BSSID of the previous generation is stored again
+    ASSERT_TRUE(ring.add(make_result(1)));
+    EXPECT_EQ(ring.size(), 1U);
+
+    channel_scan_result_ring no_capacity(0);
+    EXPECT_FALSE(no_capacity.add(make_result(1)));
+}
+
+TEST(channel_scan_result_ring_test, records_should_round_trip_through_the_bml_response)
+{
+    channel_scan_result_ring ring(8);
+    ring.start_generation();
+    for (uint8_t id = 1; id <= 10; id++) {
+        ASSERT_TRUE(ring.add(make_result(id)));
+    }
+
+    // Same as the ACTION_BML_CHANNEL_SCAN_GET_RESULTS_REQUEST handler: the stored records are
+    // copied as is into the response
+    uint8_t tx_buffer[BUFFER_SIZE];
+    ieee1905_1::CmduMessageTx cmdu_tx(tx_buffer, sizeof(tx_buffer));
+    auto response = beerocks::message_com::create_vs_message<
+        cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE>(cmdu_tx);
+    ASSERT_NE(response, nullptr);
+    for (const auto &result : ring) {
+        ASSERT_TRUE(response->alloc_results());
+        auto entry = response->results(response->results_size() - 1);
+        ASSERT_TRUE(std::get<0>(entry));
+        std::get<1>(entry) = result;
+    }
+    ASSERT_TRUE(cmdu_tx.finalize());
+
+    uint8_t rx_buffer[BUFFER_SIZE];
+    std::memcpy(rx_buffer, tx_buffer, sizeof(rx_buffer));
+    ieee1905_1::CmduMessageRx cmdu_rx(rx_buffer, sizeof(rx_buffer));
+    ASSERT_TRUE(cmdu_rx.parse());
+    auto beerocks_header = beerocks::message_com::parse_intel_vs_message(cmdu_rx);
+    ASSERT_NE(beerocks_header, nullptr);
+    auto received = beerocks_header->addClass<cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE>();
+    ASSERT_NE(received, nullptr);
+
+    ASSERT_EQ(received->results_size(), ring.size());
+    for (size_t i = 0; i < ring.size(); i++) {
+        auto entry = received->results(i);
+        ASSERT_TRUE(std::get<0>(entry));
+        EXPECT_EQ(std::memcmp(&std::get<1>(entry), &ring.at(i), sizeof(ring.at(i))), 0)
+            << "record " << i;
+    }
+    EXPECT_EQ(std::get<1>(received->results(0)).channel_utilization,
+              make_result(3).channel_utilization);
+}
+
+} // namespace
@@ -0,0 +1,160 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "topology_graph.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace son;
+
+namespace {
+
+/**
+ * Builds the tree:
+ *   gw
+ *   +-- agent_1
+ *   |   +-- client_1
+ *   |   +-- agent_2
+ *   |       +-- client_2
+ *   +-- client_3
+ */
+void build_tree(topology_graph &graph)
+{
+    ASSERT_TRUE(graph.set_parent("gw", ""));
+    ASSERT_TRUE(graph.set_parent("agent_1", "gw"));
+    ASSERT_TRUE(graph.set_parent("client_1", "agent_1"));
+    ASSERT_TRUE(graph.set_parent("agent_2", "agent_1"));
+    ASSERT_TRUE(graph.set_parent("client_2", "agent_2"));
+    ASSERT_TRUE(graph.set_parent("client_3", "gw"));
+}
+
+bool contains(const std::vector<std::string> &keys, const std::string &key)
+{
+    return std::find(keys.begin(), keys.end(), key) != keys.end();
+}
+
+TEST(topology_graph_test, parent_should_be_set)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    EXPECT_EQ(graph.size(), 6U);
+    EXPECT_TRUE(graph.has_node("agent_2"));
+    EXPECT_EQ(graph.get_parent("agent_2"), "agent_1");
+    EXPECT_EQ(graph.get_parent("gw"), "");
+    EXPECT_EQ(graph.get_parent("no_such_node"), "");
+}
+
+TEST(topology_graph_test, children_should_be_direct_descendants)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    auto children = graph.get_children("agent_1");
+    ASSERT_EQ(children.size(), 2U);
+    EXPECT_TRUE(contains(children, "client_1"));
+    EXPECT_TRUE(contains(children, "agent_2"));
+    EXPECT_TRUE(graph.get_children("client_1").empty());
+    EXPECT_TRUE(graph.get_children("no_such_node").empty());
+}
+
+TEST(topology_graph_test, subtree_should_be_in_depth_first_order)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    auto subtree = graph.get_subtree("gw");
+    ASSERT_EQ(subtree.size(), 5U);
+    for (const auto &key : subtree) {
+        // Every node comes after its parent
+        auto parent = graph.get_parent(key);
+        if (parent != "gw") {
+            auto parent_it = std::find(subtree.begin(), subtree.end(), parent);
+            auto key_it    = std::find(subtree.begin(), subtree.end(), key);
+            EXPECT_LT(parent_it, key_it) << key;
+        }
+    }
+
+    subtree = graph.get_subtree("agent_1");
+    ASSERT_EQ(subtree.size(), 3U);
+    EXPECT_FALSE(contains(subtree, "agent_1"));
+    EXPECT_FALSE(contains(subtree, "client_3"));
+
+    EXPECT_TRUE(graph.is_in_subtree("gw", "client_2"));
+    EXPECT_TRUE(graph.is_in_subtree("agent_1", "client_2"));
+    EXPECT_FALSE(graph.is_in_subtree("agent_1", "client_3"));
+    EXPECT_FALSE(graph.is_in_subtree("agent_1", "agent_1"));
+}
+
+TEST(topology_graph_test, subtree_should_follow_a_moved_node)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    ASSERT_TRUE(graph.set_parent("agent_2", "gw"));
+
+    EXPECT_EQ(graph.get_parent("agent_2"), "gw");
+    EXPECT_FALSE(contains(graph.get_children("agent_1"), "agent_2"));
+    EXPECT_EQ(graph.get_subtree("agent_1").size(), 1U);
+    EXPECT_TRUE(graph.is_in_subtree("agent_2", "client_2"));
+    EXPECT_FALSE(graph.is_in_subtree("agent_1", "client_2"));
+}
+
+TEST(topology_graph_test, loop_should_be_rejected)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    EXPECT_FALSE(graph.can_set_parent("agent_1", "client_2"));
+    EXPECT_FALSE(graph.set_parent("agent_1", "client_2"));
+    EXPECT_FALSE(graph.set_parent("agent_1", "agent_1"));
+    EXPECT_EQ(graph.get_parent("agent_1"), "gw");
+
+    EXPECT_TRUE(graph.can_set_parent("client_2", "client_3"));
+}
+
+TEST(topology_graph_test, removed_node_children_should_be_attached_back)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    EXPECT_TRUE(graph.remove("agent_2"));
+    EXPECT_FALSE(graph.remove("agent_2"));
+    EXPECT_FALSE(graph.has_node("agent_2"));
+    EXPECT_EQ(graph.size(), 5U);
+    EXPECT_FALSE(contains(graph.get_children("agent_1"), "agent_2"));
+    EXPECT_FALSE(contains(graph.get_subtree("gw"), "client_2"));
+
+    // The children keep their parent key
+    EXPECT_EQ(graph.get_parent("client_2"), "agent_2");
+    ASSERT_TRUE(graph.set_parent("agent_2", "client_3"));
+    EXPECT_TRUE(graph.is_in_subtree("client_3", "client_2"));
+    EXPECT_TRUE(graph.is_in_subtree("gw", "client_2"));
+}
+
+TEST(topology_graph_test, children_of_unknown_parent_should_be_indexed)
+{
+    topology_graph graph;
+    build_tree(graph);
+
+    // Clients are attached to VAP BSSIDs, which are not graph nodes
+    ASSERT_TRUE(graph.set_parent("client_4", "bssid_1"));
+    ASSERT_TRUE(graph.set_parent("client_5", "bssid_1"));
+
+    EXPECT_FALSE(graph.has_node("bssid_1"));
+    EXPECT_EQ(graph.get_children("bssid_1").size(), 2U);
+    EXPECT_EQ(graph.get_subtree("bssid_1").size(), 2U);
+
+    graph.clear();
+    EXPECT_EQ(graph.size(), 0U);
+    EXPECT_TRUE(graph.get_children("bssid_1").empty());
+}
+
+} // namespace
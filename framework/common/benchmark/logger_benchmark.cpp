@@ -0,0 +1,113 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/*
+ * Synthetic benchmark of the debug lines of a packet path when the debug level is disabled.
+ *
+ * Writes, per packet, the debug lines of Ieee1905Transport::handle_packet() on the way to the
+ * broker: a dump of the packet as printed by Ieee1905Transport::Packet::print(), then a few short
+ * lines. The lines are first written with LOG(), which evaluates the streamed operands even
+ * though the level is disabled, then with MAPF_DBG(), which does not. Prints the number of
+ * packets per second of each.
+ *
+ * Usage: logger_benchmark [packets] [payload size]
+ */
+
+#include <mapf/common/logger.h>
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+INITIALIZE_EASYLOGGINGPP
+
+static const int DEFAULT_PACKETS      = 100000;
+static const int DEFAULT_PAYLOAD_SIZE = 256;
+
+struct sPacket {
+    uint8_t src[6];
+    uint16_t ether_type;
+    std::vector<uint8_t> payload;
+};
+
+static std::ostream &operator<<(std::ostream &os, const sPacket &packet)
+{
+    std::stringstream ss;
+
+    ss << "ethernet header:" << std::endl << "  src        : ";
+    for (auto octet : packet.src) {
+        ss << std::hex << std::setfill('0') << std::setw(2) << unsigned(octet) << ":";
+    }
+    ss << std::endl
+       << "  ether_type : " << std::hex << std::setfill('0') << std::setw(4) << packet.ether_type
+       << std::endl;
+
+    ss << "  payload:" << std::endl << "    ";
+    for (size_t i = 0; i < packet.payload.size(); i++) {
+        ss << std::hex << std::setfill('0') << std::setw(2) << unsigned(packet.payload[i]) << " ";
+        if (i % 16 == 15)
+            ss << std::endl << "    ";
+        else if (i % 8 == 7)
+            ss << " ";
+    }
+
+    return os << ss.str();
+}
+
+static void handle_packet_eager(const sPacket &packet)
+{
+    LOG(DEBUG) << "handling packet:" << std::endl << packet;
+    LOG(DEBUG) << "Updating last seen for neighbour with almac " << std::hex << int(packet.src[5]);
+    LOG(DEBUG) << "forwarding packet to broker.";
+}
+
+static void handle_packet_lazy(const sPacket &packet)
+{
+    MAPF_DBG("handling packet:" << std::endl << packet);
+    MAPF_DBG("Updating last seen for neighbour with almac " << std::hex << int(packet.src[5]));
+    MAPF_DBG("forwarding packet to broker.");
+}
+
+static double packets_per_sec(void (*handle_packet)(const sPacket &), const sPacket &packet,
+                              int packets)
+{
+    auto start = std::clock();
+    for (int i = 0; i < packets; i++) {
+        handle_packet(packet);
+    }
+    double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+    return seconds > 0 ? packets / seconds : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int packets      = argc > 1 ? std::atoi(argv[1]) : DEFAULT_PACKETS;
+    int payload_size = argc > 2 ? std::atoi(argv[2]) : DEFAULT_PAYLOAD_SIZE;
+
+    el::Configurations conf;
+    conf.setToDefault();
+    conf.set(el::Level::Debug, el::ConfigurationType::Enabled, "false");
+    lazy_log::reconfigure_logger("default", conf);
+
+    sPacket packet = {{0x02, 0x00, 0x00, 0x00, 0x01, 0x00}, 0x893a, {}};
+    for (int i = 0; i < payload_size; i++) {
+        packet.payload.push_back(uint8_t(i));
+    }
+
+    std::cout << "debug disabled, " << packets << " packets of " << payload_size
+              << " bytes:" << std::endl;
+    std::cout << "LOG(DEBUG): " << std::fixed << std::setprecision(0)
+              << packets_per_sec(handle_packet_eager, packet, packets) << " packets/s"
+              << std::endl;
+    std::cout << "MAPF_DBG:   " << packets_per_sec(handle_packet_lazy, packet, packets)
+              << " packets/s" << std::endl;
+
+    return 0;
+}
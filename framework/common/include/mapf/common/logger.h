@@ -9,23 +9,24 @@
 #ifndef __MAPF_COMMON_LOGGER_H__
 #define __MAPF_COMMON_LOGGER_H__
 
-#include <easylogging++.h>
+#include <lazy_log.h>
 #include <iomanip> //for resetiosflags
 #include <mapf/common/config.h>
 
-#define MAPF_ERR(msg) LOG(ERROR) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
-#define MAPF_WARN(msg) LOG(WARNING) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
-#define MAPF_INFO(msg) LOG(INFO) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
-#define MAPF_DBG(msg) LOG(DEBUG) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+// msg is only evaluated when the level is enabled (see LAZY_LOG in lazy_log.h)
+#define MAPF_ERR(msg) LAZY_LOG(ERROR) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+#define MAPF_WARN(msg) LAZY_LOG(WARNING) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+#define MAPF_INFO(msg) LAZY_LOG(INFO) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+#define MAPF_DBG(msg) LAZY_LOG(DEBUG) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
 
 #define MAPF_ERR_IF(cond, msg)                                                                     \
-    LOG_IF(cond, ERROR) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+    LAZY_LOG_IF(cond, ERROR) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
 #define MAPF_WARN_IF(cond, msg)                                                                    \
-    LOG_IF(cond, WARNING) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+    LAZY_LOG_IF(cond, WARNING) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
 #define MAPF_INFO_IF(cond, msg)                                                                    \
-    LOG_IF(cond, INFO) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+    LAZY_LOG_IF(cond, INFO) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
 #define MAPF_DBG_IF(cond, msg)                                                                     \
-    LOG_IF(cond, DEBUG) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
+    LAZY_LOG_IF(cond, DEBUG) << msg << resetiosflags((std::ios_base::fmtflags)0xFFFF)
 
 #define CONF_FILE_PATH std::string(MAPF_ROOT) + "/config/framework_logging.conf"
 #define CONF_FILE_TMP_PATH std::string("/tmp/share/framework_logging.conf")
@@ -45,6 +46,8 @@ public:
         void set_write_to_file(bool param) { write_to_file_ = param; }
         void set_max_file_size(size_t param) { max_file_size_ = param; }
         void set_log_flush_threshold(size_t param) { log_flush_threshold_ = param; }
+        void set_async(bool param) { async_ = param; }
+        void set_auto_roll(bool param) { auto_roll_ = param; }
 
         std::string level() { return level_; }
         std::string file_path() { return file_path_; }
@@ -53,6 +56,8 @@ public:
         bool write_to_file() { return write_to_file_; }
         size_t max_file_size() { return max_file_size_; }
         size_t log_flush_threshold() { return log_flush_threshold_; }
+        bool async() { return async_; }
+        bool auto_roll() { return auto_roll_; }
         int SetValuesFromJson(const std::string &file_path, const std::string &logger_name);
         std::string ToEasyLoggingString();
 
@@ -60,6 +65,8 @@ public:
         std::string level_ = "DEBUG", file_path_ = "logs.log";
         bool write_to_syslog_ = false, write_to_console_ = true, write_to_file_ = false;
         size_t max_file_size_ = 1024, log_flush_threshold_ = 100;
+        // Not applied by LoggerConfig(), left to the process (see beerocks::async_log)
+        bool async_ = false, auto_roll_ = false;
         const char *kMessageFormat = "%datetime{%H:%m:%s} [%proc] [%level] %fbase[%line]: %msg";
         void SetValuesFromJson(struct json_object *jlogger, const std::string &logger_name);
     };
@@ -76,9 +83,11 @@ public:
     void LoggerConfig(const char *logger_name);
     void LoggerConfig(Logger::Config &cfg);
     const char *logger_name() { return logger_name_.c_str(); } //for all API users
+    Logger::Config config() { return config_; }                //last applied configuration
 
 private:
     std::string logger_name_         = "";
+    Logger::Config config_;
     const char *kSyslogMessageFormat = "[mapf] [%proc] %fbase[%line]: %msg";
     Logger();
     Logger(const Logger &) = delete;
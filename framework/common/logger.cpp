@@ -76,7 +76,7 @@ Logger::Logger()
     conf.set(el::Level::Global, el::ConfigurationType::ToStandardOutput, "true");
     conf.set(el::Level::Global, el::ConfigurationType::Format,
              "%datetime{%H:%m:%s} %fbase[%line]: %msg");
-    el::Loggers::reconfigureLogger(DEFAULT_LOGGER_NAME, conf);
+    lazy_log::reconfigure_logger(DEFAULT_LOGGER_NAME, conf);
 }
 
 void Logger::LoggerInit() { LoggerInit(DEFAULT_LOGGER_NAME); }
@@ -107,7 +107,7 @@ void Logger::LoggerInit(const char *logger_name)
         syslogConf.parseFromText(
             std::string(std::string("*GLOBAL:\n FORMAT = ") + std::string(kSyslogMessageFormat))
                 .c_str());
-        el::Loggers::reconfigureLogger("syslog", syslogConf);
+        lazy_log::reconfigure_logger("syslog", syslogConf);
 #endif //#ifdef ELPP_SYSLOG
     }
 }
@@ -134,7 +134,8 @@ void Logger::LoggerConfig(Logger::Config &cfg)
 {
     el::Configurations conf;
     conf.parseFromText(cfg.ToEasyLoggingString().c_str());
-    el::Loggers::reconfigureLogger(DEFAULT_LOGGER_NAME, conf);
+    lazy_log::reconfigure_logger(DEFAULT_LOGGER_NAME, conf);
+    config_ = cfg;
 }
 
 int Logger::Config::SetValuesFromJson(const std::string &file_path, const std::string &logger_name)
@@ -175,6 +176,9 @@ void Logger::Config::SetValuesFromJson(struct json_object *jlogger, const std::s
     if (json_object_object_get_ex(jlogger, "flushthreshold", &jtmp)) {
         log_flush_threshold_ = json_object_get_int(jtmp);
     }
+    if (json_object_object_get_ex(jlogger, "async", &jtmp)) {
+        async_ = json_object_get_boolean(jtmp);
+    }
     if (json_object_object_get_ex(jlogger, "file", &jfile)) {
         if (json_object_object_get_ex(jfile, "enable", &jtmp)) {
             write_to_file_ = json_object_get_boolean(jtmp);
@@ -187,6 +191,9 @@ void Logger::Config::SetValuesFromJson(struct json_object *jlogger, const std::s
         if (json_object_object_get_ex(jfile, "size", &jtmp)) {
             max_file_size_ = json_object_get_int(jtmp);
         }
+        if (json_object_object_get_ex(jfile, "auto_roll", &jtmp)) {
+            auto_roll_ = json_object_get_boolean(jtmp);
+        }
     }
 }
 
@@ -0,0 +1,192 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/**
+ * @brief prplMesh extension of easylogging++ which skips the operands of disabled log lines.
+ *
+ * LOG(DEBUG) evaluates everything streamed into it before easylogging++ finds out that the level
+ * is disabled, and finding that out takes the registry and the logger locks. LAZY_LOG(LEVEL)
+ * first checks the level against a per thread cache, and only evaluates the line when enabled.
+ *
+ * The cache is invalidated by a generation counter, so the loggers must be (re)configured and
+ * attached to threads through the functions of this file, not through el::Loggers directly.
+ * easylogging++ itself is left untouched. This header lives next to it because elpp is the only
+ * library shared by tlvf, mapfcommon and bcl.
+ */
+
+#ifndef _LAZY_LOG_H_
+#define _LAZY_LOG_H_
+
+#include <easylogging++.h>
+
+#include <atomic>
+
+namespace lazy_log {
+
+/**
+ * @brief Configuration generation of the loggers of the process.
+ *
+ * A static of an inline function, so that it is shared by all the libraries of a process.
+ */
+inline std::atomic<unsigned int> &generation()
+{
+    static std::atomic<unsigned int> s_generation(1);
+    return s_generation;
+}
+
+/**
+ * @brief Invalidates the levels cached by level_enabled() in all the threads.
+ *
+ * Called after a logger is configured or a thread is attached to a logger.
+ */
+inline void reconfigured() { generation().fetch_add(1, std::memory_order_release); }
+
+/**
+ * @brief Reads the enabled levels of a logger.
+ *
+ * Logger::configure() replaces the typed configurations that Logger::enabled() reads, so they
+ * are read under the logger lock, which reconfigure_logger() holds while configuring.
+ *
+ * @param logger_id Logger used by CLOG(level, logger_id), unless the thread is attached to
+ * another logger.
+ * @return Bitmask of the enabled el::Level values.
+ */
+inline el::base::type::EnumType read_enabled_levels(const char *logger_id)
+{
+    // Same lookup as Writer::initializeLogger()
+    std::string thread_logger_id = ELPP->getCurrentThreadLoggerId();
+    auto logger = el::Loggers::getLogger(
+        thread_logger_id.empty() ? std::string(logger_id) : thread_logger_id, false);
+    if (!logger) {
+        // Unknown loggers are left to the writer, which reports them
+        return el::base::type::EnumType(-1);
+    }
+
+    el::base::type::EnumType levels = 0;
+    logger->acquireLock();
+    for (auto level : {el::Level::Trace, el::Level::Debug, el::Level::Fatal, el::Level::Error,
+                       el::Level::Warning, el::Level::Verbose, el::Level::Info}) {
+        if (logger->enabled(level)) {
+            levels |= el::LevelHelper::castToInt(level);
+        }
+    }
+    logger->releaseLock();
+    return levels;
+}
+
+/**
+ * @brief Whether the level is enabled in the logger that CLOG(level, logger_id) would use on the
+ * current thread.
+ *
+ * The enabled levels are cached per thread and only read again after reconfigured(), so the check
+ * costs an atomic load and a bit test.
+ */
+inline bool level_enabled(el::Level level, const char *logger_id)
+{
+    if (el::Loggers::hasFlag(el::LoggingFlag::HierarchicalLogging)) {
+        // Left to the writer, which compares the level to the global logging level
+        return true;
+    }
+
+    struct sEnabledLevels {
+        unsigned int generation;
+        const char *logger_id;
+        el::base::type::EnumType levels;
+    };
+    static thread_local sEnabledLevels cache = {0, nullptr, 0};
+
+    unsigned int current = generation().load(std::memory_order_acquire);
+    if (cache.generation != current || cache.logger_id != logger_id) {
+        // A reconfiguration racing with the read bumps the generation again after it
+        cache.levels     = read_enabled_levels(logger_id);
+        cache.generation = current;
+        cache.logger_id  = logger_id;
+    }
+    return (cache.levels & el::LevelHelper::castToInt(level)) != 0;
+}
+
+/**
+ * @brief el::Loggers::reconfigureLogger() under the logger lock, followed by reconfigured().
+ *
+ * @return The logger, registered if it did not exist yet.
+ */
+inline el::Logger *reconfigure_logger(const std::string &logger_id,
+                                      const el::Configurations &configurations)
+{
+    auto logger = el::Loggers::getLogger(logger_id);
+    if (!logger) {
+        return nullptr;
+    }
+    logger->acquireLock();
+    el::Loggers::reconfigureLogger(logger, configurations);
+    logger->releaseLock();
+    reconfigured();
+    return logger;
+}
+
+/**
+ * @brief Sets one configuration of all the levels of a logger and reconfigures it.
+ *
+ * @return The logger, or nullptr if it does not exist.
+ */
+inline el::Logger *reconfigure_logger(const std::string &logger_id,
+                                      el::ConfigurationType configuration_type,
+                                      const std::string &value)
+{
+    auto logger = el::Loggers::getLogger(logger_id, false);
+    if (!logger) {
+        return nullptr;
+    }
+    logger->acquireLock();
+    logger->configurations()->set(el::Level::Global, configuration_type, value);
+    logger->reconfigure();
+    logger->releaseLock();
+    reconfigured();
+    return logger;
+}
+
+/**
+ * @brief el::Helpers::attachLoggerIdThreadId() followed by reconfigured().
+ */
+inline void attach_current_thread(const std::string &logger_id)
+{
+    el::Helpers::attachLoggerIdThreadId(logger_id);
+    reconfigured();
+}
+
+/**
+ * @brief Discards the writer of a log line, so that LAZY_LOG() is an expression and does not
+ * capture the else of an enclosing if statement.
+ */
+class Voidify {
+public:
+    template <typename T> void operator&(const T &) {}
+};
+
+} // namespace lazy_log
+
+#define LAZY_LOG_LEVEL_TRACE el::Level::Trace
+#define LAZY_LOG_LEVEL_DEBUG el::Level::Debug
+#define LAZY_LOG_LEVEL_INFO el::Level::Info
+#define LAZY_LOG_LEVEL_WARNING el::Level::Warning
+#define LAZY_LOG_LEVEL_ERROR el::Level::Error
+#define LAZY_LOG_LEVEL_FATAL el::Level::Fatal
+
+// Whether CLOG(LEVEL, logger_id) writes anything: false at compile time when
+// ELPP_DISABLE_<LEVEL>_LOGS is defined, otherwise the cached run time check
+#define CLOG_ENABLED(LEVEL, logger_id)                                                             \
+    (ELPP_##LEVEL##_LOG && lazy_log::level_enabled(LAZY_LOG_LEVEL_##LEVEL, logger_id))
+#define LOG_ENABLED(LEVEL) CLOG_ENABLED(LEVEL, ELPP_CURR_FILE_LOGGER_ID)
+
+// Same as LOG(LEVEL) and LOG_IF(condition, LEVEL), but the streamed operands are only evaluated
+// when LOG_ENABLED(LEVEL)
+#define LAZY_LOG(LEVEL) !LOG_ENABLED(LEVEL) ? (void)0 : lazy_log::Voidify() & LOG(LEVEL)
+#define LAZY_LOG_IF(condition, LEVEL)                                                              \
+    !((condition) && LOG_ENABLED(LEVEL)) ? (void)0 : lazy_log::Voidify() & LOG(LEVEL)
+
+#endif // _LAZY_LOG_H_
@@ -90,14 +90,20 @@ int arp_mon_get_fd(BPL_ARP_MON_CTX ctx);
 int arp_mon_get_raw_arp_fd(BPL_ARP_MON_CTX ctx);
 
 /**
- * Process data from the monitoring socket.
+ * Process all the data available on the monitoring socket.
+ *
+ * A single read of the monitoring socket may carry many entries (e.g. when
+ * many clients connect at once). If more than max_entries are available, the
+ * remaining ones are returned by the next call, so the function shall be
+ * called again as long as it returns max_entries.
  *
  * @param [in] ctx BPL ARP monitor context.
- * @param [out] entry ARP monitor entry.
+ * @param [out] entries Array of ARP monitor entries.
+ * @param [in] max_entries Number of entries in the array.
  *
- * @return 0 on success or -1 on error.
+ * @return Number of entries read on success or -1 on error.
  */
-int arp_mon_process(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entry);
+int arp_mon_process(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entries, int max_entries);
 
 /**
  * Process data from the raw arp socket.
@@ -125,6 +131,7 @@ int arp_mon_probe(BPL_ARP_MON_CTX ctx, const uint8_t mac[BPL_ARP_MON_MAC_LEN],
 
 /**
  * Query the ARP table for the MAC address of a given IP.
+ * The ARP table is cached by the monitor, so the query does not access the kernel.
  *
  * @param [in] ctx BPL ARP Monitor Context.
  * @param [in] ip IP address to query.
@@ -137,6 +144,10 @@ int arp_mon_get_mac_for_ip(BPL_ARP_MON_CTX ctx, const uint8_t ip[BPL_ARP_MON_IP_
 
 /**
  * Query the ARP table for the IP address of a given MAC.
+ * The ARP table is cached by the monitor, so the query does not access the kernel.
+ * The cache keeps a single IP address per MAC address, the most recently added or updated one.
+ * Once that entry is removed from the ARP table, the MAC address is not found, even if the
+ * table has other entries for it.
  *
  * @param [in] ctx BPL ARP Monitor Context.
  * @param [in] mac MAC address to query.
@@ -26,7 +26,10 @@ int arp_mon_get_fd(BPL_ARP_MON_CTX ctx) { return -1; }
 
 int arp_mon_get_raw_arp_fd(BPL_ARP_MON_CTX ctx) { return -1; }
 
-int arp_mon_process(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entry) { return 0; }
+int arp_mon_process(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entries, int max_entries)
+{
+    return 0;
+}
 
 int arp_mon_process_raw_arp(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entry) { return 0; }
 
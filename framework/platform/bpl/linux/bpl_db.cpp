@@ -8,8 +8,18 @@
 
 #include "bpl/bpl_db.h"
 
+#include "db/bpl_db_log_store.h"
+
 #include <mapf/common/logger.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#ifndef BPL_DB_PATH
+#define BPL_DB_PATH "/tmp/prplmesh_db"
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////////// Implementation ///////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -17,30 +27,210 @@
 namespace beerocks {
 namespace bpl {
 
+namespace {
+
+/**
+ * @brief The store and its maintenance thread.
+ *
+ * The updates only append to the log. The maintenance thread syncs the records left pending
+ * once their sync deadline is reached, even if no update follows, and compacts the log without
+ * holding the lock while the compacted log is written.
+ */
+struct sDb {
+    std::mutex mutex;
+    // Notified on every update
+    std::condition_variable updated;
+    db::log_store store;
+    std::thread maintenance_thread;
+    bool stop = false;
+
+    ~sDb()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        updated.notify_one();
+        if (maintenance_thread.joinable()) {
+            maintenance_thread.join();
+        }
+        // The store syncs the pending records when destructed
+    }
+};
+
+} // namespace
+
+static sDb s_db;
+
+static void maintain_db()
+{
+    std::unique_lock<std::mutex> lock(s_db.mutex);
+    auto &store = s_db.store;
+    while (!s_db.stop) {
+        if (store.needs_compaction()) {
+            db::log_store::sCompaction compaction;
+            if (store.prepare_compaction(compaction)) {
+                lock.unlock();
+                bool written = db::log_store::write_compaction(compaction);
+                lock.lock();
+                if (written) {
+                    store.finish_compaction(compaction);
+                }
+            }
+            continue;
+        }
+
+        if (!store.has_unsynced_records()) {
+            s_db.updated.wait(lock);
+            continue;
+        }
+
+        auto sync_deadline = store.get_sync_deadline();
+        if (std::chrono::steady_clock::now() < sync_deadline) {
+            s_db.updated.wait_until(lock, sync_deadline);
+            continue;
+        }
+        if (!store.sync()) {
+            // Don't retry in a busy loop
+            s_db.updated.wait_for(lock, db::log_store::SYNC_INTERVAL);
+        }
+    }
+}
+
+/**
+ * @brief Get the store, opening it and starting its maintenance thread on first use.
+ * Must be called with s_db.mutex held.
+ *
+ * @return pointer to the store, or nullptr if it could not be opened.
+ */
+static db::log_store *get_db()
+{
+    if (!s_db.store.is_open() && !s_db.store.open(BPL_DB_PATH)) {
+        LOG(ERROR) << "Failed to open the db at " << BPL_DB_PATH;
+        return nullptr;
+    }
+    if (!s_db.maintenance_thread.joinable()) {
+        s_db.maintenance_thread = std::thread(maintain_db);
+    }
+    return &s_db.store;
+}
+
+/**
+ * @brief Wake up the maintenance thread after an update of the store.
+ *
+ * @param result result of the update.
+ * @return @a result.
+ */
+static bool notify_update(bool result)
+{
+    s_db.updated.notify_one();
+    return result;
+}
+
+static bool entry_matches(const db::log_store::sEntry *entry, const std::string &entry_type)
+{
+    return entry && (entry_type.empty() || entry->type == entry_type);
+}
+
 bool db_has_entry(const std::string &entry_type, const std::string &entry_name)
 {
-    LOG(TRACE) << " - NOT IMPLEMENTED!";
-    return false;
+    LOG(TRACE) << entry_type << ":" << entry_name;
+
+    if (entry_name.empty()) {
+        LOG(ERROR) << "Entry name must be provided";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_db.mutex);
+    auto store = get_db();
+    if (!store) {
+        return false;
+    }
+    return entry_matches(store->find(entry_name), entry_type);
 }
 
 bool db_add_entry(const std::string &entry_type, const std::string &entry_name,
                   const std::unordered_map<std::string, std::string> &params)
 {
-    LOG(TRACE) << " - NOT IMPLEMENTED!";
-    return true;
+    LOG(TRACE) << entry_type << ":" << entry_name;
+
+    if (entry_name.empty() || entry_type.empty()) {
+        LOG(ERROR) << "Entry name & type must be set";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_db.mutex);
+    auto store = get_db();
+    if (!store) {
+        return false;
+    }
+    // Check if entry of the same name exists.
+    if (store->find(entry_name)) {
+        LOG(ERROR) << "Entry " << entry_name << " already exists";
+        return false;
+    }
+    return notify_update(store->set(entry_type, entry_name, params));
 }
 
 bool db_set_entry(const std::string &entry_type, const std::string &entry_name,
                   const std::unordered_map<std::string, std::string> &params)
 {
-    LOG(TRACE) << " - NOT IMPLEMENTED!";
-    return true;
+    LOG(TRACE) << entry_type << ":" << entry_name;
+
+    if (entry_name.empty()) {
+        LOG(ERROR) << "Entry name must be provided";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_db.mutex);
+    auto store = get_db();
+    if (!store) {
+        return false;
+    }
+    auto entry = store->find(entry_name);
+    if (!entry_matches(entry, entry_type)) {
+        LOG(DEBUG) << "Entry " << entry_name
+                   << (!entry_type.empty() ? std::string(" of type ") + entry_type : "")
+                   << " not found!";
+        return false;
+    }
+    return notify_update(store->set(entry->type, entry_name, params));
 }
 
 bool db_get_entry(const std::string &entry_type, const std::string &entry_name,
                   std::unordered_map<std::string, std::string> &params)
 {
-    LOG(TRACE) << " - NOT IMPLEMENTED!";
+    LOG(TRACE) << entry_type << ":" << entry_name;
+
+    if (entry_name.empty()) {
+        LOG(ERROR) << "Entry name must be provided";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_db.mutex);
+    auto store = get_db();
+    if (!store) {
+        return false;
+    }
+    auto entry = store->find(entry_name);
+    if (!entry_matches(entry, entry_type)) {
+        LOG(DEBUG) << "Entry " << entry_name << " not found!";
+        return false;
+    }
+    if (params.empty()) {
+        // params map is empty, getting all parameters
+        params = entry->params;
+        return true;
+    }
+    for (auto &param : params) {
+        // params map is not empty, getting selected parameters
+        auto it = entry->params.find(param.first);
+        if (it == entry->params.end()) {
+            LOG(ERROR) << "Failed to get " << param.first;
+            return false;
+        }
+        param.second = it->second;
+    }
     return true;
 }
 
@@ -48,14 +238,46 @@ bool db_get_entries_by_type(
     const std::string &entry_type,
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> &nested_params)
 {
-    LOG(TRACE) << " - NOT IMPLEMENTED!";
+    LOG(TRACE) << entry_type;
+
+    std::lock_guard<std::mutex> lock(s_db.mutex);
+    auto store = get_db();
+    if (!store) {
+        return false;
+    }
+    for (const auto &entry : store->get_entries()) {
+        // If the entry has no parameters, there is not need to set.
+        if (!entry_matches(&entry.second, entry_type) || entry.second.params.empty()) {
+            continue;
+        }
+        nested_params[entry.first] = entry.second.params;
+    }
+
+    LOG(DEBUG) << "Found " << nested_params.size() << " entries!";
     return true;
 }
 
 bool db_remove_entry(const std::string &entry_type, const std::string &entry_name)
 {
-    LOG(TRACE) << " - NOT IMPLEMENTED!";
-    return true;
+    LOG(TRACE) << entry_type << ":" << entry_name;
+
+    if (entry_name.empty()) {
+        LOG(ERROR) << "Entry name must be provided";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_db.mutex);
+    auto store = get_db();
+    if (!store) {
+        return false;
+    }
+    if (!entry_matches(store->find(entry_name), entry_type)) {
+        LOG(DEBUG) << "Entry " << entry_name
+                   << (!entry_type.empty() ? std::string(" of type ") + entry_type : "")
+                   << " not found!";
+        return true;
+    }
+    return notify_update(store->remove(entry_name));
 }
 
 } // namespace bpl
@@ -0,0 +1,551 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "bpl_db_log_store.h"
+
+#include <mapf/common/logger.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace beerocks {
+namespace bpl {
+namespace db {
+
+constexpr size_t log_store::SYNC_BATCH_RECORDS;
+constexpr std::chrono::milliseconds log_store::SYNC_INTERVAL;
+constexpr size_t log_store::COMPACTION_MIN_SIZE;
+constexpr size_t log_store::COMPACTION_RATIO;
+
+// The file starts with a magic + format version
+static const char FILE_HEADER[]        = {'P', 'M', 'D', 'B', 'L', 'O', 'G', '1'};
+static const size_t FILE_HEADER_SIZE   = sizeof(FILE_HEADER);
+static const size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+// Anything longer is a corrupted length field
+static const size_t MAX_PAYLOAD_SIZE = 1024 * 1024;
+
+namespace {
+struct sCrc32Table {
+    uint32_t entries[256];
+    sCrc32Table()
+    {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+            }
+            entries[i] = c;
+        }
+    }
+};
+} // namespace
+
+static uint32_t crc32(const uint8_t *data, size_t length)
+{
+    static const sCrc32Table table;
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc = table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+static void put_u32(std::vector<uint8_t> &buffer, uint32_t value)
+{
+    auto offset = buffer.size();
+    buffer.resize(offset + sizeof(value));
+    std::memcpy(&buffer[offset], &value, sizeof(value));
+}
+
+static void put_string(std::vector<uint8_t> &buffer, const std::string &value)
+{
+    put_u32(buffer, value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+static bool get_u32(const uint8_t *&data, const uint8_t *end, uint32_t &value)
+{
+    if (size_t(end - data) < sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, data, sizeof(value));
+    data += sizeof(value);
+    return true;
+}
+
+static bool get_string(const uint8_t *&data, const uint8_t *end, std::string &value)
+{
+    uint32_t length;
+    if (!get_u32(data, end, length) || size_t(end - data) < length) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(data), length);
+    data += length;
+    return true;
+}
+
+static bool write_all(int fd, const uint8_t *data, size_t length)
+{
+    while (length > 0) {
+        auto written = ::write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        length -= written;
+    }
+    return true;
+}
+
+static size_t entry_record_size(const std::string &type, const std::string &name,
+                                const std::unordered_map<std::string, std::string> &params)
+{
+    // record header, operation, type, name, params count
+    size_t size = RECORD_HEADER_SIZE + 1 + sizeof(uint32_t) + type.size() + sizeof(uint32_t) +
+                  name.size() + sizeof(uint32_t);
+    for (const auto &param : params) {
+        size += 2 * sizeof(uint32_t) + param.first.size() + param.second.size();
+    }
+    return size;
+}
+
+log_store::sCompaction::~sCompaction()
+{
+    if (fd >= 0) {
+        ::close(fd);
+        unlink(temp_path.c_str());
+    }
+}
+
+log_store::~log_store() { close(); }
+
+bool log_store::open(const std::string &path)
+{
+    close();
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+    if (m_fd < 0) {
+        LOG(ERROR) << "Failed to open " << path << ": " << strerror(errno);
+        return false;
+    }
+    m_path = path;
+
+    if (!load()) {
+        close();
+        return false;
+    }
+
+    m_unsynced_records = 0;
+    m_last_sync        = std::chrono::steady_clock::now();
+
+    LOG(DEBUG) << "Loaded " << m_entries.size() << " entries from " << m_path << " ("
+               << m_file_size << " bytes, " << m_live_size << " live)";
+    return true;
+}
+
+void log_store::close()
+{
+    if (m_fd >= 0) {
+        sync();
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_entries.clear();
+    m_file_size            = 0;
+    m_live_size            = 0;
+    m_dropped_size         = 0;
+    m_next_compaction_size = 0;
+    m_unsynced_records     = 0;
+}
+
+bool log_store::load()
+{
+    struct stat st;
+    if (fstat(m_fd, &st) < 0) {
+        LOG(ERROR) << "Failed to stat " << m_path << ": " << strerror(errno);
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(st.st_size);
+    size_t offset = 0;
+    while (offset < buffer.size()) {
+        auto count = pread(m_fd, &buffer[offset], buffer.size() - offset, offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            LOG(ERROR) << "Failed to read " << m_path << ": " << strerror(errno);
+            return false;
+        }
+        offset += count;
+    }
+
+    size_t valid_size = 0;
+    if (buffer.size() >= FILE_HEADER_SIZE) {
+        if (std::memcmp(buffer.data(), FILE_HEADER, FILE_HEADER_SIZE) != 0) {
+            LOG(ERROR) << m_path << " is not a prplMesh db log";
+            return false;
+        }
+        valid_size = FILE_HEADER_SIZE;
+
+        // Replay records until the end of the file or the first torn/corrupted record
+        while (buffer.size() - valid_size >= RECORD_HEADER_SIZE) {
+            const uint8_t *data = &buffer[valid_size];
+            uint32_t length, crc;
+            std::memcpy(&length, data, sizeof(length));
+            std::memcpy(&crc, data + sizeof(length), sizeof(crc));
+            data += RECORD_HEADER_SIZE;
+
+            if (length > MAX_PAYLOAD_SIZE ||
+                length > buffer.size() - valid_size - RECORD_HEADER_SIZE) {
+                break;
+            }
+            if (crc32(data, length) != crc || !apply_record(data, length)) {
+                break;
+            }
+            valid_size += RECORD_HEADER_SIZE + length;
+        }
+    }
+
+    m_file_size = buffer.size();
+    if (valid_size == m_file_size && m_file_size > 0) {
+        return true;
+    }
+
+    if (m_file_size > valid_size) {
+        m_dropped_size = m_file_size - valid_size;
+        LOG(WARNING) << "Dropping " << m_dropped_size << " bytes of torn or corrupted records"
+                     << " from the end of " << m_path;
+    }
+
+    if (valid_size == 0) {
+        // New file, or a crash before its header was written
+        if (ftruncate(m_fd, 0) < 0 ||
+            !write_all(m_fd, reinterpret_cast<const uint8_t *>(FILE_HEADER), FILE_HEADER_SIZE)) {
+            LOG(ERROR) << "Failed to initialize " << m_path << ": " << strerror(errno);
+            return false;
+        }
+        valid_size = FILE_HEADER_SIZE;
+    } else if (ftruncate(m_fd, valid_size) < 0) {
+        LOG(ERROR) << "Failed to truncate " << m_path << ": " << strerror(errno);
+        return false;
+    }
+    m_file_size = valid_size;
+
+    if (fdatasync(m_fd) < 0) {
+        LOG(ERROR) << "Failed to sync " << m_path << ": " << strerror(errno);
+        return false;
+    }
+    return true;
+}
+
+const log_store::sEntry *log_store::find(const std::string &name) const
+{
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+bool log_store::set(const std::string &type, const std::string &name,
+                    const std::unordered_map<std::string, std::string> &params)
+{
+    std::vector<uint8_t> record;
+    encode_record(record, OP_SET, type, name, params);
+    if (!append(record)) {
+        return false;
+    }
+    apply_set(type, name, params);
+    return true;
+}
+
+bool log_store::remove(const std::string &name)
+{
+    if (m_entries.find(name) == m_entries.end()) {
+        return true;
+    }
+
+    std::vector<uint8_t> record;
+    encode_record(record, OP_REMOVE, std::string(), name,
+                  std::unordered_map<std::string, std::string>());
+    if (!append(record)) {
+        return false;
+    }
+    apply_remove(name);
+    return true;
+}
+
+bool log_store::sync()
+{
+    if (m_fd < 0 || m_unsynced_records == 0) {
+        return true;
+    }
+    if (fdatasync(m_fd) < 0) {
+        LOG(ERROR) << "Failed to sync " << m_path << ": " << strerror(errno);
+        return false;
+    }
+    m_unsynced_records = 0;
+    m_last_sync        = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool log_store::needs_compaction() const
+{
+    return m_file_size > COMPACTION_MIN_SIZE && m_file_size > COMPACTION_RATIO * m_live_size &&
+           m_file_size > m_next_compaction_size;
+}
+
+bool log_store::compact()
+{
+    sCompaction compaction;
+    return prepare_compaction(compaction) && write_compaction(compaction) &&
+           finish_compaction(compaction);
+}
+
+bool log_store::prepare_compaction(sCompaction &compaction)
+{
+    if (m_fd < 0) {
+        LOG(ERROR) << "Log is not open";
+        return false;
+    }
+
+    // Until this compaction succeeds, don't retry before the log has grown further
+    m_next_compaction_size = m_file_size + COMPACTION_MIN_SIZE;
+
+    compaction.temp_path = m_path + ".tmp";
+    compaction.log_size  = m_file_size;
+    compaction.buffer.assign(FILE_HEADER, FILE_HEADER + FILE_HEADER_SIZE);
+    compaction.buffer.reserve(m_live_size);
+    for (const auto &entry : m_entries) {
+        encode_record(compaction.buffer, OP_SET, entry.second.type, entry.first,
+                      entry.second.params);
+    }
+    return true;
+}
+
+bool log_store::write_compaction(sCompaction &compaction)
+{
+    compaction.fd = ::open(compaction.temp_path.c_str(),
+                           O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0600);
+    if (compaction.fd < 0) {
+        LOG(ERROR) << "Failed to open " << compaction.temp_path << ": " << strerror(errno);
+        return false;
+    }
+
+    if (!write_all(compaction.fd, compaction.buffer.data(), compaction.buffer.size()) ||
+        fdatasync(compaction.fd) < 0) {
+        LOG(ERROR) << "Failed to write " << compaction.temp_path << ": " << strerror(errno);
+        return false;
+    }
+    return true;
+}
+
+bool log_store::finish_compaction(sCompaction &compaction)
+{
+    if (m_fd < 0 || compaction.fd < 0 || compaction.log_size > m_file_size) {
+        LOG(ERROR) << "No compaction of " << m_path << " in progress";
+        return false;
+    }
+
+    // Copy the records written since prepare_compaction(), they are applied on top of the
+    // compacted entries when the log is loaded
+    std::vector<uint8_t> tail(m_file_size - compaction.log_size);
+    size_t offset = 0;
+    while (offset < tail.size()) {
+        auto count = pread(m_fd, &tail[offset], tail.size() - offset, compaction.log_size + offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            LOG(ERROR) << "Failed to read " << m_path << ": " << strerror(errno);
+            return false;
+        }
+        offset += count;
+    }
+    if (!tail.empty() &&
+        (!write_all(compaction.fd, tail.data(), tail.size()) || fdatasync(compaction.fd) < 0)) {
+        LOG(ERROR) << "Failed to write " << compaction.temp_path << ": " << strerror(errno);
+        return false;
+    }
+
+    if (rename(compaction.temp_path.c_str(), m_path.c_str()) < 0) {
+        LOG(ERROR) << "Failed to rename " << compaction.temp_path << ": " << strerror(errno);
+        return false;
+    }
+
+    // Make the rename itself durable
+    auto slash    = m_path.rfind('/');
+    auto dir_path = (slash == std::string::npos) ? std::string(".") : m_path.substr(0, slash + 1);
+    int dir_fd    = ::open(dir_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        fsync(dir_fd);
+        ::close(dir_fd);
+    }
+
+    auto compacted_size = compaction.buffer.size() + tail.size();
+    LOG(DEBUG) << "Compacted " << m_path << " from " << m_file_size << " to " << compacted_size
+               << " bytes";
+
+    ::close(m_fd);
+    m_fd                   = compaction.fd;
+    compaction.fd          = -1;
+    m_file_size            = compacted_size;
+    m_next_compaction_size = 0;
+    m_unsynced_records     = 0;
+    m_last_sync            = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool log_store::append(const std::vector<uint8_t> &record)
+{
+    if (m_fd < 0) {
+        LOG(ERROR) << "Log is not open";
+        return false;
+    }
+
+    if (!write_all(m_fd, record.data(), record.size())) {
+        LOG(ERROR) << "Failed to write to " << m_path << ": " << strerror(errno);
+        // Don't leave a partial record behind, the following ones would be lost on load
+        if (ftruncate(m_fd, m_file_size) < 0) {
+            LOG(ERROR) << "Failed to truncate " << m_path << ": " << strerror(errno);
+        }
+        return false;
+    }
+
+    m_file_size += record.size();
+    if (m_unsynced_records++ == 0) {
+        m_first_unsynced_time = std::chrono::steady_clock::now();
+    }
+    maybe_sync();
+    return true;
+}
+
+void log_store::maybe_sync()
+{
+    // An update following an idle period is synced right away, bursts are synced in batches
+    if (m_unsynced_records >= SYNC_BATCH_RECORDS ||
+        std::chrono::steady_clock::now() - m_last_sync >= SYNC_INTERVAL) {
+        sync();
+    }
+}
+
+void log_store::apply_set(const std::string &type, const std::string &name,
+                          const std::unordered_map<std::string, std::string> &params)
+{
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()) {
+        it = m_entries.emplace(name, sEntry()).first;
+    } else {
+        m_live_size -= it->second.record_size;
+    }
+
+    auto &entry = it->second;
+    if (!type.empty()) {
+        entry.type = type;
+    }
+    for (const auto &param : params) {
+        if (param.second.empty()) {
+            entry.params.erase(param.first);
+        } else {
+            entry.params[param.first] = param.second;
+        }
+    }
+
+    entry.record_size = entry_record_size(entry.type, name, entry.params);
+    m_live_size += entry.record_size;
+}
+
+void log_store::apply_remove(const std::string &name)
+{
+    auto it = m_entries.find(name);
+    if (it == m_entries.end()) {
+        return;
+    }
+    m_live_size -= it->second.record_size;
+    m_entries.erase(it);
+}
+
+bool log_store::apply_record(const uint8_t *payload, size_t length)
+{
+    const uint8_t *end = payload + length;
+    if (payload == end) {
+        return false;
+    }
+    auto operation = *payload++;
+
+    std::string type, name;
+    if (!get_string(payload, end, type) || !get_string(payload, end, name)) {
+        return false;
+    }
+
+    if (operation == OP_REMOVE) {
+        apply_remove(name);
+        return payload == end;
+    }
+    if (operation != OP_SET) {
+        return false;
+    }
+
+    uint32_t count;
+    if (!get_u32(payload, end, count)) {
+        return false;
+    }
+    std::unordered_map<std::string, std::string> params;
+    for (uint32_t i = 0; i < count; i++) {
+        std::string key, value;
+        if (!get_string(payload, end, key) || !get_string(payload, end, value)) {
+            return false;
+        }
+        params[key] = value;
+    }
+    if (payload != end) {
+        return false;
+    }
+
+    apply_set(type, name, params);
+    return true;
+}
+
+void log_store::encode_record(std::vector<uint8_t> &record, eOperation operation,
+                              const std::string &type, const std::string &name,
+                              const std::unordered_map<std::string, std::string> &params)
+{
+    // Reserve the record header, filled once the payload is known
+    auto header_offset = record.size();
+    record.resize(header_offset + RECORD_HEADER_SIZE);
+
+    record.push_back(operation);
+    put_string(record, type);
+    put_string(record, name);
+    if (operation == OP_SET) {
+        put_u32(record, params.size());
+        for (const auto &param : params) {
+            put_string(record, param.first);
+            put_string(record, param.second);
+        }
+    }
+
+    auto payload_offset = header_offset + RECORD_HEADER_SIZE;
+    uint32_t length     = record.size() - payload_offset;
+    uint32_t crc        = crc32(&record[payload_offset], length);
+    std::memcpy(&record[header_offset], &length, sizeof(length));
+    std::memcpy(&record[header_offset + sizeof(length)], &crc, sizeof(crc));
+}
+
+} // namespace db
+} // namespace bpl
+} // namespace beerocks
@@ -0,0 +1,255 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BPL_DB_LOG_STORE_H_
+#define _BPL_DB_LOG_STORE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace beerocks {
+namespace bpl {
+namespace db {
+
+/**
+ * @brief Log-structured, crash-safe key/value store backing the bpl::db_* API on platforms
+ * that have no UCI.
+ *
+ * Every update is appended to a single log file as a self-contained record:
+ *
+ *     | payload length (4) | CRC32 of payload (4) | payload |
+ *
+ * The payload holds the operation (set/remove), the entry type and name and, for a set, the
+ * changed parameters. An empty parameter value removes the parameter, like uci_set does.
+ *
+ * The whole database is kept in memory (an index from entry name to its type and parameters),
+ * so reads never touch the file. On open the log is replayed into the index. Replay stops at
+ * the first torn or corrupted record (a crash in the middle of a write), and the file is
+ * truncated back to the last good record.
+ *
+ * Records are written with a single write() so a crash of the process never loses an update.
+ * fsync() is batched: it is issued by append once SYNC_BATCH_RECORDS records are pending or
+ * SYNC_INTERVAL passed since the previous one. The records left pending after the last update
+ * are synced by the owner, which calls sync() once get_sync_deadline() is reached, so a power
+ * loss loses at most one batch or SYNC_INTERVAL of updates.
+ *
+ * When the log grows beyond COMPACTION_RATIO times the size of the live data, needs_compaction()
+ * is set and the owner compacts it: the live entries are written to a temporary file which is
+ * synced and atomically renamed over the log. The compaction is split in steps so that the
+ * temporary file is written without blocking the updates (see prepare_compaction()).
+ *
+ * The store is not thread safe, the owner serializes the calls.
+ */
+class log_store {
+public:
+    static constexpr size_t SYNC_BATCH_RECORDS               = 64;
+    static constexpr std::chrono::milliseconds SYNC_INTERVAL = std::chrono::milliseconds(1000);
+    static constexpr size_t COMPACTION_MIN_SIZE              = 64 * 1024;
+    static constexpr size_t COMPACTION_RATIO                 = 2;
+
+    struct sEntry {
+        std::string type;
+        std::unordered_map<std::string, std::string> params;
+        // Size of the record holding the whole entry, used to track the live data size
+        size_t record_size = 0;
+    };
+
+    /**
+     * @brief Compaction in progress, see prepare_compaction().
+     * The temporary file is closed and removed if the compaction is not finished.
+     */
+    struct sCompaction {
+        sCompaction() = default;
+        ~sCompaction();
+        sCompaction(const sCompaction &) = delete;
+        sCompaction &operator=(const sCompaction &) = delete;
+
+        std::string temp_path;
+        int fd = -1;
+        // File header and live entries at the time of prepare_compaction()
+        std::vector<uint8_t> buffer;
+        // Size of the log at the time of prepare_compaction(), the records written after it
+        // are copied to the compacted log by finish_compaction()
+        size_t log_size = 0;
+    };
+
+    log_store() = default;
+    ~log_store();
+
+    log_store(const log_store &) = delete;
+    log_store &operator=(const log_store &) = delete;
+
+    /**
+     * @brief Open the log file and load it, creating an empty log if it does not exist.
+     * A torn or corrupted tail is dropped from the file.
+     *
+     * @param[in] path path of the log file.
+     * @return true on success, false otherwise.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Sync pending records and close the log file. The in-memory index is cleared.
+     */
+    void close();
+
+    bool is_open() const { return m_fd >= 0; }
+
+    /**
+     * @brief Find an entry by name.
+     *
+     * @param[in] name name of the entry.
+     * @return pointer to the entry, or nullptr if not found. Valid until the next update.
+     */
+    const sEntry *find(const std::string &name) const;
+
+    /**
+     * @brief Get all the entries, indexed by name.
+     */
+    const std::unordered_map<std::string, sEntry> &get_entries() const { return m_entries; }
+
+    /**
+     * @brief Create or update an entry.
+     * Parameters with an empty value are removed, parameters not in @a params are unchanged.
+     *
+     * @param[in] type type of the entry.
+     * @param[in] name name of the entry.
+     * @param[in] params parameters to set.
+     * @return true on success, false if the record could not be written.
+     */
+    bool set(const std::string &type, const std::string &name,
+             const std::unordered_map<std::string, std::string> &params);
+
+    /**
+     * @brief Remove an entry. Removing an entry that does not exist succeeds.
+     *
+     * @param[in] name name of the entry.
+     * @return true on success, false if the record could not be written.
+     */
+    bool remove(const std::string &name);
+
+    /**
+     * @brief fsync() the records written since the last sync.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool sync();
+
+    /**
+     * @brief Check if records were written since the last sync.
+     */
+    bool has_unsynced_records() const { return m_unsynced_records > 0; }
+
+    /**
+     * @brief Get the time at which the unsynced records shall be synced, SYNC_INTERVAL after the
+     * oldest of them was written. Meaningless if has_unsynced_records() is not set.
+     */
+    std::chrono::steady_clock::time_point get_sync_deadline() const
+    {
+        return m_first_unsynced_time + SYNC_INTERVAL;
+    }
+
+    /**
+     * @brief Check if the log has grown enough to be compacted.
+     */
+    bool needs_compaction() const;
+
+    /**
+     * @brief Rewrite the log with the live entries only, in a single call.
+     *
+     * @return true on success, false otherwise (the current log is left intact).
+     */
+    bool compact();
+
+    /**
+     * @brief First step of a compaction: encode the live entries in memory.
+     *
+     * The owner may then release its lock, call write_compaction() and take its lock again to
+     * call finish_compaction(). Updates done in between are kept.
+     *
+     * @param[out] compaction compaction state.
+     * @return true on success, false otherwise.
+     */
+    bool prepare_compaction(sCompaction &compaction);
+
+    /**
+     * @brief Second step of a compaction: write and sync the temporary file.
+     * Does not access the store, so it can run concurrently with its updates.
+     *
+     * @param[in,out] compaction compaction state, from prepare_compaction().
+     * @return true on success, false otherwise.
+     */
+    static bool write_compaction(sCompaction &compaction);
+
+    /**
+     * @brief Last step of a compaction: copy the records written since prepare_compaction() and
+     * replace the log with the temporary file.
+     *
+     * @param[in,out] compaction compaction state, from write_compaction().
+     * @return true on success, false otherwise (the current log is left intact).
+     */
+    bool finish_compaction(sCompaction &compaction);
+
+    /**
+     * @brief Get the size of the log file, in bytes.
+     */
+    size_t get_file_size() const { return m_file_size; }
+
+    /**
+     * @brief Get the size the log file would have after compaction, in bytes.
+     */
+    size_t get_live_size() const { return m_live_size; }
+
+    /**
+     * @brief Get the number of bytes dropped from the log tail while loading it.
+     */
+    size_t get_dropped_size() const { return m_dropped_size; }
+
+private:
+    enum eOperation : uint8_t {
+        OP_SET    = 1,
+        OP_REMOVE = 2,
+    };
+
+    bool load();
+    bool append(const std::vector<uint8_t> &record);
+    void apply_set(const std::string &type, const std::string &name,
+                   const std::unordered_map<std::string, std::string> &params);
+    void apply_remove(const std::string &name);
+    bool apply_record(const uint8_t *payload, size_t length);
+    void maybe_sync();
+
+    static void encode_record(std::vector<uint8_t> &record, eOperation operation,
+                              const std::string &type, const std::string &name,
+                              const std::unordered_map<std::string, std::string> &params);
+
+    std::string m_path;
+    int m_fd = -1;
+
+    std::unordered_map<std::string, sEntry> m_entries;
+
+    size_t m_file_size    = 0;
+    size_t m_live_size    = 0;
+    size_t m_dropped_size = 0;
+
+    // Set when a compaction fails, to retry only once the log has grown further
+    size_t m_next_compaction_size = 0;
+
+    size_t m_unsynced_records = 0;
+    std::chrono::steady_clock::time_point m_first_unsynced_time;
+    std::chrono::steady_clock::time_point m_last_sync;
+};
+
+} // namespace db
+} // namespace bpl
+} // namespace beerocks
+
+#endif // _BPL_DB_LOG_STORE_H_
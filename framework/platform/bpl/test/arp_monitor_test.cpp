@@ -0,0 +1,356 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "../uci/arp/monitor/arp_monitor.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <linux/neighbour.h>
+#include <linux/rtnetlink.h>
+
+#include <netlink/cache.h>
+#include <netlink/msg.h>
+
+namespace beerocks {
+namespace bpl {
+
+using namespace std::chrono;
+
+namespace {
+
+struct sNeigh {
+    uint8_t ip[BPL_ARP_MON_IP_LEN];
+    uint8_t mac[BPL_ARP_MON_MAC_LEN];
+    uint32_t ifindex;
+    uint16_t state;
+    uint8_t family;
+};
+
+sNeigh make_neigh(uint8_t id, uint8_t mac_id = 0, uint32_t ifindex = 3,
+                  uint16_t state = NUD_REACHABLE, uint8_t family = AF_INET)
+{
+    sNeigh neigh = {{192, 168, 1, id},
+                    {0x02, 0x00, 0x00, 0x00, 0x00, mac_id ? mac_id : id},
+                    ifindex,
+                    state,
+                    family};
+    return neigh;
+}
+
+void append_attr(std::vector<char> &message, uint16_t type, const void *data, size_t len)
+{
+    size_t offset = message.size();
+    message.resize(offset + RTA_SPACE(len));
+    auto rta      = (struct rtattr *)&message[offset];
+    rta->rta_type = type;
+    rta->rta_len  = RTA_LENGTH(len);
+    std::memcpy(RTA_DATA(rta), data, len);
+}
+
+// Netlink message of the kernel neighbor table, as sent in a dump or a notification
+std::vector<char> make_neigh_message(uint16_t type, const sNeigh &neigh)
+{
+    std::vector<char> message(NLMSG_LENGTH(sizeof(struct ndmsg)));
+
+    auto r          = (struct ndmsg *)NLMSG_DATA((struct nlmsghdr *)message.data());
+    r->ndm_family   = neigh.family;
+    r->ndm_ifindex  = neigh.ifindex;
+    r->ndm_state    = neigh.state;
+    r->ndm_type     = RTN_UNICAST;
+    append_attr(message, NDA_DST, neigh.ip, sizeof(neigh.ip));
+    append_attr(message, NDA_LLADDR, neigh.mac, sizeof(neigh.mac));
+
+    auto h         = (struct nlmsghdr *)message.data();
+    h->nlmsg_len   = message.size();
+    h->nlmsg_type  = type;
+    h->nlmsg_flags = (type == RTM_NEWNEIGH) ? NLM_F_MULTI : 0;
+    return message;
+}
+
+std::vector<char> make_datagram(const std::vector<std::vector<char>> &messages)
+{
+    std::vector<char> datagram;
+    for (const auto &message : messages) {
+        datagram.insert(datagram.end(), message.begin(), message.end());
+        datagram.resize(NLMSG_ALIGN(datagram.size()));
+    }
+    return datagram;
+}
+
+} // namespace
+
+class arp_monitor_test : public ::testing::Test {
+protected:
+    // Load the neighbor cache from the RTM_NEWNEIGH messages of an RTM_GETNEIGH dump
+    void load_dump(const std::vector<sNeigh> &table)
+    {
+        struct nl_cache *cache = nullptr;
+        ASSERT_EQ(nl_cache_alloc_name("route/neigh", &cache), 0);
+        for (const auto &neigh : table) {
+            auto message = make_neigh_message(RTM_NEWNEIGH, neigh);
+            auto msg     = nlmsg_convert((struct nlmsghdr *)message.data());
+            ASSERT_NE(msg, nullptr);
+            EXPECT_EQ(nl_cache_parse_and_add(cache, msg), 0);
+            nlmsg_free(msg);
+        }
+        m_monitor.load_neigh_cache(cache);
+        nl_cache_free(cache);
+    }
+
+    bool handle_messages(const std::vector<std::vector<char>> &messages)
+    {
+        auto datagram = make_datagram(messages);
+        return m_monitor.handle_mon_messages(datagram.data(), datagram.size());
+    }
+
+    std::vector<BPL_ARP_MON_ENTRY> take_pending()
+    {
+        std::vector<BPL_ARP_MON_ENTRY> entries(m_monitor.m_vecPending.size());
+        if (!entries.empty()) {
+            entries.resize(m_monitor.process_mon(entries.data(), entries.size()));
+        }
+        return entries;
+    }
+
+    bool has_mac_for_ip(const sNeigh &neigh, const uint8_t expected_mac[BPL_ARP_MON_MAC_LEN])
+    {
+        uint8_t mac[BPL_ARP_MON_MAC_LEN];
+        return m_monitor.get_mac_for_ip(neigh.ip, mac) &&
+               std::memcmp(mac, expected_mac, sizeof(mac)) == 0;
+    }
+
+    bool has_ip_for_mac(const sNeigh &neigh, const uint8_t expected_ip[BPL_ARP_MON_IP_LEN])
+    {
+        uint8_t ip[BPL_ARP_MON_IP_LEN];
+        return m_monitor.get_ip_for_mac(neigh.mac, ip) &&
+               std::memcmp(ip, expected_ip, sizeof(ip)) == 0;
+    }
+
+    size_t cache_size() const { return m_monitor.m_mapNeighByIP.size(); }
+
+    size_t mac_index_size() const { return m_monitor.m_mapNeighIPByMac.size(); }
+
+    uint32_t cached_iface_idx(const sNeigh &neigh) const
+    {
+        uint32_t key;
+        std::memcpy(&key, neigh.ip, sizeof(key));
+        auto it = m_monitor.m_mapNeighByIP.find(key);
+        return (it == m_monitor.m_mapNeighByIP.end()) ? 0 : it->second.iface_idx;
+    }
+
+    void start_probe_wheel(steady_clock::time_point tpStart) { m_monitor.m_tpProbeWheel = tpStart; }
+
+    void add_probe(const sNeigh &neigh, int iTaskID, steady_clock::time_point tpNow)
+    {
+        m_monitor.add_probe(neigh.mac, neigh.ip, iTaskID, tpNow);
+    }
+
+    void expire_probes(steady_clock::time_point tpNow) { m_monitor.expire_probes(tpNow); }
+
+    // Same as a reply received by process_arp()
+    void answer_probe(const sNeigh &neigh)
+    {
+        for (auto it = m_monitor.m_mapProbe.begin(); it != m_monitor.m_mapProbe.end(); ++it) {
+            if (std::memcmp(it->second.ip, neigh.ip, sizeof(neigh.ip)) == 0) {
+                m_monitor.m_mapProbe.erase(it);
+                return;
+            }
+        }
+    }
+
+    int probe_task_id(const sNeigh &neigh) const
+    {
+        for (const auto &probe : m_monitor.m_mapProbe) {
+            if (std::memcmp(probe.second.ip, neigh.ip, sizeof(neigh.ip)) == 0) {
+                return probe.second.iTaskID;
+            }
+        }
+        return 0;
+    }
+
+    size_t probe_count() const { return m_monitor.m_mapProbe.size(); }
+
+    arp_monitor m_monitor;
+};
+
+TEST_F(arp_monitor_test, dump_should_load_every_valid_ipv4_record)
+{
+    auto first  = make_neigh(1);
+    auto stale  = make_neigh(2, 0, 3, NUD_STALE);
+    auto noarp  = make_neigh(3, 0, 3, NUD_NOARP);
+    auto failed = make_neigh(4, 0, 3, NUD_FAILED);
+    auto ipv6   = make_neigh(5, 0, 3, NUD_REACHABLE, AF_INET6);
+    auto last   = make_neigh(6);
+
+    load_dump({first, stale, noarp, failed, ipv6, last});
+
+    EXPECT_EQ(cache_size(), 3U);
+    EXPECT_TRUE(has_mac_for_ip(first, first.mac));
+    EXPECT_TRUE(has_mac_for_ip(stale, stale.mac));
+    EXPECT_TRUE(has_mac_for_ip(last, last.mac));
+    EXPECT_TRUE(has_ip_for_mac(last, last.ip));
+    uint8_t mac[BPL_ARP_MON_MAC_LEN];
+    EXPECT_FALSE(m_monitor.get_mac_for_ip(noarp.ip, mac));
+    EXPECT_FALSE(m_monitor.get_mac_for_ip(failed.ip, mac));
+}
+
+TEST_F(arp_monitor_test, empty_dump_should_load_an_empty_cache)
+{
+    load_dump({make_neigh(1)});
+    ASSERT_EQ(cache_size(), 1U);
+
+    load_dump({});
+    EXPECT_EQ(cache_size(), 0U);
+    EXPECT_EQ(mac_index_size(), 0U);
+}
+
+TEST_F(arp_monitor_test, interface_index_should_not_be_truncated)
+{
+    auto dumped   = make_neigh(1, 0, 300);
+    auto notified = make_neigh(2, 0, 0x10002);
+
+    load_dump({dumped});
+    ASSERT_TRUE(handle_messages({make_neigh_message(RTM_NEWNEIGH, notified)}));
+
+    EXPECT_EQ(cached_iface_idx(dumped), 300U);
+    EXPECT_EQ(cached_iface_idx(notified), 0x10002U);
+    auto entries = take_pending();
+    ASSERT_EQ(entries.size(), 1U);
+    EXPECT_EQ(entries[0].iface_idx, 0x10002U);
+}
+
+TEST_F(arp_monitor_test, notifications_should_update_the_cache)
+{
+    auto added      = make_neigh(1);
+    auto removed    = make_neigh(2);
+    auto ignored    = make_neigh(3, 0, 3, NUD_REACHABLE, AF_INET6);
+    auto incomplete = make_neigh(4, 0, 3, NUD_INCOMPLETE);
+    load_dump({removed});
+
+    ASSERT_TRUE(handle_messages({
+        make_neigh_message(RTM_NEWNEIGH, added),
+        make_neigh_message(RTM_DELNEIGH, removed),
+        make_neigh_message(RTM_NEWNEIGH, ignored),
+        make_neigh_message(RTM_NEWNEIGH, incomplete),
+    }));
+
+    EXPECT_EQ(cache_size(), 1U);
+    EXPECT_TRUE(has_mac_for_ip(added, added.mac));
+    EXPECT_TRUE(has_ip_for_mac(added, added.ip));
+    uint8_t ip[BPL_ARP_MON_IP_LEN];
+    EXPECT_FALSE(m_monitor.get_ip_for_mac(removed.mac, ip));
+    EXPECT_FALSE(m_monitor.get_ip_for_mac(incomplete.mac, ip));
+
+    // The removal is not reported, the others are in the order received
+    auto entries = take_pending();
+    ASSERT_EQ(entries.size(), 2U);
+    EXPECT_EQ(entries[0].type, BPL_ARP_TYPE_NEWNEIGH);
+    EXPECT_EQ(std::memcmp(entries[0].mac, added.mac, sizeof(added.mac)), 0);
+    EXPECT_EQ(std::memcmp(entries[1].ip, incomplete.ip, sizeof(incomplete.ip)), 0);
+}
+
+TEST_F(arp_monitor_test, truncated_message_should_fail)
+{
+    auto message = make_neigh_message(RTM_NEWNEIGH, make_neigh(1));
+    auto h       = (struct nlmsghdr *)message.data();
+    h->nlmsg_len = NLMSG_LENGTH(sizeof(struct ndmsg) - 1);
+    message.resize(h->nlmsg_len);
+
+    EXPECT_FALSE(handle_messages({message}));
+}
+
+TEST_F(arp_monitor_test, mac_index_should_follow_the_ip_of_the_mac)
+{
+    auto neigh   = make_neigh(1, 0x10);
+    auto moved   = make_neigh(1, 0x20);
+    auto renewed = make_neigh(2, 0x20);
+    load_dump({neigh});
+
+    // The IP moved to another MAC
+    ASSERT_TRUE(handle_messages({make_neigh_message(RTM_NEWNEIGH, moved)}));
+    EXPECT_TRUE(has_mac_for_ip(neigh, moved.mac));
+    uint8_t ip[BPL_ARP_MON_IP_LEN];
+    EXPECT_FALSE(m_monitor.get_ip_for_mac(neigh.mac, ip));
+    EXPECT_TRUE(has_ip_for_mac(moved, moved.ip));
+    EXPECT_EQ(mac_index_size(), 1U);
+
+    // A second IP for the same MAC: only the most recent one is indexed
+    ASSERT_TRUE(handle_messages({make_neigh_message(RTM_NEWNEIGH, renewed)}));
+    EXPECT_EQ(cache_size(), 2U);
+    EXPECT_TRUE(has_ip_for_mac(moved, renewed.ip));
+
+    // Updating the older IP does not take the index back
+    ASSERT_TRUE(handle_messages({make_neigh_message(RTM_DELNEIGH, moved)}));
+    EXPECT_TRUE(has_ip_for_mac(moved, renewed.ip));
+
+    ASSERT_TRUE(handle_messages({make_neigh_message(RTM_DELNEIGH, renewed)}));
+    EXPECT_FALSE(m_monitor.get_ip_for_mac(moved.mac, ip));
+    EXPECT_EQ(cache_size(), 0U);
+    EXPECT_EQ(mac_index_size(), 0U);
+}
+
+TEST_F(arp_monitor_test, probe_should_expire_in_the_second_after_its_timeout)
+{
+    auto t0    = steady_clock::now();
+    auto neigh = make_neigh(1);
+    start_probe_wheel(t0);
+
+    add_probe(neigh, 7, t0 + milliseconds(200));
+    // Already waiting for a reply, the probe is not restarted
+    add_probe(neigh, 8, t0 + seconds(3));
+    EXPECT_EQ(probe_task_id(neigh), 7);
+
+    expire_probes(t0 + seconds(5));
+    EXPECT_EQ(probe_count(), 1U);
+    expire_probes(t0 + seconds(6));
+    EXPECT_EQ(probe_count(), 0U);
+
+    // Timed out, the probe restarts
+    add_probe(neigh, 9, t0 + seconds(6));
+    EXPECT_EQ(probe_task_id(neigh), 9);
+}
+
+TEST_F(arp_monitor_test, restarted_probe_should_not_expire_in_the_old_slot)
+{
+    auto t0    = steady_clock::now();
+    auto neigh = make_neigh(1);
+    start_probe_wheel(t0);
+
+    add_probe(neigh, 7, t0);
+    answer_probe(neigh);
+    add_probe(neigh, 8, t0 + seconds(3));
+
+    expire_probes(t0 + seconds(7));
+    EXPECT_EQ(probe_task_id(neigh), 8);
+    expire_probes(t0 + seconds(9));
+    EXPECT_EQ(probe_count(), 0U);
+}
+
+TEST_F(arp_monitor_test, probes_should_expire_after_a_long_idle_period)
+{
+    auto t0    = steady_clock::now();
+    auto first = make_neigh(1);
+    auto later = make_neigh(2);
+    start_probe_wheel(t0);
+
+    add_probe(first, 7, t0);
+    expire_probes(t0 + seconds(100));
+    EXPECT_EQ(probe_count(), 0U);
+
+    // The wheel is in sync with the time again
+    add_probe(later, 8, t0 + seconds(100));
+    expire_probes(t0 + seconds(105));
+    EXPECT_EQ(probe_count(), 1U);
+    expire_probes(t0 + seconds(106));
+    EXPECT_EQ(probe_count(), 0U);
+}
+
+} // namespace bpl
+} // namespace beerocks
@@ -0,0 +1,290 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "../linux/db/bpl_db_log_store.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace beerocks::bpl::db;
+
+namespace {
+
+class LogStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        char dir_template[] = "/tmp/bpl_db_log_store_test.XXXXXX";
+        ASSERT_NE(mkdtemp(dir_template), nullptr);
+        m_dir  = dir_template;
+        m_path = m_dir + "/db.log";
+    }
+
+    void TearDown() override
+    {
+        unlink(m_path.c_str());
+        unlink((m_path + ".tmp").c_str());
+        rmdir(m_dir.c_str());
+    }
+
+    size_t file_size()
+    {
+        struct stat st;
+        if (stat(m_path.c_str(), &st) < 0) {
+            return 0;
+        }
+        return st.st_size;
+    }
+
+    void truncate_file(size_t size) { ASSERT_EQ(truncate(m_path.c_str(), size), 0); }
+
+    void append_to_file(const std::string &data)
+    {
+        int fd = open(m_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0600);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(write(fd, data.data(), data.size()), ssize_t(data.size()));
+        close(fd);
+    }
+
+    void flip_byte(size_t offset)
+    {
+        int fd = open(m_path.c_str(), O_RDWR);
+        ASSERT_GE(fd, 0);
+        uint8_t byte;
+        ASSERT_EQ(pread(fd, &byte, 1, offset), 1);
+        byte ^= 0xFF;
+        ASSERT_EQ(pwrite(fd, &byte, 1, offset), 1);
+        close(fd);
+    }
+
+    std::string m_dir;
+    std::string m_path;
+};
+
+TEST_F(LogStoreTest, entries_should_persist_across_reopen)
+{
+    {
+        log_store store;
+        ASSERT_TRUE(store.open(m_path));
+        EXPECT_TRUE(store.set("client", "client_1", {{"timestamp", "100"}, {"steering", "1"}}));
+        EXPECT_TRUE(store.set("client", "client_2", {{"timestamp", "200"}}));
+        EXPECT_TRUE(store.set("client", "client_1", {{"timestamp", "101"}, {"steering", ""}}));
+        EXPECT_TRUE(store.remove("client_2"));
+    }
+
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_EQ(store.get_dropped_size(), 0U);
+    ASSERT_EQ(store.get_entries().size(), 1U);
+
+    auto entry = store.find("client_1");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->type, "client");
+    ASSERT_EQ(entry->params.size(), 1U);
+    EXPECT_EQ(entry->params.at("timestamp"), "101");
+    EXPECT_EQ(store.find("client_2"), nullptr);
+}
+
+TEST_F(LogStoreTest, torn_record_should_be_dropped_on_recovery)
+{
+    size_t size_before_last_record;
+    {
+        log_store store;
+        ASSERT_TRUE(store.open(m_path));
+        EXPECT_TRUE(store.set("client", "client_1", {{"timestamp", "100"}}));
+        size_before_last_record = store.get_file_size();
+        EXPECT_TRUE(store.set("client", "client_2", {{"timestamp", "200"}}));
+    }
+
+    // Crash in the middle of writing the last record
+    truncate_file(file_size() - 3);
+
+    {
+        log_store store;
+        ASSERT_TRUE(store.open(m_path));
+        EXPECT_GT(store.get_dropped_size(), 0U);
+        EXPECT_NE(store.find("client_1"), nullptr);
+        EXPECT_EQ(store.find("client_2"), nullptr);
+        EXPECT_EQ(file_size(), size_before_last_record);
+
+        // The log is usable after recovery
+        EXPECT_TRUE(store.set("client", "client_3", {{"timestamp", "300"}}));
+    }
+
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_EQ(store.get_dropped_size(), 0U);
+    EXPECT_NE(store.find("client_1"), nullptr);
+    EXPECT_NE(store.find("client_3"), nullptr);
+}
+
+TEST_F(LogStoreTest, corrupted_record_should_be_dropped_on_recovery)
+{
+    size_t size_before_last_record;
+    {
+        log_store store;
+        ASSERT_TRUE(store.open(m_path));
+        EXPECT_TRUE(store.set("client", "client_1", {{"timestamp", "100"}}));
+        size_before_last_record = store.get_file_size();
+        EXPECT_TRUE(store.set("client", "client_2", {{"timestamp", "200"}}));
+    }
+
+    // Garbage in the payload of the last record
+    auto size = file_size();
+    flip_byte(size - 1);
+
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_EQ(store.get_dropped_size(), size - size_before_last_record);
+    EXPECT_NE(store.find("client_1"), nullptr);
+    EXPECT_EQ(store.find("client_2"), nullptr);
+    EXPECT_EQ(file_size(), size_before_last_record);
+}
+
+TEST_F(LogStoreTest, partial_record_header_should_be_dropped_on_recovery)
+{
+    {
+        log_store store;
+        ASSERT_TRUE(store.open(m_path));
+        EXPECT_TRUE(store.set("client", "client_1", {{"timestamp", "100"}}));
+    }
+    auto size = file_size();
+
+    append_to_file(std::string("\x10\x00", 2));
+
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_EQ(store.get_dropped_size(), 2U);
+    EXPECT_NE(store.find("client_1"), nullptr);
+    EXPECT_EQ(file_size(), size);
+}
+
+TEST_F(LogStoreTest, torn_file_header_should_start_an_empty_log)
+{
+    append_to_file("PMD");
+
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_TRUE(store.get_entries().empty());
+    EXPECT_TRUE(store.set("client", "client_1", {{"timestamp", "100"}}));
+}
+
+TEST_F(LogStoreTest, foreign_file_should_not_be_opened)
+{
+    append_to_file("config 'client' 'client_1'\n");
+
+    log_store store;
+    EXPECT_FALSE(store.open(m_path));
+}
+
+TEST_F(LogStoreTest, compaction_should_keep_live_entries_only)
+{
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+
+    // Overwrite the same entries until the log needs a compaction
+    for (int i = 0; i < 5000; i++) {
+        auto name = "client_" + std::to_string(i % 10);
+        ASSERT_TRUE(store.set("client", name, {{"timestamp", std::to_string(i)}}));
+    }
+    // The updates don't compact the log, the owner does
+    EXPECT_GT(store.get_file_size(), log_store::COMPACTION_MIN_SIZE);
+    EXPECT_TRUE(store.needs_compaction());
+
+    ASSERT_TRUE(store.compact());
+    EXPECT_FALSE(store.needs_compaction());
+    // Only the file header and one record per entry are left
+    EXPECT_EQ(store.get_file_size(), store.get_live_size() + 8);
+    EXPECT_EQ(file_size(), store.get_file_size());
+
+    store.close();
+    ASSERT_TRUE(store.open(m_path));
+    ASSERT_EQ(store.get_entries().size(), 10U);
+    for (int i = 0; i < 10; i++) {
+        auto entry = store.find("client_" + std::to_string(i));
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry->params.at("timestamp"), std::to_string(4990 + i));
+    }
+}
+
+TEST_F(LogStoreTest, updates_during_compaction_should_be_kept)
+{
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(store.set("client", "client_" + std::to_string(i), {{"timestamp", "0"}}));
+    }
+
+    log_store::sCompaction compaction;
+    ASSERT_TRUE(store.prepare_compaction(compaction));
+    // Updates done while the compacted log is written, as the owner doesn't hold its lock
+    ASSERT_TRUE(store.set("client", "client_0", {{"timestamp", "1"}}));
+    ASSERT_TRUE(store.set("client", "client_10", {{"timestamp", "1"}}));
+    ASSERT_TRUE(store.remove("client_1"));
+    ASSERT_TRUE(log_store::write_compaction(compaction));
+    ASSERT_TRUE(store.finish_compaction(compaction));
+    EXPECT_EQ(file_size(), store.get_file_size());
+
+    store.close();
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_EQ(store.get_dropped_size(), 0U);
+    EXPECT_EQ(store.get_entries().size(), 10U);
+    EXPECT_EQ(store.find("client_1"), nullptr);
+    ASSERT_NE(store.find("client_0"), nullptr);
+    EXPECT_EQ(store.find("client_0")->params.at("timestamp"), "1");
+    ASSERT_NE(store.find("client_10"), nullptr);
+}
+
+TEST_F(LogStoreTest, unsynced_records_should_have_a_sync_deadline)
+{
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_FALSE(store.has_unsynced_records());
+
+    auto before = std::chrono::steady_clock::now();
+    ASSERT_TRUE(store.set("client", "client_0", {{"timestamp", "0"}}));
+    auto after = std::chrono::steady_clock::now();
+    ASSERT_TRUE(store.has_unsynced_records());
+    auto deadline = store.get_sync_deadline();
+    EXPECT_GE(deadline, before + log_store::SYNC_INTERVAL);
+    EXPECT_LE(deadline, after + log_store::SYNC_INTERVAL);
+
+    // The deadline is set by the oldest unsynced record
+    ASSERT_TRUE(store.set("client", "client_1", {{"timestamp", "0"}}));
+    EXPECT_EQ(store.get_sync_deadline(), deadline);
+
+    ASSERT_TRUE(store.sync());
+    EXPECT_FALSE(store.has_unsynced_records());
+}
+
+TEST_F(LogStoreTest, thousands_of_entries_should_be_reloaded)
+{
+    const int entries_count = 5000;
+    {
+        log_store store;
+        ASSERT_TRUE(store.open(m_path));
+        for (int i = 0; i < entries_count; i++) {
+            ASSERT_TRUE(store.set("client", "client_" + std::to_string(i),
+                                  {{"timestamp", std::to_string(i)}, {"steering", "1"}}));
+        }
+    }
+
+    log_store store;
+    ASSERT_TRUE(store.open(m_path));
+    EXPECT_EQ(store.get_dropped_size(), 0U);
+    ASSERT_EQ(store.get_entries().size(), size_t(entries_count));
+    auto entry = store.find("client_" + std::to_string(entries_count - 1));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->params.at("timestamp"), std::to_string(entries_count - 1));
+}
+
+} // namespace
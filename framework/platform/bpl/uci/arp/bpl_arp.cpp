@@ -99,19 +99,18 @@ int arp_mon_get_raw_arp_fd(BPL_ARP_MON_CTX ctx)
     return pArpMon->get_arp_fd();
 }
 
-int arp_mon_process(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entry)
+int arp_mon_process(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entries, int max_entries)
 {
-    if (!ctx || !entry) {
-        LOG(ERROR) << "Invalid argument: ctx = " << ctx << ", entry = " << entry;
+    if (!ctx || !entries || max_entries <= 0) {
+        LOG(ERROR) << "Invalid argument: ctx = " << ctx << ", entries = " << entries
+                   << ", max_entries = " << max_entries;
 
         return -1;
     }
 
     arp_monitor *pArpMon = (arp_monitor *)ctx;
-    if (pArpMon->process_mon(*entry) == false)
-        return -1;
 
-    return 0;
+    return pArpMon->process_mon(entries, max_entries);
 }
 
 int arp_mon_process_raw_arp(BPL_ARP_MON_CTX ctx, struct BPL_ARP_MON_ENTRY *entry)
@@ -58,87 +58,78 @@ typedef struct {
     uint8_t ip[4];
     uint8_t mac[6];
     uint8_t state;
-    uint8_t ifindex;
+    uint32_t ifindex;
 } arp_neigh;
 
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// Local Module Functions ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
-static bool read_arp_table(struct nl_sock *sock, std::vector<arp_neigh> &vecNeigh)
+static void read_neigh_cache(struct nl_cache *neightbl_cache, std::vector<arp_neigh> &vecNeigh)
 {
-    // ARP table cache
-    struct nl_cache *neightbl_cache = nullptr;
-
-    // Allocate the cache and fill it with data
-    int ret;
-    if ((ret = rtnl_neigh_alloc_cache(sock, &neightbl_cache)) != 0) {
-        LOG(ERROR) << "Failed probing ARP table: " << nl_geterror(ret);
-        return false;
-    }
+    // Iterate over all the records (an empty table is not an error)
+    auto object = nl_cache_get_first(neightbl_cache);
+    for (; object; object = nl_cache_get_next(object)) {
+        auto neigh = (struct rtnl_neigh *)object;
 
-    // struct nl_dump_params params;
-    // memset(&params, 0, sizeof(nl_dump_params));
-
-    // params.dp_type = NL_DUMP_DETAILS;//NL_DUMP_LINE;
-    // params.dp_fd = stdout;
-    // // params.dp_type = NL_DUMP_DETAILS;
-    // // params.dp_prefix = 30;
-    // // params.dp_print_index = 1;
-    // // params.dp_dump_msgtype = 1;
-    // // params.dp_cb = NULL;
-    // // params.dp_nl_cb = NULL;
-    // // params.dp_data = NULL;
-    // // params.dp_fd = stdout;
-    // // params.dp_buf = NULL;
-    // // params.dp_buflen = 0;
-
-    // nl_cache_dump(neightbl_cache, &params);
-
-    int num_of_items = nl_cache_nitems(neightbl_cache);
-
-    struct rtnl_neigh *neigh = (rtnl_neigh *)nl_cache_get_first(neightbl_cache);
-    if (!neigh) {
-        MAPF_ERR("neigh is null");
-        nl_cache_free(neightbl_cache);
-        return false;
-    }
-
-    for (int i = 0; i < num_of_items; i++) {
-        arp_neigh curr_neigh = {0};
+        arp_neigh curr_neigh = {};
 
         curr_neigh.ifindex = rtnl_neigh_get_ifindex(neigh);
         curr_neigh.state   = rtnl_neigh_get_state(neigh);
 
         // Skip NOARP state and non IPv4 records
-        if (curr_neigh.state != NUD_NOARP && rtnl_neigh_get_family(neigh) == AF_INET) {
+        if (curr_neigh.state == NUD_NOARP || rtnl_neigh_get_family(neigh) != AF_INET) {
+            continue;
+        }
 
-            // Only store valid records
-            if (rtnl_neigh_get_dst(neigh) && rtnl_neigh_get_lladdr(neigh)) {
-                std::copy_n((uint8_t *)nl_addr_get_binary_addr(rtnl_neigh_get_dst(neigh)), 4,
-                            curr_neigh.ip);
-                std::copy_n((uint8_t *)nl_addr_get_binary_addr(rtnl_neigh_get_lladdr(neigh)), 6,
-                            curr_neigh.mac);
+        // Only store valid records
+        if (rtnl_neigh_get_dst(neigh) && rtnl_neigh_get_lladdr(neigh)) {
+            std::copy_n((uint8_t *)nl_addr_get_binary_addr(rtnl_neigh_get_dst(neigh)), 4,
+                        curr_neigh.ip);
+            std::copy_n((uint8_t *)nl_addr_get_binary_addr(rtnl_neigh_get_lladdr(neigh)), 6,
+                        curr_neigh.mac);
 
-                vecNeigh.push_back(curr_neigh);
-            }
+            vecNeigh.push_back(curr_neigh);
         }
+    }
+}
 
-        // Advance to the next record
-        neigh = (rtnl_neigh *)nl_cache_get_next((nl_object *)neigh);
-        if (!neigh) {
-            MAPF_ERR("neigh is null");
-            nl_cache_free(neightbl_cache);
-            return false;
-        }
+static bool read_arp_table(struct nl_sock *sock, std::vector<arp_neigh> &vecNeigh)
+{
+    // ARP table cache
+    struct nl_cache *neightbl_cache = nullptr;
+
+    // Allocate the cache and fill it with data
+    int ret;
+    if ((ret = rtnl_neigh_alloc_cache(sock, &neightbl_cache)) != 0) {
+        LOG(ERROR) << "Failed probing ARP table: " << nl_geterror(ret);
+        return false;
     }
 
+    read_neigh_cache(neightbl_cache, vecNeigh);
+
     // Free the cache
     nl_cache_free(neightbl_cache);
 
     return true;
 }
 
+static uint64_t mac_to_key(const uint8_t mac[BPL_ARP_MON_MAC_LEN])
+{
+    uint64_t key = 0;
+    for (int i = 0; i < BPL_ARP_MON_MAC_LEN; i++) {
+        key = (key << 8) | mac[i];
+    }
+    return key;
+}
+
+static uint32_t ip_to_key(const uint8_t ip[BPL_ARP_MON_IP_LEN])
+{
+    uint32_t key;
+    std::copy_n(ip, BPL_ARP_MON_IP_LEN, (uint8_t *)&key);
+    return key;
+}
+
 static bool send_arp(std::string iface, std::string dst_ip, std::string src_ip, uint8_t *dst_mac,
                      uint8_t *src_mac, int count, int arp_socket)
 {
@@ -270,6 +261,14 @@ int arp_monitor::start(std::string strIface)
         return -1;
     }
 
+    // The monitoring socket is already bound, so changes made during the dump are not lost
+    if (!load_neigh_cache()) {
+        stop();
+        return -1;
+    }
+
+    m_tpProbeWheel = std::chrono::steady_clock::now();
+
     return 0;
 }
 
@@ -289,162 +288,223 @@ void arp_monitor::stop()
         nl_socket_free(m_pNlSocket);
         m_pNlSocket = nullptr;
     }
+
+    m_mapNeighByIP.clear();
+    m_mapNeighIPByMac.clear();
+    m_mapProbe.clear();
+    for (auto &slot : m_arrProbeWheel) {
+        slot.clear();
+    }
+    m_vecPending.clear();
 }
 
-bool arp_monitor::process_mon(BPL_ARP_MON_ENTRY &sArpMonData)
+bool arp_monitor::load_neigh_cache()
 {
-    char buf_local[256];
-    struct sockaddr_nl nladdr;
-    struct iovec iov;
-
-    memset(&nladdr, 0, sizeof(nladdr));
-    nladdr.nl_family = AF_NETLINK;
-    nladdr.nl_pid    = 0;
-    nladdr.nl_groups = 0;
-    iov.iov_base     = buf_local;
-    iov.iov_len      = sizeof(buf_local);
-
-    // Reading the message (non-blocking)
-    struct msghdr msg;
-    msg.msg_name    = &nladdr;
-    msg.msg_namelen = sizeof(nladdr);
-    msg.msg_iov     = &iov;
-    msg.msg_iovlen  = 1;
-
-    memset(&sArpMonData, 0, sizeof(sArpMonData));
-
-    ssize_t status;
-    if ((status = recvmsg(m_fdMonSocket, &msg, MSG_DONTWAIT | MSG_ERRQUEUE)) < 0) {
-        LOG(ERROR) << "Failed reading from socket: " << strerror(errno);
-        // if (errno == EINTR || errno == EAGAIN || errno == ENOBUFS)
+    struct nl_cache *pNeighCache = nullptr;
+
+    int ret;
+    if ((ret = rtnl_neigh_alloc_cache(m_pNlSocket, &pNeighCache)) != 0) {
+        LOG(ERROR) << "Failed reading the ARP table: " << nl_geterror(ret);
         return false;
     }
 
-    if (status == 0) {
-        LOG(ERROR) << "EOF on netlink\n";
-        return false;
+    load_neigh_cache(pNeighCache);
+    nl_cache_free(pNeighCache);
+
+    return true;
+}
+
+void arp_monitor::load_neigh_cache(struct nl_cache *pNeighCache)
+{
+    std::vector<arp_neigh> vecArpTable;
+    read_neigh_cache(pNeighCache, vecArpTable);
+
+    m_mapNeighByIP.clear();
+    m_mapNeighIPByMac.clear();
+
+    BPL_ARP_MON_ENTRY sEntry = {};
+    for (const auto &neigh : vecArpTable) {
+        std::copy_n(neigh.mac, BPL_ARP_MON_MAC_LEN, sEntry.mac);
+        std::copy_n(neigh.ip, BPL_ARP_MON_IP_LEN, sEntry.ip);
+        sEntry.iface_idx = neigh.ifindex;
+        sEntry.state     = neigh.state;
+        update_neigh_cache(sEntry, false);
     }
-    if (msg.msg_namelen != sizeof(nladdr)) {
-        LOG(ERROR) << "ender address length == " << msg.msg_namelen;
-        return false;
+
+    LOG(DEBUG) << "Loaded " << m_mapNeighByIP.size() << " entries from the ARP table";
+}
+
+void arp_monitor::update_neigh_cache(const BPL_ARP_MON_ENTRY &sEntry, bool bDeleted)
+{
+    uint32_t ip = ip_to_key(sEntry.ip);
+
+    auto it = m_mapNeighByIP.find(ip);
+    if (it != m_mapNeighByIP.end()) {
+        // Drop the MAC index of the previous entry, if it points to this IP
+        auto mac_it = m_mapNeighIPByMac.find(mac_to_key(it->second.mac));
+        if (mac_it != m_mapNeighIPByMac.end() && mac_it->second == ip) {
+            m_mapNeighIPByMac.erase(mac_it);
+        }
+        m_mapNeighByIP.erase(it);
     }
 
-    // for loop to retrieve all ARP data.
-    for (nlmsghdr *h = (struct nlmsghdr *)buf_local; status >= ssize_t(sizeof(*h));) {
-        int len    = h->nlmsg_len;
-        int l      = len - sizeof(*h);
-        int len_at = len;
+    // Failed and incomplete entries have no valid MAC address
+    if (bDeleted || (sEntry.state & (NUD_FAILED | NUD_INCOMPLETE | NUD_NOARP)) ||
+        !mac_to_key(sEntry.mac)) {
+        return;
+    }
 
-        if (l < 0 || len > status) {
-            if (msg.msg_flags & MSG_TRUNC) {
-                LOG(ERROR) << "Truncated message";
-                return false;
-            }
+    auto &neigh = m_mapNeighByIP[ip];
+    std::copy_n(sEntry.mac, BPL_ARP_MON_MAC_LEN, neigh.mac);
+    neigh.iface_idx = sEntry.iface_idx;
+    neigh.state     = sEntry.state;
 
-            LOG(ERROR) << "Malformed message: len = " << len;
-            return false;
-        }
+    m_mapNeighIPByMac[mac_to_key(sEntry.mac)] = ip;
+}
 
-        status -= NLMSG_ALIGN(len);
+bool arp_monitor::handle_mon_messages(const char *pBuffer, int iLen)
+{
+    int len = iLen;
+    for (auto h = (const struct nlmsghdr *)pBuffer; NLMSG_OK(h, len); h = NLMSG_NEXT(h, len)) {
 
         // Skip irrelevant messages
         if (h->nlmsg_type != RTM_NEWNEIGH && h->nlmsg_type != RTM_DELNEIGH &&
             h->nlmsg_type != RTM_GETNEIGH) {
             continue;
-            // if (r->ndm_family != AF_INET) {
-            //     LOG(ERROR) << "ndm_family != AF_INET";
-            //     return false;
-            //  }
         }
 
-        // IMPORTANT: Ignore RTM_DELNEIGH messages on the GRX350/IRE220 platforms.
-        // Since the transport layer is accelerated, the OS may incorrectly decide
-        // that a connected client has disconnected.
-        if (h->nlmsg_type == RTM_DELNEIGH) {
-            continue;
+        auto r = (struct ndmsg *)NLMSG_DATA(h);
+        if (h->nlmsg_len < NLMSG_LENGTH(sizeof(*r))) {
+            LOG(ERROR) << "BUG: wrong nlmsg len = " << h->nlmsg_len;
+            return false;
         }
 
-        // Header type converted to beerocks_define.h ARP_TYPE
-        if (h->nlmsg_type == RTM_NEWNEIGH) {
-            sArpMonData.type = BPL_ARP_TYPE_NEWNEIGH;
-        } else if (h->nlmsg_type == RTM_GETNEIGH) {
-            sArpMonData.type = BPL_ARP_TYPE_GETNEIGH;
+        if (r->ndm_family != AF_INET) {
+            continue;
         }
 
-        struct ndmsg *r = (struct ndmsg *)NLMSG_DATA(h);
-        if (r == nullptr) {
-            LOG(ERROR) << "ndmsg is NULL";
-            return false;
-        }
+        BPL_ARP_MON_ENTRY sArpMonData = {};
 
         // State
         sArpMonData.state = r->ndm_state;
 
-        struct rtattr *tb[NDA_MAX + 1];
-        len_at -= NLMSG_LENGTH(sizeof(*r));
-        if (len_at < 0) {
-            LOG(ERROR) << "BUG: wrong nlmsg len = " << len_at;
-            return false;
+        // Interface index
+        sArpMonData.iface_idx = r->ndm_ifindex;
+
+        // IP and MAC addresses
+        int len_at = h->nlmsg_len - NLMSG_LENGTH(sizeof(*r));
+        auto rta   = (struct rtattr *)(((char *)r) + NLMSG_ALIGN(sizeof(*r)));
+        for (; RTA_OK(rta, len_at); rta = RTA_NEXT(rta, len_at)) {
+            if (rta->rta_type == NDA_DST && RTA_PAYLOAD(rta) >= BPL_ARP_MON_IP_LEN) {
+                std::copy_n((uint8_t *)RTA_DATA(rta), BPL_ARP_MON_IP_LEN, sArpMonData.ip);
+            } else if (rta->rta_type == NDA_LLADDR && RTA_PAYLOAD(rta) >= BPL_ARP_MON_MAC_LEN) {
+                std::copy_n((uint8_t *)RTA_DATA(rta), BPL_ARP_MON_MAC_LEN, sArpMonData.mac);
+            }
         }
 
-        // creating atrribute table
-        unsigned short type;
-        int max            = NDA_MAX;
-        struct rtattr *rta = ((struct rtattr *)(((char *)(r)) + NLMSG_ALIGN(sizeof(struct ndmsg))));
-        len_at             = h->nlmsg_len - NLMSG_LENGTH(sizeof(*r));
-        unsigned short flags = 0;
-
-        memset(tb, 0, sizeof(struct rtattr *) * (max + 1));
-        while (RTA_OK(rta, len_at)) {
-            type = rta->rta_type & ~flags;
-            if ((type <= max) && (!tb[type])) {
-                tb[type] = rta;
-            }
-            rta = RTA_NEXT(rta, len_at);
+        update_neigh_cache(sArpMonData, h->nlmsg_type == RTM_DELNEIGH);
+
+        // IMPORTANT: Do not report RTM_DELNEIGH messages on the GRX350/IRE220 platforms.
+        // Since the transport layer is accelerated, the OS may incorrectly decide
+        // that a connected client has disconnected.
+        if (h->nlmsg_type == RTM_DELNEIGH) {
+            continue;
         }
 
-        // IP address
-        std::string ipv4_str;
-        if (tb[NDA_DST]) {
-            std::copy_n((uint8_t *)RTA_DATA(tb[NDA_DST]), BPL_ARP_MON_IP_LEN, sArpMonData.ip);
+        // Header type converted to beerocks_define.h ARP_TYPE
+        sArpMonData.type = (h->nlmsg_type == RTM_NEWNEIGH) ? BPL_ARP_TYPE_NEWNEIGH
+                                                       : BPL_ARP_TYPE_GETNEIGH;
+
+        m_vecPending.push_back(sArpMonData);
+    }
+
+    return true;
+}
+
+int arp_monitor::process_mon(BPL_ARP_MON_ENTRY *arrEntries, int iMaxEntries)
+{
+    // Read all the messages available on the socket (non-blocking), unless entries of a previous
+    // read are still pending
+    while (m_vecPending.empty()) {
+        struct sockaddr_nl nladdr;
+        memset(&nladdr, 0, sizeof(nladdr));
+
+        struct iovec iov;
+        iov.iov_base = m_arrMonBuffer;
+        iov.iov_len  = sizeof(m_arrMonBuffer);
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name    = &nladdr;
+        msg.msg_namelen = sizeof(nladdr);
+        msg.msg_iov     = &iov;
+        msg.msg_iovlen  = 1;
+
+        ssize_t status = recvmsg(m_fdMonSocket, &msg, MSG_DONTWAIT);
+        if (status < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                break;
+            }
+            LOG(ERROR) << "Failed reading from socket: " << strerror(errno);
+            return -1;
         }
 
-        // Interface index
-        if (r->ndm_ifindex)
-            sArpMonData.iface_idx = r->ndm_ifindex;
+        if (status == 0) {
+            LOG(ERROR) << "EOF on netlink";
+            return -1;
+        }
+        if (msg.msg_namelen != sizeof(nladdr)) {
+            LOG(ERROR) << "Sender address length == " << msg.msg_namelen;
+            return -1;
+        }
+        if (msg.msg_flags & MSG_TRUNC) {
+            LOG(ERROR) << "Truncated message";
+            return -1;
+        }
 
-        // MAC address
-        if (tb[NDA_LLADDR]) {
-            std::copy_n((uint8_t *)RTA_DATA(tb[NDA_LLADDR]), BPL_ARP_MON_MAC_LEN, sArpMonData.mac);
+        // Retrieve all the ARP data of the datagram
+        if (!handle_mon_messages(m_arrMonBuffer, status)) {
+            return -1;
         }
-        // else {
-        //     h = (struct nlmsghdr*)((char*)h + NLMSG_ALIGN(len));
-        //     LOG(WARNING) << "MAC address not found in ARP message.";
-        //     continue;
-        // }
+    }
 
-        // // At the time the ARP response packet is received, when we check the ARP table for state,
-        // // we only get STALE as the state. After some x seconds the local table gets updated
-        // // to Reachable but we do not know when. Hence we do consider stale entry and process it.
-        // // Anything other than reachable or stale state, we simply continue with the loop.
-        // if(sArpMonData.state == NUD_REACHABLE || sArpMonData.state == NUD_STALE) {
-        //     LOG(TRACE) << "ARP response state valid to proceed";
-        // }
-        // else
-        // {
-        //     h = (struct nlmsghdr*)((char*)h + NLMSG_ALIGN(len));
+    // Return the pending entries, in the order they were received
+    int iEntries = std::min(iMaxEntries, int(m_vecPending.size()));
+    std::copy_n(m_vecPending.begin(), iEntries, arrEntries);
+    m_vecPending.erase(m_vecPending.begin(), m_vecPending.begin() + iEntries);
 
-        //     LOG(WARNING) << "Invalid ARP state: " << int(sArpMonData.state);
-        //     continue;
-        // }
+    return iEntries;
+}
 
-        if (status > 0)
-            LOG(WARNING) << "Data remaining in Netlink packet: " << int(status);
+void arp_monitor::expire_probes(std::chrono::steady_clock::time_point tpNow)
+{
+    // Advance the wheel up to the current time, expiring the probes of each slot passed.
+    // After a long idle period, there is no need to go around the wheel more than once.
+    int iSlots = 0;
+    while (m_tpProbeWheel + std::chrono::seconds(1) <= tpNow) {
+        m_tpProbeWheel += std::chrono::seconds(1);
+        m_iProbeWheelSlot = (m_iProbeWheelSlot + 1) % PROBE_WHEEL_SLOTS;
+
+        if (iSlots++ >= PROBE_WHEEL_SLOTS) {
+            continue;
+        }
 
-        break;
+        auto &slot = m_arrProbeWheel[m_iProbeWheelSlot];
+        for (auto mac : slot) {
+            // The probe may have been answered or restarted since it was added to the slot
+            auto it = m_mapProbe.find(mac);
+            if (it != m_mapProbe.end() && it->second.tpTimeout <= tpNow) {
+                uint8_t arrMac[BPL_ARP_MON_MAC_LEN];
+                for (int i = BPL_ARP_MON_MAC_LEN - 1; i >= 0; i--, mac >>= 8) {
+                    arrMac[i] = mac & 0xff;
+                }
+                LOG(DEBUG) << "Removing the mac: " << utils::mac_to_string(arrMac)
+                           << " from probe list";
+                m_mapProbe.erase(it);
+            }
+        }
+        slot.clear();
     }
-
-    return true;
 }
 
 int arp_monitor::process_arp(BPL_ARP_MON_ENTRY &sArpMonData)
@@ -459,9 +519,11 @@ int arp_monitor::process_arp(BPL_ARP_MON_ENTRY &sArpMonData)
         return -1;
     }
 
+    expire_probes(std::chrono::steady_clock::now());
+
     // Do NOT continue if the nodes list is empty
     // taskId cannot be 0 - 0 means nodes list is empty
-    if (!m_lstProbe.size()) {
+    if (m_mapProbe.empty()) {
         return 0;
     }
 
@@ -482,26 +544,10 @@ int arp_monitor::process_arp(BPL_ARP_MON_ENTRY &sArpMonData)
 
     // Check whether the received MAC is in the list
     int iTaskID = -1;
-    for (auto iter = m_lstProbe.begin(); iter != m_lstProbe.end();) {
-        auto &node = *iter;
-
-        // Found our node
-        if (!std::memcmp(&node->mac, pArpHeader->sender_mac, ETH_ALEN)) {
-            iTaskID = node->iTaskID;
-            iter    = m_lstProbe.erase(iter);
-            break;
-        }
-
-        // Check the timeout of the node
-        if (node->tpTimeout < std::chrono::steady_clock::now()) {
-            LOG(DEBUG) << "Removing the mac: " << utils::mac_to_string(node->mac)
-                       << " from probe list";
-            iter = m_lstProbe.erase(iter);
-            continue;
-        }
-
-        // Advance to the next node
-        ++iter;
+    auto it     = m_mapProbe.find(mac_to_key(pArpHeader->sender_mac));
+    if (it != m_mapProbe.end()) {
+        iTaskID = it->second.iTaskID;
+        m_mapProbe.erase(it);
     }
 
     // MAC was not found in the list
@@ -521,48 +567,43 @@ int arp_monitor::process_arp(BPL_ARP_MON_ENTRY &sArpMonData)
     return iTaskID;
 }
 
-bool arp_monitor::probe(const uint8_t mac[BPL_ARP_MON_MAC_LEN],
-                        const uint8_t ip[BPL_ARP_MON_IP_LEN], int iTaskID)
+void arp_monitor::add_probe(const uint8_t mac[BPL_ARP_MON_MAC_LEN],
+                            const uint8_t ip[BPL_ARP_MON_IP_LEN], int iTaskID,
+                            std::chrono::steady_clock::time_point tpNow)
 {
-    LOG(DEBUG) << "probe, mac=" << utils::mac_to_string(mac) << " task_id=" << iTaskID;
-    bool create_new_entrie = true;
-    // Check whether the given node is already waiting for a response
-    for (auto iter = m_lstProbe.begin(); iter != m_lstProbe.end();) {
-        auto &node = *iter;
-
-        // If the MAC of the given node is already in the list
-        if (!std::memcmp(&node->mac, mac, BPL_ARP_MON_MAC_LEN)) {
-            LOG(DEBUG) << "node already in the list, mac=" << utils::mac_to_string(mac);
-            create_new_entrie = false;
-            // If timedout for this mac then update the exisitng entry with current data
-            if (node->tpTimeout < std::chrono::steady_clock::now()) {
-                LOG(DEBUG) << "Updating the mac: " << utils::mac_to_string(node->mac)
-                           << " from probe list";
-                std::copy_n(ip, BPL_ARP_MON_IP_LEN, node->ip);
-                node->iTaskID = iTaskID;
-                node->tpTimeout =
-                    std::chrono::steady_clock::now() + std::chrono::seconds(PROBE_TIMEOUT_SEC);
-            }
-            break;
-        }
+    expire_probes(tpNow);
 
-        // Advance to the next node
-        ++iter;
+    // Check whether the given node is already waiting for a response
+    auto key = mac_to_key(mac);
+    auto it  = m_mapProbe.find(key);
+    if (it != m_mapProbe.end()) {
+        LOG(DEBUG) << "node already in the list, mac=" << utils::mac_to_string(mac);
     }
 
-    // Create a new node entry
-    if (create_new_entrie) {
-        auto pProbeEntry = std::make_shared<SProbeEntry>();
-        std::copy_n(mac, BPL_ARP_MON_MAC_LEN, pProbeEntry->mac);
-        std::copy_n(ip, BPL_ARP_MON_IP_LEN, pProbeEntry->ip);
-        pProbeEntry->iTaskID = iTaskID;
-        pProbeEntry->tpTimeout =
-            std::chrono::steady_clock::now() + std::chrono::seconds(PROBE_TIMEOUT_SEC);
+    // Create a new node entry, or update the exisitng entry with current data if timed out
+    if (it == m_mapProbe.end() || it->second.tpTimeout <= tpNow) {
+        auto &sProbeEntry = m_mapProbe[key];
+        std::copy_n(ip, BPL_ARP_MON_IP_LEN, sProbeEntry.ip);
+        sProbeEntry.iTaskID   = iTaskID;
+        sProbeEntry.tpTimeout = tpNow + std::chrono::seconds(PROBE_TIMEOUT_SEC);
+
+        // Add the entry to the slot of the timer wheel following its timeout
+        auto tpDelay = sProbeEntry.tpTimeout - m_tpProbeWheel;
+        int iOffset  = std::chrono::duration_cast<std::chrono::seconds>(tpDelay).count() + 1;
+        m_arrProbeWheel[(m_iProbeWheelSlot + iOffset) % PROBE_WHEEL_SLOTS].push_back(key);
 
-        // Add the entry to the list
-        m_lstProbe.push_back(pProbeEntry);
         LOG(DEBUG) << "pushed entery to probe list, mac=" << utils::mac_to_string(mac);
     }
+}
+
+bool arp_monitor::probe(const uint8_t mac[BPL_ARP_MON_MAC_LEN],
+                        const uint8_t ip[BPL_ARP_MON_IP_LEN], int iTaskID)
+{
+    LOG(DEBUG) << "probe, mac=" << utils::mac_to_string(mac) << " task_id=" << iTaskID;
+
+    static_assert(PROBE_TIMEOUT_SEC + 2 <= PROBE_WHEEL_SLOTS, "Probe timer wheel too small");
+
+    add_probe(mac, ip, iTaskID, std::chrono::steady_clock::now());
 
     // Send the ARP
     // TODO: Check for error?
@@ -598,47 +639,31 @@ bool arp_monitor::probe(const uint8_t mac[BPL_ARP_MON_MAC_LEN],
 bool arp_monitor::get_mac_for_ip(const uint8_t ip[BPL_ARP_MON_IP_LEN],
                                  uint8_t mac[BPL_ARP_MON_MAC_LEN])
 {
-    std::vector<arp_neigh> vecArpTable;
-
-    if (!read_arp_table(m_pNlSocket, vecArpTable)) {
-        LOG(ERROR) << "Failed reading the ARP table!";
-        return false;
-    }
-
     // Clear the MAC address
     memset((void *)mac, 0, BPL_ARP_MON_MAC_LEN);
 
-    for (auto neigh : vecArpTable) {
-        if (memcmp((void *)ip, neigh.ip, BPL_ARP_MON_IP_LEN) == 0) {
-            std::copy_n(neigh.mac, BPL_ARP_MON_MAC_LEN, mac);
-            return true;
-        }
+    auto it = m_mapNeighByIP.find(ip_to_key(ip));
+    if (it == m_mapNeighByIP.end()) {
+        return false;
     }
 
-    return false;
+    std::copy_n(it->second.mac, BPL_ARP_MON_MAC_LEN, mac);
+    return true;
 }
 
 bool arp_monitor::get_ip_for_mac(const uint8_t mac[BPL_ARP_MON_MAC_LEN],
                                  uint8_t ip[BPL_ARP_MON_IP_LEN])
 {
-    std::vector<arp_neigh> vecArpTable;
-
-    if (!read_arp_table(m_pNlSocket, vecArpTable)) {
-        LOG(ERROR) << "Failed reading the ARP table!";
-        return false;
-    }
-
     // Clear the IP address
     memset((void *)ip, 0, BPL_ARP_MON_IP_LEN);
 
-    for (auto neigh : vecArpTable) {
-        if (memcmp((void *)mac, neigh.mac, BPL_ARP_MON_MAC_LEN) == 0) {
-            std::copy_n(neigh.ip, BPL_ARP_MON_IP_LEN, ip);
-            return true;
-        }
+    auto it = m_mapNeighIPByMac.find(mac_to_key(mac));
+    if (it == m_mapNeighIPByMac.end()) {
+        return false;
     }
 
-    return false;
+    std::copy_n((const uint8_t *)&it->second, BPL_ARP_MON_IP_LEN, ip);
+    return true;
 }
 
 void arp_monitor::print_arp_table()
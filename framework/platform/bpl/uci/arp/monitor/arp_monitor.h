@@ -11,18 +11,23 @@
 
 #include <bpl/bpl_arp.h>
 
+#include <array>
 #include <chrono>
-#include <list>
-#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <linux/if_ether.h>
 
 // Forward declaration
 struct nl_sock;
+struct nl_cache;
 
 namespace beerocks {
 namespace bpl {
 
+class arp_monitor_test;
+
 class arp_monitor {
 
     /*
@@ -38,8 +43,9 @@ public:
     // Stop monitoring
     void stop();
 
-    // Process data from the monitoring interface
-    bool process_mon(BPL_ARP_MON_ENTRY &sArpMonData);
+    // Process all the data available on the monitoring interface
+    // Returns the number of entries copied to arrEntries (or -1 on error)
+    int process_mon(BPL_ARP_MON_ENTRY *arrEntries, int iMaxEntries);
 
     // Process data from the raw ARP socket
     // Returns the TaskID for the processed ARP (or -1 on error)
@@ -49,8 +55,9 @@ public:
     bool probe(const uint8_t mac[BPL_ARP_MON_MAC_LEN], const uint8_t ip[BPL_ARP_MON_IP_LEN],
                int iTaskID);
 
-    // Query the ARP table for MAC/IP address
+    // Query the neighbor cache for MAC/IP address
     // First arg is input, the second is output
+    // A MAC address with several IP addresses is mapped to the last one added or updated
     bool get_mac_for_ip(const uint8_t ip[BPL_ARP_MON_IP_LEN], uint8_t mac[BPL_ARP_MON_MAC_LEN]);
     bool get_ip_for_mac(const uint8_t mac[BPL_ARP_MON_MAC_LEN], uint8_t ip[BPL_ARP_MON_IP_LEN]);
 
@@ -66,6 +73,8 @@ public:
     void print_arp_table();
 
 private:
+    friend class arp_monitor_test;
+
     // Monitoring Netlink Socket
     int m_fdMonSocket;
 
@@ -78,17 +87,68 @@ private:
     // Interface for sending ARP messages
     std::string m_strIface;
 
+    // Read the kernel neighbor table (RTM_GETNEIGH dump) into the neighbor cache
+    bool load_neigh_cache();
+
+    // Replace the neighbor cache with the entries of a libnl neighbor cache
+    void load_neigh_cache(struct nl_cache *pNeighCache);
+
+    // Parse the netlink messages of a datagram read from the monitoring socket, update the
+    // neighbor cache and queue the entries to report
+    bool handle_mon_messages(const char *pBuffer, int iLen);
+
+    // Update the neighbor cache with an entry of the kernel neighbor table
+    void update_neigh_cache(const BPL_ARP_MON_ENTRY &sEntry, bool bDeleted);
+
+    // Remove the probes which timed out
+    void expire_probes(std::chrono::steady_clock::time_point tpNow);
+
+    // Wait for an ARP reply from the given MAC address, unless already waiting
+    void add_probe(const uint8_t mac[BPL_ARP_MON_MAC_LEN], const uint8_t ip[BPL_ARP_MON_IP_LEN],
+                   int iTaskID, std::chrono::steady_clock::time_point tpNow);
+
+    struct SNeighEntry {
+        uint8_t mac[BPL_ARP_MON_MAC_LEN];
+        uint32_t iface_idx;
+        uint8_t state;
+    };
+
+    // Neighbor cache, mirroring the IPv4 entries of the kernel neighbor table.
+    // Filled by a dump of the table on start, and then kept up to date by the
+    // RTM_NEWNEIGH/RTM_DELNEIGH notifications received on the monitoring socket.
+    // Key: IPv4 address
+    std::unordered_map<uint32_t, SNeighEntry> m_mapNeighByIP;
+
+    // Index of the neighbor cache by MAC address (value: IPv4 address).
+    // Only the most recent IP address of a MAC address is indexed: when it is removed, the MAC
+    // address is not found anymore, even if the cache holds other IP addresses for it.
+    std::unordered_map<uint64_t, uint32_t> m_mapNeighIPByMac;
+
     struct SProbeEntry {
         int iTaskID;
-        uint8_t mac[BPL_ARP_MON_MAC_LEN];
         uint8_t ip[BPL_ARP_MON_IP_LEN];
         std::chrono::steady_clock::time_point tpTimeout;
     };
 
-    std::list<std::shared_ptr<SProbeEntry>> m_lstProbe;
+    // Probes waiting for an ARP reply (key: MAC address)
+    std::unordered_map<uint64_t, SProbeEntry> m_mapProbe;
+
+    // Timer wheel of the probe timeouts, with a slot per second. Each slot holds the MAC
+    // addresses of the probes which time out during that second, so expiring the probes does
+    // not scan all of them.
+    static constexpr int PROBE_WHEEL_SLOTS = 8;
+    std::array<std::vector<uint64_t>, PROBE_WHEEL_SLOTS> m_arrProbeWheel;
+    int m_iProbeWheelSlot = 0;
+    std::chrono::steady_clock::time_point m_tpProbeWheel;
 
     // Buffer for reading ARP packets
     char m_arrArpPacket[ETH_FRAME_LEN]{0};
+
+    // Buffer for reading netlink messages from the monitoring socket
+    char m_arrMonBuffer[8192]{0};
+
+    // Entries read from the monitoring socket, not yet returned by process_mon()
+    std::vector<BPL_ARP_MON_ENTRY> m_vecPending;
 };
 
 } // namespace bpl
@@ -0,0 +1,1363 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WSC_WSC_ATTRIBUTESVIEW_H_
+#define _TLVF_WSC_WSC_ATTRIBUTESVIEW_H_
+
+#include "tlvf/WSC/WSC_Attributes.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace WSC {
+
+/**
+ * @brief Read-only view of cWscAttrVendorExtension, which reads the TLV in place.
+ */
+class cWscAttrVendorExtensionView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_vendor_data_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t);
+            if (m_buff_len__ < m_vendor_data_offset__) {
+                return false;
+            }
+            m_vendor_data_count__ = (m_buff_len__ - m_vendor_data_offset__) / sizeof(uint8_t);
+            if (m_buff_len__ < m_vendor_data_offset__ + m_vendor_data_count__ * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        uint8_t vendor_id_0() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+        uint8_t vendor_id_1() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint8_t)); }
+        uint8_t vendor_id_2() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t)); }
+        size_t vendor_data_length() const { return m_vendor_data_count__ * sizeof(uint8_t); }
+        const uint8_t* vendor_data(size_t idx = 0) const {
+            if (idx >= m_vendor_data_count__) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + m_vendor_data_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_vendor_data_offset__ = 0;
+        size_t m_vendor_data_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrEncryptedSettings, which reads the TLV in place.
+ */
+class cWscAttrEncryptedSettingsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_encrypted_settings_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_ENCRYPTED_SETTINGS_IV_LENGTH * sizeof(char);
+            if (m_buff_len__ < m_encrypted_settings_offset__) {
+                return false;
+            }
+            m_encrypted_settings_count__ = (m_buff_len__ - m_encrypted_settings_offset__) / sizeof(char);
+            if (m_buff_len__ < m_encrypted_settings_offset__ + m_encrypted_settings_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        static constexpr eWscAttributes get_tlv_type() { return eWscAttributes::ATTR_ENCR_SETTINGS; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const char* iv(size_t idx = 0) const {
+            if (idx >= WSC_ENCRYPTED_SETTINGS_IV_LENGTH) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+        size_t encrypted_settings_length() const { return m_encrypted_settings_count__ * sizeof(char); }
+        const char* encrypted_settings(size_t idx = 0) const {
+            if (idx >= m_encrypted_settings_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_encrypted_settings_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_encrypted_settings_offset__ = 0;
+        size_t m_encrypted_settings_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrVersion, which reads the TLV in place.
+ */
+class cWscAttrVersionView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscValues8)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscValues8 data() const { return tlvf_view_read<eWscValues8>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrMessageType, which reads the TLV in place.
+ */
+class cWscAttrMessageTypeView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscMessageType)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscMessageType msg_type() const { return tlvf_view_read<eWscMessageType>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrEnrolleeNonce, which reads the TLV in place.
+ */
+class cWscAttrEnrolleeNonceView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_NONCE_LENGTH * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const uint8_t* nonce(size_t idx = 0) const {
+            if (idx >= WSC_NONCE_LENGTH) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrPublicKey, which reads the TLV in place.
+ */
+class cWscAttrPublicKeyView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_PUBLIC_KEY_LENGTH * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const uint8_t* public_key(size_t idx = 0) const {
+            if (idx >= WSC_PUBLIC_KEY_LENGTH) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrAuthenticationTypeFlags, which reads the TLV in place.
+ */
+class cWscAttrAuthenticationTypeFlagsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint16_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        uint16_t auth_type_flags() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrEncryptionTypeFlags, which reads the TLV in place.
+ */
+class cWscAttrEncryptionTypeFlagsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint16_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        uint16_t encr_type_flags() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrConnectionTypeFlags, which reads the TLV in place.
+ */
+class cWscAttrConnectionTypeFlagsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscConn)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscConn conn_type_flags() const { return tlvf_view_read<eWscConn>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrConfigurationMethods, which reads the TLV in place.
+ */
+class cWscAttrConfigurationMethodsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint16_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        uint16_t conf_methods() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrManufacturer, which reads the TLV in place.
+ */
+class cWscAttrManufacturerView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_manufacturer_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_manufacturer_offset__) {
+                return false;
+            }
+            m_manufacturer_count__ = (m_buff_len__ - m_manufacturer_offset__) / sizeof(char);
+            if (m_buff_len__ < m_manufacturer_offset__ + m_manufacturer_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t manufacturer_length() const { return m_manufacturer_count__ * sizeof(char); }
+        const char* manufacturer(size_t idx = 0) const {
+            if (idx >= m_manufacturer_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_manufacturer_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_manufacturer_offset__ = 0;
+        size_t m_manufacturer_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrModelName, which reads the TLV in place.
+ */
+class cWscAttrModelNameView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_model_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_model_offset__) {
+                return false;
+            }
+            m_model_count__ = (m_buff_len__ - m_model_offset__) / sizeof(char);
+            if (m_buff_len__ < m_model_offset__ + m_model_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t model_length() const { return m_model_count__ * sizeof(char); }
+        const char* model(size_t idx = 0) const {
+            if (idx >= m_model_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_model_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_model_offset__ = 0;
+        size_t m_model_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrModelNumber, which reads the TLV in place.
+ */
+class cWscAttrModelNumberView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_model_number_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_model_number_offset__) {
+                return false;
+            }
+            m_model_number_count__ = (m_buff_len__ - m_model_number_offset__) / sizeof(char);
+            if (m_buff_len__ < m_model_number_offset__ + m_model_number_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t model_number_length() const { return m_model_number_count__ * sizeof(char); }
+        const char* model_number(size_t idx = 0) const {
+            if (idx >= m_model_number_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_model_number_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_model_number_offset__ = 0;
+        size_t m_model_number_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrSerialNumber, which reads the TLV in place.
+ */
+class cWscAttrSerialNumberView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_serial_number_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_serial_number_offset__) {
+                return false;
+            }
+            m_serial_number_count__ = (m_buff_len__ - m_serial_number_offset__) / sizeof(char);
+            if (m_buff_len__ < m_serial_number_offset__ + m_serial_number_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t serial_number_length() const { return m_serial_number_count__ * sizeof(char); }
+        const char* serial_number(size_t idx = 0) const {
+            if (idx >= m_serial_number_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_serial_number_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_serial_number_offset__ = 0;
+        size_t m_serial_number_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrPrimaryDeviceType, which reads the TLV in place.
+ */
+class cWscAttrPrimaryDeviceTypeView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t) + sizeof(uint16_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        uint16_t category_id() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+        uint32_t oui() const { return tlvf_view_read<uint32_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint16_t)); }
+        uint16_t sub_category_id() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrDeviceName, which reads the TLV in place.
+ */
+class cWscAttrDeviceNameView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_device_name_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_device_name_offset__) {
+                return false;
+            }
+            m_device_name_count__ = (m_buff_len__ - m_device_name_offset__) / sizeof(char);
+            if (m_buff_len__ < m_device_name_offset__ + m_device_name_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t device_name_length() const { return m_device_name_count__ * sizeof(char); }
+        const char* device_name(size_t idx = 0) const {
+            if (idx >= m_device_name_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_device_name_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_device_name_offset__ = 0;
+        size_t m_device_name_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrRfBands, which reads the TLV in place.
+ */
+class cWscAttrRfBandsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscRfBands)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscRfBands bands() const { return tlvf_view_read<eWscRfBands>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrAssociationState, which reads the TLV in place.
+ */
+class cWscAttrAssociationStateView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscAssoc)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscAssoc assoc_state() const { return tlvf_view_read<eWscAssoc>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrDevicePasswordID, which reads the TLV in place.
+ */
+class cWscAttrDevicePasswordIDView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscValues16)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscValues16 pw() const { return tlvf_view_read<eWscValues16>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrConfigurationError, which reads the TLV in place.
+ */
+class cWscAttrConfigurationErrorView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscValues16)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscValues16 cfg_err() const { return tlvf_view_read<eWscValues16>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrOsVersion, which reads the TLV in place.
+ */
+class cWscAttrOsVersionView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(uint32_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        uint32_t os_version() const { return tlvf_view_read<uint32_t>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrMac, which reads the TLV in place.
+ */
+class cWscAttrMacView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(sMacAddr)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        sMacAddr data() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrUuidE, which reads the TLV in place.
+ */
+class cWscAttrUuidEView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_UUID_LENGTH * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const uint8_t* data(size_t idx = 0) const {
+            if (idx >= WSC_UUID_LENGTH) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrWscState, which reads the TLV in place.
+ */
+class cWscAttrWscStateView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscState)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscState state() const { return tlvf_view_read<eWscState>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrUuidR, which reads the TLV in place.
+ */
+class cWscAttrUuidRView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_UUID_LENGTH * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const uint8_t* data(size_t idx = 0) const {
+            if (idx >= WSC_UUID_LENGTH) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrAuthenticator, which reads the TLV in place.
+ */
+class cWscAttrAuthenticatorView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_AUTHENTICATOR_LENGTH * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const uint8_t* data(size_t idx = 0) const {
+            if (idx >= WSC_AUTHENTICATOR_LENGTH) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrRegistrarNonce, which reads the TLV in place.
+ */
+class cWscAttrRegistrarNonceView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + WSC_NONCE_LENGTH * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        const uint8_t* nonce(size_t idx = 0) const {
+            if (idx >= WSC_NONCE_LENGTH) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t) + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrSsid, which reads the TLV in place.
+ */
+class cWscAttrSsidView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_ssid_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_ssid_offset__) {
+                return false;
+            }
+            m_ssid_count__ = (m_buff_len__ - m_ssid_offset__) / sizeof(char);
+            if (m_buff_len__ < m_ssid_offset__ + m_ssid_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t ssid_length() const { return m_ssid_count__ * sizeof(char); }
+        const char* ssid(size_t idx = 0) const {
+            if (idx >= m_ssid_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_ssid_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_ssid_offset__ = 0;
+        size_t m_ssid_count__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrAuthenticationType, which reads the TLV in place.
+ */
+class cWscAttrAuthenticationTypeView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscAuth)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscAuth data() const { return tlvf_view_read<eWscAuth>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrEncryptionType, which reads the TLV in place.
+ */
+class cWscAttrEncryptionTypeView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + sizeof(eWscEncr)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        eWscEncr data() const { return tlvf_view_read<eWscEncr>(m_buff__ + sizeof(eWscAttributes) + sizeof(uint16_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+};
+
+/**
+ * @brief Read-only view of cWscAttrNetworkKey, which reads the TLV in place.
+ */
+class cWscAttrNetworkKeyView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eWscAttributes) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eWscAttributes) + sizeof(uint16_t) + length();
+            m_key_offset__ = sizeof(eWscAttributes) + sizeof(uint16_t);
+            if (m_buff_len__ < m_key_offset__) {
+                return false;
+            }
+            m_key_count__ = (m_buff_len__ - m_key_offset__) / sizeof(char);
+            if (m_buff_len__ < m_key_offset__ + m_key_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eWscAttributes type() const { return tlvf_view_read<eWscAttributes>(m_buff__ + 0); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eWscAttributes)); }
+        size_t key_length() const { return m_key_count__ * sizeof(char); }
+        const char* key(size_t idx = 0) const {
+            if (idx >= m_key_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_key_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_key_offset__ = 0;
+        size_t m_key_count__ = 0;
+};
+
+}; // close namespace: WSC
+
+#endif //_TLVF_WSC_WSC_ATTRIBUTESVIEW_H_
@@ -0,0 +1,79 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_IEEE_1905_1_TLV1905NEIGHBORDEVICEVIEW_H_
+#define _TLVF_IEEE_1905_1_TLV1905NEIGHBORDEVICEVIEW_H_
+
+#include "tlvf/ieee_1905_1/tlv1905NeighborDevice.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace ieee1905_1 {
+
+/**
+ * @brief Read-only view of tlv1905NeighborDevice, which reads the TLV in place.
+ */
+class tlv1905NeighborDeviceView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvType) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvType) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvType) + sizeof(uint16_t) + length();
+            m_mac_al_1905_device_offset__ = sizeof(eTlvType) + sizeof(uint16_t) + sizeof(sMacAddr);
+            if (m_buff_len__ < m_mac_al_1905_device_offset__) {
+                return false;
+            }
+            m_mac_al_1905_device_count__ = (m_buff_len__ - m_mac_al_1905_device_offset__) / sizeof(tlv1905NeighborDevice::sMacAl1905Device);
+            if (m_buff_len__ < m_mac_al_1905_device_offset__ + m_mac_al_1905_device_count__ * sizeof(tlv1905NeighborDevice::sMacAl1905Device)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvType type() const { return tlvf_view_read<eTlvType>(m_buff__ + 0); }
+        static constexpr eTlvType get_tlv_type() { return eTlvType::TLV_1905_NEIGHBOR_DEVICE; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvType)); }
+        sMacAddr mac_local_iface() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eTlvType) + sizeof(uint16_t)); }
+        size_t mac_al_1905_device_length() const { return m_mac_al_1905_device_count__ * sizeof(tlv1905NeighborDevice::sMacAl1905Device); }
+        std::tuple<bool, tlv1905NeighborDevice::sMacAl1905Device> mac_al_1905_device(size_t idx) const {
+            if (idx >= m_mac_al_1905_device_count__) { return std::make_tuple(false, tlv1905NeighborDevice::sMacAl1905Device()); }
+            return std::make_tuple(true, tlvf_view_read_struct<tlv1905NeighborDevice::sMacAl1905Device>(m_buff__ + m_mac_al_1905_device_offset__ + idx * sizeof(tlv1905NeighborDevice::sMacAl1905Device)));
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_mac_al_1905_device_offset__ = 0;
+        size_t m_mac_al_1905_device_count__ = 0;
+};
+
+}; // close namespace: ieee1905_1
+
+#endif //_TLVF_IEEE_1905_1_TLV1905NEIGHBORDEVICEVIEW_H_
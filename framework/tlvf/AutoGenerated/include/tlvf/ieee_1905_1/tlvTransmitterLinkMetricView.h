@@ -0,0 +1,80 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_IEEE_1905_1_TLVTRANSMITTERLINKMETRICVIEW_H_
+#define _TLVF_IEEE_1905_1_TLVTRANSMITTERLINKMETRICVIEW_H_
+
+#include "tlvf/ieee_1905_1/tlvTransmitterLinkMetric.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace ieee1905_1 {
+
+/**
+ * @brief Read-only view of tlvTransmitterLinkMetric, which reads the TLV in place.
+ */
+class tlvTransmitterLinkMetricView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvType) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvType) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvType) + sizeof(uint16_t) + length();
+            m_interface_pair_info_offset__ = sizeof(eTlvType) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(sMacAddr);
+            if (m_buff_len__ < m_interface_pair_info_offset__) {
+                return false;
+            }
+            m_interface_pair_info_count__ = (m_buff_len__ - m_interface_pair_info_offset__) / sizeof(tlvTransmitterLinkMetric::sInterfacePairInfo);
+            if (m_buff_len__ < m_interface_pair_info_offset__ + m_interface_pair_info_count__ * sizeof(tlvTransmitterLinkMetric::sInterfacePairInfo)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvType type() const { return tlvf_view_read<eTlvType>(m_buff__ + 0); }
+        static constexpr eTlvType get_tlv_type() { return eTlvType::TLV_TRANSMITTER_LINK_METRIC; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvType)); }
+        sMacAddr reporter_al_mac() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eTlvType) + sizeof(uint16_t)); }
+        sMacAddr neighbor_al_mac() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eTlvType) + sizeof(uint16_t) + sizeof(sMacAddr)); }
+        size_t interface_pair_info_length() const { return m_interface_pair_info_count__ * sizeof(tlvTransmitterLinkMetric::sInterfacePairInfo); }
+        std::tuple<bool, tlvTransmitterLinkMetric::sInterfacePairInfo> interface_pair_info(size_t idx) const {
+            if (idx >= m_interface_pair_info_count__) { return std::make_tuple(false, tlvTransmitterLinkMetric::sInterfacePairInfo()); }
+            return std::make_tuple(true, tlvf_view_read_struct<tlvTransmitterLinkMetric::sInterfacePairInfo>(m_buff__ + m_interface_pair_info_offset__ + idx * sizeof(tlvTransmitterLinkMetric::sInterfacePairInfo)));
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_interface_pair_info_offset__ = 0;
+        size_t m_interface_pair_info_count__ = 0;
+};
+
+}; // close namespace: ieee1905_1
+
+#endif //_TLVF_IEEE_1905_1_TLVTRANSMITTERLINKMETRICVIEW_H_
@@ -0,0 +1,87 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_TEST_TLVVARLISTVIEW_H_
+#define _TLVF_TEST_TLVVARLISTVIEW_H_
+
+#include "tlvf/test/tlvVarList.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+/**
+ * @brief Read-only view of cInner, which reads the TLV in place.
+ */
+class cInnerView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(uint16_t) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(uint16_t) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(uint16_t) + sizeof(uint16_t) + length();
+            m_list_offset__ = sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t);
+            if (m_buff_len__ < m_list_offset__) {
+                return false;
+            }
+            m_list_count__ = list_length();
+            m_unknown_length_list_inner_offset__ = m_list_offset__ + m_list_count__ * sizeof(uint8_t) + sizeof(uint32_t);
+            if (m_buff_len__ < m_unknown_length_list_inner_offset__) {
+                return false;
+            }
+            m_unknown_length_list_inner_count__ = (m_buff_len__ - m_unknown_length_list_inner_offset__) / sizeof(char);
+            if (m_buff_len__ < m_unknown_length_list_inner_offset__ + m_unknown_length_list_inner_count__ * sizeof(char)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        uint16_t type() const { return tlvf_view_read<uint16_t>(m_buff__ + 0); }
+        static constexpr uint16_t get_tlv_type() { return uint16_t(1); }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(uint16_t)); }
+        uint8_t list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(uint16_t) + sizeof(uint16_t)); }
+        const uint8_t* list(size_t idx = 0) const {
+            if (idx >= m_list_count__) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + m_list_offset__ + idx);
+        }
+        uint32_t var1() const { return tlvf_view_read<uint32_t>(m_buff__ + m_list_offset__ + m_list_count__ * sizeof(uint8_t)); }
+        size_t unknown_length_list_inner_length() const { return m_unknown_length_list_inner_count__ * sizeof(char); }
+        const char* unknown_length_list_inner(size_t idx = 0) const {
+            if (idx >= m_unknown_length_list_inner_count__) { return nullptr; }
+            return reinterpret_cast<const char*>(m_buff__ + m_unknown_length_list_inner_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_list_offset__ = 0;
+        size_t m_list_count__ = 0;
+        size_t m_unknown_length_list_inner_offset__ = 0;
+        size_t m_unknown_length_list_inner_count__ = 0;
+};
+
+#endif //_TLVF_TEST_TLVVARLISTVIEW_H_
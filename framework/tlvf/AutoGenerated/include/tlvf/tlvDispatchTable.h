@@ -0,0 +1,39 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_TLVDISPATCHTABLE_H_
+#define _TLVF_TLVDISPATCHTABLE_H_
+
+#include <memory>
+#include <tlvf/BaseClass.h>
+#include <tlvf/ClassList.h>
+
+namespace ieee1905_1 {
+
+/**
+ * @brief Entry of the TLV dispatch table.
+ */
+typedef struct sTlvDispatchEntry {
+    // Name of the TLV class, nullptr if the TLV type is unknown
+    const char *name;
+    // Adds the TLV to the message being parsed, nullptr if the TLV type is unknown
+    std::shared_ptr<BaseClass> (*parse)(ClassList &msg);
+} sTlvDispatchEntry;
+
+/**
+ * @brief The TLV classes defined in the YAML files, indexed by TLV type.
+ */
+extern const sTlvDispatchEntry tlv_dispatch_table[256];
+
+}; // close namespace: ieee1905_1
+
+#endif //_TLVF_TLVDISPATCHTABLE_H_
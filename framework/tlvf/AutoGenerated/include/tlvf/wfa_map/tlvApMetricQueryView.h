@@ -0,0 +1,78 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WFA_MAP_TLVAPMETRICQUERYVIEW_H_
+#define _TLVF_WFA_MAP_TLVAPMETRICQUERYVIEW_H_
+
+#include "tlvf/wfa_map/tlvApMetricQuery.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace wfa_map {
+
+/**
+ * @brief Read-only view of tlvApMetricQuery, which reads the TLV in place.
+ */
+class tlvApMetricQueryView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + length();
+            m_bssid_list_offset__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(uint8_t);
+            if (m_buff_len__ < m_bssid_list_offset__) {
+                return false;
+            }
+            m_bssid_list_count__ = bssid_list_length();
+            if (m_buff_len__ < m_bssid_list_offset__ + m_bssid_list_count__ * sizeof(sMacAddr)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvTypeMap type() const { return tlvf_view_read<eTlvTypeMap>(m_buff__ + 0); }
+        static constexpr eTlvTypeMap get_tlv_type() { return eTlvTypeMap::TLV_AP_METRIC_QUERY; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap)); }
+        uint8_t bssid_list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t)); }
+        std::tuple<bool, sMacAddr> bssid_list(size_t idx) const {
+            if (idx >= m_bssid_list_count__) { return std::make_tuple(false, sMacAddr()); }
+            return std::make_tuple(true, tlvf_view_read_struct<sMacAddr>(m_buff__ + m_bssid_list_offset__ + idx * sizeof(sMacAddr)));
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_bssid_list_offset__ = 0;
+        size_t m_bssid_list_count__ = 0;
+};
+
+}; // close namespace: wfa_map
+
+#endif //_TLVF_WFA_MAP_TLVAPMETRICQUERYVIEW_H_
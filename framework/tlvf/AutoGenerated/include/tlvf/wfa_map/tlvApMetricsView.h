@@ -0,0 +1,82 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WFA_MAP_TLVAPMETRICSVIEW_H_
+#define _TLVF_WFA_MAP_TLVAPMETRICSVIEW_H_
+
+#include "tlvf/wfa_map/tlvApMetrics.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace wfa_map {
+
+/**
+ * @brief Read-only view of tlvApMetrics, which reads the TLV in place.
+ */
+class tlvApMetricsView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + length();
+            m_estimated_service_info_field_offset__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t) + sizeof(uint16_t) + sizeof(tlvApMetrics::sEstimatedService);
+            if (m_buff_len__ < m_estimated_service_info_field_offset__) {
+                return false;
+            }
+            m_estimated_service_info_field_count__ = (m_buff_len__ - m_estimated_service_info_field_offset__) / sizeof(uint8_t);
+            if (m_buff_len__ < m_estimated_service_info_field_offset__ + m_estimated_service_info_field_count__ * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvTypeMap type() const { return tlvf_view_read<eTlvTypeMap>(m_buff__ + 0); }
+        static constexpr eTlvTypeMap get_tlv_type() { return eTlvTypeMap::TLV_AP_METRIC; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap)); }
+        sMacAddr bssid() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t)); }
+        uint8_t channel_utilization() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr)); }
+        uint16_t number_of_stas_currently_associated() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t)); }
+        tlvApMetrics::sEstimatedService estimated_service_parameters() const { return tlvf_view_read_struct<tlvApMetrics::sEstimatedService>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t) + sizeof(uint16_t)); }
+        size_t estimated_service_info_field_length() const { return m_estimated_service_info_field_count__ * sizeof(uint8_t); }
+        const uint8_t* estimated_service_info_field(size_t idx = 0) const {
+            if (idx >= m_estimated_service_info_field_count__) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + m_estimated_service_info_field_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_estimated_service_info_field_offset__ = 0;
+        size_t m_estimated_service_info_field_count__ = 0;
+};
+
+}; // close namespace: wfa_map
+
+#endif //_TLVF_WFA_MAP_TLVAPMETRICSVIEW_H_
@@ -0,0 +1,98 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WFA_MAP_TLVCHANNELSCANRESULTVIEW_H_
+#define _TLVF_WFA_MAP_TLVCHANNELSCANRESULTVIEW_H_
+
+#include "tlvf/wfa_map/tlvChannelScanResult.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace wfa_map {
+
+/**
+ * @brief Read-only view of tlvChannelScanResult, which reads the TLV in place.
+ */
+class tlvChannelScanResultView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + length();
+            m_timestamp_offset__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(tlvChannelScanResult::eScanStatus) + sizeof(uint8_t);
+            if (m_buff_len__ < m_timestamp_offset__) {
+                return false;
+            }
+            m_timestamp_count__ = timestamp_length();
+            m_neighbors_list_offset__ = m_timestamp_offset__ + m_timestamp_count__ * sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint16_t);
+            if (m_buff_len__ < m_neighbors_list_offset__) {
+                return false;
+            }
+            m_neighbors_list_count__ = neighbors_list_length();
+            if (m_buff_len__ < m_neighbors_list_offset__ + m_neighbors_list_count__ * sizeof(tlvChannelScanResult::sNeighbors) + sizeof(uint32_t) + sizeof(tlvChannelScanResult::eScanType)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvTypeMap type() const { return tlvf_view_read<eTlvTypeMap>(m_buff__ + 0); }
+        static constexpr eTlvTypeMap get_tlv_type() { return eTlvTypeMap::TLV_CHANNEL_SCAN_RESULT; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap)); }
+        sMacAddr radio_uid() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t)); }
+        uint8_t operating_class() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr)); }
+        uint8_t channel() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t)); }
+        tlvChannelScanResult::eScanStatus success() const { return tlvf_view_read<tlvChannelScanResult::eScanStatus>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t) + sizeof(uint8_t)); }
+        uint8_t timestamp_length() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(tlvChannelScanResult::eScanStatus)); }
+        const uint8_t* timestamp(size_t idx = 0) const {
+            if (idx >= m_timestamp_count__) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + m_timestamp_offset__ + idx);
+        }
+        uint8_t utilization() const { return tlvf_view_read<uint8_t>(m_buff__ + m_timestamp_offset__ + m_timestamp_count__ * sizeof(uint8_t)); }
+        uint8_t noise() const { return tlvf_view_read<uint8_t>(m_buff__ + m_timestamp_offset__ + m_timestamp_count__ * sizeof(uint8_t) + sizeof(uint8_t)); }
+        uint16_t neighbors_list_length() const { return tlvf_view_read<uint16_t>(m_buff__ + m_timestamp_offset__ + m_timestamp_count__ * sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t)); }
+        std::tuple<bool, tlvChannelScanResult::sNeighbors> neighbors_list(size_t idx) const {
+            if (idx >= m_neighbors_list_count__) { return std::make_tuple(false, tlvChannelScanResult::sNeighbors()); }
+            return std::make_tuple(true, tlvf_view_read_struct<tlvChannelScanResult::sNeighbors>(m_buff__ + m_neighbors_list_offset__ + idx * sizeof(tlvChannelScanResult::sNeighbors)));
+        }
+        uint32_t aggregate_scan_duration() const { return tlvf_view_read<uint32_t>(m_buff__ + m_neighbors_list_offset__ + m_neighbors_list_count__ * sizeof(tlvChannelScanResult::sNeighbors)); }
+        tlvChannelScanResult::eScanType scan_type() const { return tlvf_view_read<tlvChannelScanResult::eScanType>(m_buff__ + m_neighbors_list_offset__ + m_neighbors_list_count__ * sizeof(tlvChannelScanResult::sNeighbors) + sizeof(uint32_t)); }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_timestamp_offset__ = 0;
+        size_t m_timestamp_count__ = 0;
+        size_t m_neighbors_list_offset__ = 0;
+        size_t m_neighbors_list_count__ = 0;
+};
+
+}; // close namespace: wfa_map
+
+#endif //_TLVF_WFA_MAP_TLVCHANNELSCANRESULTVIEW_H_
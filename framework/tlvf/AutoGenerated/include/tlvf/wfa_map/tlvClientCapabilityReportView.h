@@ -0,0 +1,79 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WFA_MAP_TLVCLIENTCAPABILITYREPORTVIEW_H_
+#define _TLVF_WFA_MAP_TLVCLIENTCAPABILITYREPORTVIEW_H_
+
+#include "tlvf/wfa_map/tlvClientCapabilityReport.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace wfa_map {
+
+/**
+ * @brief Read-only view of tlvClientCapabilityReport, which reads the TLV in place.
+ */
+class tlvClientCapabilityReportView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + length();
+            m_association_frame_offset__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(tlvClientCapabilityReport::eResultCode);
+            if (m_buff_len__ < m_association_frame_offset__) {
+                return false;
+            }
+            m_association_frame_count__ = (m_buff_len__ - m_association_frame_offset__) / sizeof(uint8_t);
+            if (m_buff_len__ < m_association_frame_offset__ + m_association_frame_count__ * sizeof(uint8_t)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvTypeMap type() const { return tlvf_view_read<eTlvTypeMap>(m_buff__ + 0); }
+        static constexpr eTlvTypeMap get_tlv_type() { return eTlvTypeMap::TLV_CLIENT_CAPABILITY_REPORT; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap)); }
+        tlvClientCapabilityReport::eResultCode result_code() const { return tlvf_view_read<tlvClientCapabilityReport::eResultCode>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t)); }
+        size_t association_frame_length() const { return m_association_frame_count__ * sizeof(uint8_t); }
+        const uint8_t* association_frame(size_t idx = 0) const {
+            if (idx >= m_association_frame_count__) { return nullptr; }
+            return reinterpret_cast<const uint8_t*>(m_buff__ + m_association_frame_offset__ + idx);
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_association_frame_offset__ = 0;
+        size_t m_association_frame_count__ = 0;
+};
+
+}; // close namespace: wfa_map
+
+#endif //_TLVF_WFA_MAP_TLVCLIENTCAPABILITYREPORTVIEW_H_
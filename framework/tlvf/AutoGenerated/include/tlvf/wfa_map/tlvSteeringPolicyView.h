@@ -0,0 +1,102 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WFA_MAP_TLVSTEERINGPOLICYVIEW_H_
+#define _TLVF_WFA_MAP_TLVSTEERINGPOLICYVIEW_H_
+
+#include "tlvf/wfa_map/tlvSteeringPolicy.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace wfa_map {
+
+/**
+ * @brief Read-only view of tlvSteeringPolicy, which reads the TLV in place.
+ */
+class tlvSteeringPolicyView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + length();
+            m_local_steering_disallowed_sta_list_offset__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(uint8_t);
+            if (m_buff_len__ < m_local_steering_disallowed_sta_list_offset__) {
+                return false;
+            }
+            m_local_steering_disallowed_sta_list_count__ = local_steering_disallowed_sta_list_length();
+            m_btm_steering_disallowed_sta_list_offset__ = m_local_steering_disallowed_sta_list_offset__ + m_local_steering_disallowed_sta_list_count__ * sizeof(sMacAddr) + sizeof(uint8_t);
+            if (m_buff_len__ < m_btm_steering_disallowed_sta_list_offset__) {
+                return false;
+            }
+            m_btm_steering_disallowed_sta_list_count__ = btm_steering_disallowed_sta_list_length();
+            m_radio_ap_control_policy_list_offset__ = m_btm_steering_disallowed_sta_list_offset__ + m_btm_steering_disallowed_sta_list_count__ * sizeof(sMacAddr) + sizeof(uint8_t);
+            if (m_buff_len__ < m_radio_ap_control_policy_list_offset__) {
+                return false;
+            }
+            m_radio_ap_control_policy_list_count__ = radio_ap_control_policy_list_length();
+            if (m_buff_len__ < m_radio_ap_control_policy_list_offset__ + m_radio_ap_control_policy_list_count__ * sizeof(tlvSteeringPolicy::sRadioApControlPolicy)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvTypeMap type() const { return tlvf_view_read<eTlvTypeMap>(m_buff__ + 0); }
+        static constexpr eTlvTypeMap get_tlv_type() { return eTlvTypeMap::TLV_STEERING_POLICY; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap)); }
+        uint8_t local_steering_disallowed_sta_list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t)); }
+        std::tuple<bool, sMacAddr> local_steering_disallowed_sta_list(size_t idx) const {
+            if (idx >= m_local_steering_disallowed_sta_list_count__) { return std::make_tuple(false, sMacAddr()); }
+            return std::make_tuple(true, tlvf_view_read_struct<sMacAddr>(m_buff__ + m_local_steering_disallowed_sta_list_offset__ + idx * sizeof(sMacAddr)));
+        }
+        uint8_t btm_steering_disallowed_sta_list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + m_local_steering_disallowed_sta_list_offset__ + m_local_steering_disallowed_sta_list_count__ * sizeof(sMacAddr)); }
+        std::tuple<bool, sMacAddr> btm_steering_disallowed_sta_list(size_t idx) const {
+            if (idx >= m_btm_steering_disallowed_sta_list_count__) { return std::make_tuple(false, sMacAddr()); }
+            return std::make_tuple(true, tlvf_view_read_struct<sMacAddr>(m_buff__ + m_btm_steering_disallowed_sta_list_offset__ + idx * sizeof(sMacAddr)));
+        }
+        uint8_t radio_ap_control_policy_list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + m_btm_steering_disallowed_sta_list_offset__ + m_btm_steering_disallowed_sta_list_count__ * sizeof(sMacAddr)); }
+        std::tuple<bool, tlvSteeringPolicy::sRadioApControlPolicy> radio_ap_control_policy_list(size_t idx) const {
+            if (idx >= m_radio_ap_control_policy_list_count__) { return std::make_tuple(false, tlvSteeringPolicy::sRadioApControlPolicy()); }
+            return std::make_tuple(true, tlvf_view_read_struct<tlvSteeringPolicy::sRadioApControlPolicy>(m_buff__ + m_radio_ap_control_policy_list_offset__ + idx * sizeof(tlvSteeringPolicy::sRadioApControlPolicy)));
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_local_steering_disallowed_sta_list_offset__ = 0;
+        size_t m_local_steering_disallowed_sta_list_count__ = 0;
+        size_t m_btm_steering_disallowed_sta_list_offset__ = 0;
+        size_t m_btm_steering_disallowed_sta_list_count__ = 0;
+        size_t m_radio_ap_control_policy_list_offset__ = 0;
+        size_t m_radio_ap_control_policy_list_count__ = 0;
+};
+
+}; // close namespace: wfa_map
+
+#endif //_TLVF_WFA_MAP_TLVSTEERINGPOLICYVIEW_H_
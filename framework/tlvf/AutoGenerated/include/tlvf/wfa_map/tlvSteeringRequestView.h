@@ -0,0 +1,94 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_WFA_MAP_TLVSTEERINGREQUESTVIEW_H_
+#define _TLVF_WFA_MAP_TLVSTEERINGREQUESTVIEW_H_
+
+#include "tlvf/wfa_map/tlvSteeringRequest.h"
+#include <tlvf/tlvfview.h>
+#include <tuple>
+
+namespace wfa_map {
+
+/**
+ * @brief Read-only view of tlvSteeringRequest, which reads the TLV in place.
+ */
+class tlvSteeringRequestView
+{
+    public:
+        /**
+         * @brief Attach the view to a TLV in network byte order.
+         *
+         * The accessors must not be used if the TLV is not valid.
+         *
+         * @return true if the TLV and its lists fit in the buffer.
+         */
+        bool parse(const uint8_t* buff, size_t buff_len) {
+            m_buff__ = buff;
+            m_buff_len__ = buff_len;
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t)) {
+                return false;
+            }
+            if (type() != get_tlv_type()) {
+                return false;
+            }
+            if (m_buff_len__ < sizeof(eTlvTypeMap) + sizeof(uint16_t) + length()) {
+                return false;
+            }
+            m_buff_len__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + length();
+            m_sta_list_offset__ = sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(tlvSteeringRequest::sRequestFlags) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t);
+            if (m_buff_len__ < m_sta_list_offset__) {
+                return false;
+            }
+            m_sta_list_count__ = sta_list_length();
+            m_target_bssid_list_offset__ = m_sta_list_offset__ + m_sta_list_count__ * sizeof(sMacAddr) + sizeof(uint8_t);
+            if (m_buff_len__ < m_target_bssid_list_offset__) {
+                return false;
+            }
+            m_target_bssid_list_count__ = target_bssid_list_length();
+            if (m_buff_len__ < m_target_bssid_list_offset__ + m_target_bssid_list_count__ * sizeof(tlvSteeringRequest::sTargetBssidInfo)) {
+                return false;
+            }
+            return true;
+        }
+        const uint8_t* getBuffPtr() const { return m_buff__; }
+        size_t getLen() const { return m_buff_len__; }
+        eTlvTypeMap type() const { return tlvf_view_read<eTlvTypeMap>(m_buff__ + 0); }
+        static constexpr eTlvTypeMap get_tlv_type() { return eTlvTypeMap::TLV_STEERING_REQUEST; }
+        uint16_t length() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap)); }
+        sMacAddr bssid() const { return tlvf_view_read_struct<sMacAddr>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t)); }
+        tlvSteeringRequest::sRequestFlags request_flags() const { return tlvf_view_read_struct<tlvSteeringRequest::sRequestFlags>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr)); }
+        uint16_t steering_opportunity_window_sec() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(tlvSteeringRequest::sRequestFlags)); }
+        uint16_t btm_disassociation_timer_ms() const { return tlvf_view_read<uint16_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(tlvSteeringRequest::sRequestFlags) + sizeof(uint16_t)); }
+        uint8_t sta_list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + sizeof(eTlvTypeMap) + sizeof(uint16_t) + sizeof(sMacAddr) + sizeof(tlvSteeringRequest::sRequestFlags) + sizeof(uint16_t) + sizeof(uint16_t)); }
+        std::tuple<bool, sMacAddr> sta_list(size_t idx) const {
+            if (idx >= m_sta_list_count__) { return std::make_tuple(false, sMacAddr()); }
+            return std::make_tuple(true, tlvf_view_read_struct<sMacAddr>(m_buff__ + m_sta_list_offset__ + idx * sizeof(sMacAddr)));
+        }
+        uint8_t target_bssid_list_length() const { return tlvf_view_read<uint8_t>(m_buff__ + m_sta_list_offset__ + m_sta_list_count__ * sizeof(sMacAddr)); }
+        std::tuple<bool, tlvSteeringRequest::sTargetBssidInfo> target_bssid_list(size_t idx) const {
+            if (idx >= m_target_bssid_list_count__) { return std::make_tuple(false, tlvSteeringRequest::sTargetBssidInfo()); }
+            return std::make_tuple(true, tlvf_view_read_struct<tlvSteeringRequest::sTargetBssidInfo>(m_buff__ + m_target_bssid_list_offset__ + idx * sizeof(tlvSteeringRequest::sTargetBssidInfo)));
+        }
+
+    private:
+        const uint8_t* m_buff__ = nullptr;
+        size_t m_buff_len__ = 0;
+        size_t m_sta_list_offset__ = 0;
+        size_t m_sta_list_count__ = 0;
+        size_t m_target_bssid_list_offset__ = 0;
+        size_t m_target_bssid_list_count__ = 0;
+};
+
+}; // close namespace: wfa_map
+
+#endif //_TLVF_WFA_MAP_TLVSTEERINGREQUESTVIEW_H_
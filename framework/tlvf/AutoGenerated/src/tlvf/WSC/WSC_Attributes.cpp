@@ -68,15 +68,15 @@ bool cWscAttrVendorExtension::alloc_vendor_data(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_vendor_data;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_vendor_data_idx__ += count;
@@ -239,7 +239,7 @@ bool cConfigData::alloc_ssid(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -251,7 +251,7 @@ bool cConfigData::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_authentication_type_attr = (sWscAttrAuthenticationType *)((uint8_t *)(m_authentication_type_attr) + len);
@@ -320,7 +320,7 @@ bool cConfigData::alloc_network_key(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -332,7 +332,7 @@ bool cConfigData::alloc_network_key(size_t count) {
     uint8_t *src = (uint8_t *)&m_network_key[*m_network_key_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_attr = (sWscAttrBssid *)((uint8_t *)(m_bssid_attr) + len);
@@ -555,15 +555,15 @@ bool cWscAttrEncryptedSettings::alloc_encrypted_settings(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_encrypted_settings;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_encrypted_settings_idx__ += count;
@@ -1505,15 +1505,15 @@ bool cWscAttrManufacturer::alloc_manufacturer(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_manufacturer;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_manufacturer_idx__ += count;
@@ -1648,15 +1648,15 @@ bool cWscAttrModelName::alloc_model(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_model;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_model_idx__ += count;
@@ -1791,15 +1791,15 @@ bool cWscAttrModelNumber::alloc_model_number(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_model_number;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_model_number_idx__ += count;
@@ -1934,15 +1934,15 @@ bool cWscAttrSerialNumber::alloc_serial_number(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_serial_number;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_serial_number_idx__ += count;
@@ -2197,15 +2197,15 @@ bool cWscAttrDeviceName::alloc_device_name(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_device_name;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_device_name_idx__ += count;
@@ -3450,15 +3450,15 @@ bool cWscAttrSsid::alloc_ssid(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_ssid;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
@@ -3783,15 +3783,15 @@ bool cWscAttrNetworkKey::alloc_key(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_key;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_key_idx__ += count;
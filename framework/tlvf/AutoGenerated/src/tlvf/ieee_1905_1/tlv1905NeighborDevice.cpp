@@ -52,15 +52,15 @@ bool tlv1905NeighborDevice::alloc_mac_al_1905_device(size_t count) {
         return false;
     }
     size_t len = sizeof(sMacAl1905Device) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_mac_al_1905_device;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_mac_al_1905_device_idx__ += count;
@@ -52,7 +52,7 @@ std::shared_ptr<cMacList> tlvDeviceBridgingCapability::create_bridging_tuples_li
         return nullptr;
     }
     size_t len = cMacList::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -64,10 +64,14 @@ std::shared_ptr<cMacList> tlvDeviceBridgingCapability::create_bridging_tuples_li
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cMacList>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cMacList>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvDeviceBridgingCapability::add_bridging_tuples_list(std::shared_ptr<cMacList> ptr) {
@@ -229,7 +233,7 @@ bool cMacList::alloc_mac_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sMacAddr) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -237,7 +241,7 @@ bool cMacList::alloc_mac_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_mac_list[*m_mac_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_mac_list_idx__ += count;
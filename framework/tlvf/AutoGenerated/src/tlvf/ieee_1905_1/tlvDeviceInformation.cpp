@@ -56,7 +56,7 @@ std::shared_ptr<cLocalInterfaceInfo> tlvDeviceInformation::create_local_interfac
         return nullptr;
     }
     size_t len = cLocalInterfaceInfo::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -68,10 +68,14 @@ std::shared_ptr<cLocalInterfaceInfo> tlvDeviceInformation::create_local_interfac
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cLocalInterfaceInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cLocalInterfaceInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvDeviceInformation::add_local_interface_list(std::shared_ptr<cLocalInterfaceInfo> ptr) {
@@ -258,7 +262,7 @@ bool cLocalInterfaceInfo::alloc_media_info(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -266,7 +270,7 @@ bool cLocalInterfaceInfo::alloc_media_info(size_t count) {
     uint8_t *src = (uint8_t *)&m_media_info[*m_media_info_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_media_info_idx__ += count;
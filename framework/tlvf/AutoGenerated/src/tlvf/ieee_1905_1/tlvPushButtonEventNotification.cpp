@@ -52,7 +52,7 @@ bool tlvPushButtonEventNotification::alloc_media_type_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sMediaType) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -60,7 +60,7 @@ bool tlvPushButtonEventNotification::alloc_media_type_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_media_type_list[*m_media_type_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_media_type_list_idx__ += count;
@@ -56,15 +56,15 @@ bool tlvReceiverLinkMetric::alloc_interface_pair_info(size_t count) {
         return false;
     }
     size_t len = sizeof(sInterfacePairInfo) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 0;
-    uint8_t *src = (uint8_t *)m_interface_pair_info;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_interface_pair_info_idx__ += count;
@@ -53,7 +53,7 @@ bool tlvTestVarList::alloc_simple_list(size_t count) {
         return false;
     }
     size_t len = sizeof(uint16_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -61,7 +61,7 @@ bool tlvTestVarList::alloc_simple_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_simple_list[*m_simple_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_test_string_length = (uint8_t *)((uint8_t *)(m_test_string_length) + len);
@@ -120,7 +120,7 @@ bool tlvTestVarList::alloc_test_string(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -132,7 +132,7 @@ bool tlvTestVarList::alloc_test_string(size_t count) {
     uint8_t *src = (uint8_t *)&m_test_string[*m_test_string_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_complex_list_length = (uint8_t *)((uint8_t *)(m_complex_list_length) + len);
@@ -170,7 +170,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_complex_list() {
         return nullptr;
     }
     size_t len = cInner::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -182,14 +182,18 @@ std::shared_ptr<cInner> tlvTestVarList::create_complex_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_var1 = (cInner *)((uint8_t *)(m_var1) + len);
     m_var3 = (cInner *)((uint8_t *)(m_var3) + len);
     m_var2 = (uint32_t *)((uint8_t *)(m_var2) + len);
     m_unknown_length_list = (cInner *)((uint8_t *)(m_unknown_length_list) + len);
-    return std::make_shared<cInner>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cInner>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvTestVarList::add_complex_list(std::shared_ptr<cInner> ptr) {
@@ -248,7 +252,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_var1() {
         return nullptr;
     }
     size_t len = cInner::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -257,13 +261,17 @@ std::shared_ptr<cInner> tlvTestVarList::create_var1() {
     uint8_t *src = (uint8_t *)m_var1;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_var3 = (cInner *)((uint8_t *)(m_var3) + len);
     m_var2 = (uint32_t *)((uint8_t *)(m_var2) + len);
     m_unknown_length_list = (cInner *)((uint8_t *)(m_unknown_length_list) + len);
-    return std::make_shared<cInner>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cInner>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvTestVarList::add_var1(std::shared_ptr<cInner> ptr) {
@@ -305,7 +313,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_var3() {
         return nullptr;
     }
     size_t len = cInner::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -314,12 +322,16 @@ std::shared_ptr<cInner> tlvTestVarList::create_var3() {
     uint8_t *src = (uint8_t *)m_var3;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_var2 = (uint32_t *)((uint8_t *)(m_var2) + len);
     m_unknown_length_list = (cInner *)((uint8_t *)(m_unknown_length_list) + len);
-    return std::make_shared<cInner>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cInner>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvTestVarList::add_var3(std::shared_ptr<cInner> ptr) {
@@ -382,7 +394,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_unknown_length_list() {
         return nullptr;
     }
     size_t len = cInner::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -394,10 +406,14 @@ std::shared_ptr<cInner> tlvTestVarList::create_unknown_length_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cInner>(getBuffPtr(), getBuffRemainingBytes(), m_parse__);
+    auto ptr = std::make_shared<cInner>(getBuffPtr(), getBuffRemainingBytes(), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvTestVarList::add_unknown_length_list(std::shared_ptr<cInner> ptr) {
@@ -437,9 +453,7 @@ void tlvTestVarList::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_var0));
-    for (size_t i = 0; i < m_simple_list_idx__; i++){
-        tlvf_swap(16, reinterpret_cast<uint8_t*>(&m_simple_list[i]));
-    }
+    tlvf_swap_array(16, m_simple_list, m_simple_list_idx__);
     for (size_t i = 0; i < m_complex_list_idx__; i++){
         std::get<1>(complex_list(i)).class_swap();
     }
@@ -677,7 +691,7 @@ bool cInner::alloc_list(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -685,7 +699,7 @@ bool cInner::alloc_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_list[*m_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_var1 = (uint32_t *)((uint8_t *)(m_var1) + len);
@@ -734,15 +748,15 @@ bool cInner::alloc_unknown_length_list_inner(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
     m_lock_order_counter__ = 1;
-    uint8_t *src = (uint8_t *)m_unknown_length_list_inner;
+    uint8_t *src = getBuffPtr();
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_unknown_length_list_inner_idx__ += count;
@@ -0,0 +1,337 @@
+///////////////////////////////////////
+// AUTO GENERATED FILE - DO NOT EDIT //
+///////////////////////////////////////
+
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <tlvf/tlvDispatchTable.h>
+#include <tlvf/ieee_1905_1/tlv1905NeighborDevice.h>
+#include <tlvf/ieee_1905_1/tlvAlMacAddress.h>
+#include <tlvf/ieee_1905_1/tlvAutoconfigFreqBand.h>
+#include <tlvf/ieee_1905_1/tlvDeviceBridgingCapability.h>
+#include <tlvf/ieee_1905_1/tlvDeviceInformation.h>
+#include <tlvf/ieee_1905_1/tlvEndOfMessage.h>
+#include <tlvf/ieee_1905_1/tlvLinkMetricQuery.h>
+#include <tlvf/ieee_1905_1/tlvLinkMetricResultCode.h>
+#include <tlvf/ieee_1905_1/tlvMacAddress.h>
+#include <tlvf/ieee_1905_1/tlvNon1905neighborDeviceList.h>
+#include <tlvf/ieee_1905_1/tlvPushButtonEventNotification.h>
+#include <tlvf/ieee_1905_1/tlvPushButtonJoinNotification.h>
+#include <tlvf/ieee_1905_1/tlvReceiverLinkMetric.h>
+#include <tlvf/ieee_1905_1/tlvSearchedRole.h>
+#include <tlvf/ieee_1905_1/tlvSupportedFreqBand.h>
+#include <tlvf/ieee_1905_1/tlvSupportedRole.h>
+#include <tlvf/ieee_1905_1/tlvTransmitterLinkMetric.h>
+#include <tlvf/ieee_1905_1/tlvVendorSpecific.h>
+#include <tlvf/ieee_1905_1/tlvWsc.h>
+#include <tlvf/wfa_map/tlvApCapability.h>
+#include <tlvf/wfa_map/tlvApHeCapabilities.h>
+#include <tlvf/wfa_map/tlvApHtCapabilities.h>
+#include <tlvf/wfa_map/tlvApMetricQuery.h>
+#include <tlvf/wfa_map/tlvApMetrics.h>
+#include <tlvf/wfa_map/tlvApOperationalBSS.h>
+#include <tlvf/wfa_map/tlvApRadioBasicCapabilities.h>
+#include <tlvf/wfa_map/tlvApRadioIdentifier.h>
+#include <tlvf/wfa_map/tlvApVhtCapabilities.h>
+#include <tlvf/wfa_map/tlvAssociatedClients.h>
+#include <tlvf/wfa_map/tlvAssociatedStaLinkMetrics.h>
+#include <tlvf/wfa_map/tlvAssociatedStaTrafficStats.h>
+#include <tlvf/wfa_map/tlvBackhaulSteeringRequest.h>
+#include <tlvf/wfa_map/tlvBackhaulSteeringResponse.h>
+#include <tlvf/wfa_map/tlvBeaconMetricsQuery.h>
+#include <tlvf/wfa_map/tlvBeaconMetricsResponse.h>
+#include <tlvf/wfa_map/tlvChannelPreference.h>
+#include <tlvf/wfa_map/tlvChannelScanCapabilities.h>
+#include <tlvf/wfa_map/tlvChannelScanReportingPolicy.h>
+#include <tlvf/wfa_map/tlvChannelScanRequest.h>
+#include <tlvf/wfa_map/tlvChannelScanResult.h>
+#include <tlvf/wfa_map/tlvChannelSelectionResponse.h>
+#include <tlvf/wfa_map/tlvClientAssociationControlRequest.h>
+#include <tlvf/wfa_map/tlvClientAssociationEvent.h>
+#include <tlvf/wfa_map/tlvClientCapabilityReport.h>
+#include <tlvf/wfa_map/tlvClientInfo.h>
+#include <tlvf/wfa_map/tlvErrorCode.h>
+#include <tlvf/wfa_map/tlvHigherLayerData.h>
+#include <tlvf/wfa_map/tlvMetricReportingPolicy.h>
+#include <tlvf/wfa_map/tlvOperatingChannelReport.h>
+#include <tlvf/wfa_map/tlvRadioOperationRestriction.h>
+#include <tlvf/wfa_map/tlvSearchedService.h>
+#include <tlvf/wfa_map/tlvStaMacAddressType.h>
+#include <tlvf/wfa_map/tlvSteeringBTMReport.h>
+#include <tlvf/wfa_map/tlvSteeringPolicy.h>
+#include <tlvf/wfa_map/tlvSteeringRequest.h>
+#include <tlvf/wfa_map/tlvSupportedService.h>
+#include <tlvf/wfa_map/tlvTimestamp.h>
+#include <tlvf/wfa_map/tlvTransmitPowerLimit.h>
+
+using namespace ieee1905_1;
+
+template <class T> static std::shared_ptr<BaseClass> parse_tlv(ClassList &msg)
+{
+    return msg.addClass<T>();
+}
+
+const sTlvDispatchEntry ieee1905_1::tlv_dispatch_table[256] = {
+    {"tlvEndOfMessage", parse_tlv<ieee1905_1::tlvEndOfMessage>}, // 0x0
+    {"tlvAlMacAddress", parse_tlv<ieee1905_1::tlvAlMacAddress>}, // 0x1
+    {"tlvMacAddress", parse_tlv<ieee1905_1::tlvMacAddress>}, // 0x2
+    {"tlvDeviceInformation", parse_tlv<ieee1905_1::tlvDeviceInformation>}, // 0x3
+    {"tlvDeviceBridgingCapability", parse_tlv<ieee1905_1::tlvDeviceBridgingCapability>}, // 0x4
+    {nullptr, nullptr}, // 0x5
+    {"tlvNon1905neighborDeviceList", parse_tlv<ieee1905_1::tlvNon1905neighborDeviceList>}, // 0x6
+    {"tlv1905NeighborDevice", parse_tlv<ieee1905_1::tlv1905NeighborDevice>}, // 0x7
+    {"tlvLinkMetricQuery", parse_tlv<ieee1905_1::tlvLinkMetricQuery>}, // 0x8
+    {"tlvTransmitterLinkMetric", parse_tlv<ieee1905_1::tlvTransmitterLinkMetric>}, // 0x9
+    {"tlvReceiverLinkMetric", parse_tlv<ieee1905_1::tlvReceiverLinkMetric>}, // 0xa
+    {"tlvVendorSpecific", parse_tlv<ieee1905_1::tlvVendorSpecific>}, // 0xb
+    {"tlvLinkMetricResultCode", parse_tlv<ieee1905_1::tlvLinkMetricResultCode>}, // 0xc
+    {"tlvSearchedRole", parse_tlv<ieee1905_1::tlvSearchedRole>}, // 0xd
+    {"tlvAutoconfigFreqBand", parse_tlv<ieee1905_1::tlvAutoconfigFreqBand>}, // 0xe
+    {"tlvSupportedRole", parse_tlv<ieee1905_1::tlvSupportedRole>}, // 0xf
+    {"tlvSupportedFreqBand", parse_tlv<ieee1905_1::tlvSupportedFreqBand>}, // 0x10
+    {"tlvWsc", parse_tlv<ieee1905_1::tlvWsc>}, // 0x11
+    {"tlvPushButtonEventNotification", parse_tlv<ieee1905_1::tlvPushButtonEventNotification>}, // 0x12
+    {"tlvPushButtonJoinNotification", parse_tlv<ieee1905_1::tlvPushButtonJoinNotification>}, // 0x13
+    {nullptr, nullptr}, // 0x14
+    {nullptr, nullptr}, // 0x15
+    {nullptr, nullptr}, // 0x16
+    {nullptr, nullptr}, // 0x17
+    {nullptr, nullptr}, // 0x18
+    {nullptr, nullptr}, // 0x19
+    {nullptr, nullptr}, // 0x1a
+    {nullptr, nullptr}, // 0x1b
+    {nullptr, nullptr}, // 0x1c
+    {nullptr, nullptr}, // 0x1d
+    {nullptr, nullptr}, // 0x1e
+    {nullptr, nullptr}, // 0x1f
+    {nullptr, nullptr}, // 0x20
+    {nullptr, nullptr}, // 0x21
+    {nullptr, nullptr}, // 0x22
+    {nullptr, nullptr}, // 0x23
+    {nullptr, nullptr}, // 0x24
+    {nullptr, nullptr}, // 0x25
+    {nullptr, nullptr}, // 0x26
+    {nullptr, nullptr}, // 0x27
+    {nullptr, nullptr}, // 0x28
+    {nullptr, nullptr}, // 0x29
+    {nullptr, nullptr}, // 0x2a
+    {nullptr, nullptr}, // 0x2b
+    {nullptr, nullptr}, // 0x2c
+    {nullptr, nullptr}, // 0x2d
+    {nullptr, nullptr}, // 0x2e
+    {nullptr, nullptr}, // 0x2f
+    {nullptr, nullptr}, // 0x30
+    {nullptr, nullptr}, // 0x31
+    {nullptr, nullptr}, // 0x32
+    {nullptr, nullptr}, // 0x33
+    {nullptr, nullptr}, // 0x34
+    {nullptr, nullptr}, // 0x35
+    {nullptr, nullptr}, // 0x36
+    {nullptr, nullptr}, // 0x37
+    {nullptr, nullptr}, // 0x38
+    {nullptr, nullptr}, // 0x39
+    {nullptr, nullptr}, // 0x3a
+    {nullptr, nullptr}, // 0x3b
+    {nullptr, nullptr}, // 0x3c
+    {nullptr, nullptr}, // 0x3d
+    {nullptr, nullptr}, // 0x3e
+    {nullptr, nullptr}, // 0x3f
+    {nullptr, nullptr}, // 0x40
+    {nullptr, nullptr}, // 0x41
+    {nullptr, nullptr}, // 0x42
+    {nullptr, nullptr}, // 0x43
+    {nullptr, nullptr}, // 0x44
+    {nullptr, nullptr}, // 0x45
+    {nullptr, nullptr}, // 0x46
+    {nullptr, nullptr}, // 0x47
+    {nullptr, nullptr}, // 0x48
+    {nullptr, nullptr}, // 0x49
+    {nullptr, nullptr}, // 0x4a
+    {nullptr, nullptr}, // 0x4b
+    {nullptr, nullptr}, // 0x4c
+    {nullptr, nullptr}, // 0x4d
+    {nullptr, nullptr}, // 0x4e
+    {nullptr, nullptr}, // 0x4f
+    {nullptr, nullptr}, // 0x50
+    {nullptr, nullptr}, // 0x51
+    {nullptr, nullptr}, // 0x52
+    {nullptr, nullptr}, // 0x53
+    {nullptr, nullptr}, // 0x54
+    {nullptr, nullptr}, // 0x55
+    {nullptr, nullptr}, // 0x56
+    {nullptr, nullptr}, // 0x57
+    {nullptr, nullptr}, // 0x58
+    {nullptr, nullptr}, // 0x59
+    {nullptr, nullptr}, // 0x5a
+    {nullptr, nullptr}, // 0x5b
+    {nullptr, nullptr}, // 0x5c
+    {nullptr, nullptr}, // 0x5d
+    {nullptr, nullptr}, // 0x5e
+    {nullptr, nullptr}, // 0x5f
+    {nullptr, nullptr}, // 0x60
+    {nullptr, nullptr}, // 0x61
+    {nullptr, nullptr}, // 0x62
+    {nullptr, nullptr}, // 0x63
+    {nullptr, nullptr}, // 0x64
+    {nullptr, nullptr}, // 0x65
+    {nullptr, nullptr}, // 0x66
+    {nullptr, nullptr}, // 0x67
+    {nullptr, nullptr}, // 0x68
+    {nullptr, nullptr}, // 0x69
+    {nullptr, nullptr}, // 0x6a
+    {nullptr, nullptr}, // 0x6b
+    {nullptr, nullptr}, // 0x6c
+    {nullptr, nullptr}, // 0x6d
+    {nullptr, nullptr}, // 0x6e
+    {nullptr, nullptr}, // 0x6f
+    {nullptr, nullptr}, // 0x70
+    {nullptr, nullptr}, // 0x71
+    {nullptr, nullptr}, // 0x72
+    {nullptr, nullptr}, // 0x73
+    {nullptr, nullptr}, // 0x74
+    {nullptr, nullptr}, // 0x75
+    {nullptr, nullptr}, // 0x76
+    {nullptr, nullptr}, // 0x77
+    {nullptr, nullptr}, // 0x78
+    {nullptr, nullptr}, // 0x79
+    {nullptr, nullptr}, // 0x7a
+    {nullptr, nullptr}, // 0x7b
+    {nullptr, nullptr}, // 0x7c
+    {nullptr, nullptr}, // 0x7d
+    {nullptr, nullptr}, // 0x7e
+    {nullptr, nullptr}, // 0x7f
+    {"tlvSupportedService", parse_tlv<wfa_map::tlvSupportedService>}, // 0x80
+    {"tlvSearchedService", parse_tlv<wfa_map::tlvSearchedService>}, // 0x81
+    {"tlvApRadioIdentifier", parse_tlv<wfa_map::tlvApRadioIdentifier>}, // 0x82
+    {"tlvApOperationalBSS", parse_tlv<wfa_map::tlvApOperationalBSS>}, // 0x83
+    {"tlvAssociatedClients", parse_tlv<wfa_map::tlvAssociatedClients>}, // 0x84
+    {"tlvApRadioBasicCapabilities", parse_tlv<wfa_map::tlvApRadioBasicCapabilities>}, // 0x85
+    {"tlvApHtCapabilities", parse_tlv<wfa_map::tlvApHtCapabilities>}, // 0x86
+    {"tlvApVhtCapabilities", parse_tlv<wfa_map::tlvApVhtCapabilities>}, // 0x87
+    {"tlvApHeCapabilities", parse_tlv<wfa_map::tlvApHeCapabilities>}, // 0x88
+    {"tlvSteeringPolicy", parse_tlv<wfa_map::tlvSteeringPolicy>}, // 0x89
+    {"tlvMetricReportingPolicy", parse_tlv<wfa_map::tlvMetricReportingPolicy>}, // 0x8a
+    {"tlvChannelPreference", parse_tlv<wfa_map::tlvChannelPreference>}, // 0x8b
+    {"tlvRadioOperationRestriction", parse_tlv<wfa_map::tlvRadioOperationRestriction>}, // 0x8c
+    {"tlvTransmitPowerLimit", parse_tlv<wfa_map::tlvTransmitPowerLimit>}, // 0x8d
+    {"tlvChannelSelectionResponse", parse_tlv<wfa_map::tlvChannelSelectionResponse>}, // 0x8e
+    {"tlvOperatingChannelReport", parse_tlv<wfa_map::tlvOperatingChannelReport>}, // 0x8f
+    {"tlvClientInfo", parse_tlv<wfa_map::tlvClientInfo>}, // 0x90
+    {"tlvClientCapabilityReport", parse_tlv<wfa_map::tlvClientCapabilityReport>}, // 0x91
+    {"tlvClientAssociationEvent", parse_tlv<wfa_map::tlvClientAssociationEvent>}, // 0x92
+    {"tlvApMetricQuery", parse_tlv<wfa_map::tlvApMetricQuery>}, // 0x93
+    {"tlvApMetrics", parse_tlv<wfa_map::tlvApMetrics>}, // 0x94
+    {"tlvStaMacAddressType", parse_tlv<wfa_map::tlvStaMacAddressType>}, // 0x95
+    {"tlvAssociatedStaLinkMetrics", parse_tlv<wfa_map::tlvAssociatedStaLinkMetrics>}, // 0x96
+    {nullptr, nullptr}, // 0x97
+    {nullptr, nullptr}, // 0x98
+    {"tlvBeaconMetricsQuery", parse_tlv<wfa_map::tlvBeaconMetricsQuery>}, // 0x99
+    {"tlvBeaconMetricsResponse", parse_tlv<wfa_map::tlvBeaconMetricsResponse>}, // 0x9a
+    {"tlvSteeringRequest", parse_tlv<wfa_map::tlvSteeringRequest>}, // 0x9b
+    {"tlvSteeringBTMReport", parse_tlv<wfa_map::tlvSteeringBTMReport>}, // 0x9c
+    {"tlvClientAssociationControlRequest", parse_tlv<wfa_map::tlvClientAssociationControlRequest>}, // 0x9d
+    {"tlvBackhaulSteeringRequest", parse_tlv<wfa_map::tlvBackhaulSteeringRequest>}, // 0x9e
+    {"tlvBackhaulSteeringResponse", parse_tlv<wfa_map::tlvBackhaulSteeringResponse>}, // 0x9f
+    {"tlvHigherLayerData", parse_tlv<wfa_map::tlvHigherLayerData>}, // 0xa0
+    {"tlvApCapability", parse_tlv<wfa_map::tlvApCapability>}, // 0xa1
+    {"tlvAssociatedStaTrafficStats", parse_tlv<wfa_map::tlvAssociatedStaTrafficStats>}, // 0xa2
+    {"tlvErrorCode", parse_tlv<wfa_map::tlvErrorCode>}, // 0xa3
+    {"tlvChannelScanReportingPolicy", parse_tlv<wfa_map::tlvChannelScanReportingPolicy>}, // 0xa4
+    {"tlvChannelScanCapabilities", parse_tlv<wfa_map::tlvChannelScanCapabilities>}, // 0xa5
+    {"tlvChannelScanRequest", parse_tlv<wfa_map::tlvChannelScanRequest>}, // 0xa6
+    {"tlvChannelScanResult", parse_tlv<wfa_map::tlvChannelScanResult>}, // 0xa7
+    {"tlvTimestamp", parse_tlv<wfa_map::tlvTimestamp>}, // 0xa8
+    {nullptr, nullptr}, // 0xa9
+    {nullptr, nullptr}, // 0xaa
+    {nullptr, nullptr}, // 0xab
+    {nullptr, nullptr}, // 0xac
+    {nullptr, nullptr}, // 0xad
+    {nullptr, nullptr}, // 0xae
+    {nullptr, nullptr}, // 0xaf
+    {nullptr, nullptr}, // 0xb0
+    {nullptr, nullptr}, // 0xb1
+    {nullptr, nullptr}, // 0xb2
+    {nullptr, nullptr}, // 0xb3
+    {nullptr, nullptr}, // 0xb4
+    {nullptr, nullptr}, // 0xb5
+    {nullptr, nullptr}, // 0xb6
+    {nullptr, nullptr}, // 0xb7
+    {nullptr, nullptr}, // 0xb8
+    {nullptr, nullptr}, // 0xb9
+    {nullptr, nullptr}, // 0xba
+    {nullptr, nullptr}, // 0xbb
+    {nullptr, nullptr}, // 0xbc
+    {nullptr, nullptr}, // 0xbd
+    {nullptr, nullptr}, // 0xbe
+    {nullptr, nullptr}, // 0xbf
+    {nullptr, nullptr}, // 0xc0
+    {nullptr, nullptr}, // 0xc1
+    {nullptr, nullptr}, // 0xc2
+    {nullptr, nullptr}, // 0xc3
+    {nullptr, nullptr}, // 0xc4
+    {nullptr, nullptr}, // 0xc5
+    {nullptr, nullptr}, // 0xc6
+    {nullptr, nullptr}, // 0xc7
+    {nullptr, nullptr}, // 0xc8
+    {nullptr, nullptr}, // 0xc9
+    {nullptr, nullptr}, // 0xca
+    {nullptr, nullptr}, // 0xcb
+    {nullptr, nullptr}, // 0xcc
+    {nullptr, nullptr}, // 0xcd
+    {nullptr, nullptr}, // 0xce
+    {nullptr, nullptr}, // 0xcf
+    {nullptr, nullptr}, // 0xd0
+    {nullptr, nullptr}, // 0xd1
+    {nullptr, nullptr}, // 0xd2
+    {nullptr, nullptr}, // 0xd3
+    {nullptr, nullptr}, // 0xd4
+    {nullptr, nullptr}, // 0xd5
+    {nullptr, nullptr}, // 0xd6
+    {nullptr, nullptr}, // 0xd7
+    {nullptr, nullptr}, // 0xd8
+    {nullptr, nullptr}, // 0xd9
+    {nullptr, nullptr}, // 0xda
+    {nullptr, nullptr}, // 0xdb
+    {nullptr, nullptr}, // 0xdc
+    {nullptr, nullptr}, // 0xdd
+    {nullptr, nullptr}, // 0xde
+    {nullptr, nullptr}, // 0xdf
+    {nullptr, nullptr}, // 0xe0
+    {nullptr, nullptr}, // 0xe1
+    {nullptr, nullptr}, // 0xe2
+    {nullptr, nullptr}, // 0xe3
+    {nullptr, nullptr}, // 0xe4
+    {nullptr, nullptr}, // 0xe5
+    {nullptr, nullptr}, // 0xe6
+    {nullptr, nullptr}, // 0xe7
+    {nullptr, nullptr}, // 0xe8
+    {nullptr, nullptr}, // 0xe9
+    {nullptr, nullptr}, // 0xea
+    {nullptr, nullptr}, // 0xeb
+    {nullptr, nullptr}, // 0xec
+    {nullptr, nullptr}, // 0xed
+    {nullptr, nullptr}, // 0xee
+    {nullptr, nullptr}, // 0xef
+    {nullptr, nullptr}, // 0xf0
+    {nullptr, nullptr}, // 0xf1
+    {nullptr, nullptr}, // 0xf2
+    {nullptr, nullptr}, // 0xf3
+    {nullptr, nullptr}, // 0xf4
+    {nullptr, nullptr}, // 0xf5
+    {nullptr, nullptr}, // 0xf6
+    {nullptr, nullptr}, // 0xf7
+    {nullptr, nullptr}, // 0xf8
+    {nullptr, nullptr}, // 0xf9
+    {nullptr, nullptr}, // 0xfa
+    {nullptr, nullptr}, // 0xfb
+    {nullptr, nullptr}, // 0xfc
+    {nullptr, nullptr}, // 0xfd
+    {nullptr, nullptr}, // 0xfe
+    {nullptr, nullptr}, // 0xff
+};
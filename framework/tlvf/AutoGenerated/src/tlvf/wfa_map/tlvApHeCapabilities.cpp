@@ -64,7 +64,7 @@ bool tlvApHeCapabilities::alloc_supported_he_mcs(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -72,7 +72,7 @@ bool tlvApHeCapabilities::alloc_supported_he_mcs(size_t count) {
     uint8_t *src = (uint8_t *)&m_supported_he_mcs[*m_supported_he_mcs_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_flags1 = (sFlags1 *)((uint8_t *)(m_flags1) + len);
@@ -52,7 +52,7 @@ std::shared_ptr<cRadioInfo> tlvApOperationalBSS::create_radio_list() {
         return nullptr;
     }
     size_t len = cRadioInfo::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -64,10 +64,14 @@ std::shared_ptr<cRadioInfo> tlvApOperationalBSS::create_radio_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cRadioInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cRadioInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvApOperationalBSS::add_radio_list(std::shared_ptr<cRadioInfo> ptr) {
@@ -233,7 +237,7 @@ std::shared_ptr<cRadioBssInfo> cRadioInfo::create_radio_bss_list() {
         return nullptr;
     }
     size_t len = cRadioBssInfo::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -245,10 +249,14 @@ std::shared_ptr<cRadioBssInfo> cRadioInfo::create_radio_bss_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cRadioBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cRadioBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool cRadioInfo::add_radio_bss_list(std::shared_ptr<cRadioBssInfo> ptr) {
@@ -413,7 +421,7 @@ bool cRadioBssInfo::alloc_ssid(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -421,7 +429,7 @@ bool cRadioBssInfo::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
@@ -52,7 +52,7 @@ std::shared_ptr<cBssInfo> tlvAssociatedClients::create_bss_list() {
         return nullptr;
     }
     size_t len = cBssInfo::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -64,10 +64,14 @@ std::shared_ptr<cBssInfo> tlvAssociatedClients::create_bss_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvAssociatedClients::add_bss_list(std::shared_ptr<cBssInfo> ptr) {
@@ -233,7 +237,7 @@ std::shared_ptr<cClientInfo> cBssInfo::create_clients_associated_list() {
         return nullptr;
     }
     size_t len = cClientInfo::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -245,10 +249,14 @@ std::shared_ptr<cClientInfo> cBssInfo::create_clients_associated_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cClientInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cClientInfo>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool cBssInfo::add_clients_associated_list(std::shared_ptr<cClientInfo> ptr) {
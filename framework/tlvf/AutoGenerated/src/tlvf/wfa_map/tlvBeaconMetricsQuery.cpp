@@ -87,7 +87,7 @@ bool tlvBeaconMetricsQuery::alloc_ssid(size_t count) {
         return false;
     }
     size_t len = sizeof(char) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -95,7 +95,7 @@ bool tlvBeaconMetricsQuery::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_ap_channel_reports_list_length = (uint8_t *)((uint8_t *)(m_ap_channel_reports_list_length) + len);
@@ -131,7 +131,7 @@ std::shared_ptr<cApChannelReports> tlvBeaconMetricsQuery::create_ap_channel_repo
         return nullptr;
     }
     size_t len = cApChannelReports::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -143,12 +143,16 @@ std::shared_ptr<cApChannelReports> tlvBeaconMetricsQuery::create_ap_channel_repo
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_elemnt_id_list_length = (uint8_t *)((uint8_t *)(m_elemnt_id_list_length) + len);
     m_elemnt_id_list = (uint8_t *)((uint8_t *)(m_elemnt_id_list) + len);
-    return std::make_shared<cApChannelReports>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cApChannelReports>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvBeaconMetricsQuery::add_ap_channel_reports_list(std::shared_ptr<cApChannelReports> ptr) {
@@ -214,7 +218,7 @@ bool tlvBeaconMetricsQuery::alloc_elemnt_id_list(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -222,7 +226,7 @@ bool tlvBeaconMetricsQuery::alloc_elemnt_id_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_elemnt_id_list[*m_elemnt_id_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_elemnt_id_list_idx__ += count;
@@ -437,7 +441,7 @@ bool cApChannelReports::alloc_ap_channel_report_list(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -445,7 +449,7 @@ bool cApChannelReports::alloc_ap_channel_report_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_ap_channel_report_list[*m_ap_channel_report_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_ap_channel_report_list_idx__ += count;
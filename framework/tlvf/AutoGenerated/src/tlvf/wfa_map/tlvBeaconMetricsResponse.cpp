@@ -68,7 +68,7 @@ bool tlvBeaconMetricsResponse::alloc_measurement_report_list(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -76,7 +76,7 @@ bool tlvBeaconMetricsResponse::alloc_measurement_report_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_measurement_report_list[*m_measurement_report_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_measurement_report_list_idx__ += count;
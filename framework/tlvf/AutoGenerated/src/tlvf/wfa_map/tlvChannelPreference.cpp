@@ -56,7 +56,7 @@ std::shared_ptr<cPreferenceOperatingClasses> tlvChannelPreference::create_operat
         return nullptr;
     }
     size_t len = cPreferenceOperatingClasses::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -68,10 +68,14 @@ std::shared_ptr<cPreferenceOperatingClasses> tlvChannelPreference::create_operat
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cPreferenceOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cPreferenceOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvChannelPreference::add_operating_classes_list(std::shared_ptr<cPreferenceOperatingClasses> ptr) {
@@ -254,7 +258,7 @@ bool cPreferenceOperatingClasses::alloc_channel_list(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -262,7 +266,7 @@ bool cPreferenceOperatingClasses::alloc_channel_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_channel_list[*m_channel_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_flags = (sFlags *)((uint8_t *)(m_flags) + len);
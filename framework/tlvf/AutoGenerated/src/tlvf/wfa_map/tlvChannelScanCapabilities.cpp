@@ -52,7 +52,7 @@ std::shared_ptr<cRadiosWithScanCapabilities> tlvChannelScanCapabilities::create_
         return nullptr;
     }
     size_t len = cRadiosWithScanCapabilities::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -64,10 +64,14 @@ std::shared_ptr<cRadiosWithScanCapabilities> tlvChannelScanCapabilities::create_
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cRadiosWithScanCapabilities>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cRadiosWithScanCapabilities>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvChannelScanCapabilities::add_radio_list(std::shared_ptr<cRadiosWithScanCapabilities> ptr) {
@@ -233,7 +237,7 @@ bool cRadiosWithScanCapabilities::alloc_capabilities_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sCapabilities) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -241,7 +245,7 @@ bool cRadiosWithScanCapabilities::alloc_capabilities_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_capabilities_list[*m_capabilities_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_minimum_scan_interval = (uint32_t *)((uint8_t *)(m_minimum_scan_interval) + len);
@@ -282,7 +286,7 @@ bool cRadiosWithScanCapabilities::alloc_operating_classes_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sOperatingClasses) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -290,7 +294,7 @@ bool cRadiosWithScanCapabilities::alloc_operating_classes_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_operating_classes_list[*m_operating_classes_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_operating_classes_list_idx__ += count;
@@ -56,7 +56,7 @@ std::shared_ptr<cRadiosToScan> tlvChannelScanRequest::create_radio_list() {
         return nullptr;
     }
     size_t len = cRadiosToScan::get_initial_size();
-    if (m_lock_allocation__ || getBuffRemainingBytes() < len) {
+    if (m_lock_allocation__ || getBuffFreeBytes() < len) {
         TLVF_LOG(ERROR) << "Not enough available space on buffer";
         return nullptr;
     }
@@ -68,10 +68,14 @@ std::shared_ptr<cRadiosToScan> tlvChannelScanRequest::create_radio_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
-    return std::make_shared<cRadiosToScan>(src, getBuffRemainingBytes(src), m_parse__);
+    auto ptr = std::make_shared<cRadiosToScan>(src, getBuffRemainingBytes(src), m_parse__);
+    if (!m_parse__) {
+        ptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));
+    }
+    return ptr;
 }
 
 bool tlvChannelScanRequest::add_radio_list(std::shared_ptr<cRadiosToScan> ptr) {
@@ -245,7 +249,7 @@ bool cRadiosToScan::alloc_operating_classes_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sOperatingClasses) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -253,7 +257,7 @@ bool cRadiosToScan::alloc_operating_classes_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_operating_classes_list[*m_operating_classes_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_operating_classes_list_idx__ += count;
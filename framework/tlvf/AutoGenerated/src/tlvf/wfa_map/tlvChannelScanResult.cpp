@@ -76,7 +76,7 @@ bool tlvChannelScanResult::alloc_timestamp(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -84,7 +84,7 @@ bool tlvChannelScanResult::alloc_timestamp(size_t count) {
     uint8_t *src = (uint8_t *)&m_timestamp[*m_timestamp_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_utilization = (uint8_t *)((uint8_t *)(m_utilization) + len);
@@ -130,7 +130,7 @@ bool tlvChannelScanResult::alloc_neighbors_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sNeighbors) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -138,7 +138,7 @@ bool tlvChannelScanResult::alloc_neighbors_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_neighbors_list[*m_neighbors_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_aggregate_scan_duration = (uint32_t *)((uint8_t *)(m_aggregate_scan_duration) + len);
@@ -56,7 +56,7 @@ bool tlvOperatingChannelReport::alloc_operating_classes_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sOperatingClasses) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -64,7 +64,7 @@ bool tlvOperatingChannelReport::alloc_operating_classes_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_operating_classes_list[*m_operating_classes_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_current_transmit_power = (int8_t *)((uint8_t *)(m_current_transmit_power) + len);
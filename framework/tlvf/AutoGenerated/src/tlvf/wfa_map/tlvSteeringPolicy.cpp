@@ -52,7 +52,7 @@ bool tlvSteeringPolicy::alloc_local_steering_disallowed_sta_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sMacAddr) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -60,7 +60,7 @@ bool tlvSteeringPolicy::alloc_local_steering_disallowed_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_local_steering_disallowed_sta_list[*m_local_steering_disallowed_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_btm_steering_disallowed_sta_list_length = (uint8_t *)((uint8_t *)(m_btm_steering_disallowed_sta_list_length) + len);
@@ -99,7 +99,7 @@ bool tlvSteeringPolicy::alloc_btm_steering_disallowed_sta_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sMacAddr) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -107,7 +107,7 @@ bool tlvSteeringPolicy::alloc_btm_steering_disallowed_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_btm_steering_disallowed_sta_list[*m_btm_steering_disallowed_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_radio_ap_control_policy_list_length = (uint8_t *)((uint8_t *)(m_radio_ap_control_policy_list_length) + len);
@@ -144,7 +144,7 @@ bool tlvSteeringPolicy::alloc_radio_ap_control_policy_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sRadioApControlPolicy) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -152,7 +152,7 @@ bool tlvSteeringPolicy::alloc_radio_ap_control_policy_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_radio_ap_control_policy_list[*m_radio_ap_control_policy_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_radio_ap_control_policy_list_idx__ += count;
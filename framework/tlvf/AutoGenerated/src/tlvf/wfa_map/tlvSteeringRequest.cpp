@@ -68,7 +68,7 @@ bool tlvSteeringRequest::alloc_sta_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sMacAddr) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -76,7 +76,7 @@ bool tlvSteeringRequest::alloc_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_sta_list[*m_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_target_bssid_list_length = (uint8_t *)((uint8_t *)(m_target_bssid_list_length) + len);
@@ -113,7 +113,7 @@ bool tlvSteeringRequest::alloc_target_bssid_list(size_t count) {
         return false;
     }
     size_t len = sizeof(sTargetBssidInfo) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -121,7 +121,7 @@ bool tlvSteeringRequest::alloc_target_bssid_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_target_bssid_list[*m_target_bssid_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_target_bssid_list_idx__ += count;
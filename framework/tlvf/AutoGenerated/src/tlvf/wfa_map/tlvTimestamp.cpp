@@ -60,7 +60,7 @@ bool tlvTimestamp::alloc_timestamp(size_t count) {
         return false;
     }
     size_t len = sizeof(uint8_t) * count;
-    if(getBuffRemainingBytes() < len )  {
+    if(getBuffFreeBytes() < len )  {
         TLVF_LOG(ERROR) << "Not enough available space on buffer - can't allocate";
         return false;
     }
@@ -68,7 +68,7 @@ bool tlvTimestamp::alloc_timestamp(size_t count) {
     uint8_t *src = (uint8_t *)&m_timestamp[*m_timestamp_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffUsedBytes(src);
         std::copy_n(src, move_length, dst);
     }
     m_timestamp_idx__ += count;
@@ -0,0 +1,192 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/*
+ * Synthetic benchmark of building CMDUs with tlvf.
+ *
+ * Builds an AP Metrics Response of a BSS with the given number of associated stations: an AP
+ * Metrics TLV, then an Associated STA Traffic Stats TLV and an Associated STA Link Metrics TLV
+ * per station, the latter being grown with alloc_bssid_info_list(). Prints the CPU time it takes
+ * to build and finalize the message, then to read the link metrics of the received message with
+ * CmduMessageRx::parse() and with the read-only views.
+ *
+ * Usage: ap_metrics_benchmark [stations] [iterations] [buffer size]
+ */
+
+#include <tlvf/CmduMessageRx.h>
+#include <tlvf/CmduMessageTx.h>
+#include <tlvf/wfa_map/tlvApMetrics.h>
+#include <tlvf/wfa_map/tlvAssociatedStaLinkMetrics.h>
+#include <tlvf/wfa_map/tlvAssociatedStaLinkMetricsView.h>
+#include <tlvf/wfa_map/tlvAssociatedStaTrafficStats.h>
+
+#include <easylogging++.h>
+
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+INITIALIZE_EASYLOGGINGPP
+
+static const int DEFAULT_STATIONS    = 256;
+static const int DEFAULT_ITERATIONS  = 1000;
+static const int DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+// Prevents the compiler from optimizing the readers away
+static volatile uint32_t s_checksum;
+
+static bool build_ap_metrics_response(ieee1905_1::CmduMessageTx &cmdu_tx, uint16_t mid,
+                                      int stations)
+{
+    if (!cmdu_tx.create(mid, ieee1905_1::eMessageType::AP_METRICS_RESPONSE_MESSAGE)) {
+        return false;
+    }
+
+    const sMacAddr bssid = {{0x02, 0x00, 0x00, 0x00, 0x01, 0x00}};
+
+    auto ap_metrics = cmdu_tx.addClass<wfa_map::tlvApMetrics>();
+    if (!ap_metrics || !ap_metrics->alloc_estimated_service_info_field(3)) {
+        return false;
+    }
+    ap_metrics->bssid()                               = bssid;
+    ap_metrics->channel_utilization()                 = 100;
+    ap_metrics->number_of_stas_currently_associated() = stations;
+
+    for (int i = 0; i < stations; i++) {
+        const sMacAddr sta_mac = {{0x02, 0x00, 0x00, 0x00, uint8_t(i >> 8), uint8_t(i)}};
+
+        auto traffic_stats = cmdu_tx.addClass<wfa_map::tlvAssociatedStaTrafficStats>();
+        if (!traffic_stats) {
+            return false;
+        }
+        traffic_stats->sta_mac()      = sta_mac;
+        traffic_stats->byte_sent()    = 1000 * i;
+        traffic_stats->packets_sent() = 10 * i;
+
+        auto link_metrics = cmdu_tx.addClass<wfa_map::tlvAssociatedStaLinkMetrics>();
+        if (!link_metrics || !link_metrics->alloc_bssid_info_list()) {
+            return false;
+        }
+        link_metrics->sta_mac() = sta_mac;
+
+        auto bssid_info = link_metrics->bssid_info_list(0);
+        if (!std::get<0>(bssid_info)) {
+            return false;
+        }
+        std::get<1>(bssid_info).bssid                                 = bssid;
+        std::get<1>(bssid_info).downlink_estimated_mac_data_rate_mbps = 866;
+        std::get<1>(bssid_info).uplink_estimated_mac_data_rate_mbps   = 866;
+        std::get<1>(bssid_info).sta_measured_uplink_rssi_dbm_enc      = 80;
+    }
+
+    return cmdu_tx.finalize();
+}
+
+static bool read_parsed(ieee1905_1::CmduMessageRx &cmdu_rx)
+{
+    if (!cmdu_rx.parse()) {
+        return false;
+    }
+
+    uint32_t checksum = 0;
+    for (auto &link_metrics : cmdu_rx.getClassList<wfa_map::tlvAssociatedStaLinkMetrics>()) {
+        auto bssid_info = link_metrics->bssid_info_list(0);
+        if (!std::get<0>(bssid_info)) {
+            return false;
+        }
+        checksum += std::get<1>(bssid_info).downlink_estimated_mac_data_rate_mbps;
+    }
+    s_checksum = checksum;
+
+    return true;
+}
+
+static bool read_views(ieee1905_1::CmduMessageRx &cmdu_rx, int stations)
+{
+    uint32_t checksum = 0;
+    wfa_map::tlvAssociatedStaLinkMetricsView link_metrics;
+    for (int i = 0; i < stations; i++) {
+        if (!(i == 0 ? cmdu_rx.getView(link_metrics) : cmdu_rx.getNextView(link_metrics))) {
+            return false;
+        }
+        auto bssid_info = link_metrics.bssid_info_list(0);
+        if (!std::get<0>(bssid_info)) {
+            return false;
+        }
+        checksum += std::get<1>(bssid_info).downlink_estimated_mac_data_rate_mbps;
+    }
+    s_checksum = checksum;
+
+    return true;
+}
+
+static double cpu_time_us(std::clock_t start, int iterations)
+{
+    return 1e6 * double(std::clock() - start) / CLOCKS_PER_SEC / iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    int stations    = argc > 1 ? std::atoi(argv[1]) : DEFAULT_STATIONS;
+    int iterations  = argc > 2 ? std::atoi(argv[2]) : DEFAULT_ITERATIONS;
+    int buffer_size = argc > 3 ? std::atoi(argv[3]) : DEFAULT_BUFFER_SIZE;
+    if (stations < 0 || stations > 0xffff || iterations <= 0 || buffer_size <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [stations] [iterations] [buffer size]" << std::endl;
+        return 1;
+    }
+
+    std::vector<uint8_t> buffer(buffer_size);
+    ieee1905_1::CmduMessageTx cmdu_tx(buffer.data(), buffer.size());
+
+    auto start = std::clock();
+    for (int i = 0; i < iterations; i++) {
+        if (!build_ap_metrics_response(cmdu_tx, i, stations)) {
+            std::cerr << "Failed building AP Metrics Response " << i << std::endl;
+            return 1;
+        }
+    }
+    double build_us = cpu_time_us(start, iterations);
+
+    // Both readers get the message in network byte order, as received
+    size_t message_length = cmdu_tx.getMessageLength();
+    std::vector<uint8_t> rx_buffer(message_length);
+    ieee1905_1::CmduMessageRx cmdu_rx(rx_buffer.data(), rx_buffer.size());
+
+    start = std::clock();
+    for (int i = 0; i < iterations; i++) {
+        std::memcpy(rx_buffer.data(), buffer.data(), message_length);
+        if (!read_parsed(cmdu_rx)) {
+            std::cerr << "Failed parsing AP Metrics Response " << i << std::endl;
+            return 1;
+        }
+    }
+    double parse_us = cpu_time_us(start, iterations);
+
+    // A new CmduMessageRx, the views require a message which is not parsed
+    ieee1905_1::CmduMessageRx cmdu_rx_view(rx_buffer.data(), rx_buffer.size());
+
+    start = std::clock();
+    for (int i = 0; i < iterations; i++) {
+        std::memcpy(rx_buffer.data(), buffer.data(), message_length);
+        if (!read_views(cmdu_rx_view, stations)) {
+            std::cerr << "Failed reading AP Metrics Response " << i << " views" << std::endl;
+            return 1;
+        }
+    }
+    double view_us = cpu_time_us(start, iterations);
+
+    std::cout << "stations: " << stations << ", iterations: " << iterations
+              << ", buffer size: " << buffer_size << std::endl;
+    std::cout << "message length: " << message_length << " bytes" << std::endl;
+    std::cout << "build time: " << build_us << " us/message" << std::endl;
+    std::cout << "parse time: " << parse_us << " us/message" << std::endl;
+    std::cout << "view time:  " << view_us << " us/message" << std::endl;
+
+    return 0;
+}
@@ -26,8 +26,21 @@ public:
     uint8_t *getBuffPtr();
     uint8_t *getStartBuffPtr();
     size_t getBuffRemainingBytes(void *start = nullptr);
+    size_t getBuffUsedBytes(void *start);
+    size_t getBuffFreeBytes();
     bool buffPtrIncrementSafe(size_t length);
 
+    /**
+     * @brief Set the length of the data following this class in the buffer
+     *
+     * A class created as an entry of a variable length list is followed by the data of the
+     * enclosing classes (e.g. the members after the list), which must be moved when the entry
+     * grows.
+     *
+     * @param length Length of the data following the class.
+     */
+    void setBuffTrailingLen(size_t length) { m_buff_trailing_len__ = length; }
+
     size_t getLen();
     bool isInitialized();
     virtual bool isPostInitSucceeded() { return true; };
@@ -59,6 +72,7 @@ protected:
     uint8_t *m_buff__;
     uint8_t *m_buff_ptr__;
     const size_t m_buff_len__;
+    size_t m_buff_trailing_len__ = 0;
     const bool m_parse__;
     bool m_finalized__    = false;
     bool m_init_succeeded = false;
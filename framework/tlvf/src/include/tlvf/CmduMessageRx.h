@@ -28,12 +28,46 @@ public:
     };
 
     bool parse();
+
+    /**
+     * @brief Attach a read-only view to a TLV of the message without parsing it.
+     *
+     * The views (<yaml name>View.h) read the TLV in network byte order, so the message must not
+     * be parsed, or be swapped back to network byte order with swap() after parsing it.
+     *
+     * @param view The view of the TLV, e.g. wfa_map::tlvApMetricsView.
+     * @param idx Index of the TLV among the TLVs of the same type.
+     * @return true if the TLV is found and valid, false otherwise.
+     */
+    template <class T> bool getView(T &view, size_t idx = 0) const
+    {
+        static_assert(sizeof(T::get_tlv_type()) == 1, "getView() requires a 1905 TLV view");
+        size_t length;
+        auto tlv = findTlv(uint8_t(T::get_tlv_type()), idx, kCmduHeaderLength, length);
+        return tlv && view.parse(tlv, length);
+    }
+
+    /**
+     * @brief Move a view returned by getView() to the next TLV of the same type.
+     *
+     * @param view The view of the TLV.
+     * @return true if the next TLV is found and valid, false otherwise.
+     */
+    template <class T> bool getNextView(T &view) const
+    {
+        size_t length;
+        size_t offset = view.getBuffPtr() + view.getLen() - getMessageBuff();
+        auto tlv      = findTlv(uint8_t(T::get_tlv_type()), 0, offset, length);
+        return tlv && view.parse(tlv, length);
+    }
+
     CmduMessageRx &operator=(const CmduMessageRx &) = delete;
 
 private:
     int getNextTlvType() const;
     uint16_t getNextTlvLength() const;
     std::shared_ptr<BaseClass> parseNextTlv();
+    const uint8_t *findTlv(uint8_t type, size_t idx, size_t offset, size_t &length) const;
 };
 
 }; // namespace ieee1905_1
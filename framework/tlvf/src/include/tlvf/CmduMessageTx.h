@@ -12,6 +12,8 @@
 #include <tlvf/CmduMessage.h>
 #include <tlvf/ieee_1905_1/tlvVendorSpecific.h>
 
+#include <functional>
+
 #define MTU_SIZE (size_t)1500
 
 namespace ieee1905_1 {
@@ -30,6 +32,18 @@ public:
     void reset() { msg.reset(false); }
     bool finalize();
     size_t elements_in_message(size_t size);
+    size_t free_bytes_in_message(size_t max_length = 0);
+
+    /**
+     * @brief Function which sends the message built so far and starts a new one.
+     *
+     * Used to split a message over several CMDUs. It is expected to send the current message and
+     * create a new one on this object, with the same headers and leading TLVs, so items can be
+     * added to it the same way they were added to the previous one.
+     */
+    typedef std::function<bool()> split_handler_t;
+
+    bool make_room(size_t length, const split_handler_t &split, size_t max_length = 0);
 };
 
 }; // namespace ieee1905_1
@@ -9,8 +9,8 @@
 #ifndef _TLVF_LOGGING_H_
 #define _TLVF_LOGGING_H_
 
-#include <easylogging++.h>
+#include <lazy_log.h>
 
-#define TLVF_LOG(a) (LOG(a) << "TLVF: ")
+#define TLVF_LOG(a) LAZY_LOG(a) << "TLVF: "
 
 #endif
\ No newline at end of file
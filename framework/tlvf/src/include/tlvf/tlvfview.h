@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_VIEW_H_
+#define _TLVF_VIEW_H_
+
+#include <string.h>
+#include <tlvf/swap.h>
+#include <type_traits>
+
+/*
+ * Helpers of the read-only views generated by tlvf.py (<yaml name>View.h).
+ *
+ * A view points to a TLV of a received message, which stays in network byte order. Its accessors
+ * read the fields with the helpers below, which copy them out of the buffer and convert them to
+ * host byte order, so creating and using a view neither allocates nor modifies the message.
+ */
+
+/**
+ * @brief Read a number or an enum in network byte order.
+ *
+ * @param ptr Pointer to the field, which does not need to be aligned.
+ * @return The field in host byte order.
+ */
+template <class T> inline T tlvf_view_read(const uint8_t *ptr)
+{
+    T value;
+    memcpy(&value, ptr, sizeof(T));
+    tlvf_swap(8 * sizeof(T), reinterpret_cast<uint8_t *>(&value));
+    return value;
+}
+
+/**
+ * @brief Read a struct in network byte order.
+ *
+ * @param ptr Pointer to the struct, which does not need to be aligned.
+ * @return Copy of the struct in host byte order.
+ */
+template <class T> inline T tlvf_view_read_struct(const uint8_t *ptr)
+{
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    memcpy(&storage, ptr, sizeof(T));
+    auto value = reinterpret_cast<T *>(&storage);
+    value->struct_swap();
+    return *value;
+}
+
+#endif //_TLVF_VIEW_H_
@@ -23,6 +23,32 @@ size_t BaseClass::getBuffRemainingBytes(void *start)
             (size_t)(((uint8_t *)(start ? start : m_buff_ptr__)) - ((uint8_t *)m_buff__)));
 }
 
+/**
+ * @brief Get the number of bytes in use from the given position to the end of the data.
+ *
+ * These are the bytes which must be moved when inserting data at the given position, including
+ * the data of the enclosing classes which follows this class (see setBuffTrailingLen()).
+ *
+ * @param start Position in the class.
+ * @return Number of bytes in use from the given position.
+ */
+size_t BaseClass::getBuffUsedBytes(void *start)
+{
+    return (size_t)(m_buff_ptr__ - (uint8_t *)start) + m_buff_trailing_len__;
+}
+
+/**
+ * @brief Get the number of bytes which can still be allocated.
+ *
+ * @return Number of bytes between the end of the data (including the data of the enclosing
+ * classes which follows this class) and the end of the buffer.
+ */
+size_t BaseClass::getBuffFreeBytes()
+{
+    size_t remaining = getBuffRemainingBytes();
+    return remaining > m_buff_trailing_len__ ? remaining - m_buff_trailing_len__ : 0;
+}
+
 size_t BaseClass::getLen() { return (size_t)((uint8_t *)m_buff_ptr__ - (uint8_t *)m_buff__); }
 
 bool BaseClass::isInitialized() { return m_init_succeeded; }
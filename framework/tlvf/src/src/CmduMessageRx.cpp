@@ -7,55 +7,10 @@
  */
 
 #include <tlvf/CmduMessageRx.h>
-#include <tlvf/WSC/AttrList.h>
-#include <tlvf/ieee_1905_1/tlv1905NeighborDevice.h>
-#include <tlvf/ieee_1905_1/tlvAlMacAddress.h>
-#include <tlvf/ieee_1905_1/tlvAutoconfigFreqBand.h>
-#include <tlvf/ieee_1905_1/tlvDeviceBridgingCapability.h>
-#include <tlvf/ieee_1905_1/tlvDeviceInformation.h>
 #include <tlvf/ieee_1905_1/tlvEndOfMessage.h>
 #include <tlvf/ieee_1905_1/tlvLinkMetricQuery.h>
-#include <tlvf/ieee_1905_1/tlvLinkMetricResultCode.h>
-#include <tlvf/ieee_1905_1/tlvMacAddress.h>
-#include <tlvf/ieee_1905_1/tlvNon1905neighborDeviceList.h>
-#include <tlvf/ieee_1905_1/tlvPushButtonEventNotification.h>
-#include <tlvf/ieee_1905_1/tlvPushButtonJoinNotification.h>
-#include <tlvf/ieee_1905_1/tlvReceiverLinkMetric.h>
-#include <tlvf/ieee_1905_1/tlvSearchedRole.h>
-#include <tlvf/ieee_1905_1/tlvSupportedFreqBand.h>
-#include <tlvf/ieee_1905_1/tlvSupportedRole.h>
-#include <tlvf/ieee_1905_1/tlvTransmitterLinkMetric.h>
 #include <tlvf/ieee_1905_1/tlvUnknown.h>
-#include <tlvf/ieee_1905_1/tlvVendorSpecific.h>
-#include <tlvf/ieee_1905_1/tlvWsc.h>
-#include <tlvf/wfa_map/tlvApCapability.h>
-#include <tlvf/wfa_map/tlvApMetricQuery.h>
-#include <tlvf/wfa_map/tlvApMetrics.h>
-#include <tlvf/wfa_map/tlvApRadioBasicCapabilities.h>
-#include <tlvf/wfa_map/tlvApRadioIdentifier.h>
-#include <tlvf/wfa_map/tlvAssociatedStaLinkMetrics.h>
-#include <tlvf/wfa_map/tlvAssociatedStaTrafficStats.h>
-#include <tlvf/wfa_map/tlvBackhaulSteeringRequest.h>
-#include <tlvf/wfa_map/tlvBackhaulSteeringResponse.h>
-#include <tlvf/wfa_map/tlvBeaconMetricsQuery.h>
-#include <tlvf/wfa_map/tlvBeaconMetricsResponse.h>
-#include <tlvf/wfa_map/tlvChannelPreference.h>
-#include <tlvf/wfa_map/tlvChannelSelectionResponse.h>
-#include <tlvf/wfa_map/tlvClientAssociationControlRequest.h>
-#include <tlvf/wfa_map/tlvClientAssociationEvent.h>
-#include <tlvf/wfa_map/tlvClientCapabilityReport.h>
-#include <tlvf/wfa_map/tlvClientInfo.h>
-#include <tlvf/wfa_map/tlvHigherLayerData.h>
-#include <tlvf/wfa_map/tlvMetricReportingPolicy.h>
-#include <tlvf/wfa_map/tlvOperatingChannelReport.h>
-#include <tlvf/wfa_map/tlvRadioOperationRestriction.h>
-#include <tlvf/wfa_map/tlvSearchedService.h>
-#include <tlvf/wfa_map/tlvStaMacAddressType.h>
-#include <tlvf/wfa_map/tlvSteeringBTMReport.h>
-#include <tlvf/wfa_map/tlvSteeringPolicy.h>
-#include <tlvf/wfa_map/tlvSteeringRequest.h>
-#include <tlvf/wfa_map/tlvSupportedService.h>
-#include <tlvf/wfa_map/tlvTransmitPowerLimit.h>
+#include <tlvf/tlvDispatchTable.h>
 
 #include <iostream>
 
@@ -85,29 +40,11 @@ uint16_t CmduMessageRx::getNextTlvLength() const
 std::shared_ptr<BaseClass> CmduMessageRx::parseNextTlv()
 {
     auto tlv_type = getNextTlvType();
-    switch (tlv_type) {
-    case (0): {
-        return msg.addClass<tlvEndOfMessage>();
+    if (tlv_type < 0) {
+        return nullptr;
     }
-    case (1): {
-        return msg.addClass<tlvAlMacAddress>();
-    }
-    case (2): {
-        return msg.addClass<tlvMacAddress>();
-    }
-    case (3): {
-        return msg.addClass<tlvDeviceInformation>();
-    }
-    case (4): {
-        return msg.addClass<tlvDeviceBridgingCapability>();
-    }
-    case (6): {
-        return msg.addClass<tlvNon1905neighborDeviceList>();
-    }
-    case (7): {
-        return msg.addClass<tlv1905NeighborDevice>();
-    }
-    case (8): {
+
+    if (tlv_type == int(eTlvType::TLV_LINK_METRIC_QUERY)) {
         /**
          * The IEEE 1905.1 standard says about the Link Metric Query TLV and the neighbor type
          * octet that "If the value is 0, then the EUI48 field is not present; if the value is 1,
@@ -126,132 +63,44 @@ std::shared_ptr<BaseClass> CmduMessageRx::parseNextTlv()
 
         if (all_neighbors_tlv_length == tlv_length) {
             return msg.addClass<tlvLinkMetricQueryAllNeighbors>();
-        } else {
-            return msg.addClass<tlvLinkMetricQuery>();
         }
     }
-    case (9): {
-        return msg.addClass<tlvTransmitterLinkMetric>();
-    }
-    case (10): {
-        return msg.addClass<tlvReceiverLinkMetric>();
-    }
-    case (11): {
-        return msg.addClass<tlvVendorSpecific>();
-    }
-    case (12): {
-        return msg.addClass<tlvLinkMetricResultCode>();
-    }
-    case (13): {
-        return msg.addClass<tlvSearchedRole>();
-    }
-    case (14): {
-        return msg.addClass<tlvAutoconfigFreqBand>();
-    }
-    case (15): {
-        return msg.addClass<tlvSupportedRole>();
-    }
-    case (16): {
-        return msg.addClass<tlvSupportedFreqBand>();
-    }
-    case (17): {
-        return msg.addClass<ieee1905_1::tlvWsc>();
-    }
-    case (18): {
-        return msg.addClass<tlvPushButtonEventNotification>();
-    }
-    case (19): {
-        return msg.addClass<tlvPushButtonJoinNotification>();
-    }
-    case (128): {
-        return msg.addClass<wfa_map::tlvSupportedService>();
-    }
-    case (129): {
-        return msg.addClass<wfa_map::tlvSearchedService>();
-    }
-    case (130): {
-        return msg.addClass<wfa_map::tlvApRadioIdentifier>();
-    }
-    case (133): {
-        return msg.addClass<wfa_map::tlvApRadioBasicCapabilities>();
-    }
-    case (137): {
-        return msg.addClass<wfa_map::tlvSteeringPolicy>();
-    }
-    case (138): {
-        return msg.addClass<wfa_map::tlvMetricReportingPolicy>();
-    }
-    case (139): {
-        return msg.addClass<wfa_map::tlvChannelPreference>();
-    }
-    case (140): {
-        return msg.addClass<wfa_map::tlvRadioOperationRestriction>();
-    }
-    case (141): {
-        return msg.addClass<wfa_map::tlvTransmitPowerLimit>();
-    }
-    case (142): {
-        return msg.addClass<wfa_map::tlvChannelSelectionResponse>();
-    }
-    case (143): {
-        return msg.addClass<wfa_map::tlvOperatingChannelReport>();
-    }
-    case (144): {
-        return msg.addClass<wfa_map::tlvClientInfo>();
-    }
-    case (145): {
-        return msg.addClass<wfa_map::tlvClientCapabilityReport>();
-    }
-    case (146): {
-        return msg.addClass<wfa_map::tlvClientAssociationEvent>();
-    }
-    case (147): {
-        return msg.addClass<wfa_map::tlvApMetricQuery>();
-    }
-    case (148): {
-        return msg.addClass<wfa_map::tlvApMetrics>();
-    }
-    case (149): {
-        return msg.addClass<wfa_map::tlvStaMacAddressType>();
-    }
-    case (150): {
-        return msg.addClass<wfa_map::tlvAssociatedStaLinkMetrics>();
-    }
-    case (153): {
-        return msg.addClass<wfa_map::tlvBeaconMetricsQuery>();
-    }
-    case (154): {
-        return msg.addClass<wfa_map::tlvBeaconMetricsResponse>();
-    }
-    case (155): {
-        return msg.addClass<wfa_map::tlvSteeringRequest>();
-    }
-    case (156): {
-        return msg.addClass<wfa_map::tlvSteeringBTMReport>();
-    }
-    case (157): {
-        return msg.addClass<wfa_map::tlvClientAssociationControlRequest>();
-    }
-    case (158): {
-        return msg.addClass<wfa_map::tlvBackhaulSteeringRequest>();
-    }
-    case (159): {
-        return msg.addClass<wfa_map::tlvBackhaulSteeringResponse>();
-    }
-    case (160): {
-        return msg.addClass<wfa_map::tlvHigherLayerData>();
-    }
-    case (161): {
-        return msg.addClass<wfa_map::tlvApCapability>();
-    }
-    case (162): {
-        return msg.addClass<wfa_map::tlvAssociatedStaTrafficStats>();
-    }
-    default: {
-        LOG(DEBUG) << "Unknown TLV type: " << tlv_type;
+
+    // The table is generated from the YAML files, see tlv_dispatch_table in tlvf_conf.yaml
+    auto parse_tlv = tlv_dispatch_table[tlv_type].parse;
+    if (!parse_tlv) {
+        LAZY_LOG(DEBUG) << "Unknown TLV type: " << tlv_type;
         return msg.addClass<tlvUnknown>();
     }
+
+    return parse_tlv(msg);
+}
+
+const uint8_t *CmduMessageRx::findTlv(uint8_t type, size_t idx, size_t offset,
+                                      size_t &length) const
+{
+    if (getCmduHeader() && !is_swapped()) {
+        TLVF_LOG(ERROR) << "Views require the message in network byte order";
+        return nullptr;
+    }
+
+    const uint8_t *buff = getMessageBuff();
+    size_t buff_len     = getMessageBuffLength();
+    while (offset + kTlvHeaderLength <= buff_len) {
+        auto tlv            = reinterpret_cast<const sTlvHeader *>(buff + offset);
+        uint16_t tlv_length = tlv->length;
+        swap_16(tlv_length);
+        if (tlv->type == type && idx-- == 0) {
+            length = buff_len - offset;
+            return buff + offset;
+        }
+        if (tlv->type == uint8_t(eTlvType::TLV_END_OF_MESSAGE)) {
+            break;
+        }
+        offset += kTlvHeaderLength + tlv_length;
     }
+
+    return nullptr;
 }
 
 bool CmduMessageRx::parse()
@@ -92,9 +92,26 @@ size_t CmduMessageTx::elements_in_message(size_t size)
         return 0;
     }
 
-    size_t current_msg_length = 0;
-    auto ptr                  = msg.prevClass();
-    auto valid_ptr            = ptr;
+    return free_bytes_in_message(MTU_SIZE) / size;
+}
+
+/**
+ * @brief Return how many bytes can still be added to the message.
+ *
+ * The bytes are counted from the end of the last added class, including the classes added to
+ * inner class lists (vendor specific TLVs), and room is kept for the End of Message TLV.
+ *
+ * @param[in] max_length Maximum length of the message, 0 for the length of the buffer.
+ * @return size_t number of bytes that can be added to the message.
+ */
+size_t CmduMessageTx::free_bytes_in_message(size_t max_length)
+{
+    if (!max_length || max_length > getMessageBuffLength()) {
+        max_length = getMessageBuffLength();
+    }
+
+    auto ptr       = msg.prevClass();
+    auto valid_ptr = ptr;
     while (ptr) {
         valid_ptr       = ptr;
         auto class_list = ptr->getInnerClassList();
@@ -108,10 +125,41 @@ size_t CmduMessageTx::elements_in_message(size_t size)
         return 0;
     }
 
-    current_msg_length = valid_ptr->getBuffPtr() - getMessageBuff();
-    ssize_t size_left  = MTU_SIZE - current_msg_length - tlvEndOfMessage::get_initial_size();
-    if (size_left < 0) {
+    size_t used_length = valid_ptr->getBuffPtr() - getMessageBuff();
+    if (used_length + tlvEndOfMessage::get_initial_size() > max_length) {
         return 0;
     }
-    return size_left / size;
+    return max_length - used_length - tlvEndOfMessage::get_initial_size();
+}
+
+/**
+ * @brief Make sure an item of the given length fits in the message, splitting it if not.
+ *
+ * If the item does not fit in the message built so far, the split handler is called to send it
+ * and start a new one. The producer then adds the item to the new message as it would have to
+ * the previous one, so message builders do not need to do the chunking themselves.
+ *
+ * @param[in] length Length of the item (the TLV or list entries) about to be added, in bytes.
+ * @param[in] split Function which sends the current message and starts a new one.
+ * @param[in] max_length Maximum length of a message, 0 for the length of the buffer.
+ * @return true if the item fits in the (possibly new) message, false if the split failed or the
+ * item does not fit even in an empty message.
+ */
+bool CmduMessageTx::make_room(size_t length, const split_handler_t &split, size_t max_length)
+{
+    if (length <= free_bytes_in_message(max_length)) {
+        return true;
+    }
+
+    if (!split || !split()) {
+        TLVF_LOG(ERROR) << "Failed splitting the message";
+        return false;
+    }
+
+    if (length > free_bytes_in_message(max_length)) {
+        TLVF_LOG(ERROR) << "Item of " << length << " bytes does not fit in an empty message";
+        return false;
+    }
+
+    return true;
 }
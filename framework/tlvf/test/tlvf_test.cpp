@@ -23,6 +23,12 @@
 #include "tlvf/ieee_1905_1/tlvVendorSpecific.h"
 #include "tlvf/ieee_1905_1/tlvWsc.h"
 #include "tlvf/wfa_map/tlvApCapability.h"
+#include "tlvf/wfa_map/tlvApMetricsView.h"
+#include "tlvf/wfa_map/tlvErrorCode.h"
+#include "tlvf/wfa_map/tlvErrorCodeView.h"
+#include <tlvf/swap.h>
+#include <tlvf/tlvDispatchTable.h>
+#include <tlvf/tlvftypes.h>
 #include <tlvf/test/tlvVarList.h>
 
 #include <mapf/common/encryption.h>
@@ -758,6 +764,270 @@ int test_all()
     return errors;
 }
 
+int test_split_message()
+{
+    int errors = 0;
+    uint8_t tx_buffer[128];
+    const int items = 40;
+
+    MAPF_INFO(__FUNCTION__ << " start");
+    CmduMessageTx msg(tx_buffer, sizeof(tx_buffer));
+
+    int messages      = 0;
+    int items_in_msg  = 0;
+    int items_in_msgs = 0;
+
+    auto split = [&]() -> bool {
+        if (messages > 0) {
+            if (!msg.finalize()) {
+                MAPF_ERR("Failed to finalize message " << messages);
+                return false;
+            }
+            if (msg.getMessageLength() > sizeof(tx_buffer)) {
+                MAPF_ERR("Message " << messages << " is longer than the buffer");
+                errors++;
+            }
+            items_in_msgs += items_in_msg;
+        }
+        items_in_msg = 0;
+        messages++;
+        return msg.create(messages, eMessageType::TOPOLOGY_RESPONSE_MESSAGE) != nullptr;
+    };
+
+    if (!split()) {
+        MAPF_ERR("Failed to create the first message");
+        return 1;
+    }
+
+    for (int i = 0; i < items; i++) {
+        if (!msg.make_room(tlvMacAddress::get_initial_size(), split)) {
+            MAPF_ERR("make_room() failed for item " << i);
+            errors++;
+            break;
+        }
+        auto tlv = msg.addClass<tlvMacAddress>();
+        if (!tlv) {
+            MAPF_ERR("Failed to add item " << i << " after make_room()");
+            errors++;
+            break;
+        }
+        tlv->mac().oct[5] = i;
+        items_in_msg++;
+    }
+    if (!msg.finalize()) {
+        MAPF_ERR("Failed to finalize the last message");
+        errors++;
+    }
+    items_in_msgs += items_in_msg;
+
+    // (128 - 8 byte CMDU header - 3 byte EOM) / 9 byte TLV = 13 items per message
+    if (items_in_msgs != items || messages != 4) {
+        MAPF_ERR("Expected " << items << " items in 4 messages, got " << items_in_msgs
+                             << " items in " << messages << " messages");
+        errors++;
+    }
+
+    // An item which does not fit in an empty message fails after a single split
+    if (msg.make_room(sizeof(tx_buffer), split)) {
+        MAPF_ERR("make_room() succeeded for an item larger than the buffer");
+        errors++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_tlv_dispatch()
+{
+    int errors = 0;
+    uint8_t tx_buffer[256];
+
+    MAPF_INFO(__FUNCTION__ << " start");
+
+    // Both link metric query TLVs have the same type and are told apart by their length
+    CmduMessageTx msg(tx_buffer, sizeof(tx_buffer));
+    msg.create(0, eMessageType::LINK_METRIC_QUERY_MESSAGE);
+    msg.addClass<tlvLinkMetricQueryAllNeighbors>();
+    msg.addClass<tlvLinkMetricQuery>();
+    msg.addClass<wfa_map::tlvErrorCode>();
+    if (!msg.finalize()) {
+        MAPF_ERR("Finalize step failed");
+        return 1;
+    }
+
+    CmduMessageRx received_message(tx_buffer, sizeof(tx_buffer));
+    if (!received_message.parse()) {
+        MAPF_ERR("Parse step failed");
+        errors++;
+    }
+    if (!received_message.getClass<tlvLinkMetricQueryAllNeighbors>() ||
+        !received_message.getClass<tlvLinkMetricQuery>() ||
+        !received_message.getClass<wfa_map::tlvErrorCode>()) {
+        MAPF_ERR("TLV dispatched to the wrong class");
+        errors++;
+    }
+
+    // Every TLV type, with a zeroed value, is either dispatched or parsed as tlvUnknown
+    const uint16_t value_length = 64;
+    uint8_t buffer[CmduMessage::kCmduHeaderLength + CmduMessage::kTlvHeaderLength + value_length +
+                   CmduMessage::kTlvHeaderLength];
+    msg.create(0, eMessageType::VENDOR_SPECIFIC_MESSAGE);
+    msg.finalize();
+    for (int type = 1; type < 256; type++) {
+        memset(buffer, 0, sizeof(buffer));
+        memcpy(buffer, tx_buffer, CmduMessage::kCmduHeaderLength);
+        auto tlv_header = reinterpret_cast<sTlvHeader *>(buffer + CmduMessage::kCmduHeaderLength);
+        tlv_header->type   = type;
+        tlv_header->length = htons(value_length);
+
+        CmduMessageRx fuzzed_message(buffer, sizeof(buffer));
+        bool parsed     = fuzzed_message.parse();
+        bool is_known   = tlv_dispatch_table[type].parse != nullptr;
+        bool is_unknown = fuzzed_message.getClass<tlvUnknown>() != nullptr;
+        if (is_known ? is_unknown : !(parsed && is_unknown)) {
+            MAPF_ERR("TLV type " << type << " ("
+                                 << (is_known ? tlv_dispatch_table[type].name : "unknown")
+                                 << ") dispatched to the wrong class");
+            errors++;
+        }
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_tlv_view()
+{
+    int errors = 0;
+    uint8_t tx_buffer[256];
+    const sMacAddr bssid   = {{0x02, 0x00, 0x00, 0x00, 0x01, 0x00}};
+    const sMacAddr sta_mac = {{0x02, 0x00, 0x00, 0x00, 0x02, 0x00}};
+    const auto reason_code =
+        wfa_map::tlvErrorCode::eReasonCode::STA_NOT_ASSOCIATED_WITH_ANY_BSS_OPERATED_BY_THE_AGENT;
+
+    MAPF_INFO(__FUNCTION__ << " start");
+
+    CmduMessageTx msg(tx_buffer, sizeof(tx_buffer));
+    msg.create(0, eMessageType::AP_METRICS_RESPONSE_MESSAGE);
+    auto ap_metrics = msg.addClass<wfa_map::tlvApMetrics>();
+    if (!ap_metrics || !ap_metrics->alloc_estimated_service_info_field(3)) {
+        MAPF_ERR("Failed adding tlvApMetrics");
+        return 1;
+    }
+    ap_metrics->bssid()                               = bssid;
+    ap_metrics->channel_utilization()                 = 100;
+    ap_metrics->number_of_stas_currently_associated() = 0x1234;
+    *ap_metrics->estimated_service_info_field(2)      = 0xab;
+    msg.addClass<wfa_map::tlvErrorCode>();
+    auto error_code           = msg.addClass<wfa_map::tlvErrorCode>();
+    error_code->reason_code() = reason_code;
+    error_code->sta_mac()     = sta_mac;
+    if (!msg.finalize()) {
+        MAPF_ERR("Finalize step failed");
+        return 1;
+    }
+
+    uint8_t rx_buffer[sizeof(tx_buffer)];
+    memcpy(rx_buffer, tx_buffer, sizeof(tx_buffer));
+    CmduMessageRx received_message(rx_buffer, sizeof(rx_buffer));
+
+    wfa_map::tlvApMetricsView ap_metrics_view;
+    if (!received_message.getView(ap_metrics_view)) {
+        MAPF_ERR("tlvApMetrics not found");
+        return errors + 1;
+    }
+    if (ap_metrics_view.bssid() != bssid || ap_metrics_view.channel_utilization() != 100 ||
+        ap_metrics_view.number_of_stas_currently_associated() != 0x1234 ||
+        ap_metrics_view.estimated_service_info_field_length() != 3 ||
+        *ap_metrics_view.estimated_service_info_field(2) != 0xab ||
+        ap_metrics_view.estimated_service_info_field(3)) {
+        MAPF_ERR("tlvApMetrics view mismatch");
+        errors++;
+    }
+
+    wfa_map::tlvErrorCodeView error_code_view;
+    if (!received_message.getView(error_code_view, 1) ||
+        error_code_view.reason_code() != reason_code || error_code_view.sta_mac() != sta_mac) {
+        MAPF_ERR("tlvErrorCode view mismatch");
+        errors++;
+    }
+    if (!received_message.getView(error_code_view) ||
+        !received_message.getNextView(error_code_view) ||
+        error_code_view.sta_mac() != sta_mac) {
+        MAPF_ERR("tlvErrorCode next view mismatch");
+        errors++;
+    }
+    if (received_message.getNextView(error_code_view) ||
+        received_message.getView(error_code_view, 2)) {
+        MAPF_ERR("Found a third tlvErrorCode");
+        errors++;
+    }
+
+    // The views read the message in place
+    if (memcmp(rx_buffer, tx_buffer, sizeof(tx_buffer))) {
+        MAPF_ERR("The views modified the message");
+        errors++;
+    }
+
+    // A truncated TLV is not valid
+    auto tlv = ap_metrics_view.getBuffPtr();
+    if (ap_metrics_view.parse(tlv, ap_metrics_view.getLen() - 1)) {
+        MAPF_ERR("Truncated tlvApMetrics accepted");
+        errors++;
+    }
+
+    // Parsed messages are in host byte order, views require swapping them back first
+    if (!received_message.parse()) {
+        MAPF_ERR("Parse step failed");
+        return errors + 1;
+    }
+    if (received_message.getView(ap_metrics_view)) {
+        MAPF_ERR("View of a message in host byte order");
+        errors++;
+    }
+    received_message.swap();
+    if (!received_message.getView(ap_metrics_view) ||
+        ap_metrics_view.number_of_stas_currently_associated() != 0x1234) {
+        MAPF_ERR("tlvApMetrics view mismatch after swapping back");
+        errors++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_swap_array()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " start");
+
+    // Odd counts and offsets exercise both the vector loop and the scalar tail on unaligned data
+    for (uint8_t size : {16, 32, 64}) {
+        for (size_t count = 0; count < 20; count++) {
+            uint8_t bulk[1 + 20 * sizeof(uint64_t)];
+            uint8_t single[sizeof(bulk)];
+            for (size_t i = 0; i < sizeof(bulk); i++) {
+                bulk[i] = single[i] = i;
+            }
+
+            tlvf_swap_array(size, bulk + 1, count);
+            for (size_t i = 0; i < count; i++) {
+                tlvf_swap(size, single + 1 + i * size / 8);
+            }
+
+            if (memcmp(bulk, single, sizeof(bulk))) {
+                MAPF_ERR("tlvf_swap_array(" << int(size) << ", " << count
+                                            << ") differs from tlvf_swap()");
+                errors++;
+            }
+        }
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
 int main(int argc, char *argv[])
 {
     int errors = 0;
@@ -767,6 +1037,10 @@ int main(int argc, char *argv[])
     errors += test_complex_list();
     errors += test_all();
     errors += test_parser();
+    errors += test_split_message();
+    errors += test_tlv_dispatch();
+    errors += test_swap_array();
+    errors += test_tlv_view();
     MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
     return errors;
 }
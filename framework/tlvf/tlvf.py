@@ -112,6 +112,7 @@ class TypeInfo:
         self.swap_prefix = ""
         self.swap_suffix = ""
         self.swap_is_func = False
+        self.swap_array_prefix = ""
         self.is_std_type = False
 
         if type(self.type_str) == str:
@@ -123,14 +124,17 @@ class TypeInfo:
                     self.swap_prefix = "tlvf_swap(64, reinterpret_cast<uint8_t*>("
                     self.swap_suffix = "))"
                     self.swap_needed = True
+                    self.swap_array_prefix = "tlvf_swap_array(64, "
                 elif self.type == TypeInfo.INT32 or self.type == TypeInfo.UINT32:
                     self.swap_prefix = "tlvf_swap(32, reinterpret_cast<uint8_t*>("
                     self.swap_suffix = "))"
                     self.swap_needed = True
+                    self.swap_array_prefix = "tlvf_swap_array(32, "
                 elif self.type == TypeInfo.INT16 or self.type == TypeInfo.UINT16:
                     self.swap_prefix = "tlvf_swap(16, reinterpret_cast<uint8_t*>("
                     self.swap_suffix = "))"
                     self.swap_needed = True
+                    self.swap_array_prefix = "tlvf_swap_array(16, "
                 elif not (self.type == TypeInfo.INT8 or self.type == TypeInfo.UINT8):
                     self.set_type(TypeInfo.ERROR)
             elif self.type_str.startswith("char"):
@@ -147,6 +151,7 @@ class TypeInfo:
                     self.swap_prefix += "), reinterpret_cast<uint8_t*>("
                     self.swap_suffix = "))"
                     self.swap_needed = True
+                    self.swap_array_prefix = "tlvf_swap_array(8*sizeof(%s), " % type_str
                 elif self.type_str[0] == "s":
                     self.set_type(TypeInfo.STRUCT)
                     self.swap_suffix = TypeInfo.STRUCT_SWAP_FUNCTION_NAME
@@ -197,6 +202,7 @@ class MetaData:
     DECELERATION_MULTI_CLASS = "_multi_class"
     DECELERATION_MULTI_CLASS_AUTO_INSERT = "_multi_class_auto_insert"
     DECELERATION_IS_TLV_CLASS = "_is_tlv_class"
+    KEY_TLV_DISPATCH = "_tlv_dispatch"
     AUTO_VALUE_BY_NAME = "_auto_value_by_name"
     TLV_TYPE_LENGTH = "length"
     TLV_TYPE_TYPE = "type"
@@ -224,6 +230,7 @@ class MetaData:
         self.comment = None
         self.optional = False
         self.is_tlv_class = False
+        self.tlv_dispatch = True
         self.constractor_h_lines = []
         self.constractor_cpp_lines = []
         self.alloc_list = []
@@ -254,6 +261,8 @@ class MetaData:
                             self.type = value
                 elif key == MetaData.DECELERATION_IS_TLV_CLASS:
                     self.is_tlv_class = value
+                elif key == MetaData.KEY_TLV_DISPATCH:
+                    self.tlv_dispatch = value
                 elif key == MetaData.KEY_ENUM_STORAGE:
                     self.enum_storage = value
                     self.type_info = TypeInfo(value)
@@ -412,6 +421,10 @@ class TlvF:
 
         self.loadAllYamlFilesToDB()
         self.generateCode()
+        if self.conf_tlv_dispatch_table:
+            self.generateTlvDispatchTable()
+        if self.conf_generate_views:
+            self.generateViews()
 
         if self.print_outputs:
             outputs = ";".join(self.generated_file_list + self.copied_file_list)
@@ -604,7 +617,11 @@ class TlvF:
                         self.insertLineH(obj_meta.name, self.CODE_STRUCT_INIT_FUNC_INSERT,
                                          "%s}" % (self.getIndentation(1)))
 
-                    if param_type_info.swap_needed:
+                    if param_type_info.swap_array_prefix:
+                        # homogeneous arrays of integers are swapped in bulk
+                        swap_func_lines.append("%s%s, %s);" % (
+                            param_type_info.swap_array_prefix, param_name, str(param_meta.length)))
+                    elif param_type_info.swap_needed:
                         t_name = "%s(%s[i])%s" % (("&" if not param_type_info.swap_is_func else ""),
                                                   param_name, ("." if param_type_info.swap_is_func else ""))
                         swap_func_lines.append(
@@ -1090,17 +1107,21 @@ class TlvF:
             self.insertLineCpp(obj_meta.name, self.CODE_CLASS_INIT_FUNC_INSERT, lines_cpp)
 
             # add var to swap list
-            if param_type_info.swap_needed:
+            if is_dynamic_len or is_var_len:
+                t_length = ("m_" + param_name + "_idx__")
+            else:
+                t_length = str(param_meta.length)
+            if param_type_info.swap_array_prefix:
+                # homogeneous lists of integers are swapped in bulk
+                swap_func_lines.append("%sm_%s, %s);" % (
+                    param_type_info.swap_array_prefix, param_name, t_length))
+            elif param_type_info.swap_needed:
                 if (param_type_info.type == TypeInfo.CLASS):
                     t_name = ("&" if not param_type_info.swap_is_func else "") + ("std::get<1>(%s(i))" %
                                                                                   param_name) + ("." if param_type_info.swap_is_func else "")
                 else:
                     t_name = ("&" if not param_type_info.swap_is_func else "") + \
                         ("m_%s[i]" % param_name) + ("." if param_type_info.swap_is_func else "")
-                if is_dynamic_len or is_var_len:
-                    t_length = ("m_" + param_name + "_idx__")
-                else:
-                    t_length = str(param_meta.length)
                 swap_func_lines.append("for (size_t i = 0; i < %s; i++){" % (t_length))
                 swap_func_lines.append("%s%s%s%s;" % (self.getIndentation(
                     1), param_type_info.swap_prefix, t_name, param_type_info.swap_suffix))
@@ -1297,7 +1318,7 @@ class TlvF:
             lines_cpp.append("%s}" % self.getIndentation(1))
             lines_cpp.append("%ssize_t len = %s::get_initial_size();" %
                              (self.getIndentation(1), param_type))
-            lines_cpp.append("%sif (m_%s__ || getBuffRemainingBytes() < len) {" % (
+            lines_cpp.append("%sif (m_%s__ || getBuffFreeBytes() < len) {" % (
                 self.getIndentation(1), self.MEMBER_LOCK_ALLOCATION))
             lines_cpp.append(
                 '%sTLVF_LOG(ERROR) << "Not enough available space on buffer";' % self.getIndentation(2))
@@ -1310,11 +1331,17 @@ class TlvF:
             lines_cpp.extend(self.addAllocationMarkersCreate(obj_meta, param_meta,
                                                              param_length, True))  # Variable length lists support
             if is_dynamic_len:
-                lines_cpp.append("%sreturn std::make_shared<%s>(getBuffPtr(), getBuffRemainingBytes(), m_%s__);" % (
+                lines_cpp.append("%sauto ptr = std::make_shared<%s>(getBuffPtr(), getBuffRemainingBytes(), m_%s__);" % (
                     self.getIndentation(1), param_type, self.MEMBER_PARSE))
             else:
-                lines_cpp.append("%sreturn std::make_shared<%s>(src, getBuffRemainingBytes(src), m_%s__);" % (
+                lines_cpp.append("%sauto ptr = std::make_shared<%s>(src, getBuffRemainingBytes(src), m_%s__);" % (
                     self.getIndentation(1), param_type, self.MEMBER_PARSE))
+            # The data following the new entry is moved when the entry grows
+            lines_cpp.append("%sif (!m_%s__) {" % (self.getIndentation(1), self.MEMBER_PARSE))
+            lines_cpp.append("%sptr->setBuffTrailingLen(getBuffUsedBytes(ptr->getStartBuffPtr()));" %
+                             self.getIndentation(2))
+            lines_cpp.append("%s}" % self.getIndentation(1))
+            lines_cpp.append("%sreturn ptr;" % self.getIndentation(1))
             lines_cpp.append("}")
             lines_cpp.append("")
 
@@ -1399,7 +1426,7 @@ class TlvF:
             lines_cpp.append("%s}" % self.getIndentation(1))
             lines_cpp.append("%ssize_t len = sizeof(%s) * count;" %
                              (self.getIndentation(1), param_type))
-            lines_cpp.append("%sif(getBuffRemainingBytes() < len )  {" % (self.getIndentation(1)))
+            lines_cpp.append("%sif(getBuffFreeBytes() < len )  {" % (self.getIndentation(1)))
             lines_cpp.append(
                 '%sTLVF_LOG(ERROR) << "Not enough available space on buffer - can\'t allocate";' % self.getIndentation(2))
             lines_cpp.append("%sreturn false;" % self.getIndentation(2))
@@ -1442,8 +1469,11 @@ class TlvF:
     #
     # If this is a variable length list alloc, add a call to std::copy_n to
     # move the contents of the buffer starting at the current list entry pointer
-    # till the new list pointer (ptr + allocation size). The number of bytes we
-    # move is the the calculated as END of buffer - current list pointer.
+    # till the new list pointer (ptr + allocation size). Only the bytes in use
+    # are moved, i.e. from the current list pointer till the end of the class
+    # data, plus the data of the enclosing classes which follows the class (see
+    # BaseClass::getBuffUsedBytes()). When allocating at the end of the data,
+    # nothing is moved and the allocation only increments the buffer pointer.
     # Then, we need to add a marker so that on following members we will
     # update their pointers accordingly.
     #
@@ -1471,7 +1501,7 @@ class TlvF:
                 lines_cpp.append("%sif (!m_parse__) {" % self.getIndentation(1))
                 lines_cpp.append("%suint8_t *dst = src + len;" % (self.getIndentation(2)))
                 lines_cpp.append(
-                    "%ssize_t move_length = getBuffRemainingBytes(src) - len;" % self.getIndentation(2))
+                    "%ssize_t move_length = getBuffUsedBytes(src);" % self.getIndentation(2))
                 lines_cpp.append("%sstd::copy_n(src, move_length, dst);" % self.getIndentation(2))
                 lines_cpp.append("%s}" % self.getIndentation(1))
 
@@ -1490,12 +1520,12 @@ class TlvF:
                     lines_cpp.append(
                         "%suint8_t *src = (uint8_t *)&m_%s[*m_%s];" % (self.getIndentation(1), param_meta.name, param_length))
                 else:
-                    lines_cpp.append("%suint8_t *src = (uint8_t *)m_%s;" %
-                                     (self.getIndentation(1), param_meta.name))
+                    # Dynamic length lists are the last member, so they end at the end of the class
+                    lines_cpp.append("%suint8_t *src = getBuffPtr();" % self.getIndentation(1))
                 lines_cpp.append("%suint8_t *dst = src + len;" % (self.getIndentation(1)))
                 lines_cpp.append("%sif (!m_parse__) {" % self.getIndentation(1))
                 lines_cpp.append(
-                    "%ssize_t move_length = getBuffRemainingBytes(src) - len;" % self.getIndentation(2))
+                    "%ssize_t move_length = getBuffUsedBytes(src);" % self.getIndentation(2))
                 lines_cpp.append("%sstd::copy_n(src, move_length, dst);" % self.getIndentation(2))
                 lines_cpp.append("%s}" % self.getIndentation(1))
 
@@ -1952,6 +1982,349 @@ class TlvF:
             ident += self.CODE_INDENTATION
         return ident
 
+    def getTlvDispatchEntries(self, type_enums):
+        # Returns {tlv type value: (class name, namespace, header)} of all the TLV classes which
+        # type field is one of type_enums
+        enum_values = {}
+        for (fname, obj_name), dict_value in self.db.items():
+            if obj_name in type_enums and type(dict_value) is OrderedDict:
+                enum_values[obj_name] = dict_value
+
+        entries = {}
+        for (fname, obj_name), dict_value in self.db.items():
+            if obj_name.startswith(MetaData.META_PREFIX) or type(dict_value) is not OrderedDict:
+                continue
+            if dict_value.get(MetaData.KEY_TYPE) != MetaData.TYPE_CLASS:
+                continue
+            is_tlv_class = dict_value.get(MetaData.DECELERATION_IS_TLV_CLASS,
+                                          self.db.get((fname, MetaData.DECELERATION_IS_TLV_CLASS), False))
+            if not is_tlv_class or not dict_value.get(MetaData.KEY_TLV_DISPATCH, True):
+                continue
+            type_dict = dict_value.get(MetaData.TLV_TYPE_TYPE)
+            if type(type_dict) is not OrderedDict or type_dict.get(MetaData.KEY_TYPE) not in type_enums:
+                continue
+
+            enum_name = type_dict[MetaData.KEY_TYPE]
+            value_const = type_dict.get(MetaData.KEY_VALUE_CONST)
+            if value_const not in enum_values[enum_name]:
+                self.abort("%s.yaml --> %s: unknown %s value %s" %
+                           (fname, obj_name, enum_name, value_const))
+            value = enum_values[enum_name][value_const]
+            if value in entries:
+                self.abort("%s.yaml --> %s: TLV type %s is already dispatched to %s, set %s: False on one of them" %
+                           (fname, obj_name, hex(value), entries[value][0], MetaData.KEY_TLV_DISPATCH))
+            header = "%s/%s.h" % (self.db_yaml_paths[fname], fname)
+            entries[value] = (obj_name, self.db.get((fname, MetaData.DECELERATION_NAMESPACE)), header)
+
+        return entries
+
+    def generateTlvDispatchTable(self):
+        logConsole("Generating the TLV dispatch table...")
+        conf = self.conf_tlv_dispatch_table
+        file_name = conf["file"]
+        namespace = conf["namespace"]
+        entries = self.getTlvDispatchEntries(conf["type_enums"])
+        guard = "_%s_H_" % file_name.replace("/", "_").upper()
+
+        license_lines = []
+        if self.conf_source_license_header:
+            with open(os.path.join(self.src_path, self.conf_source_license_header), 'r') as fl:
+                license_lines = [line.rstrip() for line in fl] + [""]
+
+        lines_h = [self.AUTO_GENERATED_MESSAGE] + license_lines + [
+            "#ifndef %s" % guard,
+            "#define %s" % guard,
+            "",
+            "#include <memory>",
+            "#include <tlvf/BaseClass.h>",
+            "#include <tlvf/ClassList.h>",
+            "",
+            "namespace %s {" % namespace,
+            "",
+            "/**",
+            " * @brief Entry of the TLV dispatch table.",
+            " */",
+            "typedef struct sTlvDispatchEntry {",
+            "    // Name of the TLV class, nullptr if the TLV type is unknown",
+            "    const char *name;",
+            "    // Adds the TLV to the message being parsed, nullptr if the TLV type is unknown",
+            "    std::shared_ptr<BaseClass> (*parse)(ClassList &msg);",
+            "} sTlvDispatchEntry;",
+            "",
+            "/**",
+            " * @brief The TLV classes defined in the YAML files, indexed by TLV type.",
+            " */",
+            "extern const sTlvDispatchEntry tlv_dispatch_table[256];",
+            "",
+            "}; // close namespace: %s" % namespace,
+            "",
+            "#endif //%s" % guard,
+        ]
+
+        lines_cpp = [self.AUTO_GENERATED_MESSAGE] + license_lines + [
+            "#include <%s.h>" % file_name]
+        for header in sorted(set(entry[2] for entry in entries.values())):
+            lines_cpp.append("#include <%s>" % header)
+        lines_cpp += [
+            "",
+            "using namespace %s;" % namespace,
+            "",
+            "template <class T> static std::shared_ptr<BaseClass> parse_tlv(ClassList &msg)",
+            "{",
+            "    return msg.addClass<T>();",
+            "}",
+            "",
+            "const sTlvDispatchEntry %s::tlv_dispatch_table[256] = {" % namespace,
+        ]
+        for value in range(256):
+            if value in entries:
+                (name, entry_namespace, header) = entries[value]
+                lines_cpp.append('    {"%s", parse_tlv<%s::%s>}, // %s' %
+                                 (name, entry_namespace, name, hex(value)))
+            else:
+                lines_cpp.append("    {nullptr, nullptr}, // %s" % hex(value))
+        lines_cpp.append("};")
+
+        for (code_lines, path, suffix) in [(lines_h, self.conf_output_path_include, ".h"),
+                                           (lines_cpp, self.conf_output_path_src, ".cpp")]:
+            file_path = os.path.join(path, file_name + suffix)
+            self.mkdir_p(os.path.dirname(file_path))
+            self.generated_file_list.append(file_path)
+            if not self.compareFile(file_path, code_lines):
+                with open(file_path, "w+") as f:
+                    for line in code_lines:
+                        f.write(line + "\n")
+        logConsole("Done\n")
+
+    def getViewTypeName(self, fname, type_name):
+        # Non class objects which follow the first class of a single class file are generated
+        # inside that class (see openObject())
+        if self.db.get((fname, MetaData.DECELERATION_MULTI_CLASS), False):
+            return type_name
+        root_class = None
+        for (obj_fname, obj_name), dict_value in self.db.items():
+            if obj_fname != fname or obj_name.startswith(MetaData.META_PREFIX):
+                continue
+            if type(dict_value) is not OrderedDict:
+                continue
+            if root_class is None:
+                if dict_value.get(MetaData.KEY_TYPE) == MetaData.TYPE_CLASS:
+                    root_class = obj_name
+            elif obj_name == type_name and dict_value.get(MetaData.KEY_TYPE) != MetaData.TYPE_CLASS:
+                return "%s::%s" % (root_class, type_name)
+        return type_name
+
+    def generateView(self, fname, class_name, dict_value):
+        # Returns the lines of the read-only view of a TLV class, or None if the class has fields
+        # which are not supported by views (classes, optional fields)
+        name = class_name + "View"
+        lines_public = []
+        lines_parse = []
+        lines_private = []
+        # C++ expression of the offset of the next field
+        offset = []
+        params = [(param_name, param_dict) for param_name, param_dict in dict_value.items()
+                  if not param_name.startswith(MetaData.META_PREFIX)]
+        if len(params) < 2 or params[0][0] != MetaData.TLV_TYPE_TYPE or params[1][0] != MetaData.TLV_TYPE_LENGTH:
+            return None
+
+        for idx, (param_name, param_dict) in enumerate(params):
+            if type(param_dict) is OrderedDict:
+                param_meta = MetaData(fname, param_name, param_dict)
+                if param_meta.error or param_meta.optional:
+                    return None
+                param_type = param_meta.type
+                length_type = param_meta.length_type
+                length = param_meta.length
+                value_const = param_meta.value_const
+            else:
+                param_type = param_dict
+                length_type = None
+                value_const = None
+            type_info = TypeInfo(param_type)
+            if not (type_info.is_std_type or type_info.type in [TypeInfo.CHAR, TypeInfo.ENUM, TypeInfo.STRUCT]):
+                return None
+            cpp_type = self.getViewTypeName(fname, param_type)
+            is_byte = type_info.type in [TypeInfo.CHAR, TypeInfo.INT8, TypeInfo.UINT8]
+            read = "tlvf_view_read_struct" if type_info.type == TypeInfo.STRUCT else "tlvf_view_read"
+            offset_str = " + ".join(offset) if offset else "0"
+
+            if length_type == None:
+                lines_public.append("%s%s %s() const { return %s<%s>(m_buff__ + %s); }" %
+                                    (self.getIndentation(2), cpp_type, param_name, read, cpp_type, offset_str))
+                offset.append("sizeof(%s)" % cpp_type)
+            else:
+                if length_type == MetaData.LENGTH_TYPE_INT or length_type == MetaData.LENGTH_TYPE_CONST:
+                    start = offset_str
+                    count = str(length)
+                    offset.append("%s * sizeof(%s)" % (count, cpp_type))
+                else:
+                    start = "m_%s_offset__" % param_name
+                    count = "m_%s_count__" % param_name
+                    if length_type == MetaData.LENGTH_TYPE_VAR:
+                        count_value = "%s()" % length
+                    else:
+                        count_value = "(m_buff_len__ - %s) / sizeof(%s)" % (start, cpp_type)
+                        lines_public.append("%ssize_t %s_length() const { return %s * sizeof(%s); }" %
+                                            (self.getIndentation(2), param_name, count, cpp_type))
+                    lines_parse += [
+                        "%s%s = %s;" % (self.getIndentation(2), start, offset_str),
+                        "%sif (m_buff_len__ < %s) {" % (self.getIndentation(2), start),
+                        "%sreturn false;" % self.getIndentation(3),
+                        "%s}" % self.getIndentation(2),
+                        "%s%s = %s;" % (self.getIndentation(2), count, count_value),
+                    ]
+                    lines_private += [
+                        "%ssize_t %s = 0;" % (self.getIndentation(2), start),
+                        "%ssize_t %s = 0;" % (self.getIndentation(2), count),
+                    ]
+                    offset = [start, "%s * sizeof(%s)" % (count, cpp_type)]
+
+                if is_byte:
+                    lines_public += [
+                        "%sconst %s* %s(size_t idx = 0) const {" % (self.getIndentation(2), cpp_type, param_name),
+                        "%sif (idx >= %s) { return nullptr; }" % (self.getIndentation(3), count),
+                        "%sreturn reinterpret_cast<const %s*>(m_buff__ + %s + idx);" % (
+                            self.getIndentation(3), cpp_type, start),
+                        "%s}" % self.getIndentation(2),
+                    ]
+                else:
+                    lines_public += [
+                        "%sstd::tuple<bool, %s> %s(size_t idx) const {" % (self.getIndentation(2), cpp_type, param_name),
+                        "%sif (idx >= %s) { return std::make_tuple(false, %s()); }" % (
+                            self.getIndentation(3), count, cpp_type),
+                        "%sreturn std::make_tuple(true, %s<%s>(m_buff__ + %s + idx * sizeof(%s)));" % (
+                            self.getIndentation(3), read, cpp_type, start, cpp_type),
+                        "%s}" % self.getIndentation(2),
+                    ]
+
+            if idx == 0:
+                if value_const != None:
+                    if str(value_const).isdigit():
+                        type_value = "%s(%s)" % (cpp_type, value_const)
+                    else:
+                        type_value = "%s::%s" % (cpp_type, value_const)
+                    lines_public.append("%sstatic constexpr %s get_tlv_type() { return %s; }" %
+                                        (self.getIndentation(2), cpp_type, type_value))
+                    type_check = "%s() != get_tlv_type()" % MetaData.TLV_TYPE_TYPE
+                else:
+                    type_check = None
+            elif idx == 1:
+                # the TLV header has been read, the rest of the fields must fit in the TLV
+                header_length = " + ".join(offset)
+                lines_parse += [
+                    "%sif (m_buff_len__ < %s) {" % (self.getIndentation(2), header_length),
+                    "%sreturn false;" % self.getIndentation(3),
+                    "%s}" % self.getIndentation(2),
+                ]
+                if type_check:
+                    lines_parse += [
+                        "%sif (%s) {" % (self.getIndentation(2), type_check),
+                        "%sreturn false;" % self.getIndentation(3),
+                        "%s}" % self.getIndentation(2),
+                    ]
+                lines_parse += [
+                    "%sif (m_buff_len__ < %s + %s()) {" % (self.getIndentation(2), header_length,
+                                                         MetaData.TLV_TYPE_LENGTH),
+                    "%sreturn false;" % self.getIndentation(3),
+                    "%s}" % self.getIndentation(2),
+                    "%sm_buff_len__ = %s + %s();" % (self.getIndentation(2), header_length,
+                                                    MetaData.TLV_TYPE_LENGTH),
+                ]
+
+        lines = [
+            "",
+            "/**",
+            " * @brief Read-only view of %s, which reads the TLV in place." % class_name,
+            " */",
+            "class %s" % name,
+            "{",
+            "%spublic:" % self.getIndentation(1),
+            "%s/**" % self.getIndentation(2),
+            "%s * @brief Attach the view to a TLV in network byte order." % self.getIndentation(2),
+            "%s *" % self.getIndentation(2),
+            "%s * The accessors must not be used if the TLV is not valid." % self.getIndentation(2),
+            "%s *" % self.getIndentation(2),
+            "%s * @return true if the TLV and its lists fit in the buffer." % self.getIndentation(2),
+            "%s */" % self.getIndentation(2),
+            "%sbool parse(const uint8_t* buff, size_t buff_len) {" % self.getIndentation(2),
+            "%sm_buff__ = buff;" % self.getIndentation(3),
+            "%sm_buff_len__ = buff_len;" % self.getIndentation(3),
+        ]
+        lines += [self.CODE_INDENTATION + line for line in lines_parse]
+        lines += [
+            "%sif (m_buff_len__ < %s) {" % (self.getIndentation(3), " + ".join(offset)),
+            "%sreturn false;" % self.getIndentation(4),
+            "%s}" % self.getIndentation(3),
+            "%sreturn true;" % self.getIndentation(3),
+            "%s}" % self.getIndentation(2),
+            "%sconst uint8_t* getBuffPtr() const { return m_buff__; }" % self.getIndentation(2),
+            "%ssize_t getLen() const { return m_buff_len__; }" % self.getIndentation(2),
+        ]
+        lines += lines_public
+        lines += [
+            "",
+            "%sprivate:" % self.getIndentation(1),
+            "%sconst uint8_t* m_buff__ = nullptr;" % self.getIndentation(2),
+            "%ssize_t m_buff_len__ = 0;" % self.getIndentation(2),
+        ]
+        lines += lines_private
+        lines.append("};")
+        return lines
+
+    def generateViews(self):
+        logConsole("Generating the read-only views...")
+        license_lines = []
+        if self.conf_source_license_header:
+            with open(os.path.join(self.src_path, self.conf_source_license_header), 'r') as fl:
+                license_lines = [line.rstrip() for line in fl] + [""]
+
+        for filename in self.yaml_file_list:
+            fname = os.path.splitext(os.path.basename(filename))[0]
+            yaml_path = self.db_yaml_paths[fname]
+            file_is_tlv_class = self.db.get((fname, MetaData.DECELERATION_IS_TLV_CLASS), False)
+            views = []
+            for (obj_fname, obj_name), dict_value in self.db.items():
+                if obj_fname != fname or obj_name.startswith(MetaData.META_PREFIX):
+                    continue
+                if type(dict_value) is not OrderedDict or dict_value.get(MetaData.KEY_TYPE) != MetaData.TYPE_CLASS:
+                    continue
+                if not dict_value.get(MetaData.DECELERATION_IS_TLV_CLASS, file_is_tlv_class):
+                    continue
+                view = self.generateView(fname, obj_name, dict_value)
+                if view:
+                    views += view
+                else:
+                    self.logger.debug("%s.yaml --> no view for %s, unsupported fields" % (fname, obj_name))
+            if not views:
+                continue
+
+            guard = "_%s_%sVIEW_H_" % (yaml_path.upper().replace('/', '_'), fname.upper())
+            namespace = self.db.get((fname, MetaData.DECELERATION_NAMESPACE))
+            lines = [self.AUTO_GENERATED_MESSAGE] + license_lines + [
+                "#ifndef %s" % guard,
+                "#define %s" % guard,
+                "",
+                '#include "%s/%s.h"' % (yaml_path, fname),
+                "#include <tlvf/tlvfview.h>",
+                "#include <tuple>",
+            ]
+            if namespace:
+                lines += ["", "namespace %s {" % namespace]
+            lines += views
+            if namespace:
+                lines += ["", "}; // close namespace: %s" % namespace]
+            lines += ["", "#endif //%s" % guard]
+
+            file_path = os.path.join(self.conf_output_path_include, yaml_path, fname + "View.h")
+            self.mkdir_p(os.path.dirname(file_path))
+            self.generated_file_list.append(file_path)
+            if not self.compareFile(file_path, lines):
+                with open(file_path, "w+") as f:
+                    for line in lines:
+                        f.write(line + "\n")
+        logConsole("Done\n")
+
     def mkdir_p(self, path):
         if not os.path.exists(path):
             os.makedirs(path)
@@ -2177,6 +2550,16 @@ class TlvF:
         except:
             self.conf_source_license_header = None
 
+        try:
+            self.conf_tlv_dispatch_table = yaml_conf["tlv_dispatch_table"]
+        except:
+            self.conf_tlv_dispatch_table = None
+
+        try:
+            self.conf_generate_views = yaml_conf["generate_views"]
+        except:
+            self.conf_generate_views = False
+
         try:
             self.conf_log_file = yaml_conf["debug"]["log_file"]
         except:
@@ -27,6 +27,17 @@ using broker::BrokerServer;
 // Number of concurrent connections on the server socket
 static constexpr int listen_buffer_size = 10;
 
+// In the order of CounterId
+metrics::counter Ieee1905Transport::counters_[] = {
+    metrics::counter("transport_message_id_wraparounds_total"),
+    metrics::counter("transport_incoming_network_packets_total"),
+    metrics::counter("transport_outgoing_network_packets_total"),
+    metrics::counter("transport_incoming_local_bus_packets_total"),
+    metrics::counter("transport_outgoing_local_bus_packets_total"),
+    metrics::counter("transport_duplicate_packets_total"),
+    metrics::counter("transport_defragmentation_failures_total"),
+};
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////////// Implementation ///////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -49,14 +60,14 @@ void Ieee1905Transport::run()
     // Register broker handlers for internal and external messages
     m_broker->register_external_message_handler(
         [&](std::unique_ptr<messages::Message> &msg, BrokerServer &broker) -> bool {
-            LOG(DEBUG) << "Processing external message: " << uint32_t(msg->type());
+            LAZY_LOG(DEBUG) << "Processing external message: " << uint32_t(msg->type());
             handle_broker_pollin_event(msg);
             return true;
         });
 
     m_broker->register_internal_message_handler(
         [&](std::unique_ptr<messages::Message> &msg, BrokerServer &broker) -> bool {
-            LOG(DEBUG) << "Processing internal message: " << uint32_t(msg->type());
+            LAZY_LOG(DEBUG) << "Processing internal message: " << uint32_t(msg->type());
             handle_broker_pollin_event(msg);
             return true;
         });
@@ -14,6 +14,8 @@
 
 #include "ieee1905_transport_broker.h"
 
+#include <bcl/beerocks_metrics.h>
+
 #include <tlvf/tlvftypes.h>
 
 #include <arpa/inet.h>
@@ -127,7 +129,7 @@ private:
     };
 #pragma pack(pop)
 
-    // internal statistics counters
+    // internal statistics counters, exported as metrics
     enum CounterId {
         MESSAGE_ID_WRAPAROUND,
         INCOMMING_NETWORK_PACKETS,
@@ -137,7 +139,7 @@ private:
         DUPLICATE_PACKETS,
         DEFRAGMENTATION_FAILURE,
     };
-    std::map<CounterId, unsigned long> counters_;
+    static metrics::counter counters_[];
 
     // an internal data structure used for manipulating packets (CMDUs, LLDP, etc.)
     class Packet {
@@ -151,6 +153,10 @@ private:
         uint16_t ether_type       = 0x0000;
         struct iovec header       = {.iov_base = NULL, .iov_len = 0};
         struct iovec payload      = {.iov_base = NULL, .iov_len = 0};
+#ifdef BEEROCKS_CMDU_TRACE
+        // CMDU trace stamps, see CmduXxMessage::TraceStage
+        uint64_t trace[messages::CmduXxMessage::TRACE_STAGES] = {};
+#endif
 
         virtual std::ostream &print(std::ostream &os) const;
     };
@@ -253,6 +259,9 @@ private:
         uint8_t buf[kMaximumDeFragmentionSize] = {0};
         int bufIndex                           = 0;
         bool complete                          = false;
+#ifdef BEEROCKS_CMDU_TRACE
+        uint64_t trace_received = 0; // trace stamp of the first fragment
+#endif
     };
     std::map<DeFragmentationKey, DeFragmentationValue, DeFragmentationKeyCompare>
         de_fragmentation_map_;
@@ -8,6 +8,7 @@
 
 #include "ieee1905_transport_broker.h"
 
+#include <bcl/beerocks_metrics.h>
 #include <bcl/beerocks_utils.h>
 
 #include <beerocks/tlvf/beerocks_message.h>
@@ -28,6 +29,11 @@ namespace broker {
 /////////////////////////// Local Module Functions ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
+static metrics::histogram s_publish_time("broker_publish_usec",
+                                          "Time spent publishing a message to its subscribers");
+static metrics::counter s_unsubscribed_messages("broker_unsubscribed_messages_total",
+                                                "Messages published without subscribers");
+
 static bool is_restricted_type(uint32_t type)
 {
     // TODO: Until VS message filtering is implemented (based on action and action_op)
@@ -110,6 +116,7 @@ int BrokerServer::run() { return m_broker_event_loop.run(); }
 
 bool BrokerServer::publish(const messages::Message &msg)
 {
+    metrics::scoped_timer timer(s_publish_time);
     messages::SubscribeMessage::MsgType msg_opcode;
 
     switch (messages::Type(msg.type())) {
@@ -137,6 +144,7 @@ bool BrokerServer::publish(const messages::Message &msg)
                    << ", type = " << std::hex << msg_opcode.bits.type << ")" << std::dec
                    << " with length: " << msg.header().len;
 
+        s_unsubscribed_messages.add();
         return true;
     }
 
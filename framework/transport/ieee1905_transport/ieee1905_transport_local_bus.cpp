@@ -12,6 +12,7 @@
 
 #include <arpa/inet.h>
 #include <net/if.h>
+#include <unordered_map>
 
 namespace beerocks {
 namespace transport {
@@ -19,6 +20,39 @@ namespace transport {
 // Use transport messaging classes
 using namespace beerocks::transport::messages;
 
+#ifdef BEEROCKS_CMDU_TRACE
+// Latency of the stages of the sent CMDUs
+static metrics::histogram_family s_tx_broker_time("cmdu_tx_broker_usec", "type",
+                                                  "From the originator to the transport");
+static metrics::histogram_family s_tx_transport_time("cmdu_tx_transport_usec", "type",
+                                                     "From the broker to the network");
+
+/**
+ * @brief Histograms of the stages of the sent CMDUs of a message type.
+ */
+struct sTxTraceHistograms {
+    metrics::histogram *broker;
+    metrics::histogram *transport;
+};
+
+/**
+ * @brief Gets the histograms of a message type, resolved once per message type since
+ * histogram_family::get() takes a lock.
+ */
+static const sTxTraceHistograms &get_tx_trace_histograms(uint16_t msg_type)
+{
+    // The transport handles the broker messages on a single thread
+    static std::unordered_map<uint16_t, sTxTraceHistograms> s_histograms;
+    auto it = s_histograms.find(msg_type);
+    if (it == s_histograms.end()) {
+        sTxTraceHistograms histograms = {&s_tx_broker_time.get(msg_type),
+                                         &s_tx_transport_time.get(msg_type)};
+        it = s_histograms.emplace(msg_type, histograms).first;
+    }
+    return it->second;
+}
+#endif // BEEROCKS_CMDU_TRACE
+
 void Ieee1905Transport::handle_broker_pollin_event(std::unique_ptr<messages::Message> &msg)
 {
     if (auto *cmdu_tx_msg = dynamic_cast<CmduTxMessage *>(msg.get())) {
@@ -57,6 +91,10 @@ void Ieee1905Transport::handle_broker_cmdu_tx_message(CmduTxMessage &msg)
     packet.header.iov_len   = 0;
     packet.payload.iov_base = msg.data();
     packet.payload.iov_len  = msg.metadata()->length;
+#ifdef BEEROCKS_CMDU_TRACE
+    msg.trace_stamp(CmduTxMessage::TRACE_TX_RECEIVED);
+    std::copy_n(msg.metadata()->trace, CmduTxMessage::TRACE_STAGES, packet.trace);
+#endif
 
     if (packet.ether_type == ETH_P_1905_1) {
         mapf_assert(packet.payload.iov_len >= sizeof(Ieee1905CmduHeader));
@@ -91,8 +129,17 @@ void Ieee1905Transport::handle_broker_cmdu_tx_message(CmduTxMessage &msg)
         }
     }
 
-    counters_[CounterId::OUTGOING_LOCAL_BUS_PACKETS]++;
+    counters_[CounterId::OUTGOING_LOCAL_BUS_PACKETS].add();
     handle_packet(packet);
+
+#ifdef BEEROCKS_CMDU_TRACE
+    auto now         = CmduTxMessage::trace_now();
+    auto &histograms = get_tx_trace_histograms(msg.metadata()->msg_type);
+    CmduTxMessage::trace_observe(*histograms.broker, packet.trace[CmduTxMessage::TRACE_TX_SENT],
+                                 packet.trace[CmduTxMessage::TRACE_TX_RECEIVED]);
+    CmduTxMessage::trace_observe(*histograms.transport,
+                                 packet.trace[CmduTxMessage::TRACE_TX_RECEIVED], now);
+#endif
 }
 
 void Ieee1905Transport::handle_broker_interface_configuration_request_message(
@@ -143,6 +190,9 @@ bool Ieee1905Transport::send_packet_to_broker(Packet &packet)
     msg.metadata()->if_index   = packet.src_if_index;
     msg.metadata()->length     = packet.payload.iov_len;
     std::copy_n((uint8_t *)packet.payload.iov_base, packet.payload.iov_len, msg.data());
+#ifdef BEEROCKS_CMDU_TRACE
+    std::copy_n(packet.trace, CmduRxMessage::TRACE_STAGES, msg.metadata()->trace);
+#endif
 
     if (packet.ether_type == ETH_P_1905_1) {
         Ieee1905CmduHeader *ch   = reinterpret_cast<Ieee1905CmduHeader *>(packet.payload.iov_base);
@@ -153,9 +203,10 @@ bool Ieee1905Transport::send_packet_to_broker(Packet &packet)
         msg.metadata()->relay    = 0;
     }
 
-    counters_[CounterId::INCOMMING_LOCAL_BUS_PACKETS]++;
+    counters_[CounterId::INCOMMING_LOCAL_BUS_PACKETS].add();
 
     MAPF_DBG("publishing CmduRxMessage:" << std::endl << msg);
+    msg.trace_stamp(CmduRxMessage::TRACE_RX_PUBLISHED);
     if (!m_broker->publish(msg)) {
         MAPF_ERR("failed to publish message to broker.");
         return false;
@@ -200,7 +251,7 @@ uint16_t Ieee1905Transport::get_next_message_id()
 
     if (message_id_ == 0) {
         MAPF_DBG("messageId wrap-around occurred.");
-        counters_[CounterId::MESSAGE_ID_WRAPAROUND]++;
+        counters_[CounterId::MESSAGE_ID_WRAPAROUND].add();
     }
 
     return message_id_;
@@ -372,8 +372,11 @@ void Ieee1905Transport::handle_interface_pollin_event(int fd)
     packet.header     = {.iov_base = buf, .iov_len = sizeof(struct ether_header)};
     packet.payload    = {.iov_base = buf + sizeof(struct ether_header),
                       .iov_len  = len - sizeof(struct ether_header)};
+#ifdef BEEROCKS_CMDU_TRACE
+    packet.trace[CmduRxMessage::TRACE_RX_RECEIVED] = CmduRxMessage::trace_now();
+#endif
 
-    counters_[CounterId::INCOMMING_NETWORK_PACKETS]++;
+    counters_[CounterId::INCOMMING_NETWORK_PACKETS].add();
     handle_packet(packet);
 }
 
@@ -433,7 +436,7 @@ bool Ieee1905Transport::send_packet_to_network_interface(unsigned int if_index,
         return false;
     }
 
-    counters_[CounterId::OUTGOING_NETWORK_PACKETS]++;
+    counters_[CounterId::OUTGOING_NETWORK_PACKETS].add();
 
     struct ether_header eh;
     std::copy_n(packet.dst.oct, ETH_ALEN, eh.ether_dhost);
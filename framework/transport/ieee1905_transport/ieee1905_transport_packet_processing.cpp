@@ -196,7 +196,7 @@ bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
 
     if (is_duplicate) {
         // this is a duplicate packet - update timestamp
-        counters_[CounterId::DUPLICATE_PACKETS]++;
+        counters_[CounterId::DUPLICATE_PACKETS].add();
         auto &val = it->second;
         val.time  = now;
     } else if (int(de_duplication_map_.size()) >= kMaximumDeDuplicationThreads) {
@@ -248,7 +248,7 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
             // Note: this is not necessarily related to the current fragment referenced by the argument to this method
             MAPF_DBG("defragmentation timeout - dropping a packet from defragmentation buffer");
             it = de_fragmentation_map_.erase(it);
-            counters_[CounterId::DEFRAGMENTATION_FAILURE]++;
+            counters_[CounterId::DEFRAGMENTATION_FAILURE].add();
         } else {
             ++it;
         }
@@ -283,6 +283,9 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
         std::copy_n((uint8_t *)packet.payload.iov_base, sizeof(Ieee1905CmduHeader),
                     (uint8_t *)val.buf);
         val.bufIndex = sizeof(Ieee1905CmduHeader);
+#ifdef BEEROCKS_CMDU_TRACE
+        val.trace_received = packet.trace[CmduRxMessage::TRACE_RX_RECEIVED];
+#endif
 
         // set the last fragment indicator flag as this will be the header of a complete CMDU
         Ieee1905CmduHeader *hdr = reinterpret_cast<Ieee1905CmduHeader *>(val.buf);
@@ -311,6 +314,9 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
             true; // mark as complete - the map entry will be deleted on the next invocation
         packet.payload.iov_base = val.buf; // buffer is valid until next invocation of this method
         packet.payload.iov_len  = val.bufIndex;
+#ifdef BEEROCKS_CMDU_TRACE
+        packet.trace[CmduRxMessage::TRACE_RX_RECEIVED] = val.trace_received;
+#endif
 
         return true;
     }
@@ -555,6 +561,10 @@ bool Ieee1905Transport::forward_packet_single(Packet &packet)
             Packet defragmented_packet =
                 packet; // create a copy because de_fragment_packet may modify Packet.
             if (de_fragment_packet(defragmented_packet)) {
+#ifdef BEEROCKS_CMDU_TRACE
+                defragmented_packet.trace[CmduRxMessage::TRACE_RX_REASSEMBLED] =
+                    CmduRxMessage::trace_now();
+#endif
                 if (!send_packet_to_broker(defragmented_packet)) {
                     MAPF_ERR("cannot forward packet to broker.");
                     return false;
@@ -9,6 +9,7 @@
 #ifndef MAP_IEEE1905_TRANSPORT_MESSAGES_H_
 #define MAP_IEEE1905_TRANSPORT_MESSAGES_H_
 
+#include <bcl/beerocks_metrics.h>
 #include <bcl/network/socket.h>
 #include <mapf/common/err.h>
 
@@ -16,6 +17,7 @@
 #include <netinet/ether.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <memory>
 #include <sstream>
@@ -159,6 +161,54 @@ public:
         IF_TYPE_TUNNEL,
     };
 
+    /**
+     * Stages of a CMDU stamped in the metadata when CMDU tracing is enabled (ENABLE_CMDU_TRACE).
+     * The last stage of each direction (handled by the subscriber for received CMDUs, transmitted
+     * on the network for sent CMDUs) is not stamped, it is where the latencies are observed.
+     *
+     * The stamps are only part of the metadata when tracing is enabled, so all the processes
+     * exchanging CMDUs over the broker must be built with the same option.
+     */
+    enum TraceStage {
+        TRACE_RX_RECEIVED = 0, // First fragment read from the network by the transport
+        TRACE_RX_REASSEMBLED,  // CMDU de-fragmented by the transport
+        TRACE_RX_PUBLISHED,    // CMDU published to the subscribers by the broker
+        TRACE_RX_DELIVERED,    // CMDU read from the broker by the subscriber
+        TRACE_TX_SENT,         // CMDU sent to the broker by its originator
+        TRACE_TX_RECEIVED,     // CMDU read from the broker by the transport
+        TRACE_STAGES
+    };
+
+#ifdef BEEROCKS_CMDU_TRACE
+    /**
+     * @brief Gets the time used in the trace stamps.
+     *
+     * steady_clock is CLOCK_MONOTONIC, so the stamps of different processes can be compared.
+     *
+     * @return Monotonic time in microseconds.
+     */
+    static uint64_t trace_now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /**
+     * @brief Observes the latency between two stamps, if both were set.
+     *
+     * @param histogram Histogram of the latency of a stage, for the message type of the CMDU.
+     * @param start Stamp of the beginning of the stage.
+     * @param end Stamp of the end of the stage.
+     */
+    static void trace_observe(metrics::histogram &histogram, uint64_t start, uint64_t end)
+    {
+        if (start != 0 && end >= start) {
+            histogram.observe(end - start);
+        }
+    }
+#endif // BEEROCKS_CMDU_TRACE
+
     struct Metadata {
         uint8_t version       = kVersion;
         uint16_t cookie       = 0;   // cookie that maps to CMDU to IEEE1905 message id
@@ -174,6 +224,9 @@ public:
         uint32_t if_index = 0; // network interface index (set to 0 to let transport decide)
         uint16_t length =
             0; // payload length (including IEEE1905 header, excluding Ethernet header)
+#ifdef BEEROCKS_CMDU_TRACE
+        uint64_t trace[TRACE_STAGES] = {}; // trace_now() stamps of each TraceStage, 0 if unset
+#endif
     };
 
     explicit CmduXxMessage(Type type, std::initializer_list<Frame> frames = {})
@@ -200,6 +253,16 @@ public:
         return frames().back().data() + sizeof(Metadata);
     };
 
+    /**
+     * @brief Stamps the current time for a trace stage, if CMDU tracing is enabled.
+     */
+    void trace_stamp(TraceStage stage) const
+    {
+#ifdef BEEROCKS_CMDU_TRACE
+        metadata()->trace[stage] = trace_now();
+#endif
+    }
+
     virtual std::ostream &print(std::ostream &os) const override
     {
         Message::print(os);
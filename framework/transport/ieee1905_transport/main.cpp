@@ -8,6 +8,10 @@
 
 #include "ieee1905_transport.h"
 
+#include <bcl/beerocks_async_log.h>
+#include <bcl/beerocks_defines.h>
+#include <bcl/beerocks_metrics.h>
+
 #include <net/if.h>
 #include <unistd.h>
 
@@ -16,12 +20,19 @@ using namespace beerocks::transport;
 int main(int argc, char *argv[])
 {
     mapf::Logger::Instance().LoggerInit("transport");
+    // The transport logs every packet it handles, the file I/O may be kept off its event loop
+    auto log_config = mapf::Logger::Instance().config();
+    if (log_config.async() && !beerocks::async_log::attach("default", log_config.auto_roll())) {
+        MAPF_ERR("Failed enabling asynchronous logging");
+    }
+    beerocks::metrics::start_export(TMP_PATH "/" BEEROCKS_METRICS_UDS "ieee1905_transport");
     Ieee1905Transport ieee1905_transport;
 
     MAPF_INFO("starting main loop...");
     ieee1905_transport.run();
 
     MAPF_INFO("done");
+    beerocks::metrics::stop_export();
 
     return 0;
 }